@@ -1,318 +1,697 @@
-// Basic Configuration
-#define FULLSCREEN		false		// Would you like to run it in fullscreen?
-#define WINDOWWIDTH		1150		// Window Width
-#define WINDOWHEIGHT	480			// Window Height
-#define VSYNC			false
-#define ANTIALIASING	4
-
-#include "dxstdafx.h"
-#include "resource.h"
-
-// Memory leak detection
-#if defined(DEBUG) | defined(_DEBUG)
-	#define _CRTDBG_MAP_ALLOC
-	#include <stdlib.h>
-	#include <crtdbg.h>
-#endif
-
-#include "SpaceScene.h"
-
-//--------------------------------------------------------------------------------------
-// Global variables
-//--------------------------------------------------------------------------------------
-ID3DXFont*              g_pFont			= NULL;     // Font for drawing text
-ID3DXSprite*            g_pSprite		= NULL;     // Sprite for batching draw text calls
-IDirect3DDevice9 *		Device			= 0;		// Pointer to the Direct3D device
-float					g_AspectRatio	= 0.0f;		// Used when setting the perspective projection
-SpaceScene*				scene			= 0;
-
-//--------------------------------------------------------------------------------------
-// Forward declarations 
-//--------------------------------------------------------------------------------------
-void RenderText();
-
-//--------------------------------------------------------------------------------------
-// Rejects any devices that aren't acceptable by returning false
-//--------------------------------------------------------------------------------------
-bool CALLBACK IsDeviceAcceptable( D3DCAPS9* pCaps, D3DFORMAT AdapterFormat, 
-                                  D3DFORMAT BackBufferFormat, bool bWindowed, void* pUserContext )
-{
-    // Typically want to skip backbuffer formats that don't support alpha blending
-    IDirect3D9* pD3D = DXUTGetD3DObject(); 
-    if( FAILED( pD3D->CheckDeviceFormat( pCaps->AdapterOrdinal, pCaps->DeviceType,
-                    AdapterFormat, D3DUSAGE_QUERY_POSTPIXELSHADER_BLENDING, 
-                    D3DRTYPE_TEXTURE, BackBufferFormat ) ) )
-        return false;
-
-    return true;
-}
-
-
-//--------------------------------------------------------------------------------------
-// Before a device is created, modify the device settings as needed
-//--------------------------------------------------------------------------------------
-bool CALLBACK ModifyDeviceSettings( DXUTDeviceSettings* pDeviceSettings, const D3DCAPS9* pCaps, void* pUserContext )
-{
-	// Enable VSYNC
-	if (!VSYNC)
-		pDeviceSettings->pp.PresentationInterval = D3DPRESENT_INTERVAL_IMMEDIATE;
-
-	// Enable Anti-Aliasing
-	pDeviceSettings->pp.MultiSampleType = (D3DMULTISAMPLE_TYPE)ANTIALIASING;
-	
-	// Enable the Stencil Buffer
-	//pDeviceSettings->pp.AutoDepthStencilFormat = D3DFMT_D24S8;
-
-    // If device doesn't support HW T&L or doesn't support 2.0 vertex shaders in HW 
-    // then switch to SWVP.
-    if( (pCaps->DevCaps & D3DDEVCAPS_HWTRANSFORMANDLIGHT) == 0 ||
-         pCaps->VertexShaderVersion < D3DVS_VERSION(2,0) )
-    {
-        pDeviceSettings->BehaviorFlags = D3DCREATE_SOFTWARE_VERTEXPROCESSING;
-    }
-
-    // Debugging vertex shaders requires either REF or software vertex processing 
-    // and debugging pixel shaders requires REF.  
-#ifdef DEBUG_VS
-    if( pDeviceSettings->DeviceType != D3DDEVTYPE_REF )
-    {
-        pDeviceSettings->BehaviorFlags &= ~D3DCREATE_HARDWARE_VERTEXPROCESSING;
-        pDeviceSettings->BehaviorFlags &= ~D3DCREATE_PUREDEVICE;                            
-        pDeviceSettings->BehaviorFlags |= D3DCREATE_SOFTWARE_VERTEXPROCESSING;
-    }
-#endif
-#ifdef DEBUG_PS
-    pDeviceSettings->DeviceType = D3DDEVTYPE_REF;
-#endif
-
-    // For the first device created if its a REF device, optionally display a warning dialog box
-    static bool s_bFirstTime = true;
-    if( s_bFirstTime )
-    {
-        s_bFirstTime = false;
-        if( pDeviceSettings->DeviceType == D3DDEVTYPE_REF )
-            DXUTDisplaySwitchingToREFWarning();
-    }
-
-    return true;
-}
-
-
-//--------------------------------------------------------------------------------------
-// Create any D3DPOOL_MANAGED resources here 
-//--------------------------------------------------------------------------------------
-HRESULT CALLBACK OnCreateDevice( IDirect3DDevice9* pd3dDevice, const D3DSURFACE_DESC* pBackBufferSurfaceDesc, void* pUserContext )
-{
-	HRESULT hr;
-	// Initialize the font
-    V_RETURN( D3DXCreateFont( pd3dDevice, 15, 0, FW_BOLD, 1, FALSE, DEFAULT_CHARSET, 
-                         OUT_DEFAULT_PRECIS, DEFAULT_QUALITY, DEFAULT_PITCH | FF_DONTCARE, 
-						 L"Arial", &g_pFont ) );
-
-	if (scene)
-		scene->OnCreateDevice(pd3dDevice, pBackBufferSurfaceDesc);
-
-	return S_OK;
-}
-
-
-//--------------------------------------------------------------------------------------
-// Create any D3DPOOL_DEFAULT resources here 
-//--------------------------------------------------------------------------------------
-HRESULT CALLBACK OnResetDevice( IDirect3DDevice9* pd3dDevice, 
-                                const D3DSURFACE_DESC* pBackBufferSurfaceDesc, void* pUserContext )
-{
-	HRESULT hr;
-
-	if( g_pFont )
-        V_RETURN( g_pFont->OnResetDevice() );
-	if (scene)
-		scene->OnResetDevice(pd3dDevice);
-
-    return S_OK;
-}
-
-
-//--------------------------------------------------------------------------------------
-// Handle updates to the scene
-//--------------------------------------------------------------------------------------
-void CALLBACK OnFrameMove( IDirect3DDevice9* pd3dDevice, double fTime, float fElapsedTime, void* pUserContext )
-{
-	if (scene && !scene->Paused())
-		scene->Update(fElapsedTime);
-}
-
-
-//--------------------------------------------------------------------------------------
-// Render the scene 
-//--------------------------------------------------------------------------------------
-void CALLBACK OnFrameRender( IDirect3DDevice9* pd3dDevice, double fTime, float fElapsedTime, void* pUserContext )
-{
-    HRESULT hr;
-	
-	// Clear the render target and the zbuffer 
-	V( pd3dDevice->Clear(0, NULL, D3DCLEAR_TARGET | D3DCLEAR_ZBUFFER /*| D3DCLEAR_STENCIL*/, D3DCOLOR_ARGB(0,0, 0, 0), 1.0f, 0) );
-
-	// Render the scene
-	if( SUCCEEDED( pd3dDevice->BeginScene() ) )
-	{
-		scene->Render(fElapsedTime);
-		RenderText();
-		V( pd3dDevice->EndScene() );
-	}
-}
-
-
-//--------------------------------------------------------------------------------------
-// Handle messages to the application 
-//--------------------------------------------------------------------------------------
-LRESULT CALLBACK MsgProc( HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM lParam, 
-                          bool* pbNoFurtherProcessing, void* pUserContext )
-{
-    return 0;
-}
-
-
-//--------------------------------------------------------------------------------------
-// Release resources created in the OnResetDevice callback here 
-//--------------------------------------------------------------------------------------
-void CALLBACK OnLostDevice( void* pUserContext )
-{
-	if( g_pFont )
-        g_pFont->OnLostDevice();
-	if (scene)
-		scene->OnLostDevice();
-
-}
-
-
-//--------------------------------------------------------------------------------------
-// Release resources created in the OnCreateDevice callback here
-//--------------------------------------------------------------------------------------
-void CALLBACK OnDestroyDevice( void* pUserContext )
-{
-	SAFE_RELEASE( g_pFont );
-	if (scene)
-		scene->OnDestroyDevice();
-
-}
-
-void CALLBACK KeyboardProc( UINT nChar, bool bKeyDown, bool bAltDown, void* pUserContext )
-{
-    if( bKeyDown )
-    {
-        switch( nChar )
-        {
-            case VK_F1: DXUTToggleFullScreen(); break;
-			case VK_SPACE: if (scene) scene->Pause(); break;
-			case VK_RIGHT: if (scene) scene->CameraRotateAngle(true); break;
-			case VK_LEFT: if (scene) scene->CameraRotateAngle(false); break;
-			case VK_PRIOR : if (scene) scene->Zoom(-0.02f); break;
-			case VK_NEXT : if (scene) scene->Zoom(0.02f); break;
-			case 49 : if (scene) scene->SetCameraMode(0); break;
-			case 50 : if (scene) scene->SetCameraMode(1); break;
-			case 51 : if (scene) scene->SetCameraMode(2); break;
-        }
-    }
-}
-
-void CALLBACK MouseProc( bool bLeftButtonDown, bool bRightButtonDown, bool bMiddleButtonDown, bool bSideButton1Down, 
-						 bool bSideButton2Down, int nMouseWheelDelta, int xPos, int yPos, void* pUserContext )
-{
-
-	if (scene)
-	{
-		if (nMouseWheelDelta > 0)		
-			scene->Zoom(-0.02f);
-		else if (nMouseWheelDelta < 0)	
-			scene->Zoom(0.02f);
-	}
-
-}
-
-void RenderText()
-{
-    // The helper object simply helps keep track of text position, and color
-    // and then it calls pFont->DrawText( m_pSprite, strMsg, -1, &rc, DT_NOCLIP, m_clr );
-    // If NULL is passed in as the sprite object, then it will work fine however the 
-    // pFont->DrawText() will not be batched together.  Batching calls will improves perf.
-    CDXUTTextHelper txtHelper( g_pFont, g_pSprite, 15 );
-
-    // Output statistics
-    txtHelper.Begin();
-    txtHelper.SetInsertionPos( 2, 0 );
-    txtHelper.SetForegroundColor( D3DXCOLOR( 1.0f, 1.0f, 1.0f, 1.0f ) );
-    txtHelper.DrawTextLine( DXUTGetFrameStats(true) ); // Show FPS
-	txtHelper.DrawTextLine( DXUTGetDeviceStats() );
-    txtHelper.End();
-}
-
-void InitApp()
-{
-}
-
-//--------------------------------------------------------------------------------------
-// Initialize everything and go into a render loop
-//--------------------------------------------------------------------------------------
-INT WINAPI WinMain( HINSTANCE, HINSTANCE, LPSTR, int )
-{
-    // Enable run-time memory check for debug builds.
-#if defined(DEBUG) | defined(_DEBUG)
-    _CrtSetDbgFlag( _CRTDBG_ALLOC_MEM_DF | _CRTDBG_LEAK_CHECK_DF );
-#endif
-
-	DXUTSetCallbackDeviceCreated( OnCreateDevice );
-    DXUTSetCallbackDeviceReset( OnResetDevice );
-    DXUTSetCallbackDeviceLost( OnLostDevice );
-    DXUTSetCallbackDeviceDestroyed( OnDestroyDevice );
-    DXUTSetCallbackMsgProc( MsgProc );
-    DXUTSetCallbackKeyboard( KeyboardProc );
-	DXUTSetCallbackMouse( MouseProc );
-    DXUTSetCallbackFrameRender( OnFrameRender );
-    DXUTSetCallbackFrameMove( OnFrameMove );
-
-    // Show the cursor and clip it when in full screen
-    DXUTSetCursorSettings( true, true );
-
-    // Initialize DXUT and create the desired Win32 window and Direct3D 
-    // device for the application. Calling each of these functions is optional, but they
-    // allow you to set several options which control the behavior of the framework.
-    DXUTInit( true, true, true ); // Parse the command line, handle the default hotkeys, and show msgboxes
-    DXUTCreateWindow( L"Space System" );
-
-	if (FULLSCREEN) {
-		g_AspectRatio = float(WINDOWWIDTH)/(WINDOWHEIGHT);	
-		// If the resolution is not valid then DXUT will change it to the closest valid
-		DXUTCreateDevice( D3DADAPTER_DEFAULT, false, WINDOWWIDTH, WINDOWHEIGHT, IsDeviceAcceptable, ModifyDeviceSettings );
-	}
-	else
-	{
-		g_AspectRatio = WINDOWWIDTH/WINDOWHEIGHT;	
-		DXUTCreateDevice( D3DADAPTER_DEFAULT, true, WINDOWWIDTH, WINDOWHEIGHT, IsDeviceAcceptable, ModifyDeviceSettings );
-	}
-
-	Device = DXUTGetD3DDevice();
-	if (Device)
-		scene = new SpaceScene();
-
-	//InitApp();
-
-	if(!scene)
-	{
-		MessageBox(0, L"Scene Initialization Failed", 0, 0);
-		return 0;
-	} 
-	// Pass control to DXUT for handling the message pump and 
-	// dispatching render calls. DXUT will call your FrameMove 
-	// and FrameRender callback when there is idle time between handling window messages.
-	DXUTMainLoop();
-	
-
-    // Perform any application-level cleanup here. Direct3D device resources are released within the
-    // appropriate callback functions and therefore don't require any cleanup code here.
-	
-	delete scene;
-	scene = 0;
-
-    return DXUTGetExitCode();
+// Basic Configuration
+#define FULLSCREEN		false		// Would you like to run it in fullscreen?
+#define WINDOWWIDTH		1150		// Window Width
+#define WINDOWHEIGHT	480			// Window Height
+#define VSYNC			false
+#define ANTIALIASING	4
+
+#include "dxstdafx.h"
+#include "resource.h"
+
+// Memory leak detection
+#if defined(DEBUG) | defined(_DEBUG)
+	#define _CRTDBG_MAP_ALLOC
+	#include <stdlib.h>
+	#include <crtdbg.h>
+#endif
+
+#include "SpaceScene.h"
+
+//--------------------------------------------------------------------------------------
+// Global variables
+//--------------------------------------------------------------------------------------
+ID3DXFont*              g_pFont			= NULL;     // Font for drawing text
+ID3DXSprite*            g_pSprite		= NULL;     // Sprite for batching draw text calls
+IDirect3DDevice9 *		Device			= 0;		// Pointer to the Direct3D device
+float					g_AspectRatio	= 0.0f;		// Used when setting the perspective projection
+SpaceScene*				scene			= 0;
+GpuQueries				g_GpuQueries;							// Timestamps for the GPU profiler
+WL::Benchmark*			g_pBenchmark	= NULL;		// Set by -benchmark
+bool					g_bBenchmarkFrame = false;	// The frame being drawn is one of the run
+bool					g_bBenchmarkFailed = false;
+
+//--------------------------------------------------------------------------------------
+// The scene as the benchmark runner drives it. Its frames are the ones DXUT calls back
+// for, so only the camera and the counters go through here.
+//--------------------------------------------------------------------------------------
+class SpaceBenchmarkScene : public WL::BenchmarkScene
+{
+public:
+	void SetCameraMode(int iMode) { scene->SetCameraMode(iMode); }
+	void CameraRotateAngle(bool bRight) { scene->CameraRotateAngle(bRight); }
+	void Update(float fDelta) { scene->Update(fDelta); }
+	void Render(float fDelta) { scene->Render(fDelta); }
+
+	void GetCounters(WL::BenchmarkCounters& counters)
+	{
+		// All of the frame just drawn. The graph's render and sampler states went
+		// through the cache, and are counted there if they reached the device.
+		const PostProcessGraph::Stats& graph = scene->GetSun()->GetGraphStats();
+		const RenderQueue::Stats& queue = scene->GetQueueStats();
+		const StateCache::Stats& states = StateCache::Get().GetStats();
+		counters.nParticles = scene->GetParticleCount();
+		counters.nDrawCalls = states.nDrawCalls;
+		counters.nPostPasses = graph.nLivePasses;
+		counters.nStateChanges = states.nCalls - states.nFiltered + graph.nStateChanges - graph.nCachedChanges +
+								 queue.nEffectChanges + queue.nTextureChanges;
+	}
+};
+
+SpaceBenchmarkScene		g_BenchmarkScene;
+
+//--------------------------------------------------------------------------------------
+// Forward declarations 
+//--------------------------------------------------------------------------------------
+void RenderText();
+bool HasCmdLineArg(LPCWSTR strArg);
+int GetCmdLineInt(LPCWSTR strArg, int nDefault);
+
+//--------------------------------------------------------------------------------------
+// Rejects any devices that aren't acceptable by returning false
+//--------------------------------------------------------------------------------------
+bool CALLBACK IsDeviceAcceptable( D3DCAPS9* pCaps, D3DFORMAT AdapterFormat, 
+                                  D3DFORMAT BackBufferFormat, bool bWindowed, void* pUserContext )
+{
+    // Typically want to skip backbuffer formats that don't support alpha blending
+    IDirect3D9* pD3D = DXUTGetD3DObject(); 
+    if( FAILED( pD3D->CheckDeviceFormat( pCaps->AdapterOrdinal, pCaps->DeviceType,
+                    AdapterFormat, D3DUSAGE_QUERY_POSTPIXELSHADER_BLENDING, 
+                    D3DRTYPE_TEXTURE, BackBufferFormat ) ) )
+        return false;
+
+    return true;
+}
+
+
+//--------------------------------------------------------------------------------------
+// Before a device is created, modify the device settings as needed
+//--------------------------------------------------------------------------------------
+bool CALLBACK ModifyDeviceSettings( DXUTDeviceSettings* pDeviceSettings, const D3DCAPS9* pCaps, void* pUserContext )
+{
+	// Enable VSYNC, but never for a benchmark
+	if (!VSYNC || HasCmdLineArg( L"benchmark" ))
+		pDeviceSettings->pp.PresentationInterval = D3DPRESENT_INTERVAL_IMMEDIATE;
+
+	// Enable Anti-Aliasing
+	pDeviceSettings->pp.MultiSampleType = (D3DMULTISAMPLE_TYPE)ANTIALIASING;
+	
+	// Enable the Stencil Buffer
+	//pDeviceSettings->pp.AutoDepthStencilFormat = D3DFMT_D24S8;
+
+    // If device doesn't support HW T&L or doesn't support 2.0 vertex shaders in HW 
+    // then switch to SWVP.
+    if( (pCaps->DevCaps & D3DDEVCAPS_HWTRANSFORMANDLIGHT) == 0 ||
+         pCaps->VertexShaderVersion < D3DVS_VERSION(2,0) )
+    {
+        pDeviceSettings->BehaviorFlags = D3DCREATE_SOFTWARE_VERTEXPROCESSING;
+    }
+
+	// Textures are decoded by D3DX on the loader's worker threads
+	pDeviceSettings->BehaviorFlags |= D3DCREATE_MULTITHREADED;
+
+    // Debugging vertex shaders requires either REF or software vertex processing 
+    // and debugging pixel shaders requires REF.  
+#ifdef DEBUG_VS
+    if( pDeviceSettings->DeviceType != D3DDEVTYPE_REF )
+    {
+        pDeviceSettings->BehaviorFlags &= ~D3DCREATE_HARDWARE_VERTEXPROCESSING;
+        pDeviceSettings->BehaviorFlags &= ~D3DCREATE_PUREDEVICE;                            
+        pDeviceSettings->BehaviorFlags |= D3DCREATE_SOFTWARE_VERTEXPROCESSING;
+    }
+#endif
+#ifdef DEBUG_PS
+    pDeviceSettings->DeviceType = D3DDEVTYPE_REF;
+#endif
+
+    // For the first device created if its a REF device, optionally display a warning dialog box
+    static bool s_bFirstTime = true;
+    if( s_bFirstTime )
+    {
+        s_bFirstTime = false;
+        if( pDeviceSettings->DeviceType == D3DDEVTYPE_REF )
+            DXUTDisplaySwitchingToREFWarning();
+    }
+
+    return true;
+}
+
+
+//--------------------------------------------------------------------------------------
+// Create any D3DPOOL_MANAGED resources here 
+//--------------------------------------------------------------------------------------
+HRESULT CALLBACK OnCreateDevice( IDirect3DDevice9* pd3dDevice, const D3DSURFACE_DESC* pBackBufferSurfaceDesc, void* pUserContext )
+{
+	HRESULT hr;
+	// Initialize the font
+    V_RETURN( D3DXCreateFont( pd3dDevice, 15, 0, FW_BOLD, 1, FALSE, DEFAULT_CHARSET, 
+                         OUT_DEFAULT_PRECIS, DEFAULT_QUALITY, DEFAULT_PITCH | FF_DONTCARE, 
+						 L"Arial", &g_pFont ) );
+
+	// Start the texture loader before the scene queues anything
+	V_RETURN( TextureLoader::Get().OnCreateDevice(pd3dDevice) );
+
+	if (scene)
+		scene->OnCreateDevice(pd3dDevice, pBackBufferSurfaceDesc);
+
+	return S_OK;
+}
+
+
+//--------------------------------------------------------------------------------------
+// Create any D3DPOOL_DEFAULT resources here 
+//--------------------------------------------------------------------------------------
+HRESULT CALLBACK OnResetDevice( IDirect3DDevice9* pd3dDevice, 
+                                const D3DSURFACE_DESC* pBackBufferSurfaceDesc, void* pUserContext )
+{
+	HRESULT hr;
+
+	if( g_pFont )
+        V_RETURN( g_pFont->OnResetDevice() );
+	AssetCache::Get().OnResetDevice();
+	if (scene)
+		scene->OnResetDevice(pd3dDevice);
+
+	// Without timestamps the stages run all the same, just untimed on the GPU
+	if (SUCCEEDED( g_GpuQueries.Create(pd3dDevice) ))
+		WL::GpuProfiler::Get().SetTimestamps( &g_GpuQueries );
+
+    return S_OK;
+}
+
+
+//--------------------------------------------------------------------------------------
+// Handle updates to the scene
+//--------------------------------------------------------------------------------------
+void CALLBACK OnFrameMove( IDirect3DDevice9* pd3dDevice, double fTime, float fElapsedTime, void* pUserContext )
+{
+	if (g_pBenchmark)
+	{
+		// The run starts once the textures are in, so every run draws the same scene.
+		// From then on the script moves the camera and every frame simulates the same time.
+		const TextureLoader::Stats& textures = TextureLoader::Get().GetStats();
+		g_bBenchmarkFrame = g_pBenchmark->GetFrameCount() > 0 ||
+							textures.nQueued + textures.nDecoding + textures.nUploading == 0;
+		if (g_bBenchmarkFrame)
+		{
+			float fDelta = g_pBenchmark->BeginFrame( g_BenchmarkScene );
+			scene->Update(fDelta);
+			g_pBenchmark->EndUpdate();
+		}
+		return;
+	}
+
+	if (scene && !scene->Paused())
+		scene->Update(fElapsedTime);
+}
+
+
+//--------------------------------------------------------------------------------------
+// Saves the frames of the benchmark and closes the window
+//--------------------------------------------------------------------------------------
+void FinishBenchmark()
+{
+	g_bBenchmarkFailed = !g_pBenchmark->WriteCsv( L"benchmark.csv" );
+	SAFE_DELETE( g_pBenchmark );
+	SendMessage( DXUTGetHWND(), WM_CLOSE, 0, 0 );
+}
+
+
+//--------------------------------------------------------------------------------------
+// Render the scene 
+//--------------------------------------------------------------------------------------
+void CALLBACK OnFrameRender( IDirect3DDevice9* pd3dDevice, double fTime, float fElapsedTime, void* pUserContext )
+{
+    HRESULT hr;
+	
+	// Clear the render target and the zbuffer 
+	V( pd3dDevice->Clear(0, NULL, D3DCLEAR_TARGET | D3DCLEAR_ZBUFFER /*| D3DCLEAR_STENCIL*/, D3DCOLOR_ARGB(0,0, 0, 0), 1.0f, 0) );
+
+	// Upload whatever the texture loader has finished decoding
+	TextureLoader::Get().Update();
+
+	// Render the scene
+	if( SUCCEEDED( pd3dDevice->BeginScene() ) )
+	{
+		WL::GpuProfiler::Get().BeginFrame();
+		scene->Render(fElapsedTime);
+
+		// The overlay is left out of a benchmark's timings
+		if (!g_pBenchmark)
+			RenderText();
+		WL::GpuProfiler::Get().EndFrame();
+		V( pd3dDevice->EndScene() );
+	}
+
+	WL::Profiler::Get().EndFrame();
+
+	if (g_pBenchmark && g_bBenchmarkFrame)
+	{
+		g_pBenchmark->EndFrame( g_BenchmarkScene );
+		if (g_pBenchmark->IsDone())
+			FinishBenchmark();
+	}
+}
+
+
+//--------------------------------------------------------------------------------------
+// Handle messages to the application 
+//--------------------------------------------------------------------------------------
+LRESULT CALLBACK MsgProc( HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM lParam, 
+                          bool* pbNoFurtherProcessing, void* pUserContext )
+{
+    return 0;
+}
+
+
+//--------------------------------------------------------------------------------------
+// Release resources created in the OnResetDevice callback here 
+//--------------------------------------------------------------------------------------
+void CALLBACK OnLostDevice( void* pUserContext )
+{
+	if( g_pFont )
+        g_pFont->OnLostDevice();
+	if (scene)
+		scene->OnLostDevice();
+	AssetCache::Get().OnLostDevice();
+	StateCache::Get().OnLostDevice();
+	WL::GpuProfiler::Get().SetTimestamps( NULL );
+	g_GpuQueries.Release();
+
+}
+
+
+//--------------------------------------------------------------------------------------
+// Release resources created in the OnCreateDevice callback here
+//--------------------------------------------------------------------------------------
+void CALLBACK OnDestroyDevice( void* pUserContext )
+{
+	SAFE_RELEASE( g_pFont );
+	if (scene)
+		scene->OnDestroyDevice();
+	AssetCache::Get().OnDestroyDevice();
+	TextureLoader::Get().OnDestroyDevice();
+
+}
+
+void CALLBACK KeyboardProc( UINT nChar, bool bKeyDown, bool bAltDown, void* pUserContext )
+{
+	// A benchmark's camera follows its script alone
+    if( bKeyDown && !g_pBenchmark )
+    {
+        switch( nChar )
+        {
+            case VK_F1: DXUTToggleFullScreen(); break;
+			case VK_SPACE: if (scene) scene->Pause(); break;
+			case VK_RIGHT: if (scene) scene->CameraRotateAngle(true); break;
+			case VK_LEFT: if (scene) scene->CameraRotateAngle(false); break;
+			case VK_PRIOR : if (scene) scene->Zoom(-0.02f); break;
+			case VK_NEXT : if (scene) scene->Zoom(0.02f); break;
+			case 49 : if (scene) scene->SetCameraMode(0); break;
+			case 50 : if (scene) scene->SetCameraMode(1); break;
+			case 51 : if (scene) scene->SetCameraMode(2); break;
+			case 52 : if (scene) scene->SetCameraMode(3); break;
+			case 'P' : if (scene) scene->SetPipelined(!scene->IsPipelined()); break;
+			case 'O' : WL::Profiler::Get().SetEnabled(!WL::Profiler::IsEnabled()); break;
+			case 'C' : WL::Profiler::Get().WriteChromeTrace( L"profile.json" ); break;
+			case 'L' :
+				if (scene && scene->GetSun())
+				{
+					HDRSun* sun = scene->GetSun();
+					sun->SetLuminanceMode(sun->GetLuminanceMode() == HDRSun::LUMINANCE_HISTOGRAM ?
+										  HDRSun::LUMINANCE_AVERAGE : HDRSun::LUMINANCE_HISTOGRAM);
+				}
+				break;
+			case 'B' :
+				if (scene && scene->GetSun())
+				{
+					HDRSun* sun = scene->GetSun();
+					sun->SetBloomMode(sun->GetBloomMode() == HDRSun::BLOOM_DUAL_FILTER ?
+									  HDRSun::BLOOM_GAUSSIAN : HDRSun::BLOOM_DUAL_FILTER);
+				}
+				break;
+			case 'Q' :
+				if (scene && scene->GetSun())
+				{
+					HDRSun* sun = scene->GetSun();
+					sun->SetQualityTier((HDRSun::EQualityTier)((sun->GetQualityTier() + 1) % HDRSun::NUM_QUALITY_TIERS));
+				}
+				break;
+			case 'R' :
+				if (scene && scene->GetSun())
+				{
+					HDRSun* sun = scene->GetSun();
+					sun->SetBoundedPostProcess(!sun->GetBoundedPostProcess());
+				}
+				break;
+			case 'T' :
+				if (scene && scene->GetSun())
+				{
+					HDRSun* sun = scene->GetSun();
+					if (sun->GetBloomInterval() > 1 || sun->GetStarInterval() > 1 || sun->GetLuminanceInterval() > 1)
+						sun->SetRefreshIntervals(1, 1, 1);
+					else
+						sun->SetRefreshIntervals(BLOOM_REFRESH_INTERVAL, STAR_REFRESH_INTERVAL, LUMINANCE_REFRESH_INTERVAL);
+				}
+				break;
+        }
+    }
+}
+
+void CALLBACK MouseProc( bool bLeftButtonDown, bool bRightButtonDown, bool bMiddleButtonDown, bool bSideButton1Down, 
+						 bool bSideButton2Down, int nMouseWheelDelta, int xPos, int yPos, void* pUserContext )
+{
+
+	if (scene && !g_pBenchmark)
+	{
+		if (nMouseWheelDelta > 0)		
+			scene->Zoom(-0.02f);
+		else if (nMouseWheelDelta < 0)	
+			scene->Zoom(0.02f);
+	}
+
+}
+
+void RenderText()
+{
+    // The helper object simply helps keep track of text position, and color
+    // and then it calls pFont->DrawText( m_pSprite, strMsg, -1, &rc, DT_NOCLIP, m_clr );
+    // If NULL is passed in as the sprite object, then it will work fine however the 
+    // pFont->DrawText() will not be batched together.  Batching calls will improves perf.
+    CDXUTTextHelper txtHelper( g_pFont, g_pSprite, 15 );
+
+    // Output statistics
+    txtHelper.Begin();
+    txtHelper.SetInsertionPos( 2, 0 );
+    txtHelper.SetForegroundColor( D3DXCOLOR( 1.0f, 1.0f, 1.0f, 1.0f ) );
+    txtHelper.DrawTextLine( DXUTGetFrameStats(true) ); // Show FPS
+	txtHelper.DrawTextLine( DXUTGetDeviceStats() );
+
+	const TextureLoader::Stats& stats = TextureLoader::Get().GetStats();
+	txtHelper.DrawFormattedTextLine( L"Textures: %u pending, %u loaded (%u baked), %u failed, %.1f MB, latency %.1f ms avg / %.1f ms max",
+									 stats.nQueued + stats.nDecoding + stats.nUploading, stats.nCompleted, stats.nBaked, stats.nFailed,
+									 stats.nBytesResident / (1024.0f * 1024.0f), stats.fAvgLatency, stats.fMaxLatency );
+
+	const AssetCache::Stats& cache = AssetCache::Get().GetStats();
+	txtHelper.DrawFormattedTextLine( L"Assets: %u meshes, %u textures, %u effects, %u hits / %u misses",
+									 cache.nMeshes, cache.nTextures, cache.nEffects, cache.nHits, cache.nMisses );
+
+	EffectParams::Stats params;
+	AssetCache::Get().GetEffectParamStats(&params);
+	txtHelper.DrawFormattedTextLine( L"Effect parameters: %u uploaded, %u redundant dropped",
+									 params.nUploads, params.nRedundant );
+
+	const StateCache::Stats& states = StateCache::Get().GetStats();
+	txtHelper.DrawFormattedTextLine( L"Device state: %u of %u set calls dropped, %u of %u gets answered without the device, %u draw calls",
+									 states.nFiltered, states.nCalls, states.nGets, states.nGets + states.nDeviceGets, states.nDrawCalls );
+
+	const WL::EffectCacheStats& fx = WL::GetEffectCacheStats();
+	txtHelper.DrawFormattedTextLine( L"Effects: %u compiled (%.0f ms), %u from cache (%.0f ms)",
+									 fx.nMisses, fx.fCompileTime * 1000.0f, fx.nHits, fx.fLoadTime * 1000.0f );
+
+	if (scene)
+	{
+		const RenderQueue::Stats& queue = scene->GetQueueStats();
+		txtHelper.DrawFormattedTextLine( L"Render queue: %u packets, %u pass / %u effect / %u texture changes, %u unsorted",
+										 queue.nPackets, queue.nPassChanges, queue.nEffectChanges, queue.nTextureChanges, queue.nUnsortedChanges );
+
+		if (scene->IsPipelined())
+			txtHelper.DrawFormattedTextLine( L"Simulation: pipelined, step %.2f ms, waited %.2f ms (P to switch)",
+											 scene->GetStepTime() * 1000.0, scene->GetWaitTime() * 1000.0 );
+		else
+			txtHelper.DrawFormattedTextLine( L"Simulation: serial, step %.2f ms (P to switch)", scene->GetStepTime() * 1000.0 );
+
+		const CommandBuffer::Stats& commands = scene->GetStaticCommandStats();
+		txtHelper.DrawFormattedTextLine( L"Recorded: %u calls in %u bytes, replayed %u times, recorded %u times",
+										 commands.nCommands, commands.nBytes, commands.nReplays, commands.nRecordings );
+	}
+
+	if (scene && scene->GetSun())
+	{
+		const PostProcessGraph::Stats& graph = scene->GetSun()->GetGraphStats();
+		txtHelper.DrawFormattedTextLine( L"Post-processing: %u of %u passes, %u state changes, %u redundant dropped",
+										 graph.nLivePasses, graph.nPasses, graph.nStateChanges, graph.nRedundantChanges );
+
+		const RenderTargetPool::Stats& rt = scene->GetSun()->GetTargetStats();
+		txtHelper.DrawFormattedTextLine( L"HDR targets: %u in %u textures, %.1f MB allocated / %.1f MB unshared, %.1f MB peak",
+										 rt.nTargets, rt.nTextures, rt.nAllocatedBytes / (1024.0f * 1024.0f),
+										 rt.nTotalBytes / (1024.0f * 1024.0f), rt.nPeakBytes / (1024.0f * 1024.0f) );
+
+		if (scene->GetSun()->GetLuminanceMode() == HDRSun::LUMINANCE_HISTOGRAM)
+			txtHelper.DrawFormattedTextLine( L"Exposure: histogram, scene luminance %.3f (L to switch)",
+											 scene->GetSun()->GetHistogramLuminance() );
+		else
+			txtHelper.DrawFormattedTextLine( L"Exposure: average (L to switch)" );
+
+		// What every bloom pass costs, to compare the two modes
+		WL::BloomPassCost aCosts[2 * HDR_MAX_BLOOM_LEVELS];
+		int nCosts = scene->GetSun()->GetBloomPassCosts(aCosts, 2 * HDR_MAX_BLOOM_LEVELS);
+		WCHAR strPasses[512] = L"";
+		UINT nSamples = 0;
+		for (int i = 0; i < nCosts; i++)
+		{
+			WCHAR strPass[64];
+			StringCchPrintfW( strPass, 64, L"%s%S %dx%d*%d", i ? L", " : L"", aCosts[i].strName,
+							  aCosts[i].nWidth, aCosts[i].nHeight, aCosts[i].nSamples );
+			StringCchCatW( strPasses, 512, strPass );
+			nSamples += aCosts[i].nWidth * aCosts[i].nHeight * aCosts[i].nSamples;
+		}
+
+		if (scene->GetSun()->GetBloomMode() == HDRSun::BLOOM_DUAL_FILTER)
+			txtHelper.DrawFormattedTextLine( L"Bloom: dual filter, %d levels, %d passes, %.2f M samples (B to switch)",
+											 scene->GetSun()->GetBloomLevels(), nCosts, nSamples / 1000000.0f );
+		else
+			txtHelper.DrawFormattedTextLine( L"Bloom: gaussian, %d passes, %.2f M samples (B to switch)",
+											 nCosts, nSamples / 1000000.0f );
+		txtHelper.DrawTextLine( strPasses );
+
+		HDRSun* sun = scene->GetSun();
+		const HDRSun::QualityTier& tier = HDRSun::GetQualityTierDesc(sun->GetQualityTier());
+		txtHelper.DrawFormattedTextLine( L"Quality: %s, scene %ux%u %s%s, %s (Q to switch)",
+										 tier.strName, sun->GetSceneWidth(), sun->GetSceneHeight(),
+										 tier.bPackedScene ? L"RGBE" : L"FP16", sun->IsMultiSampled() ? L" multisampled" : L"",
+										 tier.bStar ? L"bloom and star" : L"bloom only" );
+
+		if (!sun->GetBoundedPostProcess())
+			txtHelper.DrawTextLine( L"Sun region: off, bright pass, bloom and star run over the whole screen (R to switch)" );
+		else if (sun->IsSunBounded())
+			txtHelper.DrawFormattedTextLine( L"Sun region: %.1f%% of the screen, bright pass, bloom and star run around it (R to switch)",
+											 sun->GetSunCoverage() * 100.0f );
+		else
+			txtHelper.DrawTextLine( L"Sun region: sun too large, bright pass, bloom and star run over the whole screen (R to switch)" );
+
+		txtHelper.DrawFormattedTextLine( L"Refresh: bloom every %d frames, star every %d, luminance every %d (T to switch)",
+										 sun->GetBloomInterval(), sun->GetStarInterval(), sun->GetLuminanceInterval() );
+
+		// Where the GPU time of the HDR passes goes, for the tier above
+		PostProcessGraph::StageTime aStages[16];
+		UINT nStages = sun->GetStageTimes(aStages, 16);
+		if (nStages > 0)
+		{
+			WCHAR strStages[512];
+			StringCchPrintfW( strStages, 512, L"GPU: %.2f ms", graph.fGpuTime );
+			for (UINT i = 0; i < nStages; i++)
+			{
+				WCHAR strStage[64];
+				StringCchPrintfW( strStage, 64, L"%s %s %.2f", i ? L"," : L" -", aStages[i].strName, aStages[i].fTime );
+				StringCchCatW( strStages, 512, strStage );
+			}
+			txtHelper.DrawTextLine( strStages );
+		}
+		else
+		{
+			txtHelper.DrawTextLine( L"GPU: no timestamp queries" );
+		}
+	}
+
+	// The CPU zones of the last frame, in a column of their own on the right, and the
+	// GPU stages of the last frame read back under them
+	WL::Profiler& profiler = WL::Profiler::Get();
+	WL::GpuProfiler& gpuProfiler = WL::GpuProfiler::Get();
+	if (profiler.IsEnabled())
+	{
+		txtHelper.SetInsertionPos( DXUTGetBackBufferSurfaceDesc()->Width - 340, 0 );
+		txtHelper.DrawFormattedTextLine( L"CPU: %.2f ms (O to hide, C to save profile.json)", profiler.GetFrameTime() );
+		for (int i = 0; i < profiler.GetZoneCount(); i++)
+		{
+			const WL::Profiler::Zone& zone = profiler.GetZone(i);
+			txtHelper.DrawFormattedTextLine( L"%d %*s%s %.2f ms (%u)", zone.iThread, zone.nDepth * 2, L"",
+											 zone.strName, zone.fTime, zone.nCalls );
+		}
+
+		if (gpuProfiler.HasTimestamps())
+		{
+			const WL::GpuProfiler::Stats& gpuStats = gpuProfiler.GetStats();
+			txtHelper.DrawFormattedTextLine( L"GPU: %.2f ms, %u frames skipped, %u dropped",
+											 gpuProfiler.GetFrameTime(), gpuStats.nFramesSkipped, gpuStats.nFramesDropped );
+			for (int i = 0; i < gpuProfiler.GetStageCount(); i++)
+			{
+				const WL::GpuProfiler::Stage& stage = gpuProfiler.GetStage(i);
+				txtHelper.DrawFormattedTextLine( L"  %*s%s %.2f ms (%u)", stage.nDepth * 2, L"",
+												 stage.strName, stage.fTime, stage.nCalls );
+			}
+		}
+		else
+		{
+			txtHelper.DrawTextLine( L"GPU: no timestamp queries" );
+		}
+	}
+    txtHelper.End();
+}
+
+void InitApp()
+{
+}
+
+//--------------------------------------------------------------------------------------
+// Returns true if -strArg or /strArg was given on the command line
+//--------------------------------------------------------------------------------------
+bool HasCmdLineArg(LPCWSTR strArg)
+{
+	int nArgs = 0;
+	LPWSTR* pstrArgv = CommandLineToArgvW( GetCommandLineW(), &nArgs );
+	if (pstrArgv == NULL)
+		return false;
+
+	bool bFound = false;
+	for (int i = 1; i < nArgs && !bFound; i++)
+	{
+		if ((pstrArgv[i][0] == L'-' || pstrArgv[i][0] == L'/') && _wcsicmp( pstrArgv[i] + 1, strArg ) == 0)
+			bFound = true;
+	}
+
+	LocalFree( pstrArgv );
+	return bFound;
+}
+
+//--------------------------------------------------------------------------------------
+// The number N of -strArg:N or /strArg:N, nDefault when it wasn't given
+//--------------------------------------------------------------------------------------
+int GetCmdLineInt(LPCWSTR strArg, int nDefault)
+{
+	int nArgs = 0;
+	LPWSTR* pstrArgv = CommandLineToArgvW( GetCommandLineW(), &nArgs );
+	if (pstrArgv == NULL)
+		return nDefault;
+
+	int nValue = nDefault;
+	size_t nLength = wcslen( strArg );
+	for (int i = 1; i < nArgs; i++)
+	{
+		if ((pstrArgv[i][0] == L'-' || pstrArgv[i][0] == L'/') && _wcsnicmp( pstrArgv[i] + 1, strArg, nLength ) == 0 &&
+			pstrArgv[i][nLength + 1] == L':')
+		{
+			nValue = _wtoi( pstrArgv[i] + nLength + 2 );
+			break;
+		}
+	}
+
+	LocalFree( pstrArgv );
+	return nValue;
+}
+
+//--------------------------------------------------------------------------------------
+// Initialize everything and go into a render loop
+//--------------------------------------------------------------------------------------
+INT WINAPI WinMain( HINSTANCE, HINSTANCE, LPSTR, int )
+{
+    // Enable run-time memory check for debug builds.
+#if defined(DEBUG) | defined(_DEBUG)
+    _CrtSetDbgFlag( _CRTDBG_ALLOC_MEM_DF | _CRTDBG_LEAK_CHECK_DF );
+#endif
+
+	DXUTSetCallbackDeviceCreated( OnCreateDevice );
+    DXUTSetCallbackDeviceReset( OnResetDevice );
+    DXUTSetCallbackDeviceLost( OnLostDevice );
+    DXUTSetCallbackDeviceDestroyed( OnDestroyDevice );
+    DXUTSetCallbackMsgProc( MsgProc );
+    DXUTSetCallbackKeyboard( KeyboardProc );
+	DXUTSetCallbackMouse( MouseProc );
+    DXUTSetCallbackFrameRender( OnFrameRender );
+    DXUTSetCallbackFrameMove( OnFrameMove );
+
+    // Show the cursor and clip it when in full screen
+    DXUTSetCursorSettings( true, true );
+
+    // Initialize DXUT and create the desired Win32 window and Direct3D 
+    // device for the application. Calling each of these functions is optional, but they
+    // allow you to set several options which control the behavior of the framework.
+    DXUTInit( true, true, true ); // Parse the command line, handle the default hotkeys, and show msgboxes
+    DXUTCreateWindow( L"Space System" );
+
+	if (FULLSCREEN) {
+		g_AspectRatio = float(WINDOWWIDTH)/(WINDOWHEIGHT);	
+		// If the resolution is not valid then DXUT will change it to the closest valid
+		DXUTCreateDevice( D3DADAPTER_DEFAULT, false, WINDOWWIDTH, WINDOWHEIGHT, IsDeviceAcceptable, ModifyDeviceSettings );
+	}
+	else
+	{
+		g_AspectRatio = WINDOWWIDTH/WINDOWHEIGHT;	
+		DXUTCreateDevice( D3DADAPTER_DEFAULT, true, WINDOWWIDTH, WINDOWHEIGHT, IsDeviceAcceptable, ModifyDeviceSettings );
+	}
+
+	Device = DXUTGetD3DDevice();
+
+	// -bake compresses the scene's textures into DDS files next to them and exits
+	if (Device && HasCmdLineArg( L"bake" ))
+	{
+		int nBaked = WL::BakeMeshTextures( Device, L"data\\models\\*.x" );
+		nBaked += WL::BakeTextures( Device, L"*.tga" );
+		DXUTShutdown();
+		return (nBaked > 0) ? 0 : 1;
+	}
+
+	// -benchmark draws the same frames every run, so the scene's random numbers start
+	// from the same seed
+	bool bBenchmark = HasCmdLineArg( L"benchmark" );
+	if (bBenchmark)
+		WL::SetRandomSeed( WL::Benchmark::DEFAULT_SEED );
+
+	if (Device)
+		scene = new SpaceScene();
+
+	// With a core to spare the next frame is simulated while this one is drawn.
+	// -serial keeps both on the main thread, and so does -benchmark, whose update
+	// time would otherwise only be the handing over of the step to the worker.
+	if (scene && WL::GetProcessorCount() > 1 && !HasCmdLineArg( L"serial" ) && !bBenchmark)
+		scene->SetPipelined( true );
+
+	// -profile starts with the CPU profiler on
+	if (HasCmdLineArg( L"profile" ))
+		WL::Profiler::Get().SetEnabled( true );
+
+	// -lowquality starts with the cheapest HDR tier, for low end hardware
+	if (scene && scene->GetSun() && HasCmdLineArg( L"lowquality" ))
+		scene->GetSun()->SetQualityTier( HDRSun::QUALITY_LOW );
+
+	// -benchmark takes the camera through every mode for -frames:N frames at a fixed
+	// 60 Hz step, writes the time and counters of every frame to benchmark.csv and exits
+	if (scene && bBenchmark)
+	{
+		g_pBenchmark = new WL::Benchmark( GetCmdLineInt( L"frames", 600 ), 1.0f / 60.0f );
+		g_pBenchmark->AddDefaultPath( SCENE_CAMERA_MODES );
+	}
+
+	//InitApp();
+
+	if(!scene)
+	{
+		MessageBox(0, L"Scene Initialization Failed", 0, 0);
+		return 0;
+	} 
+	// Pass control to DXUT for handling the message pump and 
+	// dispatching render calls. DXUT will call your FrameMove 
+	// and FrameRender callback when there is idle time between handling window messages.
+	DXUTMainLoop();
+	
+
+    // Perform any application-level cleanup here. Direct3D device resources are released within the
+    // appropriate callback functions and therefore don't require any cleanup code here.
+	
+	delete scene;
+	scene = 0;
+	SAFE_DELETE( g_pBenchmark );
+
+	if (g_bBenchmarkFailed)
+		return 1;
+    return DXUTGetExitCode();
 }
\ No newline at end of file
@@ -1,67 +1,86 @@
-#ifndef	SPACESCENE_H
-#define SPACESCENE_H
-
-#include "WL\WL.h"
-#include "XMesh.h"
-#include "Particle.h"
-
-class SpaceScene
-{	
-private:
-	IDirect3DDevice9*	m_pd3dDevice;
-	Starmap *			m_Stars;				// Starmap
-	HDRSun *			m_Sun;
-	GeneralObject**		m_Objects;
- 
-	int					m_NumberOfObjects;
-	D3DXMATRIX			m_mViewCoordinates;
-	D3DXMATRIX			m_mProjection;
-	float				m_fAspectRatio;
-	float				m_fFarPlane;
-	float				m_fNearPlane;
-	float				m_fFov;
-	float				m_fCamRotateAngle;			// Starting rotation angle
-	bool				m_bPaused;
-	D3DXVECTOR3			cameraPos;
-	D3DXVECTOR3			m_vRotationPoint;
-	float				m_fDistanceX;
-	float				m_fDistanceY;
-	float				m_fCameraHeight;
-	float				m_fRotateDelay;
-	const D3DXVECTOR3	CameraPosition(float timeDelta);
-
-	int					m_iCameraMode;
-
-public:
-
-	SpaceScene();
-	~SpaceScene();
-	void Render(float timeDelta);
-	void Update(float timeDelta);
-	void Zoom(float amount);
-	inline void Pause() { m_bPaused = !m_bPaused; }	// Pause the scene animation
-	inline bool Paused() const { return m_bPaused; }
-	void SetCameraMode(int mode);
-	inline void CameraRotateAngle(bool right = true) 
-	{
-		if (right)
-		{
-			m_fCamRotateAngle += D3DX_PI/32.0f;
-			cameraPos = CameraPosition(0);
-		}
-		else
-		{
-			m_fCamRotateAngle -= D3DX_PI/32.0f;
-			cameraPos = CameraPosition(0);
-		}
-	}
-
-	// Device Changes
-	HRESULT OnCreateDevice(IDirect3DDevice9* pd3dDevice, const D3DSURFACE_DESC* pBackBufferSurfaceDesc);
-	void OnResetDevice(IDirect3DDevice9* pd3dDevice);
-	void OnLostDevice();
-	void OnDestroyDevice();
-
-};
-
-#endif	// SPACESCENE_H
+#ifndef	SPACESCENE_H
+#define SPACESCENE_H
+
+#include "WL\WL.h"
+#include "XMesh.h"
+#include "Particle.h"
+
+class SpaceScene
+{	
+private:
+	IDirect3DDevice9*	m_pd3dDevice;
+	Starmap *			m_Stars;				// Starmap
+	HDRSun *			m_Sun;
+
+	// The objects, their particles and the camera are simulated by m_World, the same
+	// simulation the headless benchmark runs. m_Objects draw what it publishes.
+	WL::SceneSimulation	m_World;
+	GeneralObject*		m_Objects[SCENE_OBJECTS];	// By WL::ESceneObject
+ 
+	D3DXMATRIX			m_mProjection;
+	float				m_fAspectRatio;
+	bool				m_bPaused;
+
+	int GetDrawnObjects(GeneralObject** apObjects) const;	// Of the camera mode
+	void UpdateProjection();								// For the camera's field of view
+
+	// In the pipelined mode the next frame is simulated on a worker thread while this one
+	// is drawn. Anything that touches the simulated state from the main thread calls
+	// Sync() first.
+	WL::ThreadPool		m_Simulation;
+	bool				m_bPipelined;
+	bool				m_bStepPending;				// Submitted, and not yet flipped
+	float				m_fStepDelta;
+	double				m_fStepTime;				// Seconds, of the step drawn
+	double				m_fStepRunTime;				// Written by the step itself
+	double				m_fWaitTime;				// Seconds the main thread waited for it
+
+	static void StepJob(void* pContext);
+	void Step(float timeDelta);
+	void Flip();
+	void Sync();
+
+	// Set once a frame for every effect
+	D3DXVECTOR3			m_vLightDirection;			// World space
+	EffectParams::Param	m_hView;
+	EffectParams::Param	m_hProjection;
+	EffectParams::Param	m_hLightDir;
+
+	RenderQueue			m_Queue;					// The objects, sorted by their state
+	CommandBuffer		m_StaticCommands;			// The sky, recorded once
+
+public:
+
+	SpaceScene();
+	~SpaceScene();
+	void Render(float timeDelta);
+	void Update(float timeDelta);
+	void Zoom(float amount);
+	inline void Pause() { m_bPaused = !m_bPaused; }	// Pause the scene animation
+	inline bool Paused() const { return m_bPaused; }
+	inline HDRSun* GetSun() const { return m_Sun; }
+	inline const RenderQueue::Stats& GetQueueStats() const { return m_Queue.GetStats(); }
+	inline const CommandBuffer::Stats& GetStaticCommandStats() const { return m_StaticCommands.GetStats(); }
+	UINT GetParticleCount() const;								// In the step drawn
+	void SetCameraMode(int mode);
+
+	// Simulates the next frame on a worker thread while this one is drawn, a frame late
+	void SetPipelined(bool bPipelined);
+	inline bool IsPipelined() const { return m_bPipelined; }
+	inline double GetStepTime() const { return m_fStepTime; }
+	inline double GetWaitTime() const { return m_fWaitTime; }
+	inline void CameraRotateAngle(bool right = true) 
+	{
+		Sync();
+		m_World.RotateCamera(right);
+	}
+
+	// Device Changes
+	HRESULT OnCreateDevice(IDirect3DDevice9* pd3dDevice, const D3DSURFACE_DESC* pBackBufferSurfaceDesc);
+	void OnResetDevice(IDirect3DDevice9* pd3dDevice);
+	void OnLostDevice();
+	void OnDestroyDevice();
+
+};
+
+#endif	// SPACESCENE_H
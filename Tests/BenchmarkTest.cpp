@@ -0,0 +1,152 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: BenchmarkTest.cpp
+//
+// Author: snez
+//
+// Desc: The benchmark without a device. Runs the default camera path over the scene's
+//       simulation twice from the same seed and checks that both runs did the same work,
+//       frame by frame, particles included, and that every frame drew something. The
+//       comet's and the ship's particles have to be there in the modes that draw them.
+//       The time of every camera mode is printed.
+//
+//       BenchmarkTest [frames] [file.csv] sets the length of the run, 600 frames by
+//       default like Space.exe -benchmark, and writes the frames of the first run to a
+//       CSV file, for comparing builds on a machine without a GPU.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "WLHeadlessScene.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+
+// Particles drawn in every camera mode: the comet's tail, the ship's exhaust and dust, and
+// none over the procedural planet
+static const unsigned int MODE_PARTICLES[SCENE_CAMERA_MODES] = { 500, 200 + 1000, 500, 0 };
+
+static int s_nFailures = 0;
+
+//
+//	One whole run, a fresh scene for it, its particles starting from the same seed
+//
+static bool Run(WL::Benchmark& benchmark)
+{
+	WL::SetRandomSeed(WL::Benchmark::DEFAULT_SEED);
+	WL::HeadlessScene scene;
+	if (!scene.Create())
+		return false;
+
+	benchmark.AddDefaultPath(SCENE_CAMERA_MODES);
+	benchmark.Run(scene);
+	scene.Release();
+	return true;
+}
+
+static void PrintModes(const WL::Benchmark& benchmark)
+{
+	int nModeFrames = benchmark.GetFrameCount() / SCENE_CAMERA_MODES;
+	for (int iMode = 0; iMode < SCENE_CAMERA_MODES && nModeFrames > 0; iMode++)
+	{
+		double fUpdate = 0.0, fRender = 0.0;
+		unsigned int nDrawCalls = 0, nParticles = 0;
+		for (int i = iMode * nModeFrames; i < (iMode + 1) * nModeFrames; i++)
+		{
+			const WL::Benchmark::Frame& frame = benchmark.GetFrame(i);
+			fUpdate += frame.fUpdate;
+			fRender += frame.fRender;
+			nDrawCalls += frame.counters.nDrawCalls;
+			nParticles += frame.counters.nParticles;
+		}
+		printf("     mode %d, %d frames: update %.3f, render %.3f ms a frame, %u draw calls, %u particles a frame\n", iMode,
+			   nModeFrames, fUpdate / nModeFrames, fRender / nModeFrames, nDrawCalls / nModeFrames, nParticles / nModeFrames);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	int nFrames = argc > 1 ? atoi(argv[1]) : 600;
+	if (nFrames <= 0)
+	{
+		printf("BenchmarkTest [frames] [file.csv]\n");
+		return 2;
+	}
+
+	WL::Benchmark first(nFrames, 1.0f / 60.0f), second(nFrames, 1.0f / 60.0f);
+	if (!Run(first) || !Run(second))
+	{
+		printf("FAIL: could not create the terrain\n");
+		return 1;
+	}
+
+	if (first.GetFrameCount() != nFrames || second.GetFrameCount() != nFrames)
+	{
+		printf("FAIL frames: %d and %d, expected %d\n", first.GetFrameCount(), second.GetFrameCount(), nFrames);
+		s_nFailures++;
+	}
+
+	int nModeFrames = nFrames / SCENE_CAMERA_MODES;
+	int nDifferent = 0, nEmpty = 0, nWrongParticles = 0;
+	for (int i = 0; i < first.GetFrameCount() && i < second.GetFrameCount(); i++)
+	{
+		const WL::BenchmarkCounters& a = first.GetFrame(i).counters;
+		const WL::BenchmarkCounters& b = second.GetFrame(i).counters;
+		if (a.nDrawCalls != b.nDrawCalls || a.nParticles != b.nParticles ||
+			a.nPostPasses != b.nPostPasses || a.nStateChanges != b.nStateChanges)
+		{
+			if (nDifferent++ == 0)
+				printf("FAIL same work: frame %d drew %u calls and %u particles, then %u and %u\n", i,
+					   a.nDrawCalls, a.nParticles, b.nDrawCalls, b.nParticles);
+		}
+
+		int iMode = nModeFrames > 0 ? i / nModeFrames : 0;
+		if (iMode >= SCENE_CAMERA_MODES)
+			iMode = SCENE_CAMERA_MODES - 1;
+
+		// The planet's roots are asked for in the first frame that draws it
+		if (a.nDrawCalls == 0 && i != (SCENE_CAMERA_MODES - 1) * nModeFrames)
+			nEmpty++;
+
+		if (a.nParticles != MODE_PARTICLES[iMode])
+		{
+			if (nWrongParticles++ == 0)
+				printf("FAIL particles: frame %d in mode %d drew %u, expected %u\n", i, iMode, a.nParticles, MODE_PARTICLES[iMode]);
+		}
+	}
+	if (nDifferent)
+		s_nFailures++;
+	else
+		printf("ok   same work: %d frames\n", first.GetFrameCount());
+
+	if (nEmpty)
+	{
+		printf("FAIL drawn: %d frames drew nothing\n", nEmpty);
+		s_nFailures++;
+	}
+	else
+	{
+		printf("ok   drawn: every frame\n");
+	}
+
+	if (nWrongParticles)
+		s_nFailures++;
+	else
+		printf("ok   particles: every mode\n");
+
+	PrintModes(first);
+
+	if (argc > 2)
+	{
+		std::wstring strFile;
+		for (const char* p = argv[2]; *p; p++)
+			strFile += (wchar_t)*p;
+		if (!first.WriteCsv(strFile.c_str()))
+		{
+			printf("FAIL: could not write %s\n", argv[2]);
+			s_nFailures++;
+		}
+	}
+
+	printf("%s\n", s_nFailures ? "FAILED" : "PASSED");
+	return s_nFailures ? 1 : 0;
+}
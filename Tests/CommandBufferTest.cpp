@@ -0,0 +1,238 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: CommandBufferTest.cpp
+//
+// Author: snez
+//
+// Desc: Replays command buffers on a mock device that writes down every call it gets,
+//       and compares that against the calls the recording was meant to make: the
+//       starmap's, as Starmap records them, and a mesh subset's, as the planets and the
+//       sun's sphere record theirs. Matrices recorded by address have to be read at
+//       replay, and a dropped recording must replay nothing.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "WLCommandBuffer.h"
+#include "WLStarmapCommands.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+static int s_nFailures = 0;
+
+static unsigned long Address(const void* p)
+{
+	return (unsigned long)(size_t)p;
+}
+
+//
+//	Writes each call down as a line of text, with the values it was given
+//
+class MockDevice
+{
+public:
+	std::vector<std::string>	calls;
+
+	HRESULT SetRenderState(D3DRENDERSTATETYPE state, DWORD dwValue) { return Log("SetRenderState %d %u", (int)state, dwValue); }
+	HRESULT SetSamplerState(DWORD dwSampler, D3DSAMPLERSTATETYPE type, DWORD dwValue) { return Log("SetSamplerState %u %d %u", dwSampler, (int)type, dwValue); }
+	HRESULT SetTextureStageState(DWORD dwStage, D3DTEXTURESTAGESTATETYPE type, DWORD dwValue) { return Log("SetTextureStageState %u %d %u", dwStage, (int)type, dwValue); }
+	HRESULT SetTransform(D3DTRANSFORMSTATETYPE state, const D3DMATRIX* pMatrix) { return Log("SetTransform %d %g %g %g", (int)state, pMatrix->m[3][0], pMatrix->m[3][1], pMatrix->m[3][2]); }
+	HRESULT SetMaterial(const D3DMATERIAL9* pMaterial) { return Log("SetMaterial %g %g", pMaterial->Diffuse.r, pMaterial->Power); }
+	HRESULT SetTexture(DWORD dwStage, IDirect3DBaseTexture9* pTexture) { return Log("SetTexture %u %lx", dwStage, Address(pTexture)); }
+	HRESULT SetVertexShader(IDirect3DVertexShader9* pShader) { return Log("SetVertexShader %lx", Address(pShader)); }
+	HRESULT SetPixelShader(IDirect3DPixelShader9* pShader) { return Log("SetPixelShader %lx", Address(pShader)); }
+	HRESULT SetFVF(DWORD dwFVF) { return Log("SetFVF %u", dwFVF); }
+	HRESULT SetStreamSource(UINT nStream, IDirect3DVertexBuffer9* pVB, UINT nOffset, UINT nStride) { return Log("SetStreamSource %u %lx %u %u", nStream, Address(pVB), nOffset, nStride); }
+	HRESULT SetIndices(IDirect3DIndexBuffer9* pIB) { return Log("SetIndices %lx", Address(pIB)); }
+	HRESULT DrawPrimitive(D3DPRIMITIVETYPE type, UINT nStartVertex, UINT nPrimitives) { return Log("DrawPrimitive %d %u %u", (int)type, nStartVertex, nPrimitives); }
+	HRESULT DrawIndexedPrimitive(D3DPRIMITIVETYPE type, int nBaseVertex, UINT nMinIndex, UINT nVertices, UINT nStartIndex, UINT nPrimitives)
+	{
+		return Log("DrawIndexedPrimitive %d %d %u %u %u %u", (int)type, nBaseVertex, nMinIndex, nVertices, nStartIndex, nPrimitives);
+	}
+
+private:
+	HRESULT Log(const char* strFormat, ...);
+};
+
+HRESULT MockDevice::Log(const char* strFormat, ...)
+{
+	char str[256];
+	va_list args;
+	va_start(args, strFormat);
+	vsnprintf(str, sizeof(str), strFormat, args);
+	va_end(args);
+	calls.push_back(str);
+	return D3D_OK;
+}
+
+static void Check(const char* strCase, const std::vector<std::string>& calls, const std::vector<std::string>& expected)
+{
+	for (size_t i = 0; i < calls.size() || i < expected.size(); i++)
+	{
+		const char* strCall = i < calls.size() ? calls[i].c_str() : "nothing";
+		const char* strExpected = i < expected.size() ? expected[i].c_str() : "nothing";
+		if (strcmp(strCall, strExpected) != 0)
+		{
+			printf("FAIL %s: call %d was %s, expected %s\n", strCase, (int)i, strCall, strExpected);
+			s_nFailures++;
+			return;
+		}
+	}
+	printf("ok   %s: %d calls\n", strCase, (int)calls.size());
+}
+
+static void CheckValue(const char* strCase, unsigned int nValue, unsigned int nExpected)
+{
+	if (nValue != nExpected)
+	{
+		printf("FAIL %s: %u, expected %u\n", strCase, nValue, nExpected);
+		s_nFailures++;
+	}
+	else
+	{
+		printf("ok   %s: %u\n", strCase, nValue);
+	}
+}
+
+static D3DMATRIX Translation(float x, float y, float z)
+{
+	D3DMATRIX matrix;
+	memset(&matrix, 0, sizeof(matrix));
+	matrix.m[0][0] = matrix.m[1][1] = matrix.m[2][2] = matrix.m[3][3] = 1.0f;
+	matrix.m[3][0] = x;
+	matrix.m[3][1] = y;
+	matrix.m[3][2] = z;
+	return matrix;
+}
+
+//
+//	What Starmap::Record() gives, the world at the camera's position
+//
+static std::vector<std::string> StarmapCalls(const char* strWorld)
+{
+	std::vector<std::string> calls;
+	calls.push_back("SetRenderState 128 0");			// WRAP0
+	calls.push_back("SetRenderState 137 0");			// LIGHTING
+	calls.push_back("SetRenderState 14 0");				// ZWRITEENABLE
+	calls.push_back("SetRenderState 7 0");				// ZENABLE
+	calls.push_back(std::string("SetTransform 256 ") + strWorld);
+	calls.push_back("SetVertexShader 0");
+	calls.push_back("SetPixelShader 0");
+	calls.push_back("SetFVF 66");						// XYZ | DIFFUSE
+	calls.push_back("SetStreamSource 0 1000 0 16");
+	calls.push_back("SetTexture 0 0");
+	calls.push_back("DrawPrimitive 1 0 5000");			// POINTLIST
+	calls.push_back("SetRenderState 137 1");
+	calls.push_back("SetRenderState 14 1");
+	calls.push_back("SetRenderState 7 1");
+	return calls;
+}
+
+static void TestStarmap()
+{
+	IDirect3DVertexBuffer9* pVB = (IDirect3DVertexBuffer9*)0x1000;
+	D3DMATRIX world = Translation(1.0f, 2.0f, 3.0f);
+
+	CommandBuffer commands;
+	commands.Begin();
+	RecordStarmapCommands(commands, pVB, 16, D3DFVF_XYZ | D3DFVF_DIFFUSE, 5000, &world);
+	commands.End();
+
+	MockDevice device;
+	commands.Replay(&device);
+	Check("starmap", device.calls, StarmapCalls("1 2 3"));
+
+	// The camera moved, the recording stays and reads the new world
+	world = Translation(-4.0f, 0.5f, 7.0f);
+	device.calls.clear();
+	commands.Replay(&device);
+	Check("starmap after the camera moved", device.calls, StarmapCalls("-4 0.5 7"));
+
+	CheckValue("starmap commands", commands.GetStats().nCommands, 14);
+	CheckValue("starmap recordings", commands.GetStats().nRecordings, 1);
+	CheckValue("starmap replays", commands.GetStats().nReplays, 2);
+}
+
+//
+//	A subset of a mesh, as XMesh records it with WL::RecordMeshSubset()
+//
+static void TestMeshSubset()
+{
+	IDirect3DVertexBuffer9* pVB = (IDirect3DVertexBuffer9*)0x2000;
+	IDirect3DIndexBuffer9* pIB = (IDirect3DIndexBuffer9*)0x3000;
+	D3DMATERIAL9 material;
+	memset(&material, 0, sizeof(material));
+	material.Diffuse.r = 0.5f;
+	material.Power = 8.0f;
+
+	CommandBuffer commands;
+	commands.Begin();
+	commands.SetMaterial(&material);
+	commands.SetFVF(D3DFVF_XYZ | D3DFVF_NORMAL | D3DFVF_TEX1);
+	commands.SetStreamSource(0, pVB, 0, 32);
+	commands.SetIndices(pIB);
+	commands.DrawIndexedPrimitive(D3DPT_TRIANGLELIST, 0, 120, 240, 600, 200);
+	commands.End();
+
+	// Copied in, so the material can go
+	material.Diffuse.r = 1.0f;
+
+	std::vector<std::string> expected;
+	expected.push_back("SetMaterial 0.5 8");
+	expected.push_back("SetFVF 274");
+	expected.push_back("SetStreamSource 0 2000 0 32");
+	expected.push_back("SetIndices 3000");
+	expected.push_back("DrawIndexedPrimitive 4 0 120 240 600 200");
+
+	MockDevice device;
+	commands.Replay(&device);
+	Check("mesh subset", device.calls, expected);
+}
+
+//
+//	A dropped recording replays nothing, and a new one replaces the old one whole
+//
+static void TestInvalidate()
+{
+	CommandBuffer commands;
+	commands.Begin();
+	commands.SetRenderState(D3DRS_ZENABLE, 0);
+	commands.DrawPrimitive(D3DPT_TRIANGLELIST, 0, 2);
+	commands.End();
+
+	MockDevice device;
+	commands.Invalidate();
+	commands.Replay(&device);
+	CheckValue("invalidated replay calls", (unsigned int)device.calls.size(), 0);
+
+	// Begun and never ended, like a recording that failed part of the way
+	commands.Begin();
+	commands.SetRenderState(D3DRS_LIGHTING, 0);
+	commands.Replay(&device);
+	CheckValue("unfinished replay calls", (unsigned int)device.calls.size(), 0);
+
+	commands.SetSamplerState(0, D3DSAMP_ADDRESSU, 3);
+	commands.SetTextureStageState(0, D3DTSS_COLOROP, 4);
+	commands.End();
+	commands.Replay(&device);
+
+	std::vector<std::string> expected;
+	expected.push_back("SetRenderState 137 0");
+	expected.push_back("SetSamplerState 0 1 3");
+	expected.push_back("SetTextureStageState 0 1 4");
+	Check("recorded again", device.calls, expected);
+	CheckValue("recorded again commands", commands.GetStats().nCommands, 3);
+	CheckValue("recorded again recordings", commands.GetStats().nRecordings, 2);
+}
+
+int main()
+{
+	TestStarmap();
+	TestMeshSubset();
+	TestInvalidate();
+
+	printf("%s\n", s_nFailures ? "FAILED" : "PASSED");
+	return s_nFailures ? 1 : 0;
+}
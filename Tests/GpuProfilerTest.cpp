@@ -0,0 +1,224 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: GpuProfilerTest.cpp
+//
+// Author: snez
+//
+// Desc: Drives the GpuProfiler with the clock of MockGpuTimestamps. The frames draw the
+//       same stages every time, taking a known number of ticks, so the times read back
+//       have to come out exactly. A GPU slower than the ring of frames must make frames
+//       go untimed, asking once and not waiting, and a disjoint frame must be dropped.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "WLGpuProfiler.h"
+#include <math.h>
+#include <stdio.h>
+#include <wchar.h>
+
+#define FREQUENCY		1000000		// Ticks of the mock clock in a second
+#define ISSUE_COST		10			// Ticks between two timestamps
+#define MAX_ERROR		1e-9		// Milliseconds
+
+static int s_nFailures = 0;
+
+static void Report(bool bOk, const char* strCase, const char* strDetail)
+{
+	printf("%s %s: %s\n", bOk ? "ok  " : "FAIL", strCase, strDetail);
+	if (!bOk)
+		s_nFailures++;
+}
+
+//
+//	Counts the reads, to tell a frame skipped at once from one waited on
+//
+class CountingTimestamps : public WL::MockGpuTimestamps
+{
+public:
+	CountingTimestamps(int nLatency) : WL::MockGpuTimestamps(nLatency, FREQUENCY, ISSUE_COST), m_nReads(0), m_nPending(0) {}
+
+	virtual EResult ReadFrame(int iFrame, int nSlots, WL::GpuTicks* anTimestamps, WL::GpuTicks* pnFrequency)
+	{
+		EResult eResult = WL::MockGpuTimestamps::ReadFrame(iFrame, nSlots, anTimestamps, pnFrequency);
+		m_nReads++;
+		if (eResult == READ_PENDING)
+			m_nPending++;
+		return eResult;
+	}
+
+	int		m_nReads;
+	int		m_nPending;
+};
+
+//
+//	The frame every test draws. With a timestamp costing ISSUE_COST ticks:
+//
+//		Scene	begin, 1000, Sky, 3000, end				6030 ticks
+//		Sky		begin, 2000, end						2010 ticks
+//		Bloom	twice begin, 500, end					1020 ticks
+//		frame	the above and its own two timestamps	7090 ticks
+//
+#define SCENE_MS	6.03
+#define SKY_MS		2.01
+#define BLOOM_MS	1.02
+#define FRAME_MS	7.09
+
+static void DrawFrame(WL::MockGpuTimestamps& timestamps, bool bDisjoint = false)
+{
+	WL::GpuProfiler& profiler = WL::GpuProfiler::Get();
+	profiler.BeginFrame();
+	{
+		WL::GpuZone scene(L"Scene");
+		timestamps.Advance(1000);
+		{
+			WL::GpuZone sky(L"Sky");
+			timestamps.Advance(2000);
+		}
+		timestamps.Advance(3000);
+	}
+	for (int i = 0; i < 2; i++)
+	{
+		WL::GpuZone bloom(L"Bloom");
+		timestamps.Advance(500);
+	}
+	if (bDisjoint)
+		timestamps.SetDisjoint();
+	profiler.EndFrame();
+}
+
+static bool CheckStage(const char* strCase, const wchar_t* strName, double fExpected)
+{
+	double fTime = 0.0;
+	bool bFound = WL::GpuProfiler::Get().GetStageTime(strName, &fTime);
+	bool bOk = bFound && fabs(fTime - fExpected) < MAX_ERROR;
+
+	char strDetail[96];
+	sprintf(strDetail, "%ls took %.6f ms, expected %.6f", strName, fTime, fExpected);
+	Report(bOk, strCase, strDetail);
+	return bOk;
+}
+
+static void TestStageTimes()
+{
+	WL::GpuProfiler& profiler = WL::GpuProfiler::Get();
+	CountingTimestamps timestamps(2);
+	profiler.SetTimestamps(&timestamps);
+
+	unsigned int nTimed = profiler.GetStats().nFramesTimed;
+	unsigned int nSkipped = profiler.GetStats().nFramesSkipped;
+
+	// The first frame comes back when the ring has gone round once
+	for (int i = 0; i < WL::GpuProfiler::MAX_FRAMES; i++)
+		DrawFrame(timestamps);
+	Report(profiler.GetStats().nFramesTimed == nTimed && timestamps.m_nReads == 0, "ring", "nothing read while it fills");
+
+	DrawFrame(timestamps);
+	char strDetail[96];
+	sprintf(strDetail, "%u timed, %u skipped", profiler.GetStats().nFramesTimed - nTimed, profiler.GetStats().nFramesSkipped - nSkipped);
+	Report(profiler.GetStats().nFramesTimed == nTimed + 1 && profiler.GetStats().nFramesSkipped == nSkipped, "read back", strDetail);
+
+	CheckStage("stage time", L"Scene", SCENE_MS);
+	CheckStage("nested stage time", L"Sky", SKY_MS);
+	CheckStage("repeated stage time", L"Bloom", BLOOM_MS);
+
+	sprintf(strDetail, "%.6f ms, expected %.6f", profiler.GetFrameTime(), FRAME_MS);
+	Report(fabs(profiler.GetFrameTime() - FRAME_MS) < MAX_ERROR, "frame time", strDetail);
+
+	// In the order they began, Sky one deeper than the others, Bloom counted twice
+	bool bOrder = profiler.GetStageCount() == 3 &&
+				  profiler.GetStage(0).nDepth == 0 && wcscmp(profiler.GetStage(0).strName, L"Scene") == 0 &&
+				  profiler.GetStage(1).nDepth == 1 && wcscmp(profiler.GetStage(1).strName, L"Sky") == 0 &&
+				  profiler.GetStage(2).nDepth == 0 && profiler.GetStage(2).nCalls == 2;
+	Report(bOrder, "stages", "in the order they began, with their depth and calls");
+
+	profiler.SetTimestamps(NULL);
+}
+
+static void TestPendingSkipped()
+{
+	WL::GpuProfiler& profiler = WL::GpuProfiler::Get();
+
+	// Frames come back 6 frames late, the ring only holds 4
+	CountingTimestamps timestamps(6);
+	profiler.SetTimestamps(&timestamps);
+
+	unsigned int nTimed = profiler.GetStats().nFramesTimed;
+	unsigned int nSkipped = profiler.GetStats().nFramesSkipped;
+
+	for (int i = 0; i < WL::GpuProfiler::MAX_FRAMES; i++)
+		DrawFrame(timestamps);
+
+	// The oldest frame isn't done, this one goes untimed after asking once
+	DrawFrame(timestamps);
+	bool bSkipped = profiler.GetStats().nFramesSkipped == nSkipped + 1 && profiler.GetStats().nFramesTimed == nTimed;
+	char strDetail[96];
+	sprintf(strDetail, "%d reads, %d pending", timestamps.m_nReads, timestamps.m_nPending);
+	Report(bSkipped && timestamps.m_nReads == 1 && timestamps.m_nPending == 1, "pending frame skipped", strDetail);
+
+	// Keeps asking once a frame until the GPU catches up, and the times are the same
+	int nFrames = 0;
+	while (profiler.GetStats().nFramesTimed == nTimed && nFrames < 16)
+	{
+		DrawFrame(timestamps);
+		nFrames++;
+	}
+	sprintf(strDetail, "timed after %d more frames, %d reads for %d frames", nFrames, timestamps.m_nReads, nFrames + 1);
+	Report(profiler.GetStats().nFramesTimed == nTimed + 1 && timestamps.m_nReads == nFrames + 1, "pending frame read later", strDetail);
+	CheckStage("stage time after skipping", L"Scene", SCENE_MS);
+
+	profiler.SetTimestamps(NULL);
+}
+
+static void TestDisjointDropped()
+{
+	WL::GpuProfiler& profiler = WL::GpuProfiler::Get();
+	CountingTimestamps timestamps(2);
+	profiler.SetTimestamps(&timestamps);
+
+	unsigned int nTimed = profiler.GetStats().nFramesTimed;
+	unsigned int nDropped = profiler.GetStats().nFramesDropped;
+
+	// The second frame ran while the GPU clock changed speed
+	for (int i = 0; i < WL::GpuProfiler::MAX_FRAMES; i++)
+		DrawFrame(timestamps, i == 1);
+
+	DrawFrame(timestamps);
+	DrawFrame(timestamps);
+	char strDetail[96];
+	sprintf(strDetail, "%u timed, %u dropped", profiler.GetStats().nFramesTimed - nTimed, profiler.GetStats().nFramesDropped - nDropped);
+	Report(profiler.GetStats().nFramesTimed == nTimed + 1 && profiler.GetStats().nFramesDropped == nDropped + 1, "disjoint frame dropped", strDetail);
+
+	// What is shown is still the frame before
+	CheckStage("stage time kept", L"Scene", SCENE_MS);
+
+	DrawFrame(timestamps);
+	sprintf(strDetail, "%u timed", profiler.GetStats().nFramesTimed - nTimed);
+	Report(profiler.GetStats().nFramesTimed == nTimed + 2, "frame after disjoint", strDetail);
+
+	profiler.SetTimestamps(NULL);
+}
+
+static void TestNoTimestamps()
+{
+	WL::GpuProfiler& profiler = WL::GpuProfiler::Get();
+	profiler.SetTimestamps(NULL);
+
+	unsigned int nLost = profiler.GetStats().nStagesLost;
+	profiler.BeginFrame();
+	{
+		WL::GpuZone scene(L"Scene");
+	}
+	profiler.EndFrame();
+	Report(!profiler.IsTiming() && profiler.GetStats().nStagesLost == nLost, "no timestamps", "stages are not timed");
+}
+
+int main()
+{
+	TestStageTimes();
+	TestPendingSkipped();
+	TestDisjointDropped();
+	TestNoTimestamps();
+
+	printf(s_nFailures ? "FAILED\n" : "PASSED\n");
+	return s_nFailures ? 1 : 0;
+}
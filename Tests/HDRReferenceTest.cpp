@@ -0,0 +1,185 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: HDRReferenceTest.cpp
+//
+// Author: snez
+//
+// Desc: Runs the CPU reference of the HDR chain over the scene in the data folder and
+//       compares the results against the golden images next to it. Every pixel has to
+//       be within MAX_ERROR of the golden one, and the images as a whole within
+//       MAX_RMS_ERROR. The chain is also run on a thread pool, which has to give the
+//       same images, and the time of every stage is printed.
+//
+//       HDRReferenceTest <data folder> [-update] writes the golden images again, after a
+//       change to the chain that is meant to change its output.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "WLHDRReference.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+
+#define MAX_ERROR			1e-3f		// Any channel of any pixel
+#define MAX_RMS_ERROR		1e-4f
+#define BENCHMARK_FRAMES	20
+
+static std::string s_strData;
+static bool s_bUpdate = false;
+static int s_nFailures = 0;
+
+static std::string DataPath(const char* strFile)
+{
+	return s_strData + "/" + strFile;
+}
+
+//
+//	A cross of four lines, like the GlareDef "Cross" star
+//
+static void SetupStar(WL::HDRReferenceSettings& settings)
+{
+	settings.bStar = true;
+	settings.nStarLines = 4;
+	for (int i = 0; i < settings.nStarLines; i++)
+	{
+		settings.aStarLines[i].nPasses = 3;
+		settings.aStarLines[i].fSampleLength = 1.0f;
+		settings.aStarLines[i].fAttenuation = 0.85f;
+		settings.aStarLines[i].fInclination = 3.14159265f / 4.0f + i * 3.14159265f / 2.0f;
+	}
+}
+
+static void Check(const char* strCase, const char* strGolden, const WL::FloatImage& image)
+{
+	if (s_bUpdate)
+	{
+		if (!image.SavePFM(DataPath(strGolden).c_str()))
+		{
+			printf("FAIL %s: could not write %s\n", strCase, strGolden);
+			s_nFailures++;
+		}
+		return;
+	}
+
+	WL::FloatImage golden;
+	float fMaxError, fRMSError;
+	if (!golden.LoadPFM(DataPath(strGolden).c_str()))
+	{
+		printf("FAIL %s: no golden image %s\n", strCase, strGolden);
+		s_nFailures++;
+	}
+	else if (!WL::CompareImages(image, golden, &fMaxError, &fRMSError))
+	{
+		printf("FAIL %s: %dx%d, the golden image is %dx%d\n", strCase, image.GetWidth(), image.GetHeight(),
+			   golden.GetWidth(), golden.GetHeight());
+		s_nFailures++;
+	}
+	else if (!(fMaxError <= MAX_ERROR && fRMSError <= MAX_RMS_ERROR))
+	{
+		printf("FAIL %s: max error %g, rms %g against %s\n", strCase, fMaxError, fRMSError, strGolden);
+		s_nFailures++;
+	}
+	else
+	{
+		printf("ok   %s: max error %g, rms %g\n", strCase, fMaxError, fRMSError);
+	}
+}
+
+static void CheckSame(const char* strCase, const WL::FloatImage& a, const WL::FloatImage& b)
+{
+	float fMaxError, fRMSError;
+	if (!WL::CompareImages(a, b, &fMaxError, &fRMSError) || fMaxError > MAX_ERROR)
+	{
+		printf("FAIL %s: threaded and serial results differ\n", strCase);
+		s_nFailures++;
+	}
+	else
+	{
+		printf("ok   %s: threaded matches serial, max error %g\n", strCase, fMaxError);
+	}
+}
+
+static void PrintTimings(const char* strCase, const WL::HDRReference::Stats& stats)
+{
+	printf("     %s, %d frames: scale %.3f, luminance %.3f, bright pass %.3f, bloom %.3f, star %.3f, final %.3f, total %.3f ms\n",
+		   strCase, BENCHMARK_FRAMES, stats.fScale, stats.fLuminance, stats.fBrightPass, stats.fBloom,
+		   stats.fStar, stats.fFinal, stats.fTotal);
+}
+
+//
+//	Runs one setup of the chain from a fixed adaptation, so the first frame is the same
+//	every time, and checks its final image and the bloom and star it was given goldens for
+//
+static void RunCase(const char* strCase, const WL::FloatImage& scene, const WL::HDRReferenceSettings& settings,
+					WL::ThreadPool& pool, const char* strFinalGolden, const char* strBloomGolden, const char* strStarGolden)
+{
+	WL::HDRReference serial, threaded;
+	WL::FloatImage serialOutput, threadedOutput;
+
+	serial.ResetAdaptation(0.2f);
+	threaded.ResetAdaptation(0.2f);
+	threaded.SetThreadPool(&pool);
+
+	if (!serial.Process(scene, settings, &serialOutput) || !threaded.Process(scene, settings, &threadedOutput))
+	{
+		printf("FAIL %s: the chain did not run\n", strCase);
+		s_nFailures++;
+		return;
+	}
+
+	std::string strName(strCase);
+	Check((strName + " final").c_str(), strFinalGolden, serialOutput);
+	if (strBloomGolden)
+		Check((strName + " bloom").c_str(), strBloomGolden, serial.GetBloom());
+	if (strStarGolden)
+		Check((strName + " star").c_str(), strStarGolden, serial.GetStar());
+	CheckSame(strCase, serialOutput, threadedOutput);
+
+	PrintTimings((strName + " serial").c_str(), WL::BenchmarkHDRReference(serial, scene, settings, BENCHMARK_FRAMES));
+	PrintTimings((strName + " threaded").c_str(), WL::BenchmarkHDRReference(threaded, scene, settings, BENCHMARK_FRAMES));
+}
+
+int main(int argc, char** argv)
+{
+	if (argc < 2)
+	{
+		printf("HDRReferenceTest <data folder> [-update]\n");
+		return 2;
+	}
+	s_strData = argv[1];
+	s_bUpdate = argc > 2 && strcmp(argv[2], "-update") == 0;
+
+	WL::FloatImage scene;
+	if (!scene.LoadPFM(DataPath("hdr_scene.pfm").c_str()))
+	{
+		printf("FAIL: no hdr_scene.pfm in %s\n", s_strData.c_str());
+		return 1;
+	}
+
+	WL::ThreadPool pool;
+	if (!pool.Start(3))
+	{
+		printf("FAIL: could not start the thread pool\n");
+		return 1;
+	}
+
+	// The Gaussian bloom and the star, with average exposure
+	WL::HDRReferenceSettings gaussian;
+	gaussian.bDualFilterBloom = false;
+	SetupStar(gaussian);
+	RunCase("gaussian", scene, gaussian, pool, "hdr_gaussian_final.pfm", "hdr_gaussian_bloom.pfm", "hdr_gaussian_star.pfm");
+
+	// The dual filter bloom with histogram exposure, without the star
+	WL::HDRReferenceSettings dual;
+	dual.bHistogram = true;
+	RunCase("dual filter", scene, dual, pool, "hdr_dual_final.pfm", "hdr_dual_bloom.pfm", NULL);
+
+	pool.Stop();
+
+	if (s_bUpdate)
+		printf("%s golden images\n", s_nFailures ? "Failed to write the" : "Wrote the");
+	else
+		printf("%s\n", s_nFailures ? "FAILED" : "PASSED");
+	return s_nFailures ? 1 : 0;
+}
@@ -0,0 +1,194 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: HDRTablesTest.cpp
+//
+// Author: snez
+//
+// Desc: Checks the constant tables HDRSun and the CPU reference share. The Gaussian
+//       kernels are worked out again with expf, the way HDRLighting used to every pass,
+//       and have to agree with the tables to float precision. The star library has to
+//       lay its lines out the way CStarDef does for the generic and sunny cross stars.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "WLHDRReference.h"
+#include <float.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define MAX_ULPS	4.0f		// Relative error allowed, in float epsilons
+
+static const float PI = 3.141592654f;		// D3DX_PI
+
+static int s_nFailures = 0;
+
+static void Report(bool bOk, const char* strCase, const char* strDetail)
+{
+	printf("%s %s: %s\n", bOk ? "ok  " : "FAIL", strCase, strDetail);
+	if (!bOk)
+		s_nFailures++;
+}
+
+static bool Close(float a, float b)
+{
+	return fabsf(a - b) <= MAX_ULPS * FLT_EPSILON * fabsf(b);
+}
+
+//
+//	GaussianDistribution() of the HDRLighting sample
+//
+static float Gaussian(float x, float y, float rho)
+{
+	float g = 1.0f / sqrtf(2.0f * PI * rho * rho);
+	g *= expf(-(x * x + y * y) / (2 * rho * rho));
+	return g;
+}
+
+static void TestBloomKernel()
+{
+	int nWrong = 0;
+	for (int i = 0; i < 8; i++)
+	{
+		float fExpected = Gaussian((float)i, 0.0f, 3.0f);
+		if (!Close(WL::HDR_BLOOM_KERNEL[i], fExpected))
+		{
+			printf("     bloom %d: %.9g instead of %.9g\n", i, WL::HDR_BLOOM_KERNEL[i], fExpected);
+			nWrong++;
+		}
+	}
+
+	char strDetail[64];
+	sprintf(strDetail, "%d of 8 weights wrong", nWrong);
+	Report(nWrong == 0, "bloom kernel", strDetail);
+}
+
+static void TestBlurKernel()
+{
+	// The taps no further than 2 apart in block distance, x then y, as HDRSun hands
+	// them to the shader
+	float afWeight[13];
+	int nTaps = 0;
+	bool bLayout = true;
+	float fTotal = 0.0f;
+	for (int x = -2; x <= 2; x++)
+	{
+		for (int y = -2; y <= 2; y++)
+		{
+			if (abs(x) + abs(y) > 2)
+				continue;
+
+			const WL::KernelSample& sample = WL::HDR_GAUSS_BLUR_5X5_KERNEL[nTaps];
+			if (sample.x != x || sample.y != y)
+			{
+				printf("     blur %d: at %d,%d instead of %d,%d\n", nTaps, sample.x, sample.y, x, y);
+				bLayout = false;
+			}
+
+			afWeight[nTaps] = Gaussian((float)x, (float)y, 1.0f);
+			fTotal += afWeight[nTaps];
+			nTaps++;
+		}
+	}
+
+	char strDetail[64];
+	sprintf(strDetail, "%d taps", nTaps);
+	Report(bLayout && nTaps == 13, "blur kernel layout", strDetail);
+
+	int nWrong = 0;
+	float fSum = 0.0f;
+	for (int i = 0; i < 13; i++)
+	{
+		float fExpected = afWeight[i] / fTotal;
+		float fWeight = WL::HDR_GAUSS_BLUR_5X5_KERNEL[i].fWeight;
+		if (!Close(fWeight, fExpected))
+		{
+			printf("     blur %d: %.9g instead of %.9g\n", i, fWeight, fExpected);
+			nWrong++;
+		}
+		fSum += fWeight;
+	}
+	sprintf(strDetail, "%d of 13 weights wrong", nWrong);
+	Report(nWrong == 0, "blur kernel weights", strDetail);
+
+	// Rounding every weight may cost an epsilon each
+	sprintf(strDetail, "weights add up to %.9g", fSum);
+	Report(fabsf(fSum - 1.0f) <= 13 * FLT_EPSILON, "blur kernel normalised", strDetail);
+}
+
+//
+//	The generic stars of CStarDef::Initialize(), nLines lines at even angles
+//
+static void TestEvenStar(const char* strCase, int nType, int nLines, float fAttenuation)
+{
+	const WL::HDRStarLib& lib = WL::HDR_STAR_LIB[nType];
+	bool bOk = lib.nStarLines == nLines && lib.pStarLine != NULL;
+	float fInc = (360.0f / (float)nLines) * (PI / 180.0f);
+	for (int i = 0; bOk && i < nLines; i++)
+	{
+		const WL::HDRStarLine& line = lib.pStarLine[i];
+		bOk = line.nPasses == 3 && line.fSampleLength == 1.0f && line.fAttenuation == fAttenuation &&
+			  fabsf(line.fInclination - fInc * (float)i) <= MAX_ULPS * FLT_EPSILON * 2 * PI;
+		if (!bOk)
+			printf("     line %d: %d passes, %g long, %g attenuation, %.9g radians\n",
+				   i, line.nPasses, line.fSampleLength, line.fAttenuation, line.fInclination);
+	}
+
+	char strDetail[64];
+	sprintf(strDetail, "%d lines", lib.nStarLines);
+	Report(bOk, strCase, strDetail);
+}
+
+//
+//	CStarDef::Initialize_SunnyCrossFilter() with its defaults
+//
+static void TestSunnyCross()
+{
+	const WL::HDRStarLib& lib = WL::HDR_STAR_LIB[5];
+	bool bOk = lib.nStarLines == 8 && !lib.bRotation;
+	float fInc = (360.0f / 8.0f) * (PI / 180.0f);
+	for (int i = 0; bOk && i < 8; i++)
+	{
+		const WL::HDRStarLine& line = lib.pStarLine[i];
+		float fAttenuation = i % 2 == 0 ? 0.95f : 0.88f;
+		bOk = line.nPasses == 3 && line.fSampleLength == 1.0f && line.fAttenuation == fAttenuation &&
+			  fabsf(line.fInclination - fInc * (float)i) <= MAX_ULPS * FLT_EPSILON * 2 * PI;
+	}
+	Report(bOk, "sunny cross star", "long and short lines alternate");
+}
+
+static void TestStarLib()
+{
+	Report(WL::HDR_STAR_LIB[0].nStarLines == 0, "disabled star", "no lines");
+
+	TestEvenStar("cross star", 1, 4, 0.85f);
+	TestEvenStar("cross filter star", 2, 4, 0.95f);
+	TestEvenStar("snow cross star", 3, 6, 0.96f);
+	TestEvenStar("vertical star", 4, 2, 0.96f);
+	TestSunnyCross();
+
+	bool bFits = true;
+	for (int i = 0; i < HDR_STAR_LIB_TYPES; i++)
+		bFits = bFits && WL::HDR_STAR_LIB[i].nStarLines <= HDR_MAX_STAR_LINES;
+	Report(bFits, "star lines", "every star fits HDR_MAX_STAR_LINES");
+
+	bool bColors = true;
+	for (int s = 0; s < 8; s++)
+	{
+		for (int c = 0; c < 3; c++)
+			bColors = bColors && WL::HDR_CHROMATIC_ABERRATION_COLOR[s][c] > 0.0f &&
+					  WL::HDR_CHROMATIC_ABERRATION_COLOR[s][c] <= 1.0f;
+		bColors = bColors && WL::HDR_CHROMATIC_ABERRATION_COLOR[s][3] == 0.0f;
+	}
+	Report(bColors, "chromatic aberration", "colors within 0..1, no alpha");
+}
+
+int main()
+{
+	TestBloomKernel();
+	TestBlurKernel();
+	TestStarLib();
+
+	printf(s_nFailures ? "FAILED\n" : "PASSED\n");
+	return s_nFailures ? 1 : 0;
+}
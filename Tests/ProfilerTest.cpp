@@ -0,0 +1,283 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: ProfilerTest.cpp
+//
+// Author: snez
+//
+// Desc: Runs the CPU profiler's zones and checks what EndFrame() makes of them: nested
+//       zones keep their depth and order, every thread gets its own zones, and the
+//       Chrome trace holds the events of the rings. Last a thread writes zones as fast
+//       as it can, lapping its ring many times over, while this one collects frames;
+//       every event collected has to be whole and none may be counted twice.
+//
+//       ProfilerTest [trace.json] leaves the trace in the file given.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "WLProfiler.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <wchar.h>
+
+#define WORKER_ZONES	100
+#define LAP_ROUNDS		64			// Times the lapping thread goes round its ring
+
+static int s_nFailures = 0;
+
+static void Report(bool bOk, const char* strCase, const char* strDetail)
+{
+	printf("%s %s: %s\n", bOk ? "ok  " : "FAIL", strCase, strDetail);
+	if (!bOk)
+		s_nFailures++;
+}
+
+//
+//	Something for a zone to time
+//
+static void Spin(double fSeconds)
+{
+	double fEnd = WL::GetTimeSeconds() + fSeconds;
+	while (WL::GetTimeSeconds() < fEnd)
+		;
+}
+
+static const WL::Profiler::Zone* FindZone(const wchar_t* strName, int nDepth)
+{
+	WL::Profiler& profiler = WL::Profiler::Get();
+	for (int i = 0; i < profiler.GetZoneCount(); i++)
+	{
+		const WL::Profiler::Zone& zone = profiler.GetZone(i);
+		if (zone.nDepth == nDepth && wcscmp(zone.strName, strName) == 0)
+			return &zone;
+	}
+	return NULL;
+}
+
+static int FindZoneIndex(const wchar_t* strName)
+{
+	WL::Profiler& profiler = WL::Profiler::Get();
+	for (int i = 0; i < profiler.GetZoneCount(); i++)
+		if (wcscmp(profiler.GetZone(i).strName, strName) == 0)
+			return i;
+	return -1;
+}
+
+static void TestNested()
+{
+	WL::Profiler& profiler = WL::Profiler::Get();
+	profiler.EndFrame();
+
+	{
+		WL::ProfileZone outer(L"Outer");
+		Spin(0.001);
+		for (int i = 0; i < 3; i++)
+		{
+			WL::ProfileZone inner(L"Inner");
+			Spin(0.001);
+		}
+	}
+	profiler.EndFrame();
+
+	const WL::Profiler::Zone* pOuter = FindZone(L"Outer", 0);
+	const WL::Profiler::Zone* pInner = FindZone(L"Inner", 1);
+	char strDetail[128];
+	sprintf(strDetail, "%d zones", profiler.GetZoneCount());
+	Report(profiler.GetZoneCount() == 2 && pOuter && pInner, "nested zones", strDetail);
+	if (!pOuter || !pInner)
+		return;
+
+	sprintf(strDetail, "outer %u calls %.3f ms, inner %u calls %.3f ms", pOuter->nCalls, pOuter->fTime, pInner->nCalls, pInner->fTime);
+	Report(pOuter->nCalls == 1 && pInner->nCalls == 3 && pInner->fTime >= 3.0 && pInner->fTime <= pOuter->fTime, "nested times", strDetail);
+	Report(FindZoneIndex(L"Outer") < FindZoneIndex(L"Inner") && pOuter->fFirstStart <= pInner->fFirstStart, "nested order", "parent before children");
+	Report(profiler.GetFrameTime() >= pOuter->fTime, "frame time", "at least the zones in it");
+}
+
+static void Worker(void*)
+{
+	for (int i = 0; i < WORKER_ZONES; i++)
+	{
+		WL::ProfileZone zone(L"Worker");
+	}
+}
+
+static void TestThreads()
+{
+	WL::Profiler& profiler = WL::Profiler::Get();
+	profiler.EndFrame();
+
+	WL::Thread thread;
+	thread.Start(Worker, NULL);
+	{
+		WL::ProfileZone zone(L"Main");
+		Spin(0.001);
+	}
+	thread.Join();
+	profiler.EndFrame();
+
+	const WL::Profiler::Zone* pMain = FindZone(L"Main", 0);
+	const WL::Profiler::Zone* pWorker = FindZone(L"Worker", 0);
+	bool bOk = pMain && pWorker && pMain->iThread != pWorker->iThread && pMain->nCalls == 1 && pWorker->nCalls == WORKER_ZONES;
+
+	char strDetail[128];
+	sprintf(strDetail, "main on thread %d, %u worker zones on thread %d",
+			pMain ? pMain->iThread : -1, pWorker ? pWorker->nCalls : 0, pWorker ? pWorker->iThread : -1);
+	Report(bOk, "two threads", strDetail);
+
+	// Zones of a thread are listed together, in the order the threads first profiled
+	bool bGrouped = true;
+	for (int i = 1; i < profiler.GetZoneCount(); i++)
+		bGrouped = bGrouped && profiler.GetZone(i - 1).iThread <= profiler.GetZone(i).iThread;
+	Report(bGrouped, "threads grouped", "zones sorted by thread");
+}
+
+static int CountOccurrences(const char* strText, const char* strWhat)
+{
+	int n = 0;
+	for (const char* p = strstr(strText, strWhat); p; p = strstr(p + 1, strWhat))
+		n++;
+	return n;
+}
+
+static void TestChromeTrace(const char* strPath)
+{
+	WL::Profiler& profiler = WL::Profiler::Get();
+	{
+		WL::ProfileZone zone(L"Say \"cheese\"");
+	}
+
+	wchar_t strFileName[260];
+	size_t n = 0;
+	for (; strPath[n] && n < 259; n++)
+		strFileName[n] = (wchar_t)strPath[n];
+	strFileName[n] = 0;
+
+	bool bWritten = profiler.WriteChromeTrace(strFileName);
+	Report(bWritten, "chrome trace", strPath);
+	if (!bWritten)
+		return;
+
+	FILE* pFile = fopen(strPath, "rb");
+	if (pFile == NULL)
+	{
+		Report(false, "chrome trace", "could not be read back");
+		return;
+	}
+	fseek(pFile, 0, SEEK_END);
+	long nSize = ftell(pFile);
+	fseek(pFile, 0, SEEK_SET);
+	char* strText = (char*)malloc(nSize + 1);
+	size_t nRead = fread(strText, 1, nSize, pFile);
+	strText[nRead] = 0;
+	fclose(pFile);
+
+	// The rings hold every event so far, none of them has wrapped yet
+	int nEvents = CountOccurrences(strText, "\"ph\":\"X\"");
+	int nExpected = 1 + 3 + WORKER_ZONES + 1 + 1;
+	char strDetail[128];
+	sprintf(strDetail, "%d events, expected %d", nEvents, nExpected);
+	Report(nEvents == nExpected, "trace events", strDetail);
+
+	bool bShape = strncmp(strText, "{\"traceEvents\":[", 16) == 0 && strstr(strText, "\"displayTimeUnit\":\"ms\"}") != NULL &&
+				  CountOccurrences(strText, "\"name\":\"thread_name\"") >= 2;
+	Report(bShape, "trace format", "events and thread names in a traceEvents array");
+	Report(strstr(strText, "\"name\":\"Say \\\"cheese\\\"\"") != NULL, "trace names", "quotes escaped");
+	Report(CountOccurrences(strText, "\"name\":\"Inner\"") == 3, "trace nested", "every call of a zone is an event");
+
+	free(strText);
+}
+
+//
+//	A cycle of three events of different depths, which doesn't divide RING_SIZE, so an
+//	event and the one that laps it in its slot never have the same name and depth. An
+//	event put together from the two shows up as a zone at the wrong depth.
+//
+static volatile long s_nLapDone = 0;
+static long s_nLapEvents = 0;
+
+static const wchar_t* const LAP_NAMES[3] = { L"LapOuter", L"LapMiddle", L"LapInner" };
+
+static void Lapper(void*)
+{
+	int nCycles = LAP_ROUNDS * WL::Profiler::RING_SIZE / 3;
+	for (int i = 0; i < nCycles; i++)
+	{
+		WL::ProfileZone outer(LAP_NAMES[0]);
+		WL::ProfileZone middle(LAP_NAMES[1]);
+		WL::ProfileZone inner(LAP_NAMES[2]);
+	}
+	s_nLapEvents = 3 * nCycles;
+	WL::AtomicIncrement(&s_nLapDone);
+}
+
+static void TestLapping()
+{
+	WL::Profiler& profiler = WL::Profiler::Get();
+	profiler.EndFrame();
+
+	WL::Thread thread;
+	thread.Start(Lapper, NULL);
+
+	long nCollected = 0;
+	int nFrames = 0;
+	int nBad = 0;
+	unsigned int nMostInFrame = 0;
+	bool bDone = false;
+	while (!bDone)
+	{
+		bDone = WL::AtomicRead(&s_nLapDone) != 0;
+		profiler.EndFrame();
+		nFrames++;
+
+		unsigned int nInFrame = 0;
+		for (int i = 0; i < profiler.GetZoneCount(); i++)
+		{
+			const WL::Profiler::Zone& zone = profiler.GetZone(i);
+			int iName = 0;
+			while (iName < 3 && wcscmp(zone.strName, LAP_NAMES[iName]) != 0)
+				iName++;
+			if (iName == 3)
+				continue;
+
+			if (zone.nDepth != iName || zone.fTime < 0.0)
+			{
+				printf("     frame %d: %ls at depth %d, %.6f ms\n", nFrames, zone.strName, zone.nDepth, zone.fTime);
+				nBad++;
+			}
+			nInFrame += zone.nCalls;
+		}
+		nCollected += nInFrame;
+		if (nInFrame > nMostInFrame)
+			nMostInFrame = nInFrame;
+	}
+	thread.Join();
+
+	char strDetail[128];
+	sprintf(strDetail, "%ld of %ld events in %d frames, %d torn", nCollected, s_nLapEvents, nFrames, nBad);
+	Report(nBad == 0, "lapped ring", strDetail);
+	Report(nCollected > 0 && nCollected <= s_nLapEvents, "lapped events", "none counted twice");
+
+	sprintf(strDetail, "at most %u of %d in a frame", nMostInFrame, (int)WL::Profiler::RING_SIZE);
+	Report(nMostInFrame <= WL::Profiler::RING_SIZE, "lapped frame", strDetail);
+
+	// Once the writer stops, the next frame starts from a whole ring again
+	profiler.EndFrame();
+	Report(FindZone(LAP_NAMES[0], 0) == NULL, "after lapping", "nothing collected twice");
+}
+
+int main(int argc, char* argv[])
+{
+	const char* strTrace = argc > 1 ? argv[1] : "ProfilerTest.json";
+
+	WL::Profiler::Get().SetEnabled(true);
+
+	TestNested();
+	TestThreads();
+	TestChromeTrace(strTrace);
+	TestLapping();
+
+	WL::Profiler::Get().SetEnabled(false);
+
+	printf(s_nFailures ? "FAILED\n" : "PASSED\n");
+	return s_nFailures ? 1 : 0;
+}
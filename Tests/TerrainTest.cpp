@@ -0,0 +1,308 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: TerrainTest.cpp
+//
+// Author: snez
+//
+// Desc: Checks the procedural planet terrain without a device. The chunks have to meet
+//       without gaps, between neighbours, faces and levels of the quadtree, their triangles
+//       and normals have to face away from the planet, and a dive from orbit down to the
+//       ground has to fill the memory budget without going over, go deeper with a larger
+//       one, and stop generating chunks once the camera stops. The dive is run with the
+//       chunks generated inline and on workers.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "WLTerrain.h"
+#include "WLPlatform.h"
+#include <math.h>
+#include <stdio.h>
+
+#define SEAM_TOLERANCE		1e-4f		// Planet space, the radius is 50
+#define NORMAL_TOLERANCE	1e-3f		// Between neighbours of the same level
+#define DIVE_FRAMES			400
+#define STILL_FRAMES		40			// Frames the camera stays put after the dive
+#define DIVE_BUDGET			(2u * 1024 * 1024)
+
+static const int N = TERRAIN_CHUNK_GRID;
+static int s_nFailures = 0;
+
+static void Fail(const char* strTest, const char* strWhat, float fValue)
+{
+	printf("FAIL %s: %s (%g)\n", strTest, strWhat, fValue);
+	s_nFailures++;
+}
+
+static inline float Dot(const float a[3], const float b[3])
+{
+	return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+static void GetPosition(const WL::TerrainChunkData& data, int i, int j, float vPosition[3])
+{
+	const WL::TerrainVertex& vertex = data.aVertices[j * N + i];
+	vPosition[0] = vertex.x + data.vCenter[0];
+	vPosition[1] = vertex.y + data.vCenter[1];
+	vPosition[2] = vertex.z + data.vCenter[2];
+}
+
+static float Distance(const float a[3], const float b[3])
+{
+	float d[3] = { a[0] - b[0], a[1] - b[1], a[2] - b[2] };
+	return sqrtf(Dot(d, d));
+}
+
+//
+//	Every triangle of the grid faces away from the planet, every skirt triangle away
+//	from the chunk, and every normal points up
+//
+static void CheckWinding(const WL::TerrainSettings& settings)
+{
+	unsigned short aIndices[WL::TerrainChunkData::INDICES];
+	WL::GetTerrainChunkIndices(aIndices);
+
+	const int nGridIndices = 6 * (N - 1) * (N - 1);
+	int nBadGrid = 0, nBadSkirt = 0, nBadNormals = 0;
+	static WL::TerrainChunkData data;
+
+	for (int nFace = 0; nFace < TERRAIN_FACES; nFace++)
+	{
+		for (int nLevel = 0; nLevel <= 4; nLevel += 2)
+		{
+			WL::TerrainChunkKey key = { nFace, nLevel, (1 << nLevel) / 3, (1 << nLevel) / 2 };
+			WL::GenerateTerrainChunk(settings, key, &data);
+
+			for (int t = 0; t < WL::TerrainChunkData::INDICES; t += 3)
+			{
+				const WL::TerrainVertex& a = data.aVertices[aIndices[t]];
+				const WL::TerrainVertex& b = data.aVertices[aIndices[t + 1]];
+				const WL::TerrainVertex& c = data.aVertices[aIndices[t + 2]];
+				float u[3] = { b.x - a.x, b.y - a.y, b.z - a.z };
+				float v[3] = { c.x - a.x, c.y - a.y, c.z - a.z };
+				float n[3] = { u[1] * v[2] - u[2] * v[1], u[2] * v[0] - u[0] * v[2], u[0] * v[1] - u[1] * v[0] };
+				float m[3] = { (a.x + b.x + c.x) / 3.0f, (a.y + b.y + c.y) / 3.0f, (a.z + b.z + c.z) / 3.0f };
+
+				if (t < nGridIndices)
+				{
+					float vUp[3] = { m[0] + data.vCenter[0], m[1] + data.vCenter[1], m[2] + data.vCenter[2] };
+					if (Dot(n, vUp) <= 0.0f)
+						nBadGrid++;
+				}
+				else
+				{
+					// Away from the chunk center, along the ground
+					float r = Dot(m, data.vCenter) / Dot(data.vCenter, data.vCenter);
+					for (int i = 0; i < 3; i++)
+						m[i] -= r * data.vCenter[i];
+					if (Dot(n, m) <= 0.0f)
+						nBadSkirt++;
+				}
+			}
+
+			for (int i = 0; i < WL::TerrainChunkData::GRID_VERTICES; i++)
+			{
+				const WL::TerrainVertex& vertex = data.aVertices[i];
+				float vPosition[3], vNormal[3] = { vertex.nx, vertex.ny, vertex.nz };
+				GetPosition(data, i % N, i / N, vPosition);
+				if (Dot(vNormal, vPosition) <= 0.0f)
+					nBadNormals++;
+			}
+		}
+	}
+
+	if (nBadGrid)
+		Fail("winding", "grid triangles facing the planet", (float)nBadGrid);
+	if (nBadSkirt)
+		Fail("winding", "skirt triangles facing the chunk", (float)nBadSkirt);
+	if (nBadNormals)
+		Fail("winding", "normals pointing down", (float)nBadNormals);
+	if (!nBadGrid && !nBadSkirt && !nBadNormals)
+		printf("ok   winding\n");
+}
+
+//
+//	Neighbours on a face share their edge vertices and normals, and a child's even
+//	vertices on its parent's edges are the parent's
+//
+static void CheckSeams(const WL::TerrainSettings& settings)
+{
+	static WL::TerrainChunkData left, right, bottom, top, parent, child;
+	float fPosition = 0.0f, fNormal = 0.0f, fLevels = 0.0f;
+
+	for (int nFace = 0; nFace < TERRAIN_FACES; nFace++)
+	{
+		WL::TerrainChunkKey keyLeft = { nFace, 3, 2, 5 }, keyRight = { nFace, 3, 3, 5 };
+		WL::TerrainChunkKey keyBottom = { nFace, 3, 6, 1 }, keyTop = { nFace, 3, 6, 2 };
+		WL::GenerateTerrainChunk(settings, keyLeft, &left);
+		WL::GenerateTerrainChunk(settings, keyRight, &right);
+		WL::GenerateTerrainChunk(settings, keyBottom, &bottom);
+		WL::GenerateTerrainChunk(settings, keyTop, &top);
+
+		for (int k = 0; k < N; k++)
+		{
+			float a[3], b[3];
+			GetPosition(left, N - 1, k, a);
+			GetPosition(right, 0, k, b);
+			fPosition = fmaxf(fPosition, Distance(a, b));
+			const WL::TerrainVertex& va = left.aVertices[k * N + N - 1];
+			const WL::TerrainVertex& vb = right.aVertices[k * N];
+			fNormal = fmaxf(fNormal, fabsf(va.nx - vb.nx) + fabsf(va.ny - vb.ny) + fabsf(va.nz - vb.nz));
+
+			GetPosition(bottom, k, N - 1, a);
+			GetPosition(top, k, 0, b);
+			fPosition = fmaxf(fPosition, Distance(a, b));
+			const WL::TerrainVertex& vc = bottom.aVertices[(N - 1) * N + k];
+			const WL::TerrainVertex& vd = top.aVertices[k];
+			fNormal = fmaxf(fNormal, fabsf(vc.nx - vd.nx) + fabsf(vc.ny - vd.ny) + fabsf(vc.nz - vd.nz));
+		}
+
+		WL::TerrainChunkKey keyParent = { nFace, 4, 5, 9 };
+		WL::GenerateTerrainChunk(settings, keyParent, &parent);
+		for (int c = 0; c < 4; c++)
+		{
+			WL::GenerateTerrainChunk(settings, keyParent.GetChild(c), &child);
+			int i0 = (c & 1) * (N - 1) / 2, j0 = (c >> 1) * (N - 1) / 2;
+			for (int j = 0; j < N; j += 2)
+			{
+				for (int i = 0; i < N; i += 2)
+				{
+					if (i != 0 && i != N - 1 && j != 0 && j != N - 1)
+						continue;
+					float a[3], b[3];
+					GetPosition(child, i, j, a);
+					GetPosition(parent, i0 + i / 2, j0 + j / 2, b);
+					fLevels = fmaxf(fLevels, Distance(a, b));
+				}
+			}
+		}
+	}
+
+	// Every edge vertex of a face's root chunk is on the edge of another face
+	static WL::TerrainChunkData aRoots[TERRAIN_FACES];
+	for (int nFace = 0; nFace < TERRAIN_FACES; nFace++)
+	{
+		WL::TerrainChunkKey key = { nFace, 0, 0, 0 };
+		WL::GenerateTerrainChunk(settings, key, &aRoots[nFace]);
+	}
+
+	float fFaces = 0.0f;
+	for (int nFace = 0; nFace < TERRAIN_FACES; nFace++)
+	{
+		for (int k = 0; k < 4 * (N - 1); k++)
+		{
+			int e = k / (N - 1), s = k % (N - 1);
+			int i = (e == 0) ? s : (e == 1) ? N - 1 : (e == 2) ? N - 1 - s : 0;
+			int j = (e == 0) ? 0 : (e == 1) ? s : (e == 2) ? N - 1 : N - 1 - s;
+			float a[3];
+			GetPosition(aRoots[nFace], i, j, a);
+
+			float fNearest = 1e30f;
+			for (int nOther = 0; nOther < TERRAIN_FACES; nOther++)
+			{
+				if (nOther == nFace)
+					continue;
+				for (int m = 0; m < 4 * (N - 1); m++)
+				{
+					int f = m / (N - 1), r = m % (N - 1);
+					int x = (f == 0) ? r : (f == 1) ? N - 1 : (f == 2) ? N - 1 - r : 0;
+					int y = (f == 0) ? 0 : (f == 1) ? r : (f == 2) ? N - 1 : N - 1 - r;
+					float b[3];
+					GetPosition(aRoots[nOther], x, y, b);
+					fNearest = fminf(fNearest, Distance(a, b));
+				}
+			}
+			fFaces = fmaxf(fFaces, fNearest);
+		}
+	}
+
+	bool bOk = true;
+	if (fPosition > SEAM_TOLERANCE)		{ Fail("seams", "neighbours apart", fPosition); bOk = false; }
+	if (fNormal > NORMAL_TOLERANCE)		{ Fail("seams", "neighbour normals differ", fNormal); bOk = false; }
+	if (fLevels > SEAM_TOLERANCE)		{ Fail("seams", "child off its parent's edge", fLevels); bOk = false; }
+	if (fFaces > SEAM_TOLERANCE)		{ Fail("seams", "faces apart", fFaces); bOk = false; }
+	if (bOk)
+		printf("ok   seams: neighbours %g, normals %g, levels %g, faces %g\n", fPosition, fNormal, fLevels, fFaces);
+}
+
+//
+//	From 200 above the ground down to under a millimetre, then staying there. The
+//	budget is what stops the splitting, so the chunks fill it and go no deeper than
+//	it holds. Returns the deepest level drawn.
+//
+static int CheckDive(const WL::TerrainSettings& baseSettings, unsigned int nBudget, int nThreads, const char* strTest)
+{
+	WL::TerrainSettings settings = baseSettings;
+	settings.nMemoryBudget = nBudget;
+
+	WL::TerrainQuadtree terrain;
+	if (!terrain.Create(settings, nThreads))
+	{
+		Fail(strTest, "could not create the quadtree", 0.0f);
+		return 0;
+	}
+
+	static WL::TerrainQuadtree::Chunk* apChunks[4096];
+	unsigned int nMostResident = 0, nGeneratedStill = 0;
+	int nDeepest = 0, nEmpty = 0;
+	double fStart = WL::GetTimeSeconds();
+
+	for (int iFrame = 0; iFrame < DIVE_FRAMES + STILL_FRAMES; iFrame++)
+	{
+		int iDive = iFrame < DIVE_FRAMES ? iFrame : DIVE_FRAMES - 1;
+		float fHeight = 200.0f * powf(0.97f, (float)iDive);
+		float vCamera[3] = { 0.0f, 0.0f, settings.fRadius + settings.fHeightScale + fHeight };
+
+		int nChunks = terrain.Select(vCamera, 1000.0f, NULL, apChunks, 4096);
+		if (nThreads >= 0)
+			terrain.Flush();
+
+		const WL::TerrainQuadtree::Stats& stats = terrain.GetStats();
+		// The roots are only there from the second frame
+		if (nChunks == 0 && iFrame > 0)
+			nEmpty++;
+		if (stats.nBytesResident > nMostResident)
+			nMostResident = stats.nBytesResident;
+		if (stats.nDeepestLevel > nDeepest)
+			nDeepest = stats.nDeepestLevel;
+
+		// A few frames for the last requests to arrive, then nothing new
+		if (iFrame == DIVE_FRAMES + STILL_FRAMES / 2)
+			nGeneratedStill = stats.nGenerated;
+	}
+
+	const WL::TerrainQuadtree::Stats& stats = terrain.GetStats();
+	bool bOk = true;
+	if (nMostResident > nBudget)				{ Fail(strTest, "over the memory budget, bytes", (float)nMostResident); bOk = false; }
+	if (nMostResident < nBudget * 9 / 10)		{ Fail(strTest, "stopped splitting inside the budget, bytes", (float)nMostResident); bOk = false; }
+	if (nEmpty)									{ Fail(strTest, "frames with nothing to draw", (float)nEmpty); bOk = false; }
+	if (stats.nGenerated != nGeneratedStill)	{ Fail(strTest, "still generating with the camera still", (float)(stats.nGenerated - nGeneratedStill)); bOk = false; }
+	if (bOk)
+	{
+		printf("ok   %s: %d frames, at most %u KB resident, level %d, %u generated, %u evicted, %.0f ms\n",
+			   strTest, DIVE_FRAMES + STILL_FRAMES, nMostResident / 1024, nDeepest, stats.nGenerated, stats.nEvicted,
+			   (WL::GetTimeSeconds() - fStart) * 1000.0);
+	}
+
+	terrain.Release();
+	return nDeepest;
+}
+
+int main()
+{
+	WL::TerrainSettings settings;
+
+	CheckWinding(settings);
+	CheckSeams(settings);
+	int nInline = CheckDive(settings, DIVE_BUDGET, -1, "dive inline");
+	int nThreaded = CheckDive(settings, DIVE_BUDGET, 2, "dive threaded");
+	if (nInline != nThreaded)
+		Fail("dive", "inline and threaded went to different levels", (float)(nThreaded - nInline));
+
+	// Twice the budget has to go further down
+	int nLarger = CheckDive(settings, 2 * DIVE_BUDGET, 2, "dive, twice the budget");
+	if (nLarger <= nThreaded)
+		Fail("dive", "twice the budget went no deeper, level", (float)nLarger);
+
+	printf("%s\n", s_nFailures ? "FAILED" : "PASSED");
+	return s_nFailures ? 1 : 0;
+}
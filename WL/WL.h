@@ -1,22 +1,46 @@
-// Space Phenomena Library
-
-#ifndef _WL_
-#define _WL_
-
-// Definitions
-#define DEGTORAD(degree) ((D3DX_PI / 180.0f) * (degree)) // converts from degrees to radians
-#define RADTODEG(radian) ((180.0f / D3DX_PI) * (radian)) // converts from radians to degrees
-
-// Library Tools
-#include "WLGeneralObject.h"
-#include "WLUtility.h"
-#include "WLPlanet.h"
-#include "WLComet.h"
-#include "WLSpaceship.h"
-#include "WLStarmap.h"
-#include "WLHDRSun.h"
-
-// Debugging (will be removed after the end of development)
-#include "dxerr9.h"
-
+// Space Phenomena Library
+
+#ifndef _WL_
+#define _WL_
+
+// Definitions
+#define DEGTORAD(degree) ((D3DX_PI / 180.0f) * (degree)) // converts from degrees to radians
+#define RADTODEG(radian) ((180.0f / D3DX_PI) * (radian)) // converts from radians to degrees
+
+// Library Tools
+#include "WLGeneralObject.h"
+#include "WLUtility.h"
+#include "WLPlanet.h"
+#include "WLProceduralPlanet.h"
+#include "WLComet.h"
+#include "WLSpaceship.h"
+#include "WLStarmap.h"
+#include "WLHDRSun.h"
+#include "WLTextureLoader.h"
+#include "WLTextureBaker.h"
+#include "WLAssetCache.h"
+#include "WLEffectCache.h"
+#include "WLEffectParams.h"
+#include "WLStateCache.h"
+#include "WLRenderQueue.h"
+#include "WLD3DTypes.h"
+#include "WLParticleEmitter.h"
+#include "WLSceneSimulation.h"
+#include "WLCommandBuffer.h"
+#include "WLStarmapCommands.h"
+#include "WLSnapshot.h"
+#include "WLThreadPool.h"
+#include "WLProfiler.h"
+#include "WLGpuProfiler.h"
+#include "WLGpuQueries.h"
+#include "WLBenchmark.h"
+#include "WLHeadlessScene.h"
+#include "WLRenderTargetPool.h"
+#include "WLPostProcessGraph.h"
+#include "WLHDRReference.h"
+#include "WLTerrain.h"
+
+// Debugging (will be removed after the end of development)
+#include "dxerr9.h"
+
 #endif
\ No newline at end of file
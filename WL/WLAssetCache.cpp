@@ -0,0 +1,299 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: WLAssetCache.cpp
+//
+// Author: snez
+//
+// Desc: Shared, reference counted meshes, textures and effects.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "WLAssetCache.h"
+
+AssetCache& AssetCache::Get()
+{
+	static AssetCache s_cache;
+	return s_cache;
+}
+
+AssetCache::AssetCache()
+	: m_SharedParams(true)
+{
+	for (int i = 0; i < HASH_SIZE; i++)
+		m_apBuckets[i] = NULL;
+	ZeroMemory(&m_Stats, sizeof(m_Stats));
+	m_pEffectPool = NULL;
+}
+
+AssetCache::~AssetCache()
+{
+	OnDestroyDevice();
+}
+
+//
+//	Builds the lookup path (full and lower case, so different spellings of the same file
+//	meet) and hashes it together with the type and the creation parameter (FNV-1a)
+//
+DWORD AssetCache::MakeKey(EType type, LPCWSTR strFileName, DWORD param, WCHAR* strPath)
+{
+	if (GetFullPathNameW(strFileName, MAX_PATH, strPath, NULL) == 0)
+		StringCchCopyW(strPath, MAX_PATH, strFileName);
+	_wcslwr(strPath);
+
+	DWORD hash = 2166136261;
+	for (const WCHAR* p = strPath; *p; p++)
+		hash = (hash ^ *p) * 16777619;
+	hash = (hash ^ (DWORD)type) * 16777619;
+	hash = (hash ^ param) * 16777619;
+
+	return hash;
+}
+
+AssetCache::Entry* AssetCache::Find(EType type, LPCWSTR strPath, DWORD hash, DWORD param)
+{
+	for (Entry* pEntry = m_apBuckets[hash % HASH_SIZE]; pEntry; pEntry = pEntry->pNext)
+	{
+		if (pEntry->Hash == hash && pEntry->Type == type && pEntry->Param == param &&
+			wcscmp(pEntry->strPath, strPath) == 0)
+			return pEntry;
+	}
+	return NULL;
+}
+
+void AssetCache::Insert(EType type, LPCWSTR strPath, DWORD hash, DWORD param, void* pAsset)
+{
+	Entry* pEntry = new Entry;
+	pEntry->Type = type;
+	pEntry->Param = param;
+	pEntry->Hash = hash;
+	StringCchCopyW(pEntry->strPath, MAX_PATH, strPath);
+	pEntry->pAsset = pAsset;
+	pEntry->pParams = NULL;
+	pEntry->pNext = m_apBuckets[hash % HASH_SIZE];
+	m_apBuckets[hash % HASH_SIZE] = pEntry;
+
+	Count(type, 1);
+}
+
+long AssetCache::AddRefAsset(Entry* pEntry)
+{
+	switch (pEntry->Type)
+	{
+		case TYPE_MESH:		return ((XMesh*)pEntry->pAsset)->AddRef();
+		case TYPE_TEXTURE:	return ((AsyncTexture*)pEntry->pAsset)->AddRef();
+		case TYPE_EFFECT:	return (long)((ID3DXEffect*)pEntry->pAsset)->AddRef();
+	}
+	return 0;
+}
+
+long AssetCache::ReleaseAsset(Entry* pEntry)
+{
+	switch (pEntry->Type)
+	{
+		case TYPE_MESH:		return ((XMesh*)pEntry->pAsset)->Release();
+		case TYPE_TEXTURE:	return ((AsyncTexture*)pEntry->pAsset)->Release();
+		case TYPE_EFFECT:	return (long)((ID3DXEffect*)pEntry->pAsset)->Release();
+	}
+	return 0;
+}
+
+void AssetCache::Count(EType type, int delta)
+{
+	switch (type)
+	{
+		case TYPE_MESH:		m_Stats.nMeshes += delta; break;
+		case TYPE_TEXTURE:	m_Stats.nTextures += delta; break;
+		case TYPE_EFFECT:	m_Stats.nEffects += delta; break;
+	}
+}
+
+//
+//	Drops the cache's reference to an entry that is already unlinked
+//
+void AssetCache::Destroy(Entry* pEntry)
+{
+	if (pEntry->Type == TYPE_EFFECT)
+	{
+		m_SharedParams.RemoveEffect((ID3DXEffect*)pEntry->pAsset);
+		SAFE_DELETE(pEntry->pParams);
+	}
+
+	ReleaseAsset(pEntry);
+	delete pEntry;
+}
+
+XMesh* AssetCache::GetMesh(LPCWSTR strFileName)
+{
+	WCHAR strPath[MAX_PATH];
+	DWORD hash = MakeKey(TYPE_MESH, strFileName, 0, strPath);
+
+	Entry* pEntry = Find(TYPE_MESH, strPath, hash, 0);
+	if (pEntry)
+	{
+		m_Stats.nHits++;
+		AddRefAsset(pEntry);
+		return (XMesh*)pEntry->pAsset;
+	}
+
+	m_Stats.nMisses++;
+	XMesh* pMesh = new XMesh();
+	if (FAILED(pMesh->LoadFile(strFileName)))
+	{
+		pMesh->Release();
+		return NULL;
+	}
+
+	// One reference for the cache, one for the caller
+	pMesh->AddRef();
+	Insert(TYPE_MESH, strPath, hash, 0, pMesh);
+	return pMesh;
+}
+
+AsyncTexture* AssetCache::GetTexture(LPCWSTR strFileName, D3DCOLOR placeholderColor)
+{
+	WCHAR strPath[MAX_PATH];
+	DWORD hash = MakeKey(TYPE_TEXTURE, strFileName, placeholderColor, strPath);
+
+	Entry* pEntry = Find(TYPE_TEXTURE, strPath, hash, placeholderColor);
+	if (pEntry)
+	{
+		m_Stats.nHits++;
+		AddRefAsset(pEntry);
+		return (AsyncTexture*)pEntry->pAsset;
+	}
+
+	m_Stats.nMisses++;
+	AsyncTexture* pTexture = TextureLoader::Get().Load(strFileName, placeholderColor);
+	if (pTexture == NULL)
+		return NULL;
+
+	pTexture->AddRef();
+	Insert(TYPE_TEXTURE, strPath, hash, placeholderColor, pTexture);
+	return pTexture;
+}
+
+ID3DXEffect* AssetCache::GetEffect(LPCWSTR strFileName, DWORD dwShaderFlags)
+{
+	WCHAR strPath[MAX_PATH];
+	DWORD hash = MakeKey(TYPE_EFFECT, strFileName, dwShaderFlags, strPath);
+
+	Entry* pEntry = Find(TYPE_EFFECT, strPath, hash, dwShaderFlags);
+	if (pEntry)
+	{
+		m_Stats.nHits++;
+		AddRefAsset(pEntry);
+		return (ID3DXEffect*)pEntry->pAsset;
+	}
+
+	m_Stats.nMisses++;
+	HRESULT hr;
+	if (m_pEffectPool == NULL && FAILED(hr = D3DXCreateEffectPool(&m_pEffectPool)))
+	{
+		DXUT_ERR(L"D3DXCreateEffectPool", hr);
+		return NULL;
+	}
+
+	ID3DXEffect* pEffect = NULL;
+	hr = WL::CreateEffectFromFileCached(DXUTGetD3DDevice(), strFileName, NULL,
+										dwShaderFlags, m_pEffectPool, &pEffect);
+	if (FAILED(hr))
+	{
+		DXUT_ERR(L"CreateEffectFromFileCached", hr);
+		return NULL;
+	}
+
+	pEffect->AddRef();
+	Insert(TYPE_EFFECT, strPath, hash, dwShaderFlags, pEffect);
+
+	// Insert() put the new entry first in its bucket
+	Entry* pEntry = m_apBuckets[hash % HASH_SIZE];
+	pEntry->pParams = new EffectParams();
+	pEntry->pParams->AddEffect(pEffect);
+	m_SharedParams.AddEffect(pEffect);
+
+	return pEffect;
+}
+
+EffectParams* AssetCache::GetEffectParams(ID3DXEffect* pEffect)
+{
+	for (int i = 0; i < HASH_SIZE; i++)
+		for (Entry* pEntry = m_apBuckets[i]; pEntry; pEntry = pEntry->pNext)
+			if (pEntry->Type == TYPE_EFFECT && pEntry->pAsset == pEffect)
+				return pEntry->pParams;
+	return NULL;
+}
+
+void AssetCache::GetEffectParamStats(EffectParams::Stats* pStats)
+{
+	*pStats = m_SharedParams.GetStats();
+	for (int i = 0; i < HASH_SIZE; i++)
+	{
+		for (Entry* pEntry = m_apBuckets[i]; pEntry; pEntry = pEntry->pNext)
+		{
+			if (pEntry->pParams)
+			{
+				pStats->nUploads += pEntry->pParams->GetStats().nUploads;
+				pStats->nRedundant += pEntry->pParams->GetStats().nRedundant;
+			}
+		}
+	}
+}
+
+void AssetCache::Purge()
+{
+	for (int i = 0; i < HASH_SIZE; i++)
+	{
+		Entry** ppEntry = &m_apBuckets[i];
+		while (*ppEntry)
+		{
+			Entry* pEntry = *ppEntry;
+
+			// Only the cache's reference is left if a round trip brings the count to 1
+			AddRefAsset(pEntry);
+			if (ReleaseAsset(pEntry) == 1)
+			{
+				Count(pEntry->Type, -1);
+				*ppEntry = pEntry->pNext;
+				Destroy(pEntry);
+			}
+			else
+			{
+				ppEntry = &pEntry->pNext;
+			}
+		}
+	}
+}
+
+void AssetCache::OnLostDevice()
+{
+	for (int i = 0; i < HASH_SIZE; i++)
+		for (Entry* pEntry = m_apBuckets[i]; pEntry; pEntry = pEntry->pNext)
+			if (pEntry->Type == TYPE_EFFECT)
+				((ID3DXEffect*)pEntry->pAsset)->OnLostDevice();
+}
+
+void AssetCache::OnResetDevice()
+{
+	for (int i = 0; i < HASH_SIZE; i++)
+		for (Entry* pEntry = m_apBuckets[i]; pEntry; pEntry = pEntry->pNext)
+			if (pEntry->Type == TYPE_EFFECT)
+				((ID3DXEffect*)pEntry->pAsset)->OnResetDevice();
+}
+
+void AssetCache::OnDestroyDevice()
+{
+	for (int i = 0; i < HASH_SIZE; i++)
+	{
+		while (m_apBuckets[i])
+		{
+			Entry* pEntry = m_apBuckets[i];
+			m_apBuckets[i] = pEntry->pNext;
+			Destroy(pEntry);
+		}
+	}
+
+	// Released last, the effects hold references to it
+	SAFE_RELEASE(m_pEffectPool);
+
+	m_Stats.nMeshes = m_Stats.nTextures = m_Stats.nEffects = 0;
+}
@@ -0,0 +1,111 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: WLAssetCache.h
+//
+// Author: snez
+//
+// Desc: A single place where meshes, textures and effects are loaded from, so objects that
+//       ask for the same file share one copy. Entries are found through a hash of the full
+//       path and the creation parameters. Every asset handed out is reference counted and
+//       the caller releases it as usual; the cache keeps its own reference until the
+//       device goes away or Purge() finds nobody else is using it.
+//
+//       Effects are created in one effect pool, so the parameters they mark shared are
+//       set once for all of them. Every effect comes with an EffectParams block for its
+//       own parameters, and one more block sets the shared ones.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __WLAssetCache_H__
+#define __WLAssetCache_H__
+
+#include "dxstdafx.h"
+#include "..\XMesh.h"
+#include "WLTextureLoader.h"
+#include "WLEffectCache.h"
+#include "WLEffectParams.h"
+
+class AssetCache
+{
+public:
+	struct Stats
+	{
+		UINT	nHits;
+		UINT	nMisses;
+		UINT	nMeshes;
+		UINT	nTextures;
+		UINT	nEffects;
+	};
+
+	static AssetCache& Get();
+
+	//
+	//	Each call returns a new reference, release it with Release() when done.
+	//	NULL is returned if the file could not be loaded.
+	//
+	XMesh* GetMesh(LPCWSTR strFileName);
+	AsyncTexture* GetTexture(LPCWSTR strFileName, D3DCOLOR placeholderColor = DEFAULT_PLACEHOLDER_COLOR);
+	ID3DXEffect* GetEffect(LPCWSTR strFileName, DWORD dwShaderFlags = 0);
+
+	//
+	//	The parameter block of an effect from GetEffect(), valid as long as the effect.
+	//	Objects sharing the effect share the block, so each sets all of its own values.
+	//
+	EffectParams* GetEffectParams(ID3DXEffect* pEffect);
+
+	//
+	//	The parameters shared by every effect, like the view and projection of the frame
+	//
+	inline EffectParams& GetSharedParams() { return m_SharedParams; }
+	void GetEffectParamStats(EffectParams::Stats* pStats);
+
+	//
+	//	Drop the assets nobody but the cache holds on to
+	//
+	void Purge();
+
+	//
+	//	Device changes. Cached effects are lost and reset here, so objects sharing one
+	//	don't have to coordinate.
+	//
+	void OnLostDevice();
+	void OnResetDevice();
+	void OnDestroyDevice();
+
+	inline const Stats& GetStats() const { return m_Stats; }
+
+private:
+	AssetCache();
+	~AssetCache();
+
+	enum EType { TYPE_MESH, TYPE_TEXTURE, TYPE_EFFECT };
+
+	struct Entry
+	{
+		EType		Type;
+		DWORD		Param;					// Placeholder color or shader flags
+		DWORD		Hash;
+		WCHAR		strPath[MAX_PATH];		// Full path, lower case
+		void*		pAsset;
+		EffectParams*	pParams;			// Effects only
+		Entry*		pNext;
+	};
+
+	enum { HASH_SIZE = 256 };
+
+	static DWORD MakeKey(EType type, LPCWSTR strFileName, DWORD param, WCHAR* strPath);
+	Entry* Find(EType type, LPCWSTR strPath, DWORD hash, DWORD param);
+	void Insert(EType type, LPCWSTR strPath, DWORD hash, DWORD param, void* pAsset);
+	static long AddRefAsset(Entry* pEntry);
+	static long ReleaseAsset(Entry* pEntry);
+	void Count(EType type, int delta);
+	void Destroy(Entry* pEntry);
+
+	Entry*		m_apBuckets[HASH_SIZE];
+	Stats		m_Stats;
+
+	LPD3DXEFFECTPOOL	m_pEffectPool;
+	EffectParams		m_SharedParams;
+};
+
+#endif // __WLAssetCache_H__
@@ -0,0 +1,160 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: WLBenchmark.cpp
+//
+// Author: snez
+//
+// Desc: Scripted runs of a scene, timed frame by frame.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "WLBenchmark.h"
+#include "WLPlatform.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+static bool s_bFixedSeed = false;
+static unsigned int s_nSeed = 0;
+static unsigned int s_nStreams = 0;
+
+unsigned int WL::GetRandomSeed()
+{
+	return s_bFixedSeed ? s_nSeed : (unsigned int)time(NULL);
+}
+
+void WL::SetRandomSeed(unsigned int nSeed)
+{
+	s_bFixedSeed = true;
+	s_nSeed = nSeed;
+	s_nStreams = 0;
+}
+
+unsigned int WL::GetRandomStream()
+{
+	return GetRandomSeed() + 0x9E3779B9u * ++s_nStreams;
+}
+
+WL::Benchmark::Benchmark(int nFrames, float fDelta)
+{
+	m_nFrames = nFrames;
+	m_fDelta = fDelta;
+	m_iStep = 0;
+	m_iFrame = 0;
+	m_fFrameStart = 0.0;
+	m_fUpdateEnd = 0.0;
+	m_Frames.reserve(nFrames);
+}
+
+void WL::Benchmark::AddStep(int iFrame, EAction eAction, int iValue)
+{
+	Step step;
+	step.iFrame = iFrame;
+	step.eAction = eAction;
+	step.iValue = iValue;
+	m_Steps.push_back(step);
+}
+
+void WL::Benchmark::AddDefaultPath(int nModes)
+{
+	// Half way around is 32 turns of the camera
+	const int nTurns = 32;
+
+	int nModeFrames = m_nFrames / nModes;
+	for (int iMode = 0; iMode < nModes; iMode++)
+	{
+		int iFirst = iMode * nModeFrames;
+		AddStep(iFirst, SET_CAMERA_MODE, iMode);
+
+		int nTurnFrames = nModeFrames / nTurns;
+		if (nTurnFrames == 0)
+			nTurnFrames = 1;
+		for (int t = 1; t <= nTurns && t * nTurnFrames < nModeFrames; t++)
+			AddStep(iFirst + t * nTurnFrames, ROTATE_RIGHT);
+	}
+}
+
+float WL::Benchmark::BeginFrame(BenchmarkScene& scene)
+{
+	double fNow = GetTimeSeconds();
+
+	// The time between the frames is only known once the next one begins
+	if (!m_Frames.empty())
+		m_Frames.back().fFrame = (fNow - m_fFrameStart) * 1000.0;
+
+	for (; m_iStep < m_Steps.size() && m_Steps[m_iStep].iFrame <= m_iFrame; m_iStep++)
+	{
+		const Step& step = m_Steps[m_iStep];
+		switch (step.eAction)
+		{
+			case SET_CAMERA_MODE:	scene.SetCameraMode(step.iValue); break;
+			case ROTATE_RIGHT:		scene.CameraRotateAngle(true); break;
+			case ROTATE_LEFT:		scene.CameraRotateAngle(false); break;
+		}
+	}
+
+	// The steps count as part of the update
+	m_fFrameStart = fNow;
+	m_fUpdateEnd = fNow;
+	return m_fDelta;
+}
+
+void WL::Benchmark::EndUpdate()
+{
+	m_fUpdateEnd = GetTimeSeconds();
+}
+
+void WL::Benchmark::EndFrame(BenchmarkScene& scene)
+{
+	double fNow = GetTimeSeconds();
+
+	Frame frame;
+	frame.fTime = (double)m_iFrame * m_fDelta;
+	frame.fUpdate = (m_fUpdateEnd - m_fFrameStart) * 1000.0;
+	frame.fRender = (fNow - m_fUpdateEnd) * 1000.0;
+	frame.fFrame = (fNow - m_fFrameStart) * 1000.0;
+	memset(&frame.counters, 0, sizeof(frame.counters));
+	scene.GetCounters(frame.counters);
+
+	m_Frames.push_back(frame);
+	m_iFrame++;
+}
+
+void WL::Benchmark::Run(BenchmarkScene& scene)
+{
+	while (!IsDone())
+	{
+		float fDelta = BeginFrame(scene);
+		scene.Update(fDelta);
+		EndUpdate();
+		scene.Render(fDelta);
+		EndFrame(scene);
+	}
+}
+
+bool WL::Benchmark::WriteCsv(const wchar_t* strFileName) const
+{
+	// The file name goes through the narrow runtime, so it is ASCII
+	char strPath[260];
+	size_t n = 0;
+	for (; strFileName[n] && n < sizeof(strPath) - 1; n++)
+		strPath[n] = (strFileName[n] < 0x80) ? (char)strFileName[n] : '_';
+	strPath[n] = 0;
+
+	FILE* pFile = fopen(strPath, "w");
+	if (pFile == NULL)
+		return false;
+
+	fprintf(pFile, "frame,time_s,update_ms,render_ms,frame_ms,particles,draw_calls,post_passes,state_changes\n");
+	for (size_t i = 0; i < m_Frames.size(); i++)
+	{
+		const Frame& frame = m_Frames[i];
+		fprintf(pFile, "%u,%.4f,%.4f,%.4f,%.4f,%u,%u,%u,%u\n", (unsigned int)i, frame.fTime,
+				frame.fUpdate, frame.fRender, frame.fFrame, frame.counters.nParticles,
+				frame.counters.nDrawCalls, frame.counters.nPostPasses, frame.counters.nStateChanges);
+	}
+
+	bool bResult = ferror(pFile) == 0;
+	fclose(pFile);
+	return bResult;
+}
@@ -0,0 +1,139 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: WLBenchmark.h
+//
+// Author: snez
+//
+// Desc: A scripted run of a scene for measuring it. The camera follows a path of steps
+//       set up front, every frame advances the simulation by the same time, and the
+//       random numbers start from a fixed seed, so two runs of a build do the same work
+//       and their timings can be compared. The CPU time and the counters of every frame
+//       are written to a CSV file at the end.
+//
+//       The runner only knows the scene through BenchmarkScene. When the application's
+//       loop owns the frames, it calls BeginFrame(), EndUpdate() and EndFrame() around
+//       its own update and render. Run() drives the frames itself, for a scene whose
+//       rendering is stubbed, like HeadlessScene, so the simulation can be
+//       measured without a device.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __WLBenchmark_H__
+#define __WLBenchmark_H__
+
+#include <vector>
+
+namespace WL
+{
+
+	//
+	//	The seed the scene's random numbers start from. The time, unless a benchmark
+	//	fixed it before the scene was made.
+	//
+	unsigned int GetRandomSeed();
+	void SetRandomSeed(unsigned int nSeed);
+
+	//
+	//	The start of a random stream of its own, for every particle emitter in the order
+	//	they are made. Fixing the seed starts the streams over, so a scene made again
+	//	after it draws the same numbers.
+	//
+	unsigned int GetRandomStream();
+
+	struct BenchmarkCounters
+	{
+		unsigned int	nParticles;				// Drawn
+		unsigned int	nDrawCalls;				// The whole frame's, post-processing included
+		unsigned int	nPostPasses;
+		unsigned int	nStateChanges;			// That reached the device
+	};
+
+	//
+	//	What the runner drives
+	//
+	class BenchmarkScene
+	{
+	public:
+		virtual ~BenchmarkScene() {}
+
+		virtual void SetCameraMode(int iMode) = 0;
+		virtual void CameraRotateAngle(bool bRight) = 0;
+		virtual void Update(float fDelta) = 0;
+		virtual void Render(float fDelta) = 0;
+		virtual void GetCounters(BenchmarkCounters& counters) = 0;
+	};
+
+	class Benchmark
+	{
+	public:
+		enum EAction
+		{
+			SET_CAMERA_MODE,
+			ROTATE_RIGHT,
+			ROTATE_LEFT
+		};
+
+		struct Frame
+		{
+			double				fTime;			// Seconds of simulation
+			double				fUpdate;		// Milliseconds
+			double				fRender;
+			double				fFrame;			// To the next frame, with whatever the loop did
+			BenchmarkCounters	counters;
+		};
+
+		enum { DEFAULT_SEED = 1 };
+
+		Benchmark(int nFrames, float fDelta);
+
+		//
+		//	Steps run at the start of their frame, and are added in the order of the frames
+		//
+		void AddStep(int iFrame, EAction eAction, int iValue = 0);
+
+		//
+		//	Every camera mode for a third of the frames, the camera going half way around
+		//	the scene in each
+		//
+		void AddDefaultPath(int nModes = 3);
+
+		//
+		//	A frame driven by the application. BeginFrame() runs the steps of the frame
+		//	and returns the time to simulate.
+		//
+		float BeginFrame(BenchmarkScene& scene);
+		void EndUpdate();
+		void EndFrame(BenchmarkScene& scene);
+
+		//
+		//	All the frames, for a scene that can be drawn at any time
+		//
+		void Run(BenchmarkScene& scene);
+
+		inline bool IsDone() const { return m_iFrame >= m_nFrames; }
+		inline int GetFrameCount() const { return (int)m_Frames.size(); }
+		inline const Frame& GetFrame(int i) const { return m_Frames[i]; }
+
+		bool WriteCsv(const wchar_t* strFileName) const;
+
+	private:
+		struct Step
+		{
+			int			iFrame;
+			EAction		eAction;
+			int			iValue;
+		};
+
+		int					m_nFrames;
+		float				m_fDelta;
+		std::vector<Step>	m_Steps;
+		unsigned int		m_iStep;			// The next to run
+		int					m_iFrame;			// The one running
+		double				m_fFrameStart;
+		double				m_fUpdateEnd;
+		std::vector<Frame>	m_Frames;
+	};
+
+}
+
+#endif // __WLBenchmark_H__
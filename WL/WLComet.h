@@ -1,19 +1,19 @@
-#pragma once
-
-#include "WLGeneralObject.h"
-#include "..\Particle.h"
-
-class Comet : public GeneralObject 
-{
-protected:
-
-	ParticleSystem* partSys;
-
-public:
-
-	Comet(LPCWSTR xfile);
-	~Comet();
-	
-	void Render();
-	void Update(float timeDelta);
+#pragma once
+
+#include "WLGeneralObject.h"
+#include "..\Particle.h"
+
+class Comet : public GeneralObject 
+{
+protected:
+
+	ParticleSystem* partSys;
+
+public:
+
+	Comet(const WL::CometObject* pSimulated, LPCWSTR xfile);
+	~Comet();
+	
+	void Render();
+	void Submit(RenderQueue& queue);
 };
\ No newline at end of file
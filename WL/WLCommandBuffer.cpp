@@ -0,0 +1,141 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: WLCommandBuffer.cpp
+//
+// Author: snez
+//
+// Desc: Recording of device calls into a byte stream.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "WLCommandBuffer.h"
+
+CommandBuffer::CommandBuffer()
+{
+	m_bRecorded = false;
+	memset(&m_Stats, 0, sizeof(m_Stats));
+}
+
+void CommandBuffer::Begin()
+{
+	m_Stream.clear();
+	m_bRecorded = false;
+	m_Stats.nCommands = 0;
+	m_Stats.nBytes = 0;
+}
+
+void CommandBuffer::End()
+{
+	m_bRecorded = true;
+	m_Stats.nBytes = (UINT)m_Stream.size();
+	m_Stats.nRecordings++;
+}
+
+void CommandBuffer::WriteCommand(ECommand eCommand)
+{
+	Write<BYTE>((BYTE)eCommand);
+	m_Stats.nCommands++;
+}
+
+void CommandBuffer::SetRenderState(D3DRENDERSTATETYPE state, DWORD dwValue)
+{
+	WriteCommand(CMD_RENDERSTATE);
+	Write(state);
+	Write(dwValue);
+}
+
+void CommandBuffer::SetSamplerState(DWORD dwSampler, D3DSAMPLERSTATETYPE type, DWORD dwValue)
+{
+	WriteCommand(CMD_SAMPLERSTATE);
+	Write(dwSampler);
+	Write(type);
+	Write(dwValue);
+}
+
+void CommandBuffer::SetTextureStageState(DWORD dwStage, D3DTEXTURESTAGESTATETYPE type, DWORD dwValue)
+{
+	WriteCommand(CMD_STAGESTATE);
+	Write(dwStage);
+	Write(type);
+	Write(dwValue);
+}
+
+void CommandBuffer::SetTransform(D3DTRANSFORMSTATETYPE state, const D3DMATRIX* pMatrix)
+{
+	WriteCommand(CMD_TRANSFORM);
+	Write(state);
+	Write(*pMatrix);
+}
+
+void CommandBuffer::SetTransformRef(D3DTRANSFORMSTATETYPE state, const D3DMATRIX* pMatrix)
+{
+	WriteCommand(CMD_TRANSFORMREF);
+	Write(state);
+	Write(pMatrix);
+}
+
+void CommandBuffer::SetMaterial(const D3DMATERIAL9* pMaterial)
+{
+	WriteCommand(CMD_MATERIAL);
+	Write(*pMaterial);
+}
+
+void CommandBuffer::SetTexture(DWORD dwStage, IDirect3DBaseTexture9* pTexture)
+{
+	WriteCommand(CMD_TEXTURE);
+	Write(dwStage);
+	Write(pTexture);
+}
+
+void CommandBuffer::SetVertexShader(IDirect3DVertexShader9* pShader)
+{
+	WriteCommand(CMD_VERTEXSHADER);
+	Write(pShader);
+}
+
+void CommandBuffer::SetPixelShader(IDirect3DPixelShader9* pShader)
+{
+	WriteCommand(CMD_PIXELSHADER);
+	Write(pShader);
+}
+
+void CommandBuffer::SetFVF(DWORD dwFVF)
+{
+	WriteCommand(CMD_FVF);
+	Write(dwFVF);
+}
+
+void CommandBuffer::SetStreamSource(UINT nStream, IDirect3DVertexBuffer9* pVB, UINT nOffset, UINT nStride)
+{
+	WriteCommand(CMD_STREAMSOURCE);
+	Write(nStream);
+	Write(pVB);
+	Write(nOffset);
+	Write(nStride);
+}
+
+void CommandBuffer::SetIndices(IDirect3DIndexBuffer9* pIB)
+{
+	WriteCommand(CMD_INDICES);
+	Write(pIB);
+}
+
+void CommandBuffer::DrawPrimitive(D3DPRIMITIVETYPE type, UINT nStartVertex, UINT nPrimitives)
+{
+	WriteCommand(CMD_DRAWPRIMITIVE);
+	Write(type);
+	Write(nStartVertex);
+	Write(nPrimitives);
+}
+
+void CommandBuffer::DrawIndexedPrimitive(D3DPRIMITIVETYPE type, int nBaseVertex, UINT nMinIndex, UINT nVertices,
+										 UINT nStartIndex, UINT nPrimitives)
+{
+	WriteCommand(CMD_DRAWINDEXEDPRIMITIVE);
+	Write(type);
+	Write(nBaseVertex);
+	Write(nMinIndex);
+	Write(nVertices);
+	Write(nStartIndex);
+	Write(nPrimitives);
+}
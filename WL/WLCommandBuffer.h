@@ -0,0 +1,228 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: WLCommandBuffer.h
+//
+// Author: snez
+//
+// Desc: Device calls recorded once into a byte stream and replayed every frame, for the
+//       parts of the scene that issue the same calls each time. The calls are the
+//       device's own, so a recording reads like the code it replaces.
+//
+//       A value that changes every frame, like a world matrix that follows the camera, is
+//       recorded by its address with SetTransformRef() and read when the stream is
+//       replayed. Everything else is copied into the stream, and the buffer has to be
+//       recorded again when it changes. Resources are not referenced, so a recording must
+//       not outlive them; the scene records again after a device reset.
+//
+//       Replay() is a template over the device, which only needs the calls used, so a
+//       recording can be checked against a mock without a device. The buffer only knows
+//       the D3D types, through WLD3DTypes.h, and builds without Direct3D.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __WLCommandBuffer_H__
+#define __WLCommandBuffer_H__
+
+#include "WLD3DTypes.h"
+#include <string.h>
+#include <vector>
+
+class CommandBuffer
+{
+public:
+	struct Stats
+	{
+		UINT	nCommands;			// In the recording
+		UINT	nBytes;
+		UINT	nRecordings;		// Since the buffer was created
+		UINT	nReplays;
+	};
+
+	CommandBuffer();
+
+	//
+	//	Starts a new recording, dropping the one there was
+	//
+	void Begin();
+	void End();
+
+	//
+	//	Whether there is a whole recording to replay. Invalidate() drops it, for the
+	//	owner to record again before the next replay.
+	//
+	inline bool IsRecorded() const { return m_bRecorded; }
+	inline void Invalidate() { m_bRecorded = false; }
+
+	//
+	//	The recorded calls
+	//
+	void SetRenderState(D3DRENDERSTATETYPE state, DWORD dwValue);
+	void SetSamplerState(DWORD dwSampler, D3DSAMPLERSTATETYPE type, DWORD dwValue);
+	void SetTextureStageState(DWORD dwStage, D3DTEXTURESTAGESTATETYPE type, DWORD dwValue);
+	void SetTransform(D3DTRANSFORMSTATETYPE state, const D3DMATRIX* pMatrix);
+	void SetTransformRef(D3DTRANSFORMSTATETYPE state, const D3DMATRIX* pMatrix);	// Read at replay
+	void SetMaterial(const D3DMATERIAL9* pMaterial);
+	void SetTexture(DWORD dwStage, IDirect3DBaseTexture9* pTexture);
+	void SetVertexShader(IDirect3DVertexShader9* pShader);
+	void SetPixelShader(IDirect3DPixelShader9* pShader);
+	void SetFVF(DWORD dwFVF);
+	void SetStreamSource(UINT nStream, IDirect3DVertexBuffer9* pVB, UINT nOffset, UINT nStride);
+	void SetIndices(IDirect3DIndexBuffer9* pIB);
+	void DrawPrimitive(D3DPRIMITIVETYPE type, UINT nStartVertex, UINT nPrimitives);
+	void DrawIndexedPrimitive(D3DPRIMITIVETYPE type, int nBaseVertex, UINT nMinIndex, UINT nVertices,
+							  UINT nStartIndex, UINT nPrimitives);
+
+	//
+	//	Issues the recording on pDevice, an IDirect3DDevice9 or anything with the same calls
+	//
+	template <class Device>
+	void Replay(Device* pDevice)
+	{
+		m_Stats.nReplays++;
+		if (!m_bRecorded || m_Stream.empty())
+			return;
+
+		const BYTE* p = &m_Stream[0];
+		const BYTE* pEnd = p + m_Stream.size();
+		while (p < pEnd)
+		{
+			switch (Read<BYTE>(p))
+			{
+				case CMD_RENDERSTATE:
+				{
+					D3DRENDERSTATETYPE state = Read<D3DRENDERSTATETYPE>(p);
+					pDevice->SetRenderState(state, Read<DWORD>(p));
+					break;
+				}
+				case CMD_SAMPLERSTATE:
+				{
+					DWORD dwSampler = Read<DWORD>(p);
+					D3DSAMPLERSTATETYPE type = Read<D3DSAMPLERSTATETYPE>(p);
+					pDevice->SetSamplerState(dwSampler, type, Read<DWORD>(p));
+					break;
+				}
+				case CMD_STAGESTATE:
+				{
+					DWORD dwStage = Read<DWORD>(p);
+					D3DTEXTURESTAGESTATETYPE type = Read<D3DTEXTURESTAGESTATETYPE>(p);
+					pDevice->SetTextureStageState(dwStage, type, Read<DWORD>(p));
+					break;
+				}
+				case CMD_TRANSFORM:
+				{
+					D3DTRANSFORMSTATETYPE state = Read<D3DTRANSFORMSTATETYPE>(p);
+					D3DMATRIX matrix = Read<D3DMATRIX>(p);
+					pDevice->SetTransform(state, &matrix);
+					break;
+				}
+				case CMD_TRANSFORMREF:
+				{
+					D3DTRANSFORMSTATETYPE state = Read<D3DTRANSFORMSTATETYPE>(p);
+					pDevice->SetTransform(state, Read<const D3DMATRIX*>(p));
+					break;
+				}
+				case CMD_MATERIAL:
+				{
+					D3DMATERIAL9 material = Read<D3DMATERIAL9>(p);
+					pDevice->SetMaterial(&material);
+					break;
+				}
+				case CMD_TEXTURE:
+				{
+					DWORD dwStage = Read<DWORD>(p);
+					pDevice->SetTexture(dwStage, Read<IDirect3DBaseTexture9*>(p));
+					break;
+				}
+				case CMD_VERTEXSHADER:
+					pDevice->SetVertexShader(Read<IDirect3DVertexShader9*>(p));
+					break;
+				case CMD_PIXELSHADER:
+					pDevice->SetPixelShader(Read<IDirect3DPixelShader9*>(p));
+					break;
+				case CMD_FVF:
+					pDevice->SetFVF(Read<DWORD>(p));
+					break;
+				case CMD_STREAMSOURCE:
+				{
+					UINT nStream = Read<UINT>(p);
+					IDirect3DVertexBuffer9* pVB = Read<IDirect3DVertexBuffer9*>(p);
+					UINT nOffset = Read<UINT>(p);
+					pDevice->SetStreamSource(nStream, pVB, nOffset, Read<UINT>(p));
+					break;
+				}
+				case CMD_INDICES:
+					pDevice->SetIndices(Read<IDirect3DIndexBuffer9*>(p));
+					break;
+				case CMD_DRAWPRIMITIVE:
+				{
+					D3DPRIMITIVETYPE type = Read<D3DPRIMITIVETYPE>(p);
+					UINT nStartVertex = Read<UINT>(p);
+					pDevice->DrawPrimitive(type, nStartVertex, Read<UINT>(p));
+					break;
+				}
+				case CMD_DRAWINDEXEDPRIMITIVE:
+				{
+					D3DPRIMITIVETYPE type = Read<D3DPRIMITIVETYPE>(p);
+					int nBaseVertex = Read<int>(p);
+					UINT nMinIndex = Read<UINT>(p);
+					UINT nVertices = Read<UINT>(p);
+					UINT nStartIndex = Read<UINT>(p);
+					pDevice->DrawIndexedPrimitive(type, nBaseVertex, nMinIndex, nVertices, nStartIndex, Read<UINT>(p));
+					break;
+				}
+				default:
+					// A stream we didn't write, nothing after this can be trusted
+					return;
+			}
+		}
+	}
+
+	inline const Stats& GetStats() const { return m_Stats; }
+
+private:
+	enum ECommand
+	{
+		CMD_RENDERSTATE = 1,
+		CMD_SAMPLERSTATE,
+		CMD_STAGESTATE,
+		CMD_TRANSFORM,
+		CMD_TRANSFORMREF,
+		CMD_MATERIAL,
+		CMD_TEXTURE,
+		CMD_VERTEXSHADER,
+		CMD_PIXELSHADER,
+		CMD_FVF,
+		CMD_STREAMSOURCE,
+		CMD_INDICES,
+		CMD_DRAWPRIMITIVE,
+		CMD_DRAWINDEXEDPRIMITIVE,
+	};
+
+	//
+	//	The stream is packed, so values are copied in and out rather than cast in place
+	//
+	template <class T>
+	void Write(const T& value)
+	{
+		size_t nSize = m_Stream.size();
+		m_Stream.resize(nSize + sizeof(T));
+		memcpy(&m_Stream[nSize], &value, sizeof(T));
+	}
+
+	template <class T>
+	static T Read(const BYTE*& p)
+	{
+		T value;
+		memcpy(&value, p, sizeof(T));
+		p += sizeof(T);
+		return value;
+	}
+
+	void WriteCommand(ECommand eCommand);
+
+	std::vector<BYTE>	m_Stream;				// Kept between recordings, so they don't allocate
+	bool				m_bRecorded;
+	Stats				m_Stats;
+};
+
+#endif // __WLCommandBuffer_H__
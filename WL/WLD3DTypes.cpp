@@ -0,0 +1,175 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: WLD3DTypes.cpp
+//
+// Author: snez
+//
+// Desc: The D3DX math of the headless build. On Windows D3DX itself is linked instead.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "WLD3DTypes.h"
+
+#ifndef _WIN32
+
+#include <math.h>
+
+static inline float Dot(const D3DXVECTOR3& a, const D3DXVECTOR3& b)
+{
+	return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+static inline D3DXVECTOR3 Cross(const D3DXVECTOR3& a, const D3DXVECTOR3& b)
+{
+	return D3DXVECTOR3(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x);
+}
+
+static inline D3DXVECTOR3 Normalize(const D3DXVECTOR3& v)
+{
+	float fLength = sqrtf(Dot(v, v));
+	return fLength > 0.0f ? v / fLength : D3DXVECTOR3(0.0f, 0.0f, 0.0f);
+}
+
+static inline DWORD ColorByte(float f)
+{
+	return f >= 1.0f ? 0xff : f <= 0.0f ? 0x00 : (DWORD)(f * 255.0f + 0.5f);
+}
+
+D3DXCOLOR::operator DWORD () const
+{
+	return (ColorByte(a) << 24) | (ColorByte(r) << 16) | (ColorByte(g) << 8) | ColorByte(b);
+}
+
+D3DXMATRIX& D3DXMATRIX::operator *= (const D3DXMATRIX& mat)
+{
+	D3DXMatrixMultiply(this, this, &mat);
+	return *this;
+}
+
+D3DXMATRIX D3DXMATRIX::operator * (const D3DXMATRIX& mat) const
+{
+	D3DXMATRIX result;
+	D3DXMatrixMultiply(&result, this, &mat);
+	return result;
+}
+
+D3DXMATRIX* D3DXMatrixIdentity(D3DXMATRIX* pOut)
+{
+	for (int i = 0; i < 4; i++)
+		for (int j = 0; j < 4; j++)
+			pOut->m[i][j] = i == j ? 1.0f : 0.0f;
+	return pOut;
+}
+
+//
+//	pOut may be either of the others
+//
+D3DXMATRIX* D3DXMatrixMultiply(D3DXMATRIX* pOut, const D3DXMATRIX* pM1, const D3DXMATRIX* pM2)
+{
+	D3DXMATRIX result;
+	for (int i = 0; i < 4; i++)
+		for (int j = 0; j < 4; j++)
+			result.m[i][j] = pM1->m[i][0] * pM2->m[0][j] + pM1->m[i][1] * pM2->m[1][j] +
+							 pM1->m[i][2] * pM2->m[2][j] + pM1->m[i][3] * pM2->m[3][j];
+	*pOut = result;
+	return pOut;
+}
+
+D3DXMATRIX* D3DXMatrixTranslation(D3DXMATRIX* pOut, float x, float y, float z)
+{
+	D3DXMatrixIdentity(pOut);
+	pOut->_41 = x;
+	pOut->_42 = y;
+	pOut->_43 = z;
+	return pOut;
+}
+
+D3DXMATRIX* D3DXMatrixScaling(D3DXMATRIX* pOut, float sx, float sy, float sz)
+{
+	D3DXMatrixIdentity(pOut);
+	pOut->_11 = sx;
+	pOut->_22 = sy;
+	pOut->_33 = sz;
+	return pOut;
+}
+
+D3DXMATRIX* D3DXMatrixRotationX(D3DXMATRIX* pOut, float fAngle)
+{
+	float fSin = sinf(fAngle), fCos = cosf(fAngle);
+	D3DXMatrixIdentity(pOut);
+	pOut->_22 = fCos;
+	pOut->_23 = fSin;
+	pOut->_32 = -fSin;
+	pOut->_33 = fCos;
+	return pOut;
+}
+
+D3DXMATRIX* D3DXMatrixLookAtLH(D3DXMATRIX* pOut, const D3DXVECTOR3* pEye, const D3DXVECTOR3* pAt, const D3DXVECTOR3* pUp)
+{
+	D3DXVECTOR3 vZ = Normalize(*pAt - *pEye);
+	D3DXVECTOR3 vX = Normalize(Cross(*pUp, vZ));
+	D3DXVECTOR3 vY = Cross(vZ, vX);
+
+	pOut->_11 = vX.x;	pOut->_12 = vY.x;	pOut->_13 = vZ.x;	pOut->_14 = 0.0f;
+	pOut->_21 = vX.y;	pOut->_22 = vY.y;	pOut->_23 = vZ.y;	pOut->_24 = 0.0f;
+	pOut->_31 = vX.z;	pOut->_32 = vY.z;	pOut->_33 = vZ.z;	pOut->_34 = 0.0f;
+	pOut->_41 = -Dot(vX, *pEye);
+	pOut->_42 = -Dot(vY, *pEye);
+	pOut->_43 = -Dot(vZ, *pEye);
+	pOut->_44 = 1.0f;
+	return pOut;
+}
+
+D3DXMATRIX* D3DXMatrixPerspectiveFovLH(D3DXMATRIX* pOut, float fFovY, float fAspect, float fNear, float fFar)
+{
+	float fYScale = 1.0f / tanf(fFovY * 0.5f);
+	for (int i = 0; i < 4; i++)
+		for (int j = 0; j < 4; j++)
+			pOut->m[i][j] = 0.0f;
+
+	pOut->_11 = fYScale / fAspect;
+	pOut->_22 = fYScale;
+	pOut->_33 = fFar / (fFar - fNear);
+	pOut->_34 = 1.0f;
+	pOut->_43 = -fNear * fFar / (fFar - fNear);
+	return pOut;
+}
+
+//
+//	By the cofactors, pOut may be pM
+//
+D3DXMATRIX* D3DXMatrixInverse(D3DXMATRIX* pOut, float* pDeterminant, const D3DXMATRIX* pM)
+{
+	const float* a = &pM->m[0][0];
+	float inv[16];
+
+	inv[0] = a[5] * a[10] * a[15] - a[5] * a[11] * a[14] - a[9] * a[6] * a[15] + a[9] * a[7] * a[14] + a[13] * a[6] * a[11] - a[13] * a[7] * a[10];
+	inv[4] = -a[4] * a[10] * a[15] + a[4] * a[11] * a[14] + a[8] * a[6] * a[15] - a[8] * a[7] * a[14] - a[12] * a[6] * a[11] + a[12] * a[7] * a[10];
+	inv[8] = a[4] * a[9] * a[15] - a[4] * a[11] * a[13] - a[8] * a[5] * a[15] + a[8] * a[7] * a[13] + a[12] * a[5] * a[11] - a[12] * a[7] * a[9];
+	inv[12] = -a[4] * a[9] * a[14] + a[4] * a[10] * a[13] + a[8] * a[5] * a[14] - a[8] * a[6] * a[13] - a[12] * a[5] * a[10] + a[12] * a[6] * a[9];
+	inv[1] = -a[1] * a[10] * a[15] + a[1] * a[11] * a[14] + a[9] * a[2] * a[15] - a[9] * a[3] * a[14] - a[13] * a[2] * a[11] + a[13] * a[3] * a[10];
+	inv[5] = a[0] * a[10] * a[15] - a[0] * a[11] * a[14] - a[8] * a[2] * a[15] + a[8] * a[3] * a[14] + a[12] * a[2] * a[11] - a[12] * a[3] * a[10];
+	inv[9] = -a[0] * a[9] * a[15] + a[0] * a[11] * a[13] + a[8] * a[1] * a[15] - a[8] * a[3] * a[13] - a[12] * a[1] * a[11] + a[12] * a[3] * a[9];
+	inv[13] = a[0] * a[9] * a[14] - a[0] * a[10] * a[13] - a[8] * a[1] * a[14] + a[8] * a[2] * a[13] + a[12] * a[1] * a[10] - a[12] * a[2] * a[9];
+	inv[2] = a[1] * a[6] * a[15] - a[1] * a[7] * a[14] - a[5] * a[2] * a[15] + a[5] * a[3] * a[14] + a[13] * a[2] * a[7] - a[13] * a[3] * a[6];
+	inv[6] = -a[0] * a[6] * a[15] + a[0] * a[7] * a[14] + a[4] * a[2] * a[15] - a[4] * a[3] * a[14] - a[12] * a[2] * a[7] + a[12] * a[3] * a[6];
+	inv[10] = a[0] * a[5] * a[15] - a[0] * a[7] * a[13] - a[4] * a[1] * a[15] + a[4] * a[3] * a[13] + a[12] * a[1] * a[7] - a[12] * a[3] * a[5];
+	inv[14] = -a[0] * a[5] * a[14] + a[0] * a[6] * a[13] + a[4] * a[1] * a[14] - a[4] * a[2] * a[13] - a[12] * a[1] * a[6] + a[12] * a[2] * a[5];
+	inv[3] = -a[1] * a[6] * a[11] + a[1] * a[7] * a[10] + a[5] * a[2] * a[11] - a[5] * a[3] * a[10] - a[9] * a[2] * a[7] + a[9] * a[3] * a[6];
+	inv[7] = a[0] * a[6] * a[11] - a[0] * a[7] * a[10] - a[4] * a[2] * a[11] + a[4] * a[3] * a[10] + a[8] * a[2] * a[7] - a[8] * a[3] * a[6];
+	inv[11] = -a[0] * a[5] * a[11] + a[0] * a[7] * a[9] + a[4] * a[1] * a[11] - a[4] * a[3] * a[9] - a[8] * a[1] * a[7] + a[8] * a[3] * a[5];
+	inv[15] = a[0] * a[5] * a[10] - a[0] * a[6] * a[9] - a[4] * a[1] * a[10] + a[4] * a[2] * a[9] + a[8] * a[1] * a[6] - a[8] * a[2] * a[5];
+
+	float fDeterminant = a[0] * inv[0] + a[1] * inv[4] + a[2] * inv[8] + a[3] * inv[12];
+	if (pDeterminant)
+		*pDeterminant = fDeterminant;
+	if (fDeterminant == 0.0f)
+		return NULL;
+
+	float* out = &pOut->m[0][0];
+	for (int i = 0; i < 16; i++)
+		out[i] = inv[i] / fDeterminant;
+	return pOut;
+}
+
+#endif // _WIN32
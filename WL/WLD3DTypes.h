@@ -0,0 +1,198 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: WLD3DTypes.h
+//
+// Author: snez
+//
+// Desc: The Direct3D types that code recording device calls needs, without the device,
+//       and the D3DX math the simulation steps with. On Windows they are the real ones.
+//       Elsewhere they are declared here, with the values d3d9types.h gives them, so a
+//       recording can be built and checked against a mock device in the headless build,
+//       and the scene simulated without one. Interfaces are only declared, a recording
+//       never calls them. The D3DX functions are the few the simulation uses, worked
+//       out in WLD3DTypes.cpp the way the D3DX documentation gives them.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __WLD3DTypes_H__
+#define __WLD3DTypes_H__
+
+#ifdef _WIN32
+
+#include <d3d9.h>
+#include <d3dx9math.h>
+
+#else
+
+typedef unsigned char	BYTE;
+typedef unsigned short	WORD;
+typedef unsigned int	DWORD;
+typedef unsigned int	UINT;
+typedef int				HRESULT;
+typedef DWORD			D3DCOLOR;
+
+#define D3D_OK			0
+
+#define D3DFVF_XYZ		0x002
+#define D3DFVF_NORMAL	0x010
+#define D3DFVF_DIFFUSE	0x040
+#define D3DFVF_TEX1		0x100
+
+enum D3DRENDERSTATETYPE
+{
+	D3DRS_ZENABLE = 7,
+	D3DRS_FILLMODE = 8,
+	D3DRS_ZWRITEENABLE = 14,
+	D3DRS_ALPHATESTENABLE = 15,
+	D3DRS_SRCBLEND = 19,
+	D3DRS_DESTBLEND = 20,
+	D3DRS_CULLMODE = 22,
+	D3DRS_ALPHABLENDENABLE = 27,
+	D3DRS_WRAP0 = 128,
+	D3DRS_LIGHTING = 137,
+	D3DRS_POINTSIZE = 154
+};
+
+enum D3DSAMPLERSTATETYPE
+{
+	D3DSAMP_ADDRESSU = 1,
+	D3DSAMP_ADDRESSV = 2,
+	D3DSAMP_ADDRESSW = 3,
+	D3DSAMP_MAGFILTER = 5,
+	D3DSAMP_MINFILTER = 6,
+	D3DSAMP_MIPFILTER = 7
+};
+
+enum D3DTEXTURESTAGESTATETYPE
+{
+	D3DTSS_COLOROP = 1,
+	D3DTSS_COLORARG1 = 2,
+	D3DTSS_COLORARG2 = 3,
+	D3DTSS_ALPHAOP = 4
+};
+
+enum D3DTRANSFORMSTATETYPE
+{
+	D3DTS_VIEW = 2,
+	D3DTS_PROJECTION = 3,
+	D3DTS_WORLD = 256
+};
+
+enum D3DPRIMITIVETYPE
+{
+	D3DPT_POINTLIST = 1,
+	D3DPT_LINELIST = 2,
+	D3DPT_LINESTRIP = 3,
+	D3DPT_TRIANGLELIST = 4,
+	D3DPT_TRIANGLESTRIP = 5,
+	D3DPT_TRIANGLEFAN = 6
+};
+
+struct D3DMATRIX
+{
+	union
+	{
+		struct
+		{
+			float	_11, _12, _13, _14;
+			float	_21, _22, _23, _24;
+			float	_31, _32, _33, _34;
+			float	_41, _42, _43, _44;
+		};
+		float	m[4][4];
+	};
+};
+
+struct D3DCOLORVALUE
+{
+	float	r, g, b, a;
+};
+
+struct D3DMATERIAL9
+{
+	D3DCOLORVALUE	Diffuse;
+	D3DCOLORVALUE	Ambient;
+	D3DCOLORVALUE	Specular;
+	D3DCOLORVALUE	Emissive;
+	float			Power;
+};
+
+//
+//	D3DX
+//
+#define D3DX_PI					((float)3.141592654f)
+#define D3DXToRadian(degree)	((degree) * (D3DX_PI / 180.0f))
+
+struct D3DXVECTOR3
+{
+	D3DXVECTOR3() {}
+	D3DXVECTOR3(float fx, float fy, float fz) : x(fx), y(fy), z(fz) {}
+
+	D3DXVECTOR3& operator += (const D3DXVECTOR3& v) { x += v.x; y += v.y; z += v.z; return *this; }
+	D3DXVECTOR3& operator -= (const D3DXVECTOR3& v) { x -= v.x; y -= v.y; z -= v.z; return *this; }
+	D3DXVECTOR3& operator *= (float f) { x *= f; y *= f; z *= f; return *this; }
+	D3DXVECTOR3& operator /= (float f) { return *this *= 1.0f / f; }
+
+	D3DXVECTOR3 operator - () const { return D3DXVECTOR3(-x, -y, -z); }
+	D3DXVECTOR3 operator + (const D3DXVECTOR3& v) const { return D3DXVECTOR3(x + v.x, y + v.y, z + v.z); }
+	D3DXVECTOR3 operator - (const D3DXVECTOR3& v) const { return D3DXVECTOR3(x - v.x, y - v.y, z - v.z); }
+	D3DXVECTOR3 operator * (float f) const { return D3DXVECTOR3(x * f, y * f, z * f); }
+	D3DXVECTOR3 operator / (float f) const { return *this * (1.0f / f); }
+
+	bool operator == (const D3DXVECTOR3& v) const { return x == v.x && y == v.y && z == v.z; }
+	bool operator != (const D3DXVECTOR3& v) const { return !(*this == v); }
+
+	float	x, y, z;
+};
+
+inline D3DXVECTOR3 operator * (float f, const D3DXVECTOR3& v) { return v * f; }
+
+struct D3DXCOLOR
+{
+	D3DXCOLOR() {}
+	D3DXCOLOR(float fr, float fg, float fb, float fa) : r(fr), g(fg), b(fb), a(fa) {}
+
+	operator DWORD () const;			// A8R8G8B8, clamped to 0..1
+
+	D3DXCOLOR& operator += (const D3DXCOLOR& c) { r += c.r; g += c.g; b += c.b; a += c.a; return *this; }
+	D3DXCOLOR& operator -= (const D3DXCOLOR& c) { r -= c.r; g -= c.g; b -= c.b; a -= c.a; return *this; }
+	D3DXCOLOR& operator *= (float f) { r *= f; g *= f; b *= f; a *= f; return *this; }
+	D3DXCOLOR& operator /= (float f) { return *this *= 1.0f / f; }
+
+	D3DXCOLOR operator + (const D3DXCOLOR& c) const { return D3DXCOLOR(r + c.r, g + c.g, b + c.b, a + c.a); }
+	D3DXCOLOR operator - (const D3DXCOLOR& c) const { return D3DXCOLOR(r - c.r, g - c.g, b - c.b, a - c.a); }
+	D3DXCOLOR operator * (float f) const { return D3DXCOLOR(r * f, g * f, b * f, a * f); }
+	D3DXCOLOR operator / (float f) const { return *this * (1.0f / f); }
+
+	float	r, g, b, a;
+};
+
+struct D3DXMATRIX : public D3DMATRIX
+{
+	D3DXMATRIX() {}
+
+	float& operator () (UINT iRow, UINT iCol) { return m[iRow][iCol]; }
+	float operator () (UINT iRow, UINT iCol) const { return m[iRow][iCol]; }
+
+	D3DXMATRIX& operator *= (const D3DXMATRIX& mat);
+	D3DXMATRIX operator * (const D3DXMATRIX& mat) const;
+};
+
+D3DXMATRIX* D3DXMatrixIdentity(D3DXMATRIX* pOut);
+D3DXMATRIX* D3DXMatrixMultiply(D3DXMATRIX* pOut, const D3DXMATRIX* pM1, const D3DXMATRIX* pM2);
+D3DXMATRIX* D3DXMatrixTranslation(D3DXMATRIX* pOut, float x, float y, float z);
+D3DXMATRIX* D3DXMatrixScaling(D3DXMATRIX* pOut, float sx, float sy, float sz);
+D3DXMATRIX* D3DXMatrixRotationX(D3DXMATRIX* pOut, float fAngle);
+D3DXMATRIX* D3DXMatrixLookAtLH(D3DXMATRIX* pOut, const D3DXVECTOR3* pEye, const D3DXVECTOR3* pAt, const D3DXVECTOR3* pUp);
+D3DXMATRIX* D3DXMatrixPerspectiveFovLH(D3DXMATRIX* pOut, float fFovY, float fAspect, float fNear, float fFar);
+D3DXMATRIX* D3DXMatrixInverse(D3DXMATRIX* pOut, float* pDeterminant, const D3DXMATRIX* pM);	// NULL if there is none
+
+struct IDirect3DBaseTexture9;
+struct IDirect3DVertexShader9;
+struct IDirect3DPixelShader9;
+struct IDirect3DVertexBuffer9;
+struct IDirect3DIndexBuffer9;
+
+#endif // _WIN32
+
+#endif // __WLD3DTypes_H__
@@ -0,0 +1,231 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: WLEffectCache.cpp
+//
+// Author: snez
+//
+// Desc: On-disk cache of compiled effect bytecode.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "WLEffectCache.h"
+#include "WLPlatform.h"
+
+#define EFFECT_CACHE_DIR		L"data\\fx\\cache"
+#define EFFECT_CACHE_MAGIC		0x58464c57		// "WLFX"
+#define EFFECT_CACHE_VERSION	1
+
+#define FNV64_OFFSET			0xcbf29ce484222325ui64
+#define FNV64_PRIME				0x00000100000001b3ui64
+
+// Flags that only affect the creation of the effect object, not its bytecode
+#define EFFECT_CREATE_FLAGS		(D3DXFX_NOT_CLONEABLE)
+
+struct EffectCacheHeader
+{
+	DWORD		dwMagic;
+	DWORD		dwVersion;
+	ULONGLONG	qwKey;				// Hash of the source, defines, flags and D3DX version
+	DWORD		dwSize;				// Bytes of bytecode following the header
+};
+
+static WL::EffectCacheStats s_Stats = { 0, 0, 0, 0 };
+
+const WL::EffectCacheStats& WL::GetEffectCacheStats()
+{
+	return s_Stats;
+}
+
+//
+//	64 bit FNV-1a
+//
+static ULONGLONG HashBytes(ULONGLONG hash, const void* pData, UINT nBytes)
+{
+	const BYTE* pBytes = (const BYTE*)pData;
+	for (UINT i = 0; i < nBytes; i++)
+		hash = (hash ^ pBytes[i]) * FNV64_PRIME;
+	return hash;
+}
+
+static ULONGLONG HashString(ULONGLONG hash, LPCSTR str)
+{
+	// Include the terminator so "AB","C" and "A","BC" differ
+	return HashBytes(hash, str, (UINT)strlen(str) + 1);
+}
+
+static HRESULT ReadWholeFile(LPCWSTR strFileName, BYTE** ppData, DWORD* pdwSize)
+{
+	HANDLE hFile = CreateFileW(strFileName, GENERIC_READ, FILE_SHARE_READ, NULL,
+							   OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+	if (hFile == INVALID_HANDLE_VALUE)
+		return HRESULT_FROM_WIN32(GetLastError());
+
+	DWORD dwSize = GetFileSize(hFile, NULL);
+	BYTE* pData = new BYTE[dwSize];
+	DWORD dwRead = 0;
+	BOOL bRead = ReadFile(hFile, pData, dwSize, &dwRead, NULL);
+	CloseHandle(hFile);
+
+	if (!bRead || dwRead != dwSize)
+	{
+		delete[] pData;
+		return E_FAIL;
+	}
+
+	*ppData = pData;
+	*pdwSize = dwSize;
+	return S_OK;
+}
+
+//
+//	data\fx\Glow.fx -> data\fx\cache\Glow_0123456789abcdef.fxo
+//
+static void GetCacheFileName(LPCWSTR strFileName, ULONGLONG qwKey, WCHAR* strCacheFile)
+{
+	WCHAR strName[MAX_PATH];
+	LPCWSTR pName = wcsrchr(strFileName, L'\\');
+	StringCchCopyW(strName, MAX_PATH, pName ? pName + 1 : strFileName);
+
+	WCHAR* pExt = wcsrchr(strName, L'.');
+	if (pExt)
+		*pExt = 0;
+
+	StringCchPrintfW(strCacheFile, MAX_PATH, L"%s\\%s_%08x%08x.fxo", EFFECT_CACHE_DIR, strName,
+					 (DWORD)(qwKey >> 32), (DWORD)qwKey);
+}
+
+//
+//	Returns the bytecode stored for the key, or NULL if there is no valid entry
+//
+static BYTE* LoadBytecode(LPCWSTR strCacheFile, ULONGLONG qwKey, DWORD* pdwSize)
+{
+	BYTE* pData = NULL;
+	DWORD dwSize = 0;
+	if (FAILED(ReadWholeFile(strCacheFile, &pData, &dwSize)))
+		return NULL;
+
+	const EffectCacheHeader* pHeader = (const EffectCacheHeader*)pData;
+	if (dwSize < sizeof(EffectCacheHeader) ||
+		pHeader->dwMagic != EFFECT_CACHE_MAGIC ||
+		pHeader->dwVersion != EFFECT_CACHE_VERSION ||
+		pHeader->qwKey != qwKey ||
+		pHeader->dwSize != dwSize - sizeof(EffectCacheHeader))
+	{
+		delete[] pData;
+		return NULL;
+	}
+
+	*pdwSize = dwSize;
+	return pData;
+}
+
+static void SaveBytecode(LPCWSTR strCacheFile, ULONGLONG qwKey, LPD3DXBUFFER pBytecode)
+{
+	CreateDirectoryW(EFFECT_CACHE_DIR, NULL);
+
+	HANDLE hFile = CreateFileW(strCacheFile, GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (hFile == INVALID_HANDLE_VALUE)
+		return;
+
+	EffectCacheHeader header;
+	header.dwMagic = EFFECT_CACHE_MAGIC;
+	header.dwVersion = EFFECT_CACHE_VERSION;
+	header.qwKey = qwKey;
+	header.dwSize = pBytecode->GetBufferSize();
+
+	DWORD dwWritten = 0;
+	BOOL bOK = WriteFile(hFile, &header, sizeof(header), &dwWritten, NULL) &&
+			   WriteFile(hFile, pBytecode->GetBufferPointer(), header.dwSize, &dwWritten, NULL) &&
+			   dwWritten == header.dwSize;
+	CloseHandle(hFile);
+
+	// Never leave a truncated entry behind
+	if (!bOK)
+		DeleteFileW(strCacheFile);
+}
+
+HRESULT WL::CreateEffectFromFileCached(IDirect3DDevice9* pd3dDevice, LPCWSTR strFileName,
+									   const D3DXMACRO* pDefines, DWORD dwFlags,
+									   LPD3DXEFFECTPOOL pPool, LPD3DXEFFECT* ppEffect)
+{
+	HRESULT hr;
+	BYTE* pSource = NULL;
+	DWORD dwSourceSize = 0;
+	V_RETURN( ReadWholeFile(strFileName, &pSource, &dwSourceSize) );
+
+	DWORD dwCompileFlags = dwFlags & ~EFFECT_CREATE_FLAGS;
+
+	// The key covers everything that changes the bytecode
+	ULONGLONG qwKey = FNV64_OFFSET;
+	DWORD dwVersion = D3DX_SDK_VERSION;
+	qwKey = HashBytes(qwKey, pSource, dwSourceSize);
+	qwKey = HashBytes(qwKey, &dwCompileFlags, sizeof(dwCompileFlags));
+	qwKey = HashBytes(qwKey, &dwVersion, sizeof(dwVersion));
+	for (const D3DXMACRO* pDefine = pDefines; pDefine && pDefine->Name; pDefine++)
+	{
+		qwKey = HashString(qwKey, pDefine->Name);
+		qwKey = HashString(qwKey, pDefine->Definition ? pDefine->Definition : "");
+	}
+
+	WCHAR strCacheFile[MAX_PATH];
+	GetCacheFileName(strFileName, qwKey, strCacheFile);
+
+	double fStart = WL::GetTimeSeconds();
+	DWORD dwCacheSize = 0;
+	BYTE* pCached = LoadBytecode(strCacheFile, qwKey, &dwCacheSize);
+	if (pCached)
+	{
+		delete[] pSource;
+
+		hr = D3DXCreateEffect(pd3dDevice, pCached + sizeof(EffectCacheHeader), dwCacheSize - sizeof(EffectCacheHeader),
+							  NULL, NULL, dwFlags, pPool, ppEffect, NULL);
+		delete[] pCached;
+
+		if (SUCCEEDED(hr))
+		{
+			s_Stats.nHits++;
+			s_Stats.fLoadTime += float(WL::GetTimeSeconds() - fStart);
+			return S_OK;
+		}
+
+		// A stale or damaged entry, fall through and compile again
+		DXUT_ERR(L"D3DXCreateEffect (cached)", hr);
+		V_RETURN( ReadWholeFile(strFileName, &pSource, &dwSourceSize) );
+	}
+
+	LPD3DXEFFECTCOMPILER pCompiler = NULL;
+	LPD3DXBUFFER pBytecode = NULL;
+	LPD3DXBUFFER pErrors = NULL;
+
+	hr = D3DXCreateEffectCompiler((LPCSTR)pSource, dwSourceSize, pDefines, NULL, dwCompileFlags, &pCompiler, &pErrors);
+	delete[] pSource;
+
+	if (SUCCEEDED(hr))
+	{
+		SAFE_RELEASE(pErrors);
+		hr = pCompiler->CompileEffect(dwCompileFlags, &pBytecode, &pErrors);
+	}
+
+	if (FAILED(hr))
+	{
+		if (pErrors)
+			DXUTOutputDebugStringA("%s\n", (LPCSTR)pErrors->GetBufferPointer());
+		SAFE_RELEASE(pErrors);
+		SAFE_RELEASE(pCompiler);
+		return DXUT_ERR(L"CompileEffect", hr);
+	}
+
+	SAFE_RELEASE(pErrors);
+	SAFE_RELEASE(pCompiler);
+
+	s_Stats.nMisses++;
+	s_Stats.fCompileTime += float(WL::GetTimeSeconds() - fStart);
+
+	SaveBytecode(strCacheFile, qwKey, pBytecode);
+
+	hr = D3DXCreateEffect(pd3dDevice, pBytecode->GetBufferPointer(), pBytecode->GetBufferSize(),
+						  NULL, NULL, dwFlags, pPool, ppEffect, NULL);
+	SAFE_RELEASE(pBytecode);
+
+	return hr;
+}
@@ -0,0 +1,54 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: WLEffectCache.h
+//
+// Author: snez
+//
+// Desc: Keeps the compiled bytecode of effect files on disk, so the .fx source is only
+//       compiled again when it, the defines or the compile flags change. Compiled effects
+//       are stored in data\fx\cache, named after the source file and a hash of everything
+//       that went into the compile.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __WLEffectCache_H__
+#define __WLEffectCache_H__
+
+#include "dxstdafx.h"
+
+//
+//	Shader flags to compile the scene's effects with. Debug builds keep the debug info,
+//	release builds optimize fully.
+//
+#if defined(DEBUG) || defined(_DEBUG)
+	#define WL_SHADER_FLAGS		D3DXSHADER_DEBUG
+#elif defined(D3DXSHADER_OPTIMIZATION_LEVEL3)
+	#define WL_SHADER_FLAGS		D3DXSHADER_OPTIMIZATION_LEVEL3
+#else
+	#define WL_SHADER_FLAGS		0
+#endif
+
+namespace WL
+{
+
+	struct EffectCacheStats
+	{
+		UINT	nHits;				// Effects loaded from the cache
+		UINT	nMisses;			// Effects compiled from source
+		float	fCompileTime;		// Seconds spent compiling
+		float	fLoadTime;			// Seconds spent creating effects from the cache
+	};
+
+	//
+	//	Same as D3DXCreateEffectFromFile, going through the bytecode cache. The source
+	//	may not #include other files.
+	//
+	HRESULT CreateEffectFromFileCached(IDirect3DDevice9* pd3dDevice, LPCWSTR strFileName,
+									   const D3DXMACRO* pDefines, DWORD dwFlags,
+									   LPD3DXEFFECTPOOL pPool, LPD3DXEFFECT* ppEffect);
+
+	const EffectCacheStats& GetEffectCacheStats();
+
+}
+
+#endif // __WLEffectCache_H__
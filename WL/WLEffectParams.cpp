@@ -0,0 +1,205 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: WLEffectParams.cpp
+//
+// Author: snez
+//
+// Desc: Effect parameters set through handles, with the values the effects have remembered.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "WLEffectParams.h"
+
+EffectParams::EffectParams(bool bPool)
+{
+	m_bPool = bPool;
+	ZeroMemory(&m_Stats, sizeof(m_Stats));
+}
+
+EffectParams::~EffectParams()
+{
+	for (int i = 0; i < m_Params.GetSize(); i++)
+		SAFE_DELETE_ARRAY(m_Params[i].pValue);
+}
+
+void EffectParams::AddEffect(ID3DXEffect* pEffect)
+{
+	if (pEffect == NULL || m_Effects.Contains(pEffect))
+		return;
+
+	m_Effects.Add(pEffect);
+
+	// A new effect may not have picked up the shared values, give them to it again
+	if (m_bPool)
+		Invalidate();
+
+	for (int i = 0; i < m_Params.GetSize(); i++)
+		if (m_Params[i].pEffect == NULL)
+			Resolve(m_Params[i]);
+}
+
+void EffectParams::RemoveEffect(ID3DXEffect* pEffect)
+{
+	int iEffect = m_Effects.IndexOf(pEffect);
+	if (iEffect < 0)
+		return;
+
+	m_Effects.Remove(iEffect);
+
+	// Shared parameters may still be found in the effects left
+	for (int i = 0; i < m_Params.GetSize(); i++)
+		if (m_Params[i].pEffect == pEffect)
+			Resolve(m_Params[i]);
+}
+
+//
+//	Finds the parameter in the first effect that has it and makes room for its value
+//
+void EffectParams::Resolve(ParamDecl& decl)
+{
+	decl.pEffect = NULL;
+	decl.hParam = NULL;
+	decl.nKnown = 0;
+
+	for (int i = 0; i < m_Effects.GetSize(); i++)
+	{
+		D3DXHANDLE hParam = m_Effects[i]->GetParameterByName(NULL, decl.strName);
+		D3DXPARAMETER_DESC desc;
+		if (hParam == NULL || FAILED(m_Effects[i]->GetParameterDesc(hParam, &desc)))
+			continue;
+
+		bool bShared = (desc.Flags & D3DX_PARAMETER_SHARED) != 0;
+		if (m_bPool && !bShared)
+			continue;
+
+		// Objects are remembered by their pointers
+		UINT nSize = desc.Bytes;
+		if (desc.Class == D3DXPC_OBJECT)
+			nSize = sizeof(void*) * max(desc.Elements, (UINT)1);
+
+		if (decl.pValue == NULL || decl.nSize != nSize)
+		{
+			SAFE_DELETE_ARRAY(decl.pValue);
+			decl.pValue = new BYTE[nSize];
+			decl.nSize = nSize;
+		}
+
+		decl.pEffect = m_Effects[i];
+		decl.hParam = hParam;
+		decl.bCached = m_bPool || !bShared;
+		return;
+	}
+}
+
+EffectParams::Param EffectParams::GetParam(LPCSTR strName)
+{
+	for (int i = 0; i < m_Params.GetSize(); i++)
+		if (strcmp(m_Params[i].strName, strName) == 0)
+			return i;
+
+	ParamDecl decl;
+	ZeroMemory(&decl, sizeof(decl));
+	StringCchCopyA(decl.strName, MAX_NAME, strName);
+	Resolve(decl);
+
+	if (FAILED(m_Params.Add(decl)))
+	{
+		SAFE_DELETE_ARRAY(decl.pValue);
+		return -1;
+	}
+	return m_Params.GetSize() - 1;
+}
+
+bool EffectParams::IsValid(Param hParam)
+{
+	return hParam >= 0 && hParam < m_Params.GetSize() && m_Params[hParam].pEffect != NULL;
+}
+
+//
+//	Remembers the new value and returns the parameter to upload it to, or NULL when the
+//	effect has the value already or doesn't have the parameter
+//
+EffectParams::ParamDecl* EffectParams::Change(Param hParam, const void* pData, UINT nBytes)
+{
+	if (!IsValid(hParam))
+		return NULL;
+
+	ParamDecl& decl = m_Params[hParam];
+	if (decl.bCached && nBytes <= decl.nSize)
+	{
+		if (nBytes <= decl.nKnown && memcmp(decl.pValue, pData, nBytes) == 0)
+		{
+			m_Stats.nRedundant++;
+			return NULL;
+		}
+
+		// An array set in part leaves the rest of what the effect had
+		memcpy(decl.pValue, pData, nBytes);
+		decl.nKnown = max(decl.nKnown, nBytes);
+	}
+
+	m_Stats.nUploads++;
+	return &decl;
+}
+
+//
+//	Forgets the value if it didn't make it to the effect
+//
+static HRESULT Uploaded(UINT* pKnown, HRESULT hr)
+{
+	if (FAILED(hr))
+		*pKnown = 0;
+	return hr;
+}
+
+HRESULT EffectParams::SetBool(Param hParam, BOOL bValue)
+{
+	ParamDecl* pDecl = Change(hParam, &bValue, sizeof(bValue));
+	return pDecl ? Uploaded(&pDecl->nKnown, pDecl->pEffect->SetBool(pDecl->hParam, bValue)) : S_OK;
+}
+
+HRESULT EffectParams::SetFloat(Param hParam, float fValue)
+{
+	ParamDecl* pDecl = Change(hParam, &fValue, sizeof(fValue));
+	return pDecl ? Uploaded(&pDecl->nKnown, pDecl->pEffect->SetFloat(pDecl->hParam, fValue)) : S_OK;
+}
+
+HRESULT EffectParams::SetVector(Param hParam, const D3DXVECTOR4& vValue)
+{
+	// A float3 parameter only keeps x, y and z, so only those are compared
+	UINT nBytes = IsValid(hParam) ? min(m_Params[hParam].nSize, (UINT)sizeof(vValue)) : 0;
+	ParamDecl* pDecl = Change(hParam, &vValue, nBytes);
+	return pDecl ? Uploaded(&pDecl->nKnown, pDecl->pEffect->SetVector(pDecl->hParam, &vValue)) : S_OK;
+}
+
+HRESULT EffectParams::SetMatrix(Param hParam, const D3DXMATRIX& mValue)
+{
+	ParamDecl* pDecl = Change(hParam, &mValue, sizeof(mValue));
+	return pDecl ? Uploaded(&pDecl->nKnown, pDecl->pEffect->SetMatrix(pDecl->hParam, &mValue)) : S_OK;
+}
+
+HRESULT EffectParams::SetVectorArray(Param hParam, const D3DXVECTOR4* pValues, UINT nCount)
+{
+	ParamDecl* pDecl = Change(hParam, pValues, nCount * sizeof(D3DXVECTOR4));
+	return pDecl ? Uploaded(&pDecl->nKnown, pDecl->pEffect->SetVectorArray(pDecl->hParam, pValues, nCount)) : S_OK;
+}
+
+HRESULT EffectParams::SetValue(Param hParam, const void* pData, UINT nBytes)
+{
+	ParamDecl* pDecl = Change(hParam, pData, nBytes);
+	return pDecl ? Uploaded(&pDecl->nKnown, pDecl->pEffect->SetValue(pDecl->hParam, pData, nBytes)) : S_OK;
+}
+
+HRESULT EffectParams::SetTexture(Param hParam, LPDIRECT3DBASETEXTURE9 pTexture)
+{
+	// The effect holds a reference to the texture it has, so no other texture can turn
+	// up at the same address while the pointer is remembered
+	ParamDecl* pDecl = Change(hParam, &pTexture, sizeof(pTexture));
+	return pDecl ? Uploaded(&pDecl->nKnown, pDecl->pEffect->SetTexture(pDecl->hParam, pTexture)) : S_OK;
+}
+
+void EffectParams::Invalidate()
+{
+	for (int i = 0; i < m_Params.GetSize(); i++)
+		m_Params[i].nKnown = 0;
+}
@@ -0,0 +1,99 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: WLEffectParams.h
+//
+// Author: snez
+//
+// Desc: Effect parameters looked up by name once, when the effect is loaded, and set
+//       through the handle from then on. The last value given to every parameter is
+//       remembered, and setting the value the effect already has costs nothing.
+//
+//       A block either belongs to one effect, or spans all the effects of an effect pool
+//       and sets the parameters they share, like the view and projection of the frame.
+//       Setting a shared parameter through one effect changes it for every effect in the
+//       pool, so the block of a single effect always uploads those.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __WLEffectParams_H__
+#define __WLEffectParams_H__
+
+#include "dxstdafx.h"
+
+class EffectParams
+{
+public:
+	typedef int Param;
+
+	struct Stats
+	{
+		UINT	nUploads;			// Values that reached an effect
+		UINT	nRedundant;			// Values dropped, the effect had them already
+	};
+
+	//
+	//	A pool block only looks up the parameters marked shared in the effects
+	//
+	explicit EffectParams(bool bPool = false);
+	~EffectParams();
+
+	//
+	//	The effects the names are looked up in. Effects are not referenced, remove them
+	//	before they are released.
+	//
+	void AddEffect(ID3DXEffect* pEffect);
+	void RemoveEffect(ID3DXEffect* pEffect);
+
+	//
+	//	Registers a parameter, away from the hot path. Asking for a name again returns the
+	//	same Param. A name no effect has yet is looked up again as effects are added, and
+	//	setting it meanwhile does nothing.
+	//
+	Param GetParam(LPCSTR strName);
+	bool IsValid(Param hParam);
+
+	//
+	//	Only values that differ from the last ones reach the effect
+	//
+	HRESULT SetBool(Param hParam, BOOL bValue);
+	HRESULT SetFloat(Param hParam, float fValue);
+	HRESULT SetVector(Param hParam, const D3DXVECTOR4& vValue);
+	HRESULT SetMatrix(Param hParam, const D3DXMATRIX& mValue);
+	HRESULT SetVectorArray(Param hParam, const D3DXVECTOR4* pValues, UINT nCount);
+	HRESULT SetValue(Param hParam, const void* pData, UINT nBytes);
+	HRESULT SetTexture(Param hParam, LPDIRECT3DBASETEXTURE9 pTexture);
+
+	//
+	//	Forget the values, for when a parameter was set behind the block's back
+	//
+	void Invalidate();
+
+	inline const Stats& GetStats() const { return m_Stats; }
+
+private:
+	EffectParams(const EffectParams&);
+	EffectParams& operator=(const EffectParams&);
+
+	enum { MAX_NAME = 32 };
+
+	struct ParamDecl
+	{
+		CHAR			strName[MAX_NAME];
+		ID3DXEffect*	pEffect;			// The effect the handle belongs to, NULL if not found
+		D3DXHANDLE		hParam;
+		bool			bCached;			// False for shared parameters of a single effect
+		UINT			nSize;				// Bytes of pValue
+		UINT			nKnown;				// Leading bytes of pValue the effect is known to have
+		BYTE*			pValue;
+	};
+
+	void Resolve(ParamDecl& decl);
+	ParamDecl* Change(Param hParam, const void* pData, UINT nBytes);
+
+	bool							m_bPool;
+	CGrowableArray<ID3DXEffect*>	m_Effects;
+	CGrowableArray<ParamDecl>		m_Params;
+	Stats							m_Stats;
+};
+
+#endif // __WLEffectParams_H__
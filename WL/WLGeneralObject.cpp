@@ -1,33 +1,55 @@
-#include "WLGeneralObject.h"
-
-GeneralObject::GeneralObject()
-{
-	pMesh = NULL;
-	m_vVelocity = D3DXVECTOR3(0,0,0);
-	D3DXMatrixIdentity(&m_mWorldMatrix);
-}
-
-HRESULT GeneralObject::OnCreateDevice(IDirect3DDevice9* pd3dDevice)
-{ 
-	return D3D_OK; 
-}
-
-void GeneralObject::Render()
-{
-	DXUTGetD3DDevice()->SetTransform(D3DTS_WORLD, &m_mWorldMatrix);
-
-	if (pMesh)
-		pMesh->Render();
-}
-
-D3DXVECTOR3 GeneralObject::GetPosition()
-{
-	return D3DXVECTOR3(m_mWorldMatrix._41,m_mWorldMatrix._42,m_mWorldMatrix._43);
-}
-
-void GeneralObject::SetPosition(const D3DXVECTOR3& pos)
-{
-	m_mWorldMatrix._41 = pos.x;
-	m_mWorldMatrix._42 = pos.y;
-	m_mWorldMatrix._43 = pos.z;
+#include "WLGeneralObject.h"
+#include "WLStateCache.h"
+
+GeneralObject::GeneralObject(const WL::SceneObject* pSimulated)
+{
+	pMesh = NULL;
+	m_pSimulated = pSimulated;
+}
+
+HRESULT GeneralObject::OnCreateDevice(IDirect3DDevice9* pd3dDevice)
+{ 
+	return D3D_OK; 
+}
+
+void GeneralObject::Render()
+{
+	StateCache::Get().SetTransform(D3DTS_WORLD, &GetRenderMatrix());
+
+	if (pMesh)
+		pMesh->Render();
+}
+
+void GeneralObject::Submit(RenderQueue& queue)
+{
+	if (pMesh == NULL)
+	{
+		queue.Submit(RenderQueue::PASS_OPAQUE, NULL, NULL, GetRenderPosition(), DrawObject, this, 0, RQ_SETS_TEXTURES);
+		return;
+	}
+
+	for (DWORD i = 0; i < pMesh->GetNumSubsets(); i++)
+		queue.Submit(RenderQueue::PASS_OPAQUE, NULL, pMesh->GetTexture(i), GetRenderPosition(), DrawMeshSubset, this, i);
+}
+
+void GeneralObject::SubmitParticles(RenderQueue& queue, ParticleSystem* pParticles)
+{
+	queue.Submit(RenderQueue::PASS_TRANSPARENT, NULL, pParticles->GetTexture(), pParticles->GetPosition(), DrawParticles, pParticles);
+}
+
+void GeneralObject::DrawObject(void* pObject, UINT nParam)
+{
+	((GeneralObject*)pObject)->Render();
+}
+
+void GeneralObject::DrawMeshSubset(void* pObject, UINT iSubset)
+{
+	GeneralObject* pThis = (GeneralObject*)pObject;
+	StateCache::Get().SetTransform(D3DTS_WORLD, &pThis->GetRenderMatrix());
+	pThis->pMesh->RenderSubset(iSubset);
+}
+
+void GeneralObject::DrawParticles(void* pParticles, UINT nParam)
+{
+	((ParticleSystem*)pParticles)->Draw();
 }
\ No newline at end of file
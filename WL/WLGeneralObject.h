@@ -1,33 +1,43 @@
-#pragma once
-
-#include "dxstdafx.h"
-#include "..\XMesh.h"
-
-class GeneralObject 
-{
-protected:
-
-	XMesh* pMesh;
-	D3DXMATRIX m_mWorldMatrix;
-	D3DXVECTOR3 m_vVelocity;
-
-public:
-
-	GeneralObject();
-	virtual ~GeneralObject() = 0 {};
-
-	virtual void Render();
-	virtual void Update(float timeDelta){};
-
-	inline void SetMatrix(const D3DXMATRIX& matrix) { m_mWorldMatrix = matrix; }
-	inline D3DXMATRIX GetViewMatrix() { return m_mWorldMatrix; }
-	D3DXVECTOR3 GetPosition();
-	void SetPosition(const D3DXVECTOR3& pos);	
-	D3DXVECTOR3 GetVelocity();
-	void SetVelocity(const D3DXVECTOR3& pos);
-
-	virtual HRESULT OnCreateDevice(IDirect3DDevice9* pd3dDevice);
-	virtual void OnResetDevice(){};
-	virtual void OnLostDevice(){};
-	virtual void OnDestroyDevice(){};
-};
+#pragma once
+
+#include "dxstdafx.h"
+#include "..\Particle.h"
+#include "..\XMesh.h"
+#include "WLRenderQueue.h"
+#include "WLSceneSimulation.h"
+
+//
+//	Draws an object of the scene's simulation, as its last published step has it
+//
+class GeneralObject 
+{
+protected:
+
+	XMesh* pMesh;
+	const WL::SceneObject* m_pSimulated;			// Where the object is, published by the simulation
+
+	// Draw functions for the render queue, the object is the GeneralObject
+	static void DrawObject(void* pObject, UINT nParam);
+	static void DrawMeshSubset(void* pObject, UINT iSubset);
+	static void DrawParticles(void* pParticles, UINT nParam);
+
+	void SubmitParticles(RenderQueue& queue, ParticleSystem* pParticles);
+
+public:
+
+	GeneralObject(const WL::SceneObject* pSimulated);
+	virtual ~GeneralObject() = 0 {};
+
+	virtual void Render();						// Draws the last published step
+
+	// Hands the draws of the object to the queue, a packet for every subset of the mesh
+	virtual void Submit(RenderQueue& queue);
+
+	inline const D3DXMATRIX& GetRenderMatrix() const { return m_pSimulated->GetRenderMatrix(); }
+	inline D3DXVECTOR3 GetRenderPosition() const { return m_pSimulated->GetRenderPosition(); }
+
+	virtual HRESULT OnCreateDevice(IDirect3DDevice9* pd3dDevice);
+	virtual void OnResetDevice(){};
+	virtual void OnLostDevice(){};
+	virtual void OnDestroyDevice(){};
+};
@@ -0,0 +1,231 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: WLGpuProfiler.cpp
+//
+// Author: snez
+//
+// Desc: GPU stages timed with a ring of timestamp frames, and a mock GPU clock.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "WLGpuProfiler.h"
+#include <string.h>
+#include <wchar.h>
+
+WL::MockGpuTimestamps::MockGpuTimestamps(int nLatency, GpuTicks nFrequency, GpuTicks nIssueCost)
+{
+	memset(m_aFrames, 0, sizeof(m_aFrames));
+	m_nLatency = nLatency;
+	m_nFrequency = nFrequency;
+	m_nIssueCost = nIssueCost;
+	m_nClock = 0;
+	m_nTime = 0;
+	m_bDisjoint = false;
+}
+
+void WL::MockGpuTimestamps::BeginFrame(int iFrame)
+{
+	Frame& frame = m_aFrames[iFrame % MAX_FRAMES];
+	frame.nEnded = -1;
+	frame.bDisjoint = false;
+}
+
+void WL::MockGpuTimestamps::Issue(int iFrame, int iSlot)
+{
+	if (iSlot >= MAX_SLOTS)
+		return;
+
+	m_nClock += m_nIssueCost;
+	m_aFrames[iFrame % MAX_FRAMES].anTimestamps[iSlot] = m_nClock;
+}
+
+void WL::MockGpuTimestamps::EndFrame(int iFrame)
+{
+	Frame& frame = m_aFrames[iFrame % MAX_FRAMES];
+	frame.nEnded = ++m_nTime;
+	frame.bDisjoint = m_bDisjoint;
+	m_bDisjoint = false;
+}
+
+WL::GpuTimestamps::EResult WL::MockGpuTimestamps::ReadFrame(int iFrame, int nSlots, GpuTicks* anTimestamps, GpuTicks* pnFrequency)
+{
+	const Frame& frame = m_aFrames[iFrame % MAX_FRAMES];
+	if (frame.nEnded < 0 || nSlots > MAX_SLOTS)
+		return READ_DROPPED;
+	if (m_nTime - frame.nEnded < m_nLatency)
+	{
+		m_nTime++;
+		return READ_PENDING;
+	}
+	if (frame.bDisjoint)
+		return READ_DROPPED;
+
+	memcpy(anTimestamps, frame.anTimestamps, nSlots * sizeof(GpuTicks));
+	*pnFrequency = m_nFrequency;
+	return READ_DONE;
+}
+
+WL::GpuProfiler& WL::GpuProfiler::Get()
+{
+	static GpuProfiler s_profiler;
+	return s_profiler;
+}
+
+WL::GpuProfiler::GpuProfiler()
+{
+	m_pTimestamps = NULL;
+	memset(m_aFrames, 0, sizeof(m_aFrames));
+	m_iFrame = 0;
+	m_bTiming = false;
+	m_nDepth = 0;
+	m_nStages = 0;
+	m_fFrameTime = 0.0;
+	memset(&m_Stats, 0, sizeof(m_Stats));
+}
+
+void WL::GpuProfiler::SetTimestamps(GpuTimestamps* pTimestamps)
+{
+	m_pTimestamps = pTimestamps;
+	for (int i = 0; i < MAX_FRAMES; i++)
+		m_aFrames[i].bPending = false;
+	m_iFrame = 0;
+	m_bTiming = false;
+	m_nDepth = 0;
+	m_nStages = 0;
+	m_fFrameTime = 0.0;
+}
+
+void WL::GpuProfiler::BeginFrame()
+{
+	m_bTiming = false;
+	m_nDepth = 0;
+	if (m_pTimestamps == NULL)
+		return;
+
+	// The slot was issued MAX_FRAMES frames ago. If the GPU isn't done with it yet,
+	// this frame goes untimed instead of waiting.
+	FrameRecord& frame = m_aFrames[m_iFrame];
+	if (frame.bPending)
+	{
+		GpuTicks anTimestamps[MAX_SLOTS];
+		GpuTicks nFrequency = 0;
+		GpuTimestamps::EResult eResult = m_pTimestamps->ReadFrame(m_iFrame, frame.nSlots, anTimestamps, &nFrequency);
+		if (eResult == GpuTimestamps::READ_PENDING)
+		{
+			m_Stats.nFramesSkipped++;
+			return;
+		}
+
+		frame.bPending = false;
+		if (eResult == GpuTimestamps::READ_DONE && nFrequency != 0)
+			Resolve(frame, anTimestamps, nFrequency);
+		else
+			m_Stats.nFramesDropped++;
+	}
+
+	frame.nStages = 0;
+	frame.nSlots = 0;
+	m_pTimestamps->BeginFrame(m_iFrame);
+	m_pTimestamps->Issue(m_iFrame, frame.nSlots++);
+	m_bTiming = true;
+}
+
+void WL::GpuProfiler::EndFrame()
+{
+	if (!m_bTiming)
+		return;
+
+	FrameRecord& frame = m_aFrames[m_iFrame];
+	m_pTimestamps->Issue(m_iFrame, frame.nSlots++);
+	m_pTimestamps->EndFrame(m_iFrame);
+	frame.bPending = true;
+
+	m_iFrame = (m_iFrame + 1) % MAX_FRAMES;
+	m_bTiming = false;
+}
+
+int WL::GpuProfiler::BeginStage(const wchar_t* strName)
+{
+	FrameRecord& frame = m_aFrames[m_iFrame];
+
+	// Two slots for the stage, and the one EndFrame() takes
+	if (frame.nStages == MAX_STAGES || frame.nSlots + 3 > MAX_SLOTS)
+	{
+		m_Stats.nStagesLost++;
+		return -1;
+	}
+
+	StageRecord& stage = frame.aStages[frame.nStages];
+	stage.strName = strName;
+	stage.nDepth = m_nDepth++;
+	stage.iBegin = frame.nSlots++;
+	stage.iEnd = -1;
+	m_pTimestamps->Issue(m_iFrame, stage.iBegin);
+
+	return frame.nStages++;
+}
+
+void WL::GpuProfiler::EndStage(int iStage)
+{
+	// A stage open across EndFrame() or SetTimestamps() belongs to no frame anymore
+	if (!m_bTiming)
+		return;
+
+	FrameRecord& frame = m_aFrames[m_iFrame];
+	StageRecord& stage = frame.aStages[iStage];
+	m_nDepth--;
+	stage.iEnd = frame.nSlots++;
+	m_pTimestamps->Issue(m_iFrame, stage.iEnd);
+}
+
+//
+//	Adds the stages of a frame read back up by name and depth
+//
+void WL::GpuProfiler::Resolve(const FrameRecord& frame, const GpuTicks* anTimestamps, GpuTicks nFrequency)
+{
+	double fTicksToMs = 1000.0 / (double)nFrequency;
+
+	m_nStages = 0;
+	for (int s = 0; s < frame.nStages; s++)
+	{
+		const StageRecord& record = frame.aStages[s];
+		if (record.iEnd < 0)
+			continue;
+
+		int i = 0;
+		while (i < m_nStages && (m_aStages[i].nDepth != record.nDepth || wcscmp(m_aStages[i].strName, record.strName) != 0))
+			i++;
+
+		if (i == m_nStages)
+		{
+			m_aStages[i].strName = record.strName;
+			m_aStages[i].nDepth = record.nDepth;
+			m_aStages[i].nCalls = 0;
+			m_aStages[i].fTime = 0.0;
+			m_nStages++;
+		}
+
+		m_aStages[i].nCalls++;
+		m_aStages[i].fTime += (double)(anTimestamps[record.iEnd] - anTimestamps[record.iBegin]) * fTicksToMs;
+	}
+
+	m_fFrameTime = (double)(anTimestamps[frame.nSlots - 1] - anTimestamps[0]) * fTicksToMs;
+	m_Stats.nFramesTimed++;
+}
+
+bool WL::GpuProfiler::GetStageTime(const wchar_t* strName, double* pfTime) const
+{
+	bool bFound = false;
+	double fTime = 0.0;
+	for (int i = 0; i < m_nStages; i++)
+	{
+		if (wcscmp(m_aStages[i].strName, strName) == 0)
+		{
+			fTime += m_aStages[i].fTime;
+			bFound = true;
+		}
+	}
+
+	*pfTime = fTime;
+	return bFound;
+}
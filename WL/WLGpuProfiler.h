@@ -0,0 +1,239 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: WLGpuProfiler.h
+//
+// Author: snez
+//
+// Desc: The GPU side of the profiler. A stage puts a timestamp on the GPU where it
+//       begins and one where it ends, and the time between the two is what the GPU
+//       spent on it. Stages are named like the CPU zones, and WL_PROFILE_STAGE() opens
+//       both under one name, so the overlay puts the two times side by side.
+//
+//       The timestamps of a frame are read a few frames later. The frames in between
+//       keep their own timestamps in a ring, and when the oldest still isn't done the
+//       frame goes untimed rather than wait on the GPU. A frame the GPU clock changed
+//       speed during is dropped.
+//
+//       The profiler only knows the GPU through GpuTimestamps. GpuQueries gives it the
+//       device's timestamp queries, and MockGpuTimestamps a clock of its own, so the
+//       bookkeeping runs without a device.
+//
+//       Stages are only opened on the thread that draws.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __WLGpuProfiler_H__
+#define __WLGpuProfiler_H__
+
+#include "WLProfiler.h"
+
+namespace WL
+{
+
+#ifdef _WIN32
+	typedef unsigned __int64	GpuTicks;
+#else
+	typedef unsigned long long	GpuTicks;
+#endif
+
+	//
+	//	Timestamps on the GPU, kept for a ring of frames. A slot is one timestamp of
+	//	a frame.
+	//
+	class GpuTimestamps
+	{
+	public:
+		enum EResult
+		{
+			READ_DONE,							// The frame's timestamps are in
+			READ_PENDING,						// Not there yet, ask again later
+			READ_DROPPED						// Never will be, or not to be trusted
+		};
+
+		virtual ~GpuTimestamps() {}
+
+		virtual void BeginFrame(int iFrame) = 0;
+		virtual void Issue(int iFrame, int iSlot) = 0;
+		virtual void EndFrame(int iFrame) = 0;
+
+		//
+		//	Reads the first nSlots timestamps of a frame, and the ticks of a second
+		//
+		virtual EResult ReadFrame(int iFrame, int nSlots, GpuTicks* anTimestamps, GpuTicks* pnFrequency) = 0;
+	};
+
+	//
+	//	A GPU that takes nIssueCost ticks between any two timestamps, plus whatever
+	//	Advance() adds. It finishes a frame nLatency frames after it ended, counting a
+	//	read that found the frame pending as a frame gone by, like a GPU that keeps
+	//	working while it is not fed.
+	//
+	class MockGpuTimestamps : public GpuTimestamps
+	{
+	public:
+		enum { MAX_FRAMES = 8, MAX_SLOTS = 256 };
+
+		MockGpuTimestamps(int nLatency = 2, GpuTicks nFrequency = 1000000, GpuTicks nIssueCost = 10);
+
+		inline void Advance(GpuTicks nTicks) { m_nClock += nTicks; }
+		inline void SetDisjoint() { m_bDisjoint = true; }		// The frame being issued
+
+		virtual void BeginFrame(int iFrame);
+		virtual void Issue(int iFrame, int iSlot);
+		virtual void EndFrame(int iFrame);
+		virtual EResult ReadFrame(int iFrame, int nSlots, GpuTicks* anTimestamps, GpuTicks* pnFrequency);
+
+	private:
+		struct Frame
+		{
+			GpuTicks	anTimestamps[MAX_SLOTS];
+			long		nEnded;				// m_nTime when the frame ended
+			bool		bDisjoint;
+		};
+
+		Frame		m_aFrames[MAX_FRAMES];
+		int			m_nLatency;
+		GpuTicks	m_nFrequency;
+		GpuTicks	m_nIssueCost;
+		GpuTicks	m_nClock;
+		long		m_nTime;				// In frames
+		bool		m_bDisjoint;
+	};
+
+	class GpuProfiler
+	{
+	public:
+		//
+		//	The GPU time of the stages sharing a name and depth, over a frame
+		//
+		struct Stage
+		{
+			const wchar_t*	strName;
+			int				nDepth;
+			unsigned int	nCalls;
+			double			fTime;				// Milliseconds
+		};
+
+		struct Stats
+		{
+			unsigned int	nFramesTimed;
+			unsigned int	nFramesSkipped;		// The ring was full of frames the GPU hadn't done
+			unsigned int	nFramesDropped;		// Disjoint or failed
+			unsigned int	nStagesLost;		// Past MAX_STAGES or MAX_SLOTS
+		};
+
+		enum
+		{
+			MAX_FRAMES = 4,						// Frames in flight, the latency of the results
+			MAX_STAGES = 64,					// A frame
+			MAX_SLOTS = 2 * MAX_STAGES + 2		// Every stage and the frame, begin and end
+		};
+
+		static GpuProfiler& Get();
+
+		//
+		//	Where the timestamps go. NULL stops the timing, and the results of the frames
+		//	in flight are dropped.
+		//
+		void SetTimestamps(GpuTimestamps* pTimestamps);
+		inline bool HasTimestamps() const { return m_pTimestamps != NULL; }
+
+		//
+		//	Around everything the frame draws. BeginFrame() reads the oldest frame of the
+		//	ring back, if the GPU is done with it.
+		//
+		void BeginFrame();
+		void EndFrame();
+
+		inline bool IsTiming() const { return m_bTiming; }
+
+		// Used by GpuZone. BeginStage() returns -1 for a stage that isn't timed.
+		int BeginStage(const wchar_t* strName);
+		void EndStage(int iStage);
+
+		//
+		//	The last frame read back, in the order the stages began
+		//
+		inline int GetStageCount() const { return m_nStages; }
+		inline const Stage& GetStage(int i) const { return m_aStages[i]; }
+		inline double GetFrameTime() const { return m_fFrameTime; }		// Milliseconds
+
+		//
+		//	All the stages named strName, at any depth. False when there were none.
+		//
+		bool GetStageTime(const wchar_t* strName, double* pfTime) const;
+
+		inline const Stats& GetStats() const { return m_Stats; }
+
+	private:
+		GpuProfiler();
+		GpuProfiler(const GpuProfiler&);
+		GpuProfiler& operator=(const GpuProfiler&);
+
+		struct StageRecord
+		{
+			const wchar_t*	strName;
+			int				nDepth;
+			int				iBegin;				// Slots
+			int				iEnd;				// -1 while the stage runs
+		};
+
+		struct FrameRecord
+		{
+			StageRecord		aStages[MAX_STAGES];
+			int				nStages;
+			int				nSlots;
+			bool			bPending;			// Issued and not read yet
+		};
+
+		void Resolve(const FrameRecord& frame, const GpuTicks* anTimestamps, GpuTicks nFrequency);
+
+		GpuTimestamps*	m_pTimestamps;
+		FrameRecord		m_aFrames[MAX_FRAMES];
+		int				m_iFrame;				// The one being issued
+		bool			m_bTiming;
+		int				m_nDepth;
+
+		Stage			m_aStages[MAX_STAGES];
+		int				m_nStages;
+		double			m_fFrameTime;
+		Stats			m_Stats;
+	};
+
+	//
+	//	Times the scope it is declared in on the GPU
+	//
+	class GpuZone
+	{
+	public:
+		inline explicit GpuZone(const wchar_t* strName)
+		{
+			GpuProfiler& profiler = GpuProfiler::Get();
+			m_iStage = profiler.IsTiming() ? profiler.BeginStage(strName) : -1;
+		}
+
+		inline ~GpuZone()
+		{
+			if (m_iStage >= 0)
+				GpuProfiler::Get().EndStage(m_iStage);
+		}
+
+	private:
+		GpuZone(const GpuZone&);
+		GpuZone& operator=(const GpuZone&);
+
+		int		m_iStage;
+	};
+
+}
+
+#if WL_PROFILING
+	#define WL_PROFILE_GPU_ZONE(name)	WL::GpuZone WL_PROFILE_CONCAT(gpuZone, __LINE__)(name)
+#else
+	#define WL_PROFILE_GPU_ZONE(name)
+#endif
+
+// The same scope on the CPU and the GPU
+#define WL_PROFILE_STAGE(name)		WL_PROFILE_ZONE(name); WL_PROFILE_GPU_ZONE(name)
+
+#endif // __WLGpuProfiler_H__
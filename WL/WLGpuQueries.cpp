@@ -0,0 +1,131 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: WLGpuQueries.cpp
+//
+// Author: snez
+//
+// Desc: Timestamp queries of the device, in a ring of frames.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "WLGpuQueries.h"
+
+GpuQueries::GpuQueries()
+{
+	m_pd3dDevice = NULL;
+	ZeroMemory(m_aFrames, sizeof(m_aFrames));
+}
+
+GpuQueries::~GpuQueries()
+{
+	Release();
+}
+
+HRESULT GpuQueries::Create(IDirect3DDevice9* pd3dDevice)
+{
+	HRESULT hr;
+
+	Release();
+
+	// A NULL query only asks whether the type is supported
+	if (FAILED(pd3dDevice->CreateQuery(D3DQUERYTYPE_TIMESTAMP, NULL)) ||
+		FAILED(pd3dDevice->CreateQuery(D3DQUERYTYPE_TIMESTAMPDISJOINT, NULL)) ||
+		FAILED(pd3dDevice->CreateQuery(D3DQUERYTYPE_TIMESTAMPFREQ, NULL)))
+		return E_NOTIMPL;
+
+	hr = S_OK;
+	for (int i = 0; i < WL::GpuProfiler::MAX_FRAMES && SUCCEEDED(hr); i++)
+	{
+		hr = pd3dDevice->CreateQuery(D3DQUERYTYPE_TIMESTAMPDISJOINT, &m_aFrames[i].pDisjoint);
+		if (SUCCEEDED(hr))
+			hr = pd3dDevice->CreateQuery(D3DQUERYTYPE_TIMESTAMPFREQ, &m_aFrames[i].pFrequency);
+	}
+
+	if (FAILED(hr))
+	{
+		Release();
+		return hr;
+	}
+
+	m_pd3dDevice = pd3dDevice;
+	return S_OK;
+}
+
+void GpuQueries::Release()
+{
+	for (int i = 0; i < WL::GpuProfiler::MAX_FRAMES; i++)
+	{
+		Frame& frame = m_aFrames[i];
+		SAFE_RELEASE(frame.pDisjoint);
+		SAFE_RELEASE(frame.pFrequency);
+		for (int s = 0; s < WL::GpuProfiler::MAX_SLOTS; s++)
+			SAFE_RELEASE(frame.apTimestamps[s]);
+		frame.bFailed = false;
+	}
+	m_pd3dDevice = NULL;
+}
+
+void GpuQueries::BeginFrame(int iFrame)
+{
+	Frame& frame = m_aFrames[iFrame];
+	frame.bFailed = false;
+	frame.pDisjoint->Issue(D3DISSUE_BEGIN);
+}
+
+void GpuQueries::Issue(int iFrame, int iSlot)
+{
+	Frame& frame = m_aFrames[iFrame];
+	if (frame.apTimestamps[iSlot] == NULL &&
+		FAILED(m_pd3dDevice->CreateQuery(D3DQUERYTYPE_TIMESTAMP, &frame.apTimestamps[iSlot])))
+	{
+		frame.bFailed = true;
+		return;
+	}
+
+	frame.apTimestamps[iSlot]->Issue(D3DISSUE_END);
+}
+
+void GpuQueries::EndFrame(int iFrame)
+{
+	Frame& frame = m_aFrames[iFrame];
+	frame.pFrequency->Issue(D3DISSUE_END);
+	frame.pDisjoint->Issue(D3DISSUE_END);
+}
+
+//
+//	Lost devices fail the queries, the frame is dropped rather than waited for
+//
+WL::GpuTimestamps::EResult GpuQueries::ReadFrame(int iFrame, int nSlots, WL::GpuTicks* anTimestamps, WL::GpuTicks* pnFrequency)
+{
+	Frame& frame = m_aFrames[iFrame];
+	BOOL bDisjoint = TRUE;
+	UINT64 nFrequency = 0;
+	HRESULT hr;
+
+	// The disjoint query ends last, once it is there the rest are as well
+	hr = frame.pDisjoint->GetData(&bDisjoint, sizeof(bDisjoint), 0);
+	if (hr == S_FALSE)
+		return READ_PENDING;
+	if (FAILED(hr) || bDisjoint || frame.bFailed)
+		return READ_DROPPED;
+
+	hr = frame.pFrequency->GetData(&nFrequency, sizeof(nFrequency), 0);
+	if (hr == S_FALSE)
+		return READ_PENDING;
+	if (FAILED(hr))
+		return READ_DROPPED;
+
+	for (int s = 0; s < nSlots; s++)
+	{
+		UINT64 nTimestamp = 0;
+		hr = frame.apTimestamps[s]->GetData(&nTimestamp, sizeof(nTimestamp), 0);
+		if (hr == S_FALSE)
+			return READ_PENDING;
+		if (FAILED(hr))
+			return READ_DROPPED;
+		anTimestamps[s] = nTimestamp;
+	}
+
+	*pnFrequency = nFrequency;
+	return READ_DONE;
+}
@@ -0,0 +1,51 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: WLGpuQueries.h
+//
+// Author: snez
+//
+// Desc: The device's timestamp queries, for the GPU profiler. Every frame of the ring
+//       has a disjoint and a frequency query around its timestamps. The timestamp
+//       queries are made the first time a slot is issued, so a frame with few stages
+//       doesn't hold queries for many.
+//
+//       Queries are released with the device's default pool and made again after a
+//       reset. Create() fails when the device has no timestamps, and the frames then go
+//       untimed.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __WLGpuQueries_H__
+#define __WLGpuQueries_H__
+
+#include "dxstdafx.h"
+#include "WLGpuProfiler.h"
+
+class GpuQueries : public WL::GpuTimestamps
+{
+public:
+	GpuQueries();
+	virtual ~GpuQueries();
+
+	HRESULT Create(IDirect3DDevice9* pd3dDevice);
+	void Release();
+
+	virtual void BeginFrame(int iFrame);
+	virtual void Issue(int iFrame, int iSlot);
+	virtual void EndFrame(int iFrame);
+	virtual EResult ReadFrame(int iFrame, int nSlots, WL::GpuTicks* anTimestamps, WL::GpuTicks* pnFrequency);
+
+private:
+	struct Frame
+	{
+		LPDIRECT3DQUERY9	pDisjoint;
+		LPDIRECT3DQUERY9	pFrequency;
+		LPDIRECT3DQUERY9	apTimestamps[WL::GpuProfiler::MAX_SLOTS];
+		bool				bFailed;			// A query couldn't be made, the frame is dropped
+	};
+
+	IDirect3DDevice9*	m_pd3dDevice;
+	Frame				m_aFrames[WL::GpuProfiler::MAX_FRAMES];
+};
+
+#endif // __WLGpuQueries_H__
@@ -0,0 +1,1313 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: WLHDRReference.cpp
+//
+// Author: snez
+//
+// Desc: CPU version of the HDRSun post-processing chain.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "WLHDRReference.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__SSE__)
+	#define WL_HDR_SSE
+	#include <xmmintrin.h>
+#endif
+
+//
+//	Constants from HDRLighting.fx
+//
+static const float BRIGHT_PASS_THRESHOLD = 5.0f;
+static const float BRIGHT_PASS_OFFSET = 10.0f;
+static const float LUMINANCE_VECTOR[3] = { 0.2125f, 0.7154f, 0.0721f };
+static const float BLUE_SHIFT_VECTOR[3] = { 1.05f, 0.97f, 1.27f };
+
+const float WL::HDR_CHROMATIC_ABERRATION_COLOR[8][4] =
+{
+	{ 0.5f, 0.5f, 0.5f, 0.0f },
+	{ 0.8f, 0.3f, 0.3f, 0.0f },
+	{ 1.0f, 0.2f, 0.2f, 0.0f },
+	{ 0.5f, 0.2f, 0.6f, 0.0f },
+	{ 0.2f, 0.2f, 1.0f, 0.0f },
+	{ 0.2f, 0.3f, 0.7f, 0.0f },
+	{ 0.2f, 0.6f, 0.2f, 0.0f },
+	{ 0.3f, 0.5f, 0.3f, 0.0f },
+};
+
+// The same as D3DXToRadian(), so the lines come out as they did from the D3DX tables
+#define DEGREES(a)	((a) * (3.141592654f / 180.0f))
+
+//	passes	length	attn	inclination
+static const WL::HDRStarLine STAR_LINES_CROSS[] =
+{
+	{ 3, 1.0f, 0.85f, DEGREES(0.0f) },
+	{ 3, 1.0f, 0.85f, DEGREES(90.0f) },
+	{ 3, 1.0f, 0.85f, DEGREES(180.0f) },
+	{ 3, 1.0f, 0.85f, DEGREES(270.0f) },
+};
+
+static const WL::HDRStarLine STAR_LINES_CROSS_FILTER[] =
+{
+	{ 3, 1.0f, 0.95f, DEGREES(0.0f) },
+	{ 3, 1.0f, 0.95f, DEGREES(90.0f) },
+	{ 3, 1.0f, 0.95f, DEGREES(180.0f) },
+	{ 3, 1.0f, 0.95f, DEGREES(270.0f) },
+};
+
+static const WL::HDRStarLine STAR_LINES_SNOW_CROSS[] =
+{
+	{ 3, 1.0f, 0.96f, DEGREES(0.0f) },
+	{ 3, 1.0f, 0.96f, DEGREES(60.0f) },
+	{ 3, 1.0f, 0.96f, DEGREES(120.0f) },
+	{ 3, 1.0f, 0.96f, DEGREES(180.0f) },
+	{ 3, 1.0f, 0.96f, DEGREES(240.0f) },
+	{ 3, 1.0f, 0.96f, DEGREES(300.0f) },
+};
+
+static const WL::HDRStarLine STAR_LINES_VERTICAL[] =
+{
+	{ 3, 1.0f, 0.96f, DEGREES(0.0f) },
+	{ 3, 1.0f, 0.96f, DEGREES(180.0f) },
+};
+
+static const WL::HDRStarLine STAR_LINES_SUNNY_CROSS[] =
+{
+	{ 3, 1.0f, 0.95f, DEGREES(0.0f) },		// long
+	{ 3, 1.0f, 0.88f, DEGREES(45.0f) },
+	{ 3, 1.0f, 0.95f, DEGREES(90.0f) },		// long
+	{ 3, 1.0f, 0.88f, DEGREES(135.0f) },
+	{ 3, 1.0f, 0.95f, DEGREES(180.0f) },	// long
+	{ 3, 1.0f, 0.88f, DEGREES(225.0f) },
+	{ 3, 1.0f, 0.95f, DEGREES(270.0f) },	// long
+	{ 3, 1.0f, 0.88f, DEGREES(315.0f) },
+};
+
+#define STAR_LINES(a)	(int)(sizeof(a) / sizeof(WL::HDRStarLine)), (a)
+
+const WL::HDRStarLib WL::HDR_STAR_LIB[HDR_STAR_LIB_TYPES] =
+{
+	//	lines								rotate				bRotation
+	{ 0, NULL,								DEGREES(0.0f),		false },	// STLT_DISABLE
+	{ STAR_LINES(STAR_LINES_CROSS),			DEGREES(0.0f),		true },		// STLT_CROSS
+	{ STAR_LINES(STAR_LINES_CROSS_FILTER),	DEGREES(0.0f),		true },		// STLT_CROSSFILTER
+	{ STAR_LINES(STAR_LINES_SNOW_CROSS),	DEGREES(20.0f),		true },		// STLT_SNOWCROSS
+	{ STAR_LINES(STAR_LINES_VERTICAL),		DEGREES(0.0f),		false },	// STLT_VERTICAL
+	{ STAR_LINES(STAR_LINES_SUNNY_CROSS),	DEGREES(0.0f),		false },	// STLT_SUNNYCROSS
+};
+
+#undef STAR_LINES
+#undef DEGREES
+
+const float WL::HDR_BLOOM_KERNEL[8] =
+{
+	0.132980749f, 0.125794396f, 0.106482655f, 0.0806569010f,
+	0.0546700172f, 0.0331590436f, 0.0179969873f, 0.00874062814f,
+};
+
+// In the order HDRSun hands them to the shader, which only reads the first 12
+const WL::KernelSample WL::HDR_GAUSS_BLUR_5X5_KERNEL[13] =
+{
+	{ -2,  0, 0.0248824656f },
+	{ -1, -1, 0.0676375553f },
+	{ -1,  0, 0.111515477f },
+	{ -1,  1, 0.0676375553f },
+	{  0, -2, 0.0248824656f },
+	{  0, -1, 0.111515477f },
+	{  0,  0, 0.183857948f },
+	{  0,  1, 0.111515477f },
+	{  0,  2, 0.0248824656f },
+	{  1, -1, 0.0676375553f },
+	{  1,  0, 0.111515477f },
+	{  1,  1, 0.0676375553f },
+	{  2,  0, 0.0248824656f },
+};
+
+static const float PI = 3.141592654f;
+
+//
+//	Four floats, one pixel. SSE when available, plain floats otherwise.
+//
+#ifdef WL_HDR_SSE
+
+struct Float4
+{
+	__m128 v;
+};
+
+static inline Float4 Load(const float* p) { Float4 r; r.v = _mm_loadu_ps(p); return r; }
+static inline void Store(float* p, Float4 a) { _mm_storeu_ps(p, a.v); }
+static inline Float4 Set(float x, float y, float z, float w) { Float4 r; r.v = _mm_setr_ps(x, y, z, w); return r; }
+static inline Float4 Splat(float f) { Float4 r; r.v = _mm_set1_ps(f); return r; }
+static inline Float4 Add(Float4 a, Float4 b) { Float4 r; r.v = _mm_add_ps(a.v, b.v); return r; }
+static inline Float4 Sub(Float4 a, Float4 b) { Float4 r; r.v = _mm_sub_ps(a.v, b.v); return r; }
+static inline Float4 Mul(Float4 a, Float4 b) { Float4 r; r.v = _mm_mul_ps(a.v, b.v); return r; }
+static inline Float4 Div(Float4 a, Float4 b) { Float4 r; r.v = _mm_div_ps(a.v, b.v); return r; }
+static inline Float4 Max(Float4 a, Float4 b) { Float4 r; r.v = _mm_max_ps(a.v, b.v); return r; }
+static inline Float4 Min(Float4 a, Float4 b) { Float4 r; r.v = _mm_min_ps(a.v, b.v); return r; }
+static inline Float4 MulAdd(Float4 a, Float4 b, Float4 c) { Float4 r; r.v = _mm_add_ps(_mm_mul_ps(a.v, b.v), c.v); return r; }
+
+#else
+
+struct Float4
+{
+	float v[4];
+};
+
+static inline Float4 Load(const float* p) { Float4 r; r.v[0] = p[0]; r.v[1] = p[1]; r.v[2] = p[2]; r.v[3] = p[3]; return r; }
+static inline void Store(float* p, Float4 a) { p[0] = a.v[0]; p[1] = a.v[1]; p[2] = a.v[2]; p[3] = a.v[3]; }
+static inline Float4 Set(float x, float y, float z, float w) { Float4 r; r.v[0] = x; r.v[1] = y; r.v[2] = z; r.v[3] = w; return r; }
+static inline Float4 Splat(float f) { return Set(f, f, f, f); }
+
+#define FLOAT4_OP(name, expr) \
+	static inline Float4 name(Float4 a, Float4 b) \
+	{ \
+		Float4 r; \
+		for (int i = 0; i < 4; i++) \
+			r.v[i] = expr; \
+		return r; \
+	}
+
+FLOAT4_OP(Add, a.v[i] + b.v[i])
+FLOAT4_OP(Sub, a.v[i] - b.v[i])
+FLOAT4_OP(Mul, a.v[i] * b.v[i])
+FLOAT4_OP(Div, a.v[i] / b.v[i])
+FLOAT4_OP(Max, a.v[i] > b.v[i] ? a.v[i] : b.v[i])
+FLOAT4_OP(Min, a.v[i] < b.v[i] ? a.v[i] : b.v[i])
+
+#undef FLOAT4_OP
+
+static inline Float4 MulAdd(Float4 a, Float4 b, Float4 c) { return Add(Mul(a, b), c); }
+
+#endif
+
+static inline Float4 Saturate(Float4 a)
+{
+	return Min(Max(a, Splat(0.0f)), Splat(1.0f));
+}
+
+static inline float Luminance(const float* pPixel)
+{
+	return pPixel[0] * LUMINANCE_VECTOR[0] + pPixel[1] * LUMINANCE_VECTOR[1] + pPixel[2] * LUMINANCE_VECTOR[2];
+}
+
+static inline int Clamp(int i, int nMax)
+{
+	return i < 0 ? 0 : (i > nMax ? nMax : i);
+}
+
+//
+//	Sampling with clamp addressing. Coordinates are in texels of the image, the way the
+//	GPU sees them: texel centers sit at half integers.
+//
+static inline Float4 SamplePoint(const WL::FloatImage& image, float x, float y)
+{
+	int ix = Clamp((int)floorf(x), image.GetWidth() - 1);
+	int iy = Clamp((int)floorf(y), image.GetHeight() - 1);
+	return Load(image.GetPixel(ix, iy));
+}
+
+static inline Float4 SampleLinear(const WL::FloatImage& image, float x, float y)
+{
+	x -= 0.5f;
+	y -= 0.5f;
+	float fx0 = floorf(x);
+	float fy0 = floorf(y);
+	float ax = x - fx0;
+	float ay = y - fy0;
+
+	int nMaxX = image.GetWidth() - 1;
+	int nMaxY = image.GetHeight() - 1;
+	int x0 = Clamp((int)fx0, nMaxX);
+	int x1 = Clamp((int)fx0 + 1, nMaxX);
+	int y0 = Clamp((int)fy0, nMaxY);
+	int y1 = Clamp((int)fy0 + 1, nMaxY);
+
+	Float4 top = MulAdd(Sub(Load(image.GetPixel(x1, y0)), Load(image.GetPixel(x0, y0))), Splat(ax), Load(image.GetPixel(x0, y0)));
+	Float4 bottom = MulAdd(Sub(Load(image.GetPixel(x1, y1)), Load(image.GetPixel(x0, y1))), Splat(ax), Load(image.GetPixel(x0, y1)));
+	return MulAdd(Sub(bottom, top), Splat(ay), top);
+}
+
+//
+//	Rectangles and texture coordinates, as HDRSun::GetTextureRect()/GetTextureCoords()
+//
+struct ImageRect
+{
+	int left, top, right, bottom;
+};
+
+static ImageRect FullRect(const WL::FloatImage& image)
+{
+	ImageRect rect = { 0, 0, image.GetWidth(), image.GetHeight() };
+	return rect;
+}
+
+// The rectangle inside the one texel black border
+static ImageRect InnerRect(const WL::FloatImage& image)
+{
+	ImageRect rect = { 1, 1, image.GetWidth() - 1, image.GetHeight() - 1 };
+	return rect;
+}
+
+//
+//	A pass drawing a quad over the destination, as the GaussBlur5x5, DownScale, Bloom
+//	and Star shaders do: a weighted sum of samples around the interpolated coordinate
+//
+struct FilterJob
+{
+	const WL::FloatImage*	pSrc;
+	WL::FloatImage*			pDest;
+	float					fLeftU, fTopV, fRightU, fBottomV;	// Texture coordinates of the quad
+	ImageRect				rcScissor;							// Pixels written
+	int						nSamples;
+	float					afOffsets[HDR_MAX_SAMPLES][2];		// Texture coordinate offsets
+	float					afWeights[HDR_MAX_SAMPLES][4];
+	bool					bLinear;
+	bool					bSaturate;							// Target is 8 bits per channel
+	bool					bBrightPass;						// Run BrightPassFilter on the sample
+	float					fBrightPassScale;					// g_fMiddleGray / adapted luminance
+	const WL::FloatImage*	pBase;								// Destination sized, added point sampled
+	float					fBaseWeight;
+};
+
+static void SetupFilter(FilterJob* pJob, const WL::FloatImage& src, const ImageRect* pSrcRect,
+						WL::FloatImage& dest, const ImageRect* pDestRect)
+{
+	memset(pJob, 0, sizeof(FilterJob));
+	pJob->pSrc = &src;
+	pJob->pDest = &dest;
+	pJob->rcScissor = pDestRect ? *pDestRect : FullRect(dest);
+
+	pJob->fLeftU = 0.0f;
+	pJob->fTopV = 0.0f;
+	pJob->fRightU = 1.0f;
+	pJob->fBottomV = 1.0f;
+
+	if (pSrcRect)
+	{
+		float tU = 1.0f / src.GetWidth();
+		float tV = 1.0f / src.GetHeight();
+		pJob->fLeftU += pSrcRect->left * tU;
+		pJob->fTopV += pSrcRect->top * tV;
+		pJob->fRightU -= (src.GetWidth() - pSrcRect->right) * tU;
+		pJob->fBottomV -= (src.GetHeight() - pSrcRect->bottom) * tV;
+	}
+
+	if (pDestRect)
+	{
+		float tU = 1.0f / dest.GetWidth();
+		float tV = 1.0f / dest.GetHeight();
+		pJob->fLeftU -= pDestRect->left * tU;
+		pJob->fTopV -= pDestRect->top * tV;
+		pJob->fRightU += (dest.GetWidth() - pDestRect->right) * tU;
+		pJob->fBottomV += (dest.GetHeight() - pDestRect->bottom) * tV;
+	}
+}
+
+static void AddSample(FilterJob* pJob, float u, float v, float fWeight, float fAlphaWeight)
+{
+	int i = pJob->nSamples++;
+	pJob->afOffsets[i][0] = u;
+	pJob->afOffsets[i][1] = v;
+	pJob->afWeights[i][0] = pJob->afWeights[i][1] = pJob->afWeights[i][2] = fWeight;
+	pJob->afWeights[i][3] = fAlphaWeight;
+}
+
+static void FilterRows(void* pContext, int yBegin, int yEnd)
+{
+	const FilterJob& job = *(const FilterJob*)pContext;
+	const WL::FloatImage& src = *job.pSrc;
+	WL::FloatImage& dest = *job.pDest;
+
+	float fSrcWidth = (float)src.GetWidth();
+	float fSrcHeight = (float)src.GetHeight();
+	float fStepU = (job.fRightU - job.fLeftU) / dest.GetWidth();
+	float fStepV = (job.fBottomV - job.fTopV) / dest.GetHeight();
+
+	// Offsets in source texels
+	float afOffsetX[HDR_MAX_SAMPLES];
+	float afOffsetY[HDR_MAX_SAMPLES];
+	Float4 aWeights[HDR_MAX_SAMPLES];
+	for (int i = 0; i < job.nSamples; i++)
+	{
+		afOffsetX[i] = job.afOffsets[i][0] * fSrcWidth;
+		afOffsetY[i] = job.afOffsets[i][1] * fSrcHeight;
+		aWeights[i] = Load(job.afWeights[i]);
+	}
+
+	Float4 vBrightScale = Set(job.fBrightPassScale, job.fBrightPassScale, job.fBrightPassScale, 1.0f);
+	Float4 vBrightThreshold = Set(BRIGHT_PASS_THRESHOLD, BRIGHT_PASS_THRESHOLD, BRIGHT_PASS_THRESHOLD, 0.0f);
+	Float4 vBrightOffset = Set(BRIGHT_PASS_OFFSET, BRIGHT_PASS_OFFSET, BRIGHT_PASS_OFFSET, 1.0f);
+	Float4 vColorMask = Set(1.0f, 1.0f, 1.0f, 0.0f);
+
+	for (int y = yBegin; y < yEnd; y++)
+	{
+		float ty = (job.fTopV + (y + 0.5f) * fStepV) * fSrcHeight;
+		float* pDest = dest.GetPixel(job.rcScissor.left, y);
+
+		for (int x = job.rcScissor.left; x < job.rcScissor.right; x++, pDest += 4)
+		{
+			float tx = (job.fLeftU + (x + 0.5f) * fStepU) * fSrcWidth;
+
+			Float4 vSum = Splat(0.0f);
+			if (job.bLinear)
+			{
+				for (int i = 0; i < job.nSamples; i++)
+					vSum = MulAdd(aWeights[i], SampleLinear(src, tx + afOffsetX[i], ty + afOffsetY[i]), vSum);
+			}
+			else
+			{
+				for (int i = 0; i < job.nSamples; i++)
+					vSum = MulAdd(aWeights[i], SamplePoint(src, tx + afOffsetX[i], ty + afOffsetY[i]), vSum);
+			}
+
+			if (job.pBase)
+				vSum = MulAdd(Splat(job.fBaseWeight), Load(job.pBase->GetPixel(x, y)), vSum);
+
+			if (job.bBrightPass)
+			{
+				vSum = Max(Sub(Mul(vSum, vBrightScale), vBrightThreshold), Splat(0.0f));
+				vSum = Div(vSum, MulAdd(vSum, vColorMask, vBrightOffset));
+			}
+
+			if (job.bSaturate)
+				vSum = Saturate(vSum);
+
+			Store(pDest, vSum);
+		}
+	}
+}
+
+//
+//	The tone mapping pass into the output
+//
+struct FinalJob
+{
+	const WL::FloatImage*				pScene;
+	const WL::FloatImage*				pBloom;
+	const WL::FloatImage*				pStar;
+	WL::FloatImage*						pDest;
+	const WL::HDRReferenceSettings*		pSettings;
+	float								fAdaptedLuminance;
+};
+
+static void FinalRows(void* pContext, int yBegin, int yEnd)
+{
+	const FinalJob& job = *(const FinalJob*)pContext;
+	const WL::HDRReferenceSettings& settings = *job.pSettings;
+	WL::FloatImage& dest = *job.pDest;
+	float fLum = job.fAdaptedLuminance;
+
+	float fBlueShift = 1.0f - (fLum + 1.5f) / 4.1f;
+	fBlueShift = fBlueShift < 0.0f ? 0.0f : (fBlueShift > 1.0f ? 1.0f : fBlueShift);
+
+	float fToneScale = settings.fMiddleGray / (fLum + 0.001f);
+
+	float fBloomU = (float)job.pBloom->GetWidth() / dest.GetWidth();
+	float fBloomV = (float)job.pBloom->GetHeight() / dest.GetHeight();
+	float fStarU = (float)job.pStar->GetWidth() / dest.GetWidth();
+	float fStarV = (float)job.pStar->GetHeight() / dest.GetHeight();
+
+	Float4 vColorMask = Set(1.0f, 1.0f, 1.0f, 0.0f);
+	Float4 vAlphaMask = Set(0.0f, 0.0f, 0.0f, 1.0f);
+	Float4 vRod = Set(BLUE_SHIFT_VECTOR[0], BLUE_SHIFT_VECTOR[1], BLUE_SHIFT_VECTOR[2], 0.0f);
+	Float4 vToneScale = Set(fToneScale, fToneScale, fToneScale, 1.0f);
+	Float4 vOne = Splat(1.0f);
+	Float4 vStarScale = Splat(settings.fStarScale);
+	Float4 vBloomScale = Splat(settings.fBloomScale);
+
+	for (int y = yBegin; y < yEnd; y++)
+	{
+		const float* pScene = job.pScene->GetPixel(0, y);
+		float* pDest = dest.GetPixel(0, y);
+
+		for (int x = 0; x < dest.GetWidth(); x++, pScene += 4, pDest += 4)
+		{
+			Float4 vSample = Load(pScene);
+
+			// For very low light conditions, the rods will dominate the perception
+			// of light, and therefore color will be desaturated and shifted
+			// towards blue.
+			if (settings.bBlueShift)
+			{
+				Float4 vRodColor = Add(Mul(vRod, Splat(Luminance(pScene))), Mul(vSample, vAlphaMask));
+				vSample = MulAdd(Sub(vRodColor, vSample), Splat(fBlueShift), vSample);
+			}
+
+			if (settings.bToneMap)
+			{
+				vSample = Mul(vSample, vToneScale);
+				vSample = Div(vSample, MulAdd(vSample, vColorMask, vOne));
+			}
+
+			Float4 vBloom = SampleLinear(*job.pBloom, (x + 0.5f) * fBloomU, (y + 0.5f) * fBloomV);
+			Float4 vStar = SampleLinear(*job.pStar, (x + 0.5f) * fStarU, (y + 0.5f) * fStarV);
+			vSample = MulAdd(vStarScale, vStar, vSample);
+			vSample = MulAdd(vBloomScale, vBloom, vSample);
+
+			Store(pDest, Saturate(vSample));
+		}
+	}
+}
+
+//
+//	SampleLumInitial into the first tone map level
+//
+struct LuminanceJob
+{
+	const WL::FloatImage*	pSrc;
+	float*					pDest;
+	float					afOffsets[9][2];
+};
+
+static void LuminanceRows(void* pContext, int yBegin, int yEnd)
+{
+	const LuminanceJob& job = *(const LuminanceJob*)pContext;
+	const WL::FloatImage& src = *job.pSrc;
+	float fScaleX = (float)src.GetWidth() / HDR_TONEMAP_SIZE;
+	float fScaleY = (float)src.GetHeight() / HDR_TONEMAP_SIZE;
+
+	for (int y = yBegin; y < yEnd; y++)
+	{
+		for (int x = 0; x < HDR_TONEMAP_SIZE; x++)
+		{
+			float fLogLumSum = 0.0f;
+			for (int i = 0; i < 9; i++)
+			{
+				float afSample[4];
+				Store(afSample, SampleLinear(src, (x + 0.5f) * fScaleX + job.afOffsets[i][0] * src.GetWidth(),
+												  (y + 0.5f) * fScaleY + job.afOffsets[i][1] * src.GetHeight()));
+				fLogLumSum += logf(Luminance(afSample) + 0.0001f);
+			}
+			job.pDest[y * HDR_TONEMAP_SIZE + x] = fLogLumSum / 9;
+		}
+	}
+}
+
+//
+//	Sample offsets, as the HDRSun::GetSampleOffsets_* functions
+//
+static void AddSamples_DownScale4x4(FilterJob* pJob, int width, int height)
+{
+	for (int y = 0; y < 4; y++)
+		for (int x = 0; x < 4; x++)
+			AddSample(pJob, (x - 1.5f) / width, (y - 1.5f) / height, 1.0f / 16, 1.0f / 16);
+}
+
+static void AddSamples_DownScale2x2(FilterJob* pJob, int width, int height)
+{
+	for (int y = 0; y < 2; y++)
+		for (int x = 0; x < 2; x++)
+			AddSample(pJob, (x - 0.5f) / width, (y - 0.5f) / height, 1.0f / 4, 1.0f / 4);
+}
+
+static void AddSamples_GaussBlur5x5(FilterJob* pJob, int width, int height, float fMultiplier)
+{
+	// The shader only takes the first 12 of the 13 samples
+	for (int i = 0; i < 12; i++)
+	{
+		const WL::KernelSample& sample = WL::HDR_GAUSS_BLUR_5X5_KERNEL[i];
+		float weight = sample.fWeight * fMultiplier;
+		AddSample(pJob, (float)sample.x / width, (float)sample.y / height, weight, weight);
+	}
+}
+
+static void AddSamples_Bloom(FilterJob* pJob, int size, bool bVertical, float fMultiplier)
+{
+	float tu = 1.0f / size;
+	for (int i = 0; i < 15; i++)
+	{
+		int offset = i < 8 ? i : -(i - 7);
+		float weight = fMultiplier * WL::HDR_BLOOM_KERNEL[abs(offset)];
+		if (bVertical)
+			AddSample(pJob, 0.0f, offset * tu, weight, 1.0f);
+		else
+			AddSample(pJob, offset * tu, 0.0f, weight, 1.0f);
+	}
+}
+
+// Four bilinear samples on the corners around the center, a 4x4 box
+static void AddSamples_BloomDownsample(FilterJob* pJob, int width, int height)
+{
+	for (int y = -1; y <= 1; y += 2)
+		for (int x = -1; x <= 1; x += 2)
+			AddSample(pJob, (float)x / width, (float)y / height, 0.25f, 0.25f);
+}
+
+// A 3x3 tent over the level below, half of the result. The other half is the level's
+// own downsample.
+static void AddSamples_BloomUpsample(FilterJob* pJob, int width, int height, float fMultiplier)
+{
+	for (int y = -1; y <= 1; y++)
+	{
+		for (int x = -1; x <= 1; x++)
+		{
+			float weight = fMultiplier * (2 - abs(x)) * (2 - abs(y)) / 32.0f;
+			AddSample(pJob, (float)x / width, (float)y / height, weight, weight);
+		}
+	}
+}
+
+static inline int LevelSize(int nSize, int nLevel)
+{
+	nSize >>= nLevel;
+	return nSize > 1 ? nSize : 1;
+}
+
+//
+//	FloatImage
+//
+WL::FloatImage::FloatImage()
+{
+	m_pPixels = NULL;
+	m_nWidth = 0;
+	m_nHeight = 0;
+}
+
+WL::FloatImage::~FloatImage()
+{
+	Release();
+}
+
+bool WL::FloatImage::Create(int width, int height)
+{
+	Release();
+	if (width <= 0 || height <= 0)
+		return false;
+
+	m_pPixels = new float[4 * width * height];
+	memset(m_pPixels, 0, 4 * width * height * sizeof(float));
+	m_nWidth = width;
+	m_nHeight = height;
+	return true;
+}
+
+void WL::FloatImage::Release()
+{
+	delete[] m_pPixels;
+	m_pPixels = NULL;
+	m_nWidth = 0;
+	m_nHeight = 0;
+}
+
+bool WL::FloatImage::LoadPFM(const char* strFile)
+{
+	FILE* pFile = fopen(strFile, "rb");
+	if (pFile == NULL)
+		return false;
+
+	char strType[3] = { 0 };
+	int width = 0, height = 0;
+	float fScale = 0.0f;
+	bool bResult = fscanf(pFile, "%2s %d %d %f", strType, &width, &height, &fScale) == 4 &&
+				   strcmp(strType, "PF") == 0 && fScale < 0.0f && fgetc(pFile) != EOF &&
+				   Create(width, height);
+
+	// Little endian RGB rows, bottom to top
+	float* pRow = bResult ? new float[3 * width] : NULL;
+	for (int y = height - 1; bResult && y >= 0; y--)
+	{
+		bResult = fread(pRow, sizeof(float) * 3, width, pFile) == (size_t)width;
+		for (int x = 0; bResult && x < width; x++)
+		{
+			float* pPixel = GetPixel(x, y);
+			pPixel[0] = pRow[3 * x + 0];
+			pPixel[1] = pRow[3 * x + 1];
+			pPixel[2] = pRow[3 * x + 2];
+			pPixel[3] = 1.0f;
+		}
+	}
+
+	delete[] pRow;
+	fclose(pFile);
+
+	if (!bResult)
+		Release();
+	return bResult;
+}
+
+bool WL::FloatImage::SavePFM(const char* strFile) const
+{
+	if (m_pPixels == NULL)
+		return false;
+
+	FILE* pFile = fopen(strFile, "wb");
+	if (pFile == NULL)
+		return false;
+
+	bool bResult = fprintf(pFile, "PF\n%d %d\n-1.0\n", m_nWidth, m_nHeight) > 0;
+
+	float* pRow = new float[3 * m_nWidth];
+	for (int y = m_nHeight - 1; bResult && y >= 0; y--)
+	{
+		for (int x = 0; x < m_nWidth; x++)
+		{
+			const float* pPixel = GetPixel(x, y);
+			pRow[3 * x + 0] = pPixel[0];
+			pRow[3 * x + 1] = pPixel[1];
+			pRow[3 * x + 2] = pPixel[2];
+		}
+		bResult = fwrite(pRow, sizeof(float) * 3, m_nWidth, pFile) == (size_t)m_nWidth;
+	}
+
+	delete[] pRow;
+	fclose(pFile);
+	return bResult;
+}
+
+//
+//	HDRReferenceSettings, the defaults of HDRSun without a star
+//
+WL::HDRReferenceSettings::HDRReferenceSettings()
+{
+	fMiddleGray = 0.28f;
+	fElapsedTime = 1.0f / 30.0f;
+	fBloomScale = 3.0f;
+	fStarScale = 0.5f;
+	bToneMap = true;
+	bBlueShift = true;
+	bBloom = true;
+	bDualFilterBloom = true;
+	bStar = false;
+	bHistogram = false;
+	fHistogramLow = 0.1f;
+	fHistogramHigh = 0.95f;
+
+	fStarInclination = 0.0f;
+	fChromaticAberration = 0.0f;
+	nStarLines = 0;
+	memset(aStarLines, 0, sizeof(aStarLines));
+}
+
+//
+//	HDRReference
+//
+WL::HDRReference::HDRReference()
+{
+	m_pThreadPool = NULL;
+	m_fSceneLuminance = 0.0f;
+	m_fAdaptedLuminance = 0.0f;
+	memset(m_afToneMap, 0, sizeof(m_afToneMap));
+	memset(&m_Stats, 0, sizeof(m_Stats));
+}
+
+void WL::HDRReference::ResetAdaptation(float fLuminance)
+{
+	m_fAdaptedLuminance = fLuminance;
+}
+
+struct RowBand
+{
+	void				(*pfnRows)(void* pContext, int yBegin, int yEnd);
+	void*				pContext;
+	int					yBegin;
+	int					yEnd;
+	WL::Semaphore*		pDone;
+};
+
+static void RowBandJob(void* pContext)
+{
+	RowBand* pBand = (RowBand*)pContext;
+	pBand->pfnRows(pBand->pContext, pBand->yBegin, pBand->yEnd);
+	pBand->pDone->Post();
+}
+
+//
+//	Splits the rows in bands, one per worker plus one for the calling thread
+//
+void WL::HDRReference::ForEachRow(RowFunction pfnRows, void* pContext, int yBegin, int yEnd)
+{
+	int nRows = yEnd - yBegin;
+	int nBands = m_pThreadPool ? m_pThreadPool->GetThreadCount() + 1 : 1;
+	if (nBands > MAX_BANDS)
+		nBands = MAX_BANDS;
+	if (nBands > nRows / MIN_BAND_ROWS)
+		nBands = nRows / MIN_BAND_ROWS;
+
+	if (nBands <= 1)
+	{
+		if (nRows > 0)
+			pfnRows(pContext, yBegin, yEnd);
+		return;
+	}
+
+	RowBand aBands[MAX_BANDS];
+	for (int i = 0; i < nBands; i++)
+	{
+		aBands[i].pfnRows = pfnRows;
+		aBands[i].pContext = pContext;
+		aBands[i].yBegin = yBegin + nRows * i / nBands;
+		aBands[i].yEnd = yBegin + nRows * (i + 1) / nBands;
+		aBands[i].pDone = &m_BandDone;
+	}
+
+	for (int i = 1; i < nBands; i++)
+		m_pThreadPool->Submit(RowBandJob, &aBands[i]);
+
+	pfnRows(pContext, aBands[0].yBegin, aBands[0].yEnd);
+
+	for (int i = 1; i < nBands; i++)
+		m_BandDone.Wait();
+}
+
+static bool EnsureSize(WL::FloatImage& image, int width, int height)
+{
+	if (image.GetWidth() == width && image.GetHeight() == height)
+		return true;
+	return image.Create(width, height);
+}
+
+static double Lap(double& fTime)
+{
+	double fNow = WL::GetTimeSeconds();
+	double fElapsed = (fNow - fTime) * 1000.0;
+	fTime = fNow;
+	return fElapsed;
+}
+
+bool WL::HDRReference::Process(const FloatImage& scene, const HDRReferenceSettings& settings, FloatImage* pOutput)
+{
+	int width = scene.GetWidth();
+	int height = scene.GetHeight();
+
+	// The same crop HDRSun makes, so every stage divides evenly
+	int nCropWidth = width - width % 8;
+	int nCropHeight = height - height % 8;
+	if (nCropWidth < 16 || nCropHeight < 16 || pOutput == NULL || pOutput == &scene)
+		return false;
+
+	int nQuarterWidth = nCropWidth / 4;
+	int nQuarterHeight = nCropHeight / 4;
+	int nEighthWidth = nCropWidth / 8;
+	int nEighthHeight = nCropHeight / 8;
+
+	// Bordered images keep their black border, only the inside is ever written
+	bool bResult = EnsureSize(*pOutput, width, height) &&
+				   EnsureSize(m_SceneScaled, nQuarterWidth, nQuarterHeight) &&
+				   EnsureSize(m_BrightPass, nQuarterWidth + 2, nQuarterHeight + 2) &&
+				   EnsureSize(m_StarSource, nQuarterWidth + 2, nQuarterHeight + 2) &&
+				   EnsureSize(m_BloomSource, nEighthWidth + 2, nEighthHeight + 2) &&
+				   EnsureSize(m_aBloom[0], nEighthWidth, nEighthHeight) &&
+				   EnsureSize(m_aBloom[1], nEighthWidth + 2, nEighthHeight + 2) &&
+				   EnsureSize(m_aBloom[2], nEighthWidth + 2, nEighthHeight + 2) &&
+				   EnsureSize(m_Star, nQuarterWidth, nQuarterHeight);
+
+	int nBloomLevels = settings.bDualFilterBloom ? GetBloomLevels(settings.fBloomScale, nEighthWidth, nEighthHeight) : 0;
+	for (int i = 0; i < nBloomLevels && bResult; i++)
+	{
+		int nLevelWidth = LevelSize(nEighthWidth, i);
+		int nLevelHeight = LevelSize(nEighthHeight, i);
+		bResult = EnsureSize(m_aBloomDown[i], nLevelWidth, nLevelHeight) &&
+				  (i == 0 || EnsureSize(m_aBloomUp[i], nLevelWidth, nLevelHeight));
+	}
+	if (!bResult)
+		return false;
+
+	double fStart = GetTimeSeconds();
+	double fTime = fStart;
+	FilterJob job;
+
+	// Scene_To_SceneScaled: 1/4 x 1/4 copy of the centered crop
+	ImageRect rcCrop;
+	rcCrop.left = (width - nCropWidth) / 2;
+	rcCrop.top = (height - nCropHeight) / 2;
+	rcCrop.right = rcCrop.left + nCropWidth;
+	rcCrop.bottom = rcCrop.top + nCropHeight;
+
+	SetupFilter(&job, scene, &rcCrop, m_SceneScaled, NULL);
+	AddSamples_DownScale4x4(&job, width, height);
+	ForEachRow(FilterRows, &job, job.rcScissor.top, job.rcScissor.bottom);
+	m_Stats.fScale = Lap(fTime);
+
+	// MeasureLuminance and CalculateAdaptation. Without tone mapping the luminance
+	// textures are never drawn and stay black.
+	if (settings.bToneMap)
+		MeasureLuminance(settings);
+	else
+		m_fSceneLuminance = 0.0f;
+
+	m_fAdaptedLuminance += (m_fSceneLuminance - m_fAdaptedLuminance) * (1.0f - powf(0.98f, 30.0f * settings.fElapsedTime));
+	m_Stats.fLuminance = Lap(fTime);
+
+	// SceneScaled_To_BrightPass
+	ImageRect rcSrc = InnerRect(m_SceneScaled);
+	ImageRect rcDest = InnerRect(m_BrightPass);
+	SetupFilter(&job, m_SceneScaled, &rcSrc, m_BrightPass, &rcDest);
+	AddSample(&job, 0.0f, 0.0f, 1.0f, 1.0f);
+	job.bBrightPass = true;
+	job.fBrightPassScale = settings.fMiddleGray / (m_fAdaptedLuminance + 0.001f);
+	job.bSaturate = true;
+	ForEachRow(FilterRows, &job, job.rcScissor.top, job.rcScissor.bottom);
+	m_Stats.fBrightPass = Lap(fTime);
+
+	// BrightPass_To_StarSource and StarSource_To_BloomSource. The dual filter bloom
+	// starts from the bright pass and needs neither when there is no star.
+	if (nBloomLevels == 0 || settings.bStar)
+	{
+		rcDest = InnerRect(m_StarSource);
+		SetupFilter(&job, m_BrightPass, NULL, m_StarSource, &rcDest);
+		AddSamples_GaussBlur5x5(&job, m_BrightPass.GetWidth(), m_BrightPass.GetHeight(), 1.0f);
+		job.bSaturate = true;
+		ForEachRow(FilterRows, &job, job.rcScissor.top, job.rcScissor.bottom);
+	}
+
+	if (nBloomLevels == 0)
+	{
+		rcSrc = InnerRect(m_StarSource);
+		rcDest = InnerRect(m_BloomSource);
+		SetupFilter(&job, m_StarSource, &rcSrc, m_BloomSource, &rcDest);
+		AddSamples_DownScale2x2(&job, m_BrightPass.GetWidth(), m_BrightPass.GetHeight());
+		job.bSaturate = true;
+		ForEachRow(FilterRows, &job, job.rcScissor.top, job.rcScissor.bottom);
+	}
+
+	// Without bloom or star their textures stay black, as on the GPU
+	if (settings.bBloom && nBloomLevels > 0)
+		RenderDualFilterBloom(nBloomLevels);
+	else if (settings.bBloom)
+		RenderBloom();
+	m_Stats.fBloom = Lap(fTime);
+
+	if (settings.bStar && settings.nStarLines > 0)
+		RenderStar(settings);
+	m_Stats.fStar = Lap(fTime);
+
+	// FinalScenePass
+	FinalJob finalJob;
+	finalJob.pScene = &scene;
+	finalJob.pBloom = &m_aBloom[0];
+	finalJob.pStar = &m_Star;
+	finalJob.pDest = pOutput;
+	finalJob.pSettings = &settings;
+	finalJob.fAdaptedLuminance = m_fAdaptedLuminance;
+	ForEachRow(FinalRows, &finalJob, 0, height);
+	m_Stats.fFinal = Lap(fTime);
+
+	m_Stats.fTotal = (GetTimeSeconds() - fStart) * 1000.0;
+	return true;
+}
+
+//
+//	Average log luminance of the scaled scene, reduced 64 -> 16 -> 4 -> 1
+//
+void WL::HDRReference::MeasureLuminance(const HDRReferenceSettings& settings)
+{
+	LuminanceJob job;
+	job.pSrc = &m_SceneScaled;
+	job.pDest = m_afToneMap;
+
+	float tU = 1.0f / (3.0f * HDR_TONEMAP_SIZE);
+	float tV = 1.0f / (3.0f * HDR_TONEMAP_SIZE);
+	int index = 0;
+	for (int x = -1; x <= 1; x++)
+	{
+		for (int y = -1; y <= 1; y++)
+		{
+			job.afOffsets[index][0] = x * tU;
+			job.afOffsets[index][1] = y * tV;
+			index++;
+		}
+	}
+
+	ForEachRow(LuminanceRows, &job, 0, HDR_TONEMAP_SIZE);
+
+	// HDRSun reads this level back and builds the histogram on the CPU, a few frames
+	// late. Here it is used right away.
+	if (settings.bHistogram)
+	{
+		LuminanceHistogram histogram;
+		BuildLuminanceHistogram(m_afToneMap, HDR_TONEMAP_SIZE * HDR_TONEMAP_SIZE, &histogram);
+		m_fSceneLuminance = GetHistogramLuminance(histogram, settings.fHistogramLow, settings.fHistogramHigh);
+		return;
+	}
+
+	// The resample passes sample the middle of 4x4 blocks with point filtering, so
+	// they come down to block averages. Done in place, each level reads ahead of
+	// where it writes.
+	int nSize = HDR_TONEMAP_SIZE;
+	while (nSize > 1)
+	{
+		int nDestSize = nSize / 4;
+		for (int y = 0; y < nDestSize; y++)
+		{
+			for (int x = 0; x < nDestSize; x++)
+			{
+				float fSum = 0.0f;
+				for (int j = 0; j < 4; j++)
+					for (int i = 0; i < 4; i++)
+						fSum += m_afToneMap[(4 * y + j) * nSize + 4 * x + i];
+				m_afToneMap[y * nDestSize + x] = fSum / 16;
+			}
+		}
+		nSize = nDestSize;
+	}
+
+	m_fSceneLuminance = expf(m_afToneMap[0]);
+}
+
+void WL::HDRReference::RenderBloom()
+{
+	FilterJob job;
+
+	ImageRect rcSrc = InnerRect(m_BloomSource);
+	ImageRect rcDest = InnerRect(m_aBloom[2]);
+	SetupFilter(&job, m_BloomSource, &rcSrc, m_aBloom[2], &rcDest);
+	AddSamples_GaussBlur5x5(&job, m_BloomSource.GetWidth(), m_BloomSource.GetHeight(), 1.0f);
+	job.bSaturate = true;
+	ForEachRow(FilterRows, &job, job.rcScissor.top, job.rcScissor.bottom);
+
+	rcSrc = InnerRect(m_aBloom[2]);
+	rcDest = InnerRect(m_aBloom[1]);
+	SetupFilter(&job, m_aBloom[2], &rcSrc, m_aBloom[1], &rcDest);
+	AddSamples_Bloom(&job, m_aBloom[2].GetWidth(), false, 2.0f);
+	job.bSaturate = true;
+	ForEachRow(FilterRows, &job, job.rcScissor.top, job.rcScissor.bottom);
+
+	rcSrc = InnerRect(m_aBloom[1]);
+	SetupFilter(&job, m_aBloom[1], &rcSrc, m_aBloom[0], NULL);
+	AddSamples_Bloom(&job, m_aBloom[1].GetHeight(), true, 2.0f);
+	job.bSaturate = true;
+	ForEachRow(FilterRows, &job, job.rcScissor.top, job.rcScissor.bottom);
+}
+
+//
+//	Each level is a 4x4 box of the one above, starting from the bright pass. Coming
+//	back up, every level is half its own downsample and half a tent of the level below.
+//
+void WL::HDRReference::RenderDualFilterBloom(int nLevels)
+{
+	FilterJob job;
+
+	ImageRect rcSrc = InnerRect(m_BrightPass);
+	SetupFilter(&job, m_BrightPass, &rcSrc, m_aBloomDown[0], NULL);
+	AddSamples_BloomDownsample(&job, m_BrightPass.GetWidth(), m_BrightPass.GetHeight());
+	job.bLinear = true;
+	job.bSaturate = true;
+	ForEachRow(FilterRows, &job, job.rcScissor.top, job.rcScissor.bottom);
+
+	for (int i = 1; i < nLevels; i++)
+	{
+		const FloatImage& src = m_aBloomDown[i - 1];
+		SetupFilter(&job, src, NULL, m_aBloomDown[i], NULL);
+		AddSamples_BloomDownsample(&job, src.GetWidth(), src.GetHeight());
+		job.bLinear = true;
+		job.bSaturate = true;
+		ForEachRow(FilterRows, &job, job.rcScissor.top, job.rcScissor.bottom);
+	}
+
+	for (int i = nLevels - 2; i >= 0; i--)
+	{
+		const FloatImage& src = i == nLevels - 2 ? m_aBloomDown[i + 1] : m_aBloomUp[i + 1];
+		FloatImage& dest = i == 0 ? m_aBloom[0] : m_aBloomUp[i];
+
+		// Brightened only on the way into the result, to clip as little as possible
+		float fMultiplier = i == 0 ? HDR_DUAL_BLOOM_GAIN : 1.0f;
+		SetupFilter(&job, src, NULL, dest, NULL);
+		AddSamples_BloomUpsample(&job, src.GetWidth(), src.GetHeight(), fMultiplier);
+		job.pBase = &m_aBloomDown[i];
+		job.fBaseWeight = 0.5f * fMultiplier;
+		job.bLinear = true;
+		job.bSaturate = true;
+		ForEachRow(FilterRows, &job, job.rcScissor.top, job.rcScissor.bottom);
+	}
+}
+
+//
+//	Every line expands over up to three passes of 8 samples, ping-ponging between two
+//	work images, then the lines are averaged
+//
+void WL::HDRReference::RenderStar(const HDRReferenceSettings& settings)
+{
+	static const int s_maxPasses = 3;
+	static const int nSamples = 8;
+	static const float s_colorWhite[4] = { 0.63f, 0.63f, 0.63f, 0.0f };
+
+	int nLines = settings.nStarLines < HDR_MAX_STAR_LINES ? settings.nStarLines : HDR_MAX_STAR_LINES;
+	int width = m_Star.GetWidth();
+	int height = m_Star.GetHeight();
+	for (int d = 0; d < nLines; d++)
+		EnsureSize(m_aStarLine[d], width, height);
+	EnsureSize(m_aStarWork[0], width, height);
+	EnsureSize(m_aStarWork[1], width, height);
+
+	float aaColor[s_maxPasses][nSamples][4];
+	for (int p = 0; p < s_maxPasses; p++)
+	{
+		float ratio = (float)(p + 1) / (float)s_maxPasses;
+		for (int s = 0; s < nSamples; s++)
+		{
+			for (int c = 0; c < 4; c++)
+			{
+				float chromaticAberrColor = HDR_CHROMATIC_ABERRATION_COLOR[s][c] + (s_colorWhite[c] - HDR_CHROMATIC_ABERRATION_COLOR[s][c]) * ratio;
+				aaColor[p][s][c] = s_colorWhite[c] + (chromaticAberrColor - s_colorWhite[c]) * settings.fChromaticAberration;
+			}
+		}
+	}
+
+	const float fTanFoV = atanf(PI / 8);
+	float srcW = (float)m_StarSource.GetWidth();
+	float srcH = (float)m_StarSource.GetHeight();
+
+	FilterJob job;
+	for (int d = 0; d < nLines; d++)
+	{
+		const HDRStarLine& starLine = settings.aStarLines[d];
+		int nPasses = starLine.nPasses < s_maxPasses ? starLine.nPasses : s_maxPasses;
+
+		float rad = settings.fStarInclination + starLine.fInclination;
+		float stepU = sinf(rad) / srcW * starLine.fSampleLength;
+		float stepV = cosf(rad) / srcH * starLine.fSampleLength;
+		float attnPowScale = (fTanFoV + 0.1f) * 1.0f * (160.0f + 120.0f) / (srcW + srcH) * 1.2f;
+
+		const FloatImage* pSource = &m_StarSource;
+		int iWork = 0;
+		for (int p = 0; p < nPasses; p++)
+		{
+			FloatImage& dest = p == nPasses - 1 ? m_aStarLine[d] : m_aStarWork[iWork];
+			SetupFilter(&job, *pSource, NULL, dest, NULL);
+			job.bLinear = true;
+
+			for (int i = 0; i < nSamples; i++)
+			{
+				float lum = powf(starLine.fAttenuation, attnPowScale * i) * (p + 1.0f) * 0.5f;
+				float u = stepU * i;
+				float v = stepV * i;
+				if (fabs(u) >= 0.9f || fabs(v) >= 0.9f)
+				{
+					u = v = 0.0f;
+					lum = 0.0f;
+				}
+
+				AddSample(&job, u, v, 0.0f, 0.0f);
+				for (int c = 0; c < 4; c++)
+					job.afWeights[i][c] = aaColor[nPasses - 1 - p][i][c] * lum;
+			}
+
+			ForEachRow(FilterRows, &job, 0, height);
+
+			stepU *= nSamples;
+			stepV *= nSamples;
+			attnPowScale *= nSamples;
+
+			pSource = &m_aStarWork[iWork];
+			iWork ^= 1;
+		}
+	}
+
+	// MergeTextures_N, every line sampled at its own texel centers
+	float fWeight = 1.0f / nLines;
+	for (int y = 0; y < height; y++)
+	{
+		for (int x = 0; x < width; x++)
+		{
+			Float4 vSum = Splat(0.0f);
+			for (int d = 0; d < nLines; d++)
+				vSum = MulAdd(Splat(fWeight), Load(m_aStarLine[d].GetPixel(x, y)), vSum);
+			Store(m_Star.GetPixel(x, y), vSum);
+		}
+	}
+}
+
+//
+//	Values go to four separate histograms by their position modulo 4, one per SSE lane,
+//	which are added up at the end. The scalar path does the same so both give the same sums.
+//
+void WL::BuildLuminanceHistogram(const float* pLogLum, int nCount, LuminanceHistogram* pHistogram)
+{
+	unsigned int aanCounts[4][HDR_HISTOGRAM_BINS];
+	float aafSums[4][HDR_HISTOGRAM_BINS];
+	memset(aanCounts, 0, sizeof(aanCounts));
+	memset(aafSums, 0, sizeof(aafSums));
+
+	const float fScale = HDR_HISTOGRAM_BINS / (HDR_HISTOGRAM_LOG_MAX - HDR_HISTOGRAM_LOG_MIN);
+	const float fMaxBin = HDR_HISTOGRAM_BINS - 1.0f;
+
+	int i = 0;
+	float afBins[4];
+	for (; i + 4 <= nCount; i += 4)
+	{
+		// Bin positions for four values at once, clamped to the first and last bin
+		Float4 vValues = Load(pLogLum + i);
+		Float4 vBins = Mul(Sub(vValues, Splat(HDR_HISTOGRAM_LOG_MIN)), Splat(fScale));
+		Store(afBins, Min(Max(vBins, Splat(0.0f)), Splat(fMaxBin)));
+
+		for (int lane = 0; lane < 4; lane++)
+		{
+			int bin = (int)afBins[lane];
+			aanCounts[lane][bin]++;
+			aafSums[lane][bin] += pLogLum[i + lane];
+		}
+	}
+	for (; i < nCount; i++)
+	{
+		float fBin = (pLogLum[i] - HDR_HISTOGRAM_LOG_MIN) * fScale;
+		fBin = fBin < 0.0f ? 0.0f : (fBin > fMaxBin ? fMaxBin : fBin);
+		int lane = i & 3;
+		aanCounts[lane][(int)fBin]++;
+		aafSums[lane][(int)fBin] += pLogLum[i];
+	}
+
+	pHistogram->nTotal = 0;
+	for (int bin = 0; bin < HDR_HISTOGRAM_BINS; bin++)
+	{
+		pHistogram->anCounts[bin] = aanCounts[0][bin] + aanCounts[1][bin] + aanCounts[2][bin] + aanCounts[3][bin];
+		pHistogram->afSums[bin] = (aafSums[0][bin] + aafSums[1][bin]) + (aafSums[2][bin] + aafSums[3][bin]);
+		pHistogram->nTotal += pHistogram->anCounts[bin];
+	}
+}
+
+float WL::GetHistogramLuminance(const LuminanceHistogram& histogram, float fLow, float fHigh)
+{
+	if (histogram.nTotal == 0)
+		return 0.0f;
+
+	float fFirst = fLow * histogram.nTotal;
+	float fLast = fHigh * histogram.nTotal;
+	if (fLast <= fFirst)
+	{
+		fFirst = 0.0f;
+		fLast = (float)histogram.nTotal;
+	}
+
+	// Bins partly inside the range count with the part that is, at their average value
+	float fSum = 0.0f;
+	float fWeight = 0.0f;
+	float fStart = 0.0f;
+	for (int bin = 0; bin < HDR_HISTOGRAM_BINS; bin++)
+	{
+		unsigned int nCount = histogram.anCounts[bin];
+		if (nCount == 0)
+			continue;
+
+		float fEnd = fStart + nCount;
+		float fInside = (fEnd < fLast ? fEnd : fLast) - (fStart > fFirst ? fStart : fFirst);
+		if (fInside > 0.0f)
+		{
+			fSum += histogram.afSums[bin] / nCount * fInside;
+			fWeight += fInside;
+		}
+		fStart = fEnd;
+	}
+
+	return fWeight > 0.0f ? expf(fSum / fWeight) : 0.0f;
+}
+
+int WL::GetBloomLevels(float fBloomScale, int nEighthWidth, int nEighthHeight)
+{
+	// The default scale of 3 gets 4 levels
+	int nLevels = 2;
+	for (float f = 1.0f; f < fBloomScale && nLevels < HDR_MAX_BLOOM_LEVELS; f *= 2.0f)
+		nLevels++;
+
+	// Stop before the levels get smaller than 2x2
+	while (nLevels > 2 && ((nEighthWidth >> (nLevels - 1)) < 2 || (nEighthHeight >> (nLevels - 1)) < 2))
+		nLevels--;
+
+	return nLevels;
+}
+
+static void AddCost(WL::BloomPassCost* aCosts, int nMaxCosts, int* pnCosts,
+					const char* strName, int width, int height, int nSamples)
+{
+	if (*pnCosts >= nMaxCosts)
+		return;
+
+	WL::BloomPassCost& cost = aCosts[(*pnCosts)++];
+	cost.strName = strName;
+	cost.nWidth = width;
+	cost.nHeight = height;
+	cost.nSamples = nSamples;
+}
+
+int WL::GetBloomPassCosts(bool bDualFilter, int nLevels, int nEighthWidth, int nEighthHeight,
+						  BloomPassCost* aCosts, int nMaxCosts)
+{
+	int nCosts = 0;
+	if (!bDualFilter)
+	{
+		AddCost(aCosts, nMaxCosts, &nCosts, "star source", 2 * nEighthWidth, 2 * nEighthHeight, 12);
+		AddCost(aCosts, nMaxCosts, &nCosts, "bloom source", nEighthWidth, nEighthHeight, 4);
+		AddCost(aCosts, nMaxCosts, &nCosts, "blur", nEighthWidth, nEighthHeight, 12);
+		AddCost(aCosts, nMaxCosts, &nCosts, "horizontal", nEighthWidth, nEighthHeight, 15);
+		AddCost(aCosts, nMaxCosts, &nCosts, "vertical", nEighthWidth, nEighthHeight, 15);
+		return nCosts;
+	}
+
+	for (int i = 0; i < nLevels; i++)
+		AddCost(aCosts, nMaxCosts, &nCosts, "down", LevelSize(nEighthWidth, i), LevelSize(nEighthHeight, i), 4);
+	for (int i = nLevels - 2; i >= 0; i--)
+		AddCost(aCosts, nMaxCosts, &nCosts, "up", LevelSize(nEighthWidth, i), LevelSize(nEighthHeight, i), 10);
+	return nCosts;
+}
+
+bool WL::CompareImages(const FloatImage& a, const FloatImage& b, float* pfMaxError, float* pfRMSError)
+{
+	if (a.GetWidth() != b.GetWidth() || a.GetHeight() != b.GetHeight())
+		return false;
+
+	double fSumSquares = 0.0;
+	float fMaxError = 0.0f;
+	for (int y = 0; y < a.GetHeight(); y++)
+	{
+		for (int x = 0; x < a.GetWidth(); x++)
+		{
+			const float* pA = a.GetPixel(x, y);
+			const float* pB = b.GetPixel(x, y);
+			for (int c = 0; c < 3; c++)
+			{
+				float fError = (float)fabs(pA[c] - pB[c]);
+				fMaxError = fError > fMaxError ? fError : fMaxError;
+				fSumSquares += fError * fError;
+			}
+		}
+	}
+
+	int nValues = 3 * a.GetWidth() * a.GetHeight();
+	if (pfMaxError)
+		*pfMaxError = fMaxError;
+	if (pfRMSError)
+		*pfRMSError = nValues > 0 ? (float)sqrt(fSumSquares / nValues) : 0.0f;
+	return true;
+}
+
+WL::HDRReference::Stats WL::BenchmarkHDRReference(HDRReference& reference, const FloatImage& scene,
+												  const HDRReferenceSettings& settings, int nFrames)
+{
+	HDRReference::Stats average;
+	memset(&average, 0, sizeof(average));
+
+	FloatImage output;
+	int nDone = 0;
+	for (int i = 0; i < nFrames; i++)
+	{
+		if (!reference.Process(scene, settings, &output))
+			break;
+
+		const HDRReference::Stats& stats = reference.GetStats();
+		average.fScale += stats.fScale;
+		average.fLuminance += stats.fLuminance;
+		average.fBrightPass += stats.fBrightPass;
+		average.fBloom += stats.fBloom;
+		average.fStar += stats.fStar;
+		average.fFinal += stats.fFinal;
+		average.fTotal += stats.fTotal;
+		nDone++;
+	}
+
+	if (nDone > 0)
+	{
+		average.fScale /= nDone;
+		average.fLuminance /= nDone;
+		average.fBrightPass /= nDone;
+		average.fBloom /= nDone;
+		average.fStar /= nDone;
+		average.fFinal /= nDone;
+		average.fTotal /= nDone;
+	}
+
+	return average;
+}
@@ -0,0 +1,279 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: WLHDRReference.h
+//
+// Author: snez
+//
+// Desc: The HDRSun post-processing chain done on the CPU with float RGBA images: scaling,
+//       luminance and adaptation, bright pass, bloom, star and the final tone mapping pass.
+//       It follows HDRLighting.fx and the sample offsets HDRSun hands it, texel for texel,
+//       so GPU results can be checked against it, and stills can be produced on machines
+//       without a GPU. Nothing in here depends on Direct3D.
+//
+//       Rows are split between the threads of a ThreadPool when one is given, and the
+//       per pixel work uses SSE where the compiler targets it.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __WLHDRReference_H__
+#define __WLHDRReference_H__
+
+#include "WLPlatform.h"
+#include "WLThreadPool.h"
+
+#define HDR_MAX_SAMPLES			16		// Same as MAX_SAMPLES in HDRLighting.fx
+#define HDR_MAX_STAR_LINES		8
+#define HDR_STAR_LIB_TYPES		6		// Same as NUM_STARLIBTYPES in GlareDefD3D.h
+#define HDR_TONEMAP_SIZE		64		// Size of the first luminance texture
+
+#define HDR_MAX_BLOOM_LEVELS	6		// Levels of the dual filter bloom pyramid
+#define HDR_DUAL_BLOOM_GAIN		4.0f	// The Gaussian bloom multiplies by 2 in each direction
+
+#define HDR_HISTOGRAM_BINS		64
+#define HDR_HISTOGRAM_LOG_MIN	-8.0f	// Range of log(luminance) the bins cover, values
+#define HDR_HISTOGRAM_LOG_MAX	8.0f	// outside it land in the first or last bin
+
+namespace WL
+{
+
+	//
+	//	The Gaussian kernels of the chain, worked out once from
+	//	1/sqrt(2 pi rho^2) exp(-(x^2 + y^2) / (2 rho^2)) rather than every pass.
+	//
+	//	The bloom takes the center texel and 7 on either side with rho = 3, the first
+	//	entry being the center. The 5x5 blur approximates its kernel with the 13 texels
+	//	no further than 2 apart in block distance, rho = 1, and its weights add up to 1.
+	//
+	struct KernelSample
+	{
+		int		x;
+		int		y;
+		float	fWeight;
+	};
+
+	extern const float HDR_BLOOM_KERNEL[8];
+	extern const KernelSample HDR_GAUSS_BLUR_5X5_KERNEL[13];
+
+	//
+	//	An RGBA image of floats, rows top to bottom
+	//
+	class FloatImage
+	{
+	public:
+		FloatImage();
+		~FloatImage();
+
+		// Allocates the image cleared to black
+		bool Create(int width, int height);
+		void Release();
+
+		inline int GetWidth() const { return m_nWidth; }
+		inline int GetHeight() const { return m_nHeight; }
+		inline float* GetPixel(int x, int y) { return m_pPixels + 4 * (y * m_nWidth + x); }
+		inline const float* GetPixel(int x, int y) const { return m_pPixels + 4 * (y * m_nWidth + x); }
+
+		// Portable float map files, the RGB channels only. Alpha is loaded as 1.
+		bool LoadPFM(const char* strFile);
+		bool SavePFM(const char* strFile) const;
+
+	private:
+		FloatImage(const FloatImage&);
+		FloatImage& operator=(const FloatImage&);
+
+		float*	m_pPixels;
+		int		m_nWidth;
+		int		m_nHeight;
+	};
+
+	//
+	//	One line of the star, as in STARLINE
+	//
+	struct HDRStarLine
+	{
+		int		nPasses;
+		float	fSampleLength;
+		float	fAttenuation;
+		float	fInclination;
+	};
+
+	//
+	//	A star of the GlareDef library, its lines already laid out. HDR_STAR_LIB is
+	//	indexed by ESTARLIBTYPE, CStarDef copies its stars from there. The generic forms
+	//	spread their lines evenly around the circle, the sunny cross alternates long and
+	//	short ones. Inclinations are in radians.
+	//
+	struct HDRStarLib
+	{
+		int					nStarLines;
+		const HDRStarLine*	pStarLine;			// [nStarLines]
+		float				fInclination;
+		bool				bRotation;			// Rotation is available from outside
+	};
+
+	extern const HDRStarLib HDR_STAR_LIB[HDR_STAR_LIB_TYPES];
+
+	//
+	//	The colors the samples of the star lines are tinted with for chromatic
+	//	aberration, red green blue alpha. See CStarDef::GetChromaticAberrationColor().
+	//
+	extern const float HDR_CHROMATIC_ABERRATION_COLOR[8][4];
+
+	//
+	//	Histogram of the log luminance values SampleAvgLum leaves in the first luminance
+	//	texture. Every bin also keeps the sum of its values, so the average of a range of
+	//	bins is exact rather than a bin center.
+	//
+	struct LuminanceHistogram
+	{
+		unsigned int	anCounts[HDR_HISTOGRAM_BINS];
+		float			afSums[HDR_HISTOGRAM_BINS];
+		unsigned int	nTotal;
+	};
+
+	void BuildLuminanceHistogram(const float* pLogLum, int nCount, LuminanceHistogram* pHistogram);
+
+	//
+	//	exp() of the average log luminance between two fractions of the values, so
+	//	(0.1, 0.95) ignores the darkest 10% and the brightest 5%
+	//
+	float GetHistogramLuminance(const LuminanceHistogram& histogram, float fLow, float fHigh);
+
+	//
+	//	Levels of the dual filter bloom for a bloom scale, the first level being 1/8 of
+	//	the scene. Every level doubles the radius of the bloom and costs a quarter of
+	//	the one above it.
+	//
+	int GetBloomLevels(float fBloomScale, int nEighthWidth, int nEighthHeight);
+
+	//
+	//	One pass of the bloom, and the pixels it writes. The GPU cost is roughly the
+	//	pixels times the samples.
+	//
+	struct BloomPassCost
+	{
+		const char*	strName;
+		int			nWidth;
+		int			nHeight;
+		int			nSamples;
+	};
+
+	//
+	//	The passes the bloom takes in either mode, nLevels is ignored for the Gaussian
+	//	bloom. Its star source pass is shared with the star. Returns the number of passes.
+	//
+	int GetBloomPassCosts(bool bDualFilter, int nLevels, int nEighthWidth, int nEighthHeight,
+						  BloomPassCost* aCosts, int nMaxCosts);
+
+	//
+	//	Everything the effect file is given by HDRSun, see HDRSun::GetReferenceSettings()
+	//
+	struct HDRReferenceSettings
+	{
+		float		fMiddleGray;			// g_fMiddleGray
+		float		fElapsedTime;			// Seconds since the last frame, drives adaptation
+		float		fBloomScale;			// g_fBloomScale
+		float		fStarScale;				// g_fStarScale
+		bool		bToneMap;
+		bool		bBlueShift;
+		bool		bBloom;
+		bool		bDualFilterBloom;		// Downsample pyramid instead of the Gaussian passes
+		bool		bStar;
+		bool		bHistogram;				// Exposure from the luminance histogram
+		float		fHistogramLow;			// Fractions of the histogram averaged, see
+		float		fHistogramHigh;			// GetHistogramLuminance()
+
+		float		fStarInclination;		// Glare and star inclination together, in radians
+		float		fChromaticAberration;
+		int			nStarLines;
+		HDRStarLine	aStarLines[HDR_MAX_STAR_LINES];
+
+		HDRReferenceSettings();
+	};
+
+	class HDRReference
+	{
+	public:
+		struct Stats
+		{
+			double	fScale;				// Milliseconds spent in each part of the last frame
+			double	fLuminance;
+			double	fBrightPass;
+			double	fBloom;
+			double	fStar;
+			double	fFinal;
+			double	fTotal;
+		};
+
+		HDRReference();
+
+		// Rows are spread over the pool's threads, NULL runs everything on the caller
+		inline void SetThreadPool(ThreadPool* pPool) { m_pThreadPool = pPool; }
+
+		// Start adapting from the given luminance, the GPU starts from black
+		void ResetAdaptation(float fLuminance = 0.0f);
+
+		// Run the whole chain over an HDR scene, the output has the size of the scene.
+		// Adaptation carries over from one call to the next like it does between frames.
+		bool Process(const FloatImage& scene, const HDRReferenceSettings& settings, FloatImage* pOutput);
+
+		inline float GetSceneLuminance() const { return m_fSceneLuminance; }
+		inline float GetAdaptedLuminance() const { return m_fAdaptedLuminance; }
+		inline const Stats& GetStats() const { return m_Stats; }
+
+		// Intermediate results, for comparing against the GPU render targets
+		inline const FloatImage& GetSceneScaled() const { return m_SceneScaled; }
+		inline const FloatImage& GetBrightPass() const { return m_BrightPass; }
+		inline const FloatImage& GetStarSource() const { return m_StarSource; }
+		inline const FloatImage& GetBloomSource() const { return m_BloomSource; }
+		inline const FloatImage& GetBloom() const { return m_aBloom[0]; }
+		inline const FloatImage& GetStar() const { return m_Star; }
+
+	private:
+		HDRReference(const HDRReference&);
+		HDRReference& operator=(const HDRReference&);
+
+		typedef void (*RowFunction)(void* pContext, int yBegin, int yEnd);
+
+		void ForEachRow(RowFunction pfnRows, void* pContext, int yBegin, int yEnd);
+		void MeasureLuminance(const HDRReferenceSettings& settings);
+		void RenderBloom();
+		void RenderDualFilterBloom(int nLevels);
+		void RenderStar(const HDRReferenceSettings& settings);
+
+		enum { MAX_BANDS = 64, MIN_BAND_ROWS = 4 };
+
+		ThreadPool*		m_pThreadPool;
+		Semaphore		m_BandDone;
+
+		FloatImage		m_SceneScaled;
+		FloatImage		m_BrightPass;
+		FloatImage		m_StarSource;
+		FloatImage		m_BloomSource;
+		FloatImage		m_aBloom[3];
+		FloatImage		m_aBloomDown[HDR_MAX_BLOOM_LEVELS];
+		FloatImage		m_aBloomUp[HDR_MAX_BLOOM_LEVELS];		// [0] is m_aBloom[0]
+		FloatImage		m_aStarWork[2];
+		FloatImage		m_aStarLine[HDR_MAX_STAR_LINES];
+		FloatImage		m_Star;
+		float			m_afToneMap[HDR_TONEMAP_SIZE * HDR_TONEMAP_SIZE];
+
+		float			m_fSceneLuminance;
+		float			m_fAdaptedLuminance;
+		Stats			m_Stats;
+	};
+
+	//
+	//	Largest and root mean square difference over the RGB channels. False when the
+	//	sizes differ.
+	//
+	bool CompareImages(const FloatImage& a, const FloatImage& b, float* pfMaxError, float* pfRMSError);
+
+	//
+	//	Runs the chain nFrames times over the same scene and returns the average timings
+	//
+	HDRReference::Stats BenchmarkHDRReference(HDRReference& reference, const FloatImage& scene,
+											  const HDRReferenceSettings& settings, int nFrames);
+
+}
+
+#endif // __WLHDRReference_H__
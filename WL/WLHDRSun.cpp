@@ -1,2090 +1,3190 @@
-#include "WLHDRSun.h"
-
-const DWORD ScreenVertex::FVF = D3DFVF_XYZRHW | D3DFVF_TEX1;
-
-//
-//	Constructor
-//
-HDRSun::HDRSun(	float x, float y, float z,			// The World Coordinates of the sun
-			float radius, int stacks, int slices,	// Sun's sphere geometry info
-			D3DXMATRIX mProjection,					// Camera Projection Matrix, will be set in the shader
-			float BloomScale,						// Scale of the bloom effect
-			float StarScale,						// Scale of the star effect
-			int LightIntensity,						// Light intensity of the sun, must be 0..100
-			float BloomIntensity)					// Intensity for the bloom effect
-{
-	// Basic initializations
-	m_mProjection = mProjection;
-	m_pd3dDevice = DXUTGetD3DDevice();
-	m_pEffect = NULL;
-	m_pFloatMSRT = NULL;							// Multi-Sample float render target
-	m_pFloatMSDS = NULL;							// Depth Stencil surface for the float RT
-	m_pTexScene = NULL;								// HDR render target containing the scene
-	m_pTexSceneScaled = NULL;						// Scaled copy of the HDR scene
-	m_pTexBrightPass = NULL;						// Bright-pass filtered copy of the scene
-	m_pTexAdaptedLuminanceCur = NULL;				// The luminance that the user is currenly adapted to
-	m_pTexAdaptedLuminanceLast = NULL;				// The luminance that the user is currenly adapted to
-	m_pTexStarSource = NULL;						// Star effect source texture
-	m_pTexBloomSource = NULL;						// Bloom effect source texture
-	for (int i = 0; i < NUM_BLOOM_TEXTURES; i++)
-		m_apTexBloom[i] = 0;						// Blooming effect working textures
-	for (int i = 0; i < NUM_STAR_TEXTURES; i++)
-		m_apTexStar[i] = 0;							// Star effect working textures
-	for (int i = 0; i < NUM_TONEMAP_TEXTURES; i++)
-		m_apTexToneMap[i] = 0;						// Log average luminance samples 
-													// from the HDR render target
-	m_pmeshSphere = NULL;							// Representation of point light
-	m_bUseMultiSampleFloat16 = false;				// True when using multisampling on a floating point back buffer
-	m_MaxMultiSampleType = D3DMULTISAMPLE_NONE;		// Non-Zero when m_bUseMultiSampleFloat16 is true
-	m_dwMultiSampleQuality = 0;						// Non-Zero when we have multisampling on a float backbuffer
-	m_bSupportsD16 = false;
-	m_bSupportsD32 = false;
-	m_bSupportsD24X8 = false;
-	m_fRadius = radius;						// Sun's sphere radius
-	m_fStacks = stacks;
-	m_fSlices = slices;	
-	m_fBloomScale = BloomScale;
-	m_fStarScale = StarScale;
-
-
-    // Set light positions in world space
-    m_avLightPosition = D3DXVECTOR4(x, y, z, 1.0f );
-
-	//
-	//	Initialize the values 
-	//
-	m_bToneMap = true;
-	m_bBlueShift = true;
-
-	m_eGlareType = (EGLARELIBTYPE)(INT_PTR) GLT_FILTER_SNOWCROSS_SPECTRAL;	
-	// Glare type available types
-	 //   GLT_DEFAULT
-     //   GLT_DISABLE 
-     //   GLT_CAMERA 
-     //   GLT_NATURAL
-     //   GLT_CHEAPLENS 
-     //   GLT_FILTER_CROSSSCREEN
-     //   GLT_FILTER_CROSSSCREEN_SPECTRAL
-     //   GLT_FILTER_SNOWCROSS
-     //   GLT_FILTER_SNOWCROSS_SPECTRAL
-     //   GLT_FILTER_SUNNYCROSS
-     //   GLT_FILTER_SUNNYCROSS_SPECTRAL
-     //   GLT_CINECAM_VERTICALSLITS
-     //   GLT_CINECAM_HORIZONTALSLITS
-	m_GlareDef.Initialize( m_eGlareType );
-	
-	m_fKeyValue = BloomIntensity / 100.0f;	
-
-	m_nLightMantissa = 1 + (LightIntensity % 9);	
-	m_nLightLogIntensity = -4 + (LightIntensity / 9);
-
-	RefreshLights();
-
-	OnCreateDevice();
-	OnResetDevice();
-
-}
-
-HRESULT HDRSun::OnResetDevice()
-{
-    HRESULT hr;
-
-	m_pd3dDevice = DXUTGetD3DDevice();
-	m_pd3dDevice->GetTransform(D3DTS_PROJECTION,&m_mProjection);
-
-    if( m_pEffect )
-        V_RETURN( m_pEffect->OnResetDevice() );
-
-    int i=0; // loop variable
-
-    const D3DSURFACE_DESC* pBackBufferDesc = DXUTGetBackBufferSurfaceDesc();
-
-
-    // Create the Multi-Sample floating point render target
-    D3DFORMAT dfmt = D3DFMT_UNKNOWN;
-    if(m_bSupportsD16)
-        dfmt = D3DFMT_D16;
-    else if(m_bSupportsD32)
-        dfmt = D3DFMT_D32;
-    else if(m_bSupportsD24X8)
-        dfmt = D3DFMT_D24X8;
-    else
-        m_bUseMultiSampleFloat16 = false;
-
-    if( m_bUseMultiSampleFloat16 )
-    {
-        hr = m_pd3dDevice->CreateRenderTarget( pBackBufferDesc->Width, pBackBufferDesc->Height,
-                                               D3DFMT_A16B16G16R16F, 
-                                               m_MaxMultiSampleType, m_dwMultiSampleQuality,
-                                               FALSE, &m_pFloatMSRT, NULL );
-        if( FAILED(hr) )
-            m_bUseMultiSampleFloat16 = false;
-        else
-        {
-            hr = m_pd3dDevice->CreateDepthStencilSurface(  pBackBufferDesc->Width, pBackBufferDesc->Height,
-                                               dfmt, 
-                                               m_MaxMultiSampleType, m_dwMultiSampleQuality,
-                                               TRUE, &m_pFloatMSDS, NULL );
-            if( FAILED(hr) )
-            {
-                m_bUseMultiSampleFloat16 = false;
-                SAFE_RELEASE( m_pFloatMSRT );
-            }
-        }
-    }
-
-    // Crop the scene texture so width and height are evenly divisible by 8.
-    // This cropped version of the scene will be used for post processing effects,
-    // and keeping everything evenly divisible allows precise control over
-    // sampling points within the shaders.
-    m_dwCropWidth = pBackBufferDesc->Width - pBackBufferDesc->Width % 8;
-    m_dwCropHeight = pBackBufferDesc->Height - pBackBufferDesc->Height % 8;
-
-    // Create the HDR scene texture
-    hr = m_pd3dDevice->CreateTexture(pBackBufferDesc->Width, pBackBufferDesc->Height, 
-                                     1, D3DUSAGE_RENDERTARGET, D3DFMT_A16B16G16R16F, 
-                                     D3DPOOL_DEFAULT, &m_pTexScene, NULL);
-    if( FAILED(hr) )
-        return hr;
-
-
-    // Scaled version of the HDR scene texture
-    hr = m_pd3dDevice->CreateTexture(m_dwCropWidth / 4, m_dwCropHeight / 4, 
-                                     1, D3DUSAGE_RENDERTARGET, 
-                                     D3DFMT_A16B16G16R16F, D3DPOOL_DEFAULT, 
-                                     &m_pTexSceneScaled, NULL);
-    if( FAILED(hr) )
-        return hr;
-    
-
-    // Create the bright-pass filter texture. 
-    // Texture has a black border of single texel thickness to fake border 
-    // addressing using clamp addressing
-    hr = m_pd3dDevice->CreateTexture(m_dwCropWidth / 4 + 2, m_dwCropHeight / 4 + 2, 
-                                     1, D3DUSAGE_RENDERTARGET, 
-                                     D3DFMT_A8R8G8B8, D3DPOOL_DEFAULT, 
-                                     &m_pTexBrightPass, NULL);
-    if( FAILED(hr) )
-        return hr;
-
-    
-    
-    // Create a texture to be used as the source for the star effect
-    // Texture has a black border of single texel thickness to fake border 
-    // addressing using clamp addressing
-    hr = m_pd3dDevice->CreateTexture(m_dwCropWidth / 4 + 2, m_dwCropHeight / 4 + 2, 
-                                     1, D3DUSAGE_RENDERTARGET, 
-                                     D3DFMT_A8R8G8B8, D3DPOOL_DEFAULT, 
-                                     &m_pTexStarSource, NULL);
-    if( FAILED(hr) )
-        return hr;
-
-    
-    
-    // Create a texture to be used as the source for the bloom effect
-    // Texture has a black border of single texel thickness to fake border 
-    // addressing using clamp addressing
-    hr = m_pd3dDevice->CreateTexture(m_dwCropWidth / 8 + 2, m_dwCropHeight / 8 + 2, 
-                                     1, D3DUSAGE_RENDERTARGET, 
-                                     D3DFMT_A8R8G8B8, D3DPOOL_DEFAULT, 
-                                     &m_pTexBloomSource, NULL);
-    if( FAILED(hr) )
-        return hr;
-
-
-    
-
-    // Create a 2 textures to hold the luminance that the user is currently adapted
-    // to. This allows for a simple simulation of light adaptation.
-    hr = m_pd3dDevice->CreateTexture(1, 1, 1, D3DUSAGE_RENDERTARGET,
-                                     m_LuminanceFormat, D3DPOOL_DEFAULT,
-                                     &m_pTexAdaptedLuminanceCur, NULL);
-    if( FAILED(hr) )
-        return hr;
-    hr = m_pd3dDevice->CreateTexture(1, 1, 1, D3DUSAGE_RENDERTARGET,
-                                     m_LuminanceFormat, D3DPOOL_DEFAULT,
-                                     &m_pTexAdaptedLuminanceLast, NULL);
-    if( FAILED(hr) )
-        return hr;
-
-
-    // For each scale stage, create a texture to hold the intermediate results
-    // of the luminance calculation
-    for(i=0; i < NUM_TONEMAP_TEXTURES; i++)
-    {
-        int iSampleLen = 1 << (2*i);
-
-        hr = m_pd3dDevice->CreateTexture(iSampleLen, iSampleLen, 1, D3DUSAGE_RENDERTARGET, 
-                                         m_LuminanceFormat, D3DPOOL_DEFAULT, 
-                                         &m_apTexToneMap[i], NULL);
-        if( FAILED(hr) )
-            return hr;
-    }
-
-
-    // Create the temporary blooming effect textures
-    // Texture has a black border of single texel thickness to fake border 
-    // addressing using clamp addressing
-    for( i=1; i < NUM_BLOOM_TEXTURES; i++ )
-    {
-        hr = m_pd3dDevice->CreateTexture(m_dwCropWidth/8 + 2, m_dwCropHeight/8 + 2, 
-                                        1, D3DUSAGE_RENDERTARGET, D3DFMT_A8R8G8B8, 
-                                        D3DPOOL_DEFAULT, &m_apTexBloom[i], NULL);
-        if( FAILED(hr) )
-            return hr;
-    }
-
-    // Create the final blooming effect texture
-    hr = m_pd3dDevice->CreateTexture( m_dwCropWidth/8, m_dwCropHeight/8,
-                                      1, D3DUSAGE_RENDERTARGET, D3DFMT_A8R8G8B8, 
-                                      D3DPOOL_DEFAULT, &m_apTexBloom[0], NULL);
-    if( FAILED(hr) )
-        return hr;
-                              
-
-    // Create the star effect textures
-    for( i=0; i < NUM_STAR_TEXTURES; i++ )
-    {
-        hr = m_pd3dDevice->CreateTexture( m_dwCropWidth /4, m_dwCropHeight / 4,
-                                          1, D3DUSAGE_RENDERTARGET,
-                                          D3DFMT_A16B16G16R16F, D3DPOOL_DEFAULT,
-                                          &m_apTexStar[i], NULL );
-
-        if( FAILED(hr) )
-            return hr;
-    }
-
-
-    // Textures with borders must be cleared since scissor rect testing will
-    // be used to avoid rendering on top of the border
-    ClearTexture( m_pTexAdaptedLuminanceCur );
-    ClearTexture( m_pTexAdaptedLuminanceLast );
-    ClearTexture( m_pTexBloomSource );
-    ClearTexture( m_pTexBrightPass );
-    ClearTexture( m_pTexStarSource );
-
-    for( i=0; i < NUM_BLOOM_TEXTURES; i++ )
-    {
-        ClearTexture( m_apTexBloom[i] );
-    }
-
-	// Create the sphere that will represent the sun
-	D3DXCreateSphere(
-					m_pd3dDevice,	// Pointer to IDirect3DDevice9
-					m_fRadius,		// Radius
-					m_fSlices,		// Slices
-					m_fStacks,		// Stacks
-					&m_pmeshSphere,	// Pointer to a pointer to a ID3DXMesh
-					0);
-
-    // Set effect file variables
-    m_pEffect->SetMatrix("g_mProjection", &m_mProjection);
-    m_pEffect->SetFloat( "g_fBloomScale", m_fBloomScale );
-    m_pEffect->SetFloat( "g_fStarScale", m_fStarScale );
-    
-    return S_OK;
-}
-
-void HDRSun::OnLostDevice()
-{
-
-    if( m_pEffect )
-        m_pEffect->OnLostDevice();
-
-    int i=0;
-    
-
-    SAFE_RELEASE(m_pmeshSphere);
-
-    SAFE_RELEASE(m_pFloatMSRT);
-    SAFE_RELEASE(m_pFloatMSDS);
-    SAFE_RELEASE(m_pTexScene);
-    SAFE_RELEASE(m_pTexSceneScaled);
-    SAFE_RELEASE(m_pTexAdaptedLuminanceCur);
-    SAFE_RELEASE(m_pTexAdaptedLuminanceLast);
-    SAFE_RELEASE(m_pTexBrightPass);
-    SAFE_RELEASE(m_pTexBloomSource);
-    SAFE_RELEASE(m_pTexStarSource);
-    
-    for( i=0; i < NUM_TONEMAP_TEXTURES; i++)
-    {
-        SAFE_RELEASE(m_apTexToneMap[i]);
-    }
-
-    for( i=0; i < NUM_STAR_TEXTURES; i++ )
-    {
-        SAFE_RELEASE(m_apTexStar[i]);
-    }
-
-    for( i=0; i < NUM_BLOOM_TEXTURES; i++ )
-    {
-        SAFE_RELEASE(m_apTexBloom[i]);
-    }
-
-}
-
-void HDRSun::ResetMatrices()
-{
-	m_pd3dDevice->GetTransform(D3DTS_PROJECTION,&m_mProjection);
-	m_pd3dDevice->GetTransform(D3DTS_VIEW,&m_mView);
-	if (m_pEffect)
-		m_pEffect->SetMatrix("g_mProjection", &m_mProjection);
-}
-
-
-HRESULT HDRSun::OnCreateDevice()
-{
-	m_pd3dDevice = DXUTGetD3DDevice();
-
-	HRESULT hr;
-
-    // Determine which of D3DFMT_R16F or D3DFMT_R32F to use for luminance texture
-    D3DCAPS9 Caps;
-    IDirect3D9* pD3D = DXUTGetD3DObject();
-    D3DDISPLAYMODE DisplayMode;
-    m_pd3dDevice->GetDeviceCaps( &Caps );
-    m_pd3dDevice->GetDisplayMode( 0, &DisplayMode );
-    // IsDeviceAcceptable already ensured that one of D3DFMT_R16F or D3DFMT_R32F is available.
-    if( FAILURE( pD3D->CheckDeviceFormat( Caps.AdapterOrdinal, Caps.DeviceType,
-                    DisplayMode.Format, D3DUSAGE_RENDERTARGET, 
-                    D3DRTYPE_TEXTURE, D3DFMT_R16F ) ) )
-        m_LuminanceFormat = D3DFMT_R32F;
-    else
-        m_LuminanceFormat = D3DFMT_R16F;
-
-    // Determine whether we can support multisampling on a A16B16G16R16F render target
-    m_bUseMultiSampleFloat16 = false;
-    m_MaxMultiSampleType = D3DMULTISAMPLE_NONE;
-    DXUTDeviceSettings settings = DXUTGetDeviceSettings();
-    for( D3DMULTISAMPLE_TYPE imst = D3DMULTISAMPLE_2_SAMPLES; imst <= D3DMULTISAMPLE_16_SAMPLES; imst = (D3DMULTISAMPLE_TYPE)(imst + 1) )
-    {
-        DWORD msQuality = 0;
-        if( SUCCESS( pD3D->CheckDeviceMultiSampleType( Caps.AdapterOrdinal, 
-                                                           Caps.DeviceType, 
-                                                           D3DFMT_A16B16G16R16F, 
-                                                           settings.pp.Windowed, 
-                                                           imst, &msQuality ) ) )
-        {
-            m_bUseMultiSampleFloat16 = true;
-            m_MaxMultiSampleType = imst;
-            if( msQuality > 0 )
-                m_dwMultiSampleQuality = msQuality-1;
-            else
-                m_dwMultiSampleQuality = msQuality;
-        }
-    }
-
-    m_bSupportsD16 = false;
-    if( SUCCESS( pD3D->CheckDeviceFormat( settings.AdapterOrdinal, settings.DeviceType,
-                                            settings.AdapterFormat, D3DUSAGE_DEPTHSTENCIL,
-                                            D3DRTYPE_SURFACE, D3DFMT_D16 ) ) )
-    {
-        if( SUCCESS( pD3D->CheckDepthStencilMatch( settings.AdapterOrdinal, settings.DeviceType,
-                                            settings.AdapterFormat, D3DFMT_A16B16G16R16F, 
-                                            D3DFMT_D16 ) ) )
-        {
-            m_bSupportsD16 = true;
-        }
-    }
-    m_bSupportsD32 = false;
-    if( SUCCESS( pD3D->CheckDeviceFormat( settings.AdapterOrdinal, settings.DeviceType,
-                                            settings.AdapterFormat, D3DUSAGE_DEPTHSTENCIL,
-                                            D3DRTYPE_SURFACE, D3DFMT_D32 ) ) )
-    {
-        if( SUCCESS( pD3D->CheckDepthStencilMatch( settings.AdapterOrdinal, settings.DeviceType,
-                                                settings.AdapterFormat, D3DFMT_A16B16G16R16F, 
-                                                D3DFMT_D32 ) ) )
-        {
-            m_bSupportsD32 = true;
-        }
-    }
-    m_bSupportsD24X8 = false;
-    if( SUCCESS( pD3D->CheckDeviceFormat( settings.AdapterOrdinal, settings.DeviceType,
-                                            settings.AdapterFormat, D3DUSAGE_DEPTHSTENCIL,
-                                            D3DRTYPE_SURFACE, D3DFMT_D24X8 ) ) )
-    {
-        if( SUCCESS( pD3D->CheckDepthStencilMatch( settings.AdapterOrdinal, settings.DeviceType,
-                                                settings.AdapterFormat, D3DFMT_A16B16G16R16F, 
-                                                D3DFMT_D24X8 ) ) )
-        {
-            m_bSupportsD24X8 = true;
-        }
-    }
-
-    DWORD dwShaderFlags = D3DXFX_NOT_CLONEABLE;
-    #ifdef DEBUG_VS
-        dwShaderFlags |= D3DXSHADER_FORCE_VS_SOFTWARE_NOOPT;
-    #endif
-    #ifdef DEBUG_PS
-        dwShaderFlags |= D3DXSHADER_FORCE_PS_SOFTWARE_NOOPT;
-    #endif
-
-	// Read the D3DX effect file
-    // If this fails, there should be debug output as to 
-    // they the .fx file failed to compile
-    V( D3DXCreateEffectFromFile( m_pd3dDevice, L"data\\fx\\HDRLighting.fx", NULL, NULL, dwShaderFlags, 
-                                        NULL, &m_pEffect, NULL ) );
-
-	return S_OK;
-
-}
-
-
-void HDRSun::OnDestroyDevice()
-{
-    SAFE_RELEASE(m_pEffect);
-}
-
-//-----------------------------------------------------------------------------
-// Name: ClearTexture()
-// Desc: Helper function for RestoreDeviceObjects to clear a texture surface
-//-----------------------------------------------------------------------------
-HRESULT HDRSun::ClearTexture( LPDIRECT3DTEXTURE9 pTexture )
-{
-    HRESULT hr = S_OK;
-    PDIRECT3DSURFACE9 pSurface = NULL;
-
-    hr = pTexture->GetSurfaceLevel( 0, &pSurface );
-    if( SUCCEEDED(hr) )
-        m_pd3dDevice->ColorFill( pSurface, NULL, D3DCOLOR_ARGB(0, 0, 0, 0) );
-
-    SAFE_RELEASE( pSurface );
-    return hr;
-}
-
-
-//
-//	Destructor
-//
-HDRSun::~HDRSun()
-{
-    int i=0;
-
-    SAFE_RELEASE(m_pmeshSphere);
-
-    SAFE_RELEASE(m_pFloatMSRT);
-    SAFE_RELEASE(m_pFloatMSDS);
-    SAFE_RELEASE(m_pTexScene);
-    SAFE_RELEASE(m_pTexSceneScaled);
-    SAFE_RELEASE(m_pTexAdaptedLuminanceCur);
-    SAFE_RELEASE(m_pTexAdaptedLuminanceLast);
-    SAFE_RELEASE(m_pTexBrightPass);
-    SAFE_RELEASE(m_pTexBloomSource);
-    SAFE_RELEASE(m_pTexStarSource);
-    
-    for( i=0; i < NUM_TONEMAP_TEXTURES; i++)
-    {
-        SAFE_RELEASE(m_apTexToneMap[i]);
-    }
-
-    for( i=0; i < NUM_STAR_TEXTURES; i++ )
-    {
-        SAFE_RELEASE(m_apTexStar[i]);
-    }
-
-    for( i=0; i < NUM_BLOOM_TEXTURES; i++ )
-    {
-        SAFE_RELEASE(m_apTexBloom[i]);
-    }
-
-	SAFE_RELEASE(m_pEffect);
-
-}
-
-//-----------------------------------------------------------------------------
-// Name: RefreshLights
-// Desc: Set the light intensities to match the current log luminance
-//-----------------------------------------------------------------------------
-HRESULT HDRSun::RefreshLights()
-{
-    m_avLightIntensity.x = m_nLightMantissa * (float) pow(10.0f, m_nLightLogIntensity);
-    m_avLightIntensity.y = m_nLightMantissa * (float) pow(10.0f, m_nLightLogIntensity);
-    m_avLightIntensity.z = m_nLightMantissa * (float) pow(10.0f, m_nLightLogIntensity);
-    m_avLightIntensity.w = 1.0f;
-
-    return S_OK;
-}
-
-
-//-----------------------------------------------------------------------------
-// Name: AdjustLight
-// Desc: Increment or decrement the light at the given index
-//-----------------------------------------------------------------------------
-HRESULT HDRSun::AdjustLight(bool bIncrement)
-{
-
-	if( bIncrement && m_nLightLogIntensity < 7 )
-    {
-        m_nLightMantissa++;
-        if( m_nLightMantissa > 9 )
-        {
-            m_nLightMantissa = 1;
-            m_nLightLogIntensity++;
-        }
-    }
-    
-    if( !bIncrement && m_nLightLogIntensity > -4 )
-    {
-        m_nLightMantissa--;
-        if( m_nLightMantissa < 1 )
-        {
-            m_nLightMantissa = 9;
-            m_nLightLogIntensity--;
-        }
-    }
-
-    RefreshLights();
-    return S_OK;
-}
-
-//-----------------------------------------------------------------------------
-// Name: Draw
-// Desc: Prepares the shaders and renders the sun for this frame
-//-----------------------------------------------------------------------------
-void HDRSun::Draw(D3DXMATRIX mView)				// The View Coordinates Matrix
-{
-	HRESULT hr;
-
-	// Set the flag to refresh the user's simulated adaption level.
-    // Frame move is not called when the scene is paused or single-stepped. 
-    // If the scene is paused, the user's adaptation level needs to remain
-    // unchanged.
-    m_bAdaptationInvalid = true;
-
-    // Calculate the position of the light in view space
-    D3DXVECTOR4 avLightViewPosition; 
-    D3DXVec4Transform(&avLightViewPosition, &m_avLightPosition, &mView);
-
-    // Set frame shader constants
-    m_pEffect->SetBool("g_bEnableToneMap", m_bToneMap);
-    m_pEffect->SetBool("g_bEnableBlueShift", m_bBlueShift);
-    m_pEffect->SetValue("g_avLightPositionView", avLightViewPosition, sizeof(D3DXVECTOR4));
-    m_pEffect->SetValue("g_avLightIntensity", m_avLightIntensity, sizeof(D3DXVECTOR4));
-
-	// Prepare Surfaces
-    PDIRECT3DSURFACE9 pSurfLDR; // Low dynamic range surface for final output
-    PDIRECT3DSURFACE9 pSurfDS;  // Low dynamic range depth stencil surface
-    PDIRECT3DSURFACE9 pSurfHDR; // High dynamic range surface to store 
-                                // intermediate floating point color values
-    
-    // Store the old render target
-    V( m_pd3dDevice->GetRenderTarget(0, &pSurfLDR) );
-    V( m_pd3dDevice->GetDepthStencilSurface( &pSurfDS ) );
-
-    // Setup HDR render target
-    V( m_pTexScene->GetSurfaceLevel(0, &pSurfHDR) );
-    if( m_bUseMultiSampleFloat16 )
-    {
-        V( m_pd3dDevice->SetRenderTarget(0, m_pFloatMSRT ) );
-        V( m_pd3dDevice->SetDepthStencilSurface( m_pFloatMSDS ) );
-    }
-    else
-    {
-        V( m_pd3dDevice->SetRenderTarget(0, pSurfHDR) );
-    }
-    
-    // Clear the viewport
-    V( m_pd3dDevice->Clear(0, NULL, D3DCLEAR_TARGET | D3DCLEAR_ZBUFFER, D3DCOLOR_RGBA(0, 0, 0, 0), 1.0f, 0));
-
-    // Render the HDR Scene
-        CDXUTPerfEventGenerator g( DXUT_PERFEVENTCOLOR, L"Scene" );
-        RenderScene(mView);
-
-    // If using floating point multi sampling, stretchrect to the rendertarget
-    if( m_bUseMultiSampleFloat16 )
-    {
-        V( m_pd3dDevice->StretchRect( m_pFloatMSRT, NULL, pSurfHDR, NULL, D3DTEXF_NONE ) );
-        V( m_pd3dDevice->SetRenderTarget(0, pSurfHDR) );
-        V( m_pd3dDevice->SetDepthStencilSurface( pSurfDS ) );
-    }
-
-    // Create a scaled copy of the scene
-    Scene_To_SceneScaled();
-
-    // Setup tone mapping technique
-    if( m_bToneMap )
-        MeasureLuminance();
-    
-    // If FrameMove has been called, the user's adaptation level has also changed
-    // and should be updated
-    if( m_bAdaptationInvalid )
-    {
-        // Clear the update flag
-        m_bAdaptationInvalid = false;
-
-        // Calculate the current luminance adaptation level
-        CalculateAdaptation();
-    }
-
-    // Now that luminance information has been gathered, the scene can be bright-pass filtered
-    // to remove everything except bright lights and reflections.
-    SceneScaled_To_BrightPass();
-
-    // Blur the bright-pass filtered image to create the source texture for the star effect
-    BrightPass_To_StarSource();
-
-    // Scale-down the source texture for the star effect to create the source texture
-    // for the bloom effect
-    StarSource_To_BloomSource();
-
-    // Render post-process lighting effects
-    {
-        CDXUTPerfEventGenerator g( DXUT_PERFEVENTCOLOR, L"Bloom" );
-        RenderBloom();
-    }
-    {
-        CDXUTPerfEventGenerator g( DXUT_PERFEVENTCOLOR, L"Star" );
-        RenderStar();
-    }
-            
-    // Draw the high dynamic range scene texture to the low dynamic range
-    // back buffer. As part of this final pass, the scene will be tone-mapped
-    // using the user's current adapted luminance, blue shift will occur
-    // if the scene is determined to be very dark, and the post-process lighting
-    // effect textures will be added to the scene.
-    UINT uiPassCount, uiPass;
-    
-    V( m_pEffect->SetTechnique("FinalScenePass") );
-    V( m_pEffect->SetFloat("g_fMiddleGray", m_fKeyValue) );
-    
-    V( m_pd3dDevice->SetRenderTarget(0, pSurfLDR) );
-    V( m_pd3dDevice->SetTexture( 0, m_pTexScene ) );
-    V( m_pd3dDevice->SetTexture( 1, m_apTexBloom[0] ) );
-    V( m_pd3dDevice->SetTexture( 2, m_apTexStar[0] ) );
-    V( m_pd3dDevice->SetTexture( 3, m_pTexAdaptedLuminanceCur ) );
-    V( m_pd3dDevice->SetSamplerState( 0, D3DSAMP_MAGFILTER, D3DTEXF_POINT ) );
-    V( m_pd3dDevice->SetSamplerState( 0, D3DSAMP_MINFILTER, D3DTEXF_POINT ) );
-    V( m_pd3dDevice->SetSamplerState( 1, D3DSAMP_MAGFILTER, D3DTEXF_LINEAR) );
-    V( m_pd3dDevice->SetSamplerState( 1, D3DSAMP_MINFILTER, D3DTEXF_LINEAR ) );
-    V( m_pd3dDevice->SetSamplerState( 2, D3DSAMP_MAGFILTER, D3DTEXF_LINEAR) );
-    V( m_pd3dDevice->SetSamplerState( 2, D3DSAMP_MINFILTER, D3DTEXF_LINEAR ) );
-    V( m_pd3dDevice->SetSamplerState( 3, D3DSAMP_MAGFILTER, D3DTEXF_POINT ) );
-    V( m_pd3dDevice->SetSamplerState( 3, D3DSAMP_MINFILTER, D3DTEXF_POINT ) );
-    
-
-    V( m_pEffect->Begin(&uiPassCount, 0) );
-    {
-        CDXUTPerfEventGenerator g( DXUT_PERFEVENTCOLOR, L"Final Scene Pass" );
-
-		// We enable alpha blending so that in the case of drawing something in the backbuffer like
-		// a star map where z-buffering is disabled, we don't lose the information
-		m_pd3dDevice->SetRenderState(D3DRS_ALPHABLENDENABLE, true);	
-        for (uiPass = 0; uiPass < uiPassCount; uiPass++)
-        {
-            V( m_pEffect->BeginPass(uiPass) );
-                
-            DrawFullScreenQuad( 0.0f, 0.0f, 1.0f, 1.0f );
-
-            V( m_pEffect->EndPass() );
-        }
-        m_pd3dDevice->SetRenderState(D3DRS_ALPHABLENDENABLE, false);
-    }
-    V( m_pEffect->End() );
-
-    V( m_pd3dDevice->SetTexture( 1, NULL ) );
-    V( m_pd3dDevice->SetTexture( 2, NULL ) );
-    V( m_pd3dDevice->SetTexture( 3, NULL ) );
-
-    {
-        CDXUTPerfEventGenerator g( DXUT_PERFEVENTCOLOR, L"HUD / Stats" );
-    }
-
-
-    // Release surfaces
-    SAFE_RELEASE(pSurfHDR);
-    SAFE_RELEASE(pSurfLDR);
-    SAFE_RELEASE(pSurfDS);
-
-
-	
-}
-
-
-//-----------------------------------------------------------------------------
-// Name: RenderScene()
-// Desc: Render the world objects and lights
-//-----------------------------------------------------------------------------
-HRESULT HDRSun::RenderScene(D3DXMATRIX mView)
-{
-    HRESULT hr = S_OK;
-
-    UINT uiPassCount, uiPass;
-    D3DXMATRIXA16 mWorld;
-    D3DXMATRIXA16 mTrans;
-    D3DXMATRIXA16 mRotate;
-    D3DXMATRIXA16 mObjectToView;
-
-    m_pd3dDevice->SetSamplerState( 0, D3DSAMP_ADDRESSU, D3DTADDRESS_WRAP );
-    m_pd3dDevice->SetSamplerState( 0, D3DSAMP_ADDRESSV, D3DTADDRESS_WRAP );
-    
-    m_pEffect->SetTechnique("RenderScene");
-    m_pEffect->SetMatrix("g_mObjectToView", &mView);
-    
-    hr = m_pEffect->Begin(&uiPassCount, 0);
-    if( FAILED(hr) )
-        return hr;
-
-    for (uiPass = 0; uiPass < uiPassCount; uiPass++)
-    {
-        m_pEffect->BeginPass(uiPass);
-
-        // Turn off emissive lighting
-        D3DXVECTOR4 vNull( 0.0f, 0.0f, 0.0f, 0.0f );
-        m_pEffect->SetVector("g_vEmissive", &vNull); 
-        
-        //// Enable texture
-        //m_pEffect->SetBool("g_bEnableTexture", true);
-        //m_pd3dDevice->SetSamplerState( 0, D3DSAMP_MAGFILTER, D3DTEXF_LINEAR );
-        //m_pd3dDevice->SetSamplerState( 0, D3DSAMP_MINFILTER, D3DTEXF_LINEAR );
-    
-
-        // Draw the light sphere.
-        m_pEffect->SetFloat("g_fPhongExponent", 5.0f);
-        m_pEffect->SetFloat("g_fPhongCoefficient", 1.0f);
-        m_pEffect->SetFloat("g_fDiffuseCoefficient", 1.0f);
-        m_pEffect->SetBool("g_bEnableTexture", false);
-        
-
-        // Just position the point light -- no need to orient it
-        D3DXMATRIXA16 mScale;
-        D3DXMatrixScaling( &mScale, 0.05f, 0.05f, 0.05f );
-        
-        D3DXMatrixTranslation(&mWorld, m_avLightPosition.x, m_avLightPosition.y, m_avLightPosition.z);
-        mWorld = mScale * mWorld;
-        mObjectToView = mWorld * mView;
-        m_pEffect->SetMatrix("g_mObjectToView", &mObjectToView);
-
-        // A light which illuminates objects at 80 lum/sr should be drawn
-        // at 3183 lumens/meter^2/steradian, which equates to a multiplier
-        // of 39.78 per lumen.
-        D3DXVECTOR4 vEmissive = EMISSIVE_COEFFICIENT * m_avLightIntensity;
-        m_pEffect->SetVector("g_vEmissive", &vEmissive );    
-
-        m_pEffect->CommitChanges();
-        m_pmeshSphere->DrawSubset(0);
- 
-        m_pEffect->EndPass();
-    }
-
-    m_pEffect->End();
-
-    return S_OK;
-}
-
-
-
-
-//-----------------------------------------------------------------------------
-// Name: MeasureLuminance()
-// Desc: Measure the average log luminance in the scene.
-//-----------------------------------------------------------------------------
-HRESULT HDRSun::MeasureLuminance()
-{
-    HRESULT hr = S_OK;
-    UINT uiPassCount, uiPass;
-    int i, x, y, index;
-    D3DXVECTOR2 avSampleOffsets[MAX_SAMPLES];
-
-    
-    DWORD dwCurTexture = NUM_TONEMAP_TEXTURES-1;
-
-    // Sample log average luminance
-    PDIRECT3DSURFACE9 apSurfToneMap[NUM_TONEMAP_TEXTURES] = {0};
-
-    // Retrieve the tonemap surfaces
-    for( i=0; i < NUM_TONEMAP_TEXTURES; i++ )
-    {
-        hr = m_apTexToneMap[i]->GetSurfaceLevel( 0, &apSurfToneMap[i] );
-        if( FAILED(hr) )
-            goto LCleanReturn;
-    }
-
-    D3DSURFACE_DESC desc;
-    m_apTexToneMap[dwCurTexture]->GetLevelDesc( 0, &desc );
-
-    
-    // Initialize the sample offsets for the initial luminance pass.
-    float tU, tV;
-    tU = 1.0f / (3.0f * desc.Width);
-    tV = 1.0f / (3.0f * desc.Height);
-    
-    index=0;
-    for( x = -1; x <= 1; x++ )
-    {
-        for( y = -1; y <= 1; y++ )
-        {
-            avSampleOffsets[index].x = x * tU;
-            avSampleOffsets[index].y = y * tV;
-
-            index++;
-        }
-    }
-
-    
-    // After this pass, the m_apTexToneMap[NUM_TONEMAP_TEXTURES-1] texture will contain
-    // a scaled, grayscale copy of the HDR scene. Individual texels contain the log 
-    // of average luminance values for points sampled on the HDR texture.
-    m_pEffect->SetTechnique("SampleAvgLum");
-    m_pEffect->SetValue("g_avSampleOffsets", avSampleOffsets, sizeof(avSampleOffsets));
-    
-    m_pd3dDevice->SetRenderTarget(0, apSurfToneMap[dwCurTexture]);
-    m_pd3dDevice->SetTexture(0, m_pTexSceneScaled);
-    m_pd3dDevice->SetSamplerState( 0, D3DSAMP_MAGFILTER, D3DTEXF_LINEAR );
-    m_pd3dDevice->SetSamplerState( 0, D3DSAMP_MINFILTER, D3DTEXF_LINEAR );
-    m_pd3dDevice->SetSamplerState( 1, D3DSAMP_MAGFILTER, D3DTEXF_LINEAR );
-    m_pd3dDevice->SetSamplerState( 1, D3DSAMP_MINFILTER, D3DTEXF_LINEAR );
-    
-    
-    hr = m_pEffect->Begin(&uiPassCount, 0);
-    if( FAILED(hr) )
-        goto LCleanReturn;
-
-    for (uiPass = 0; uiPass < uiPassCount; uiPass++)
-    {
-        m_pEffect->BeginPass(uiPass);
-
-        // Draw a fullscreen quad to sample the RT
-        DrawFullScreenQuad(0.0f, 0.0f, 1.0f, 1.0f);
-
-        m_pEffect->EndPass();
-    }
-
-    m_pEffect->End();
-    dwCurTexture--;
-    
-    // Initialize the sample offsets for the iterative luminance passes
-    while( dwCurTexture > 0 )
-    {
-        m_apTexToneMap[dwCurTexture+1]->GetLevelDesc( 0, &desc );
-        GetSampleOffsets_DownScale4x4( desc.Width, desc.Height, avSampleOffsets );
-    
-
-        // Each of these passes continue to scale down the log of average
-        // luminance texture created above, storing intermediate results in 
-        // m_apTexToneMap[1] through m_apTexToneMap[NUM_TONEMAP_TEXTURES-1].
-        m_pEffect->SetTechnique("ResampleAvgLum");
-        m_pEffect->SetValue("g_avSampleOffsets", avSampleOffsets, sizeof(avSampleOffsets));
-
-        m_pd3dDevice->SetRenderTarget(0, apSurfToneMap[dwCurTexture]);
-        m_pd3dDevice->SetTexture(0, m_apTexToneMap[dwCurTexture+1]);
-        m_pd3dDevice->SetSamplerState( 0, D3DSAMP_MAGFILTER, D3DTEXF_POINT );
-        m_pd3dDevice->SetSamplerState( 0, D3DSAMP_MINFILTER, D3DTEXF_POINT );
-    
-        
-        hr = m_pEffect->Begin(&uiPassCount, 0);
-        if( FAILED(hr) )
-            goto LCleanReturn;
-        
-        for (uiPass = 0; uiPass < uiPassCount; uiPass++)
-        {
-            m_pEffect->BeginPass(uiPass);
-
-            // Draw a fullscreen quad to sample the RT
-            DrawFullScreenQuad(0.0f, 0.0f, 1.0f, 1.0f);
-
-            m_pEffect->EndPass();
-        }
-
-        m_pEffect->End();
-        dwCurTexture--;
-    }
-
-    // Downsample to 1x1
-    m_apTexToneMap[1]->GetLevelDesc( 0, &desc );
-    GetSampleOffsets_DownScale4x4( desc.Width, desc.Height, avSampleOffsets );
-    
- 
-    // Perform the final pass of the average luminance calculation. This pass
-    // scales the 4x4 log of average luminance texture from above and performs
-    // an exp() operation to return a single texel cooresponding to the average
-    // luminance of the scene in m_apTexToneMap[0].
-    m_pEffect->SetTechnique("ResampleAvgLumExp");
-    m_pEffect->SetValue("g_avSampleOffsets", avSampleOffsets, sizeof(avSampleOffsets));
-    
-    m_pd3dDevice->SetRenderTarget(0, apSurfToneMap[0]);
-    m_pd3dDevice->SetTexture(0, m_apTexToneMap[1]);
-    m_pd3dDevice->SetSamplerState( 0, D3DSAMP_MAGFILTER, D3DTEXF_POINT );
-    m_pd3dDevice->SetSamplerState( 0, D3DSAMP_MINFILTER, D3DTEXF_POINT );
-    
-     
-    hr = m_pEffect->Begin(&uiPassCount, 0);
-    if( FAILED(hr) )
-        goto LCleanReturn;
-
-    for (uiPass = 0; uiPass < uiPassCount; uiPass++)
-    {
-        m_pEffect->BeginPass(uiPass);
-
-        // Draw a fullscreen quad to sample the RT
-        DrawFullScreenQuad(0.0f, 0.0f, 1.0f, 1.0f);
-
-        m_pEffect->EndPass();
-    }
-
-    m_pEffect->End();
- 
-
-    hr = S_OK;
-LCleanReturn:
-    for( i=0; i < NUM_TONEMAP_TEXTURES; i++ )
-    {
-        SAFE_RELEASE( apSurfToneMap[i] );
-    }
-
-    return hr;
-}
-
-
-
-
-//-----------------------------------------------------------------------------
-// Name: CalculateAdaptation()
-// Desc: Increment the user's adapted luminance
-//-----------------------------------------------------------------------------
-HRESULT HDRSun::CalculateAdaptation()
-{
-    HRESULT hr = S_OK;
-    UINT uiPass, uiPassCount;
-
-    // Swap current & last luminance
-    PDIRECT3DTEXTURE9 pTexSwap = m_pTexAdaptedLuminanceLast;
-    m_pTexAdaptedLuminanceLast = m_pTexAdaptedLuminanceCur;
-    m_pTexAdaptedLuminanceCur = pTexSwap;
-    
-    PDIRECT3DSURFACE9 pSurfAdaptedLum = NULL;
-    V( m_pTexAdaptedLuminanceCur->GetSurfaceLevel(0, &pSurfAdaptedLum) );
-
-    // This simulates the light adaptation that occurs when moving from a 
-    // dark area to a bright area, or vice versa. The m_pTexAdaptedLuminance
-    // texture stores a single texel cooresponding to the user's adapted 
-    // level.
-    m_pEffect->SetTechnique("CalculateAdaptedLum");
-    m_pEffect->SetFloat("g_fElapsedTime", DXUTGetElapsedTime());
-    
-    m_pd3dDevice->SetRenderTarget(0, pSurfAdaptedLum);
-    m_pd3dDevice->SetTexture(0, m_pTexAdaptedLuminanceLast);
-    m_pd3dDevice->SetTexture(1, m_apTexToneMap[0]);
-    m_pd3dDevice->SetSamplerState( 0, D3DSAMP_MAGFILTER, D3DTEXF_POINT );
-    m_pd3dDevice->SetSamplerState( 0, D3DSAMP_MINFILTER, D3DTEXF_POINT );
-    m_pd3dDevice->SetSamplerState( 1, D3DSAMP_MAGFILTER, D3DTEXF_POINT );
-    m_pd3dDevice->SetSamplerState( 1, D3DSAMP_MINFILTER, D3DTEXF_POINT );
-
-    
-    V( m_pEffect->Begin(&uiPassCount, 0) );
-    
-    for (uiPass = 0; uiPass < uiPassCount; uiPass++)
-    {
-        m_pEffect->BeginPass(uiPass);
-
-        // Draw a fullscreen quad to sample the RT
-        DrawFullScreenQuad(0.0f, 0.0f, 1.0f, 1.0f);
-
-        m_pEffect->EndPass();
-    }
-    
-    m_pEffect->End();
-
-
-    SAFE_RELEASE( pSurfAdaptedLum );
-    return S_OK;
-}
-
-
-
-
-//-----------------------------------------------------------------------------
-// Name: RenderStar()
-// Desc: Render the blooming effect
-//-----------------------------------------------------------------------------
-HRESULT HDRSun::RenderStar()
-{
-    HRESULT hr = S_OK;
-    UINT uiPassCount, uiPass;
-    int i, d, p, s; // Loop variables
-
-    LPDIRECT3DSURFACE9 pSurfStar = NULL;
-    hr = m_apTexStar[0]->GetSurfaceLevel( 0, &pSurfStar );
-    if( FAILED(hr) )
-        return hr;
-
-    // Clear the star texture
-    m_pd3dDevice->ColorFill( pSurfStar, NULL, D3DCOLOR_ARGB(0, 0, 0, 0) );
-    SAFE_RELEASE( pSurfStar );
-
-    // Avoid rendering the star if it's not being used in the current glare
-    if( m_GlareDef.m_fGlareLuminance <= 0.0f ||
-        m_GlareDef.m_fStarLuminance <= 0.0f )
-    {
-        return S_OK ;
-    }
-
-    // Initialize the constants used during the effect
-    const CStarDef& starDef = m_GlareDef.m_starDef ;
-    const float fTanFoV = atanf(D3DX_PI/8) ;
-    const D3DXVECTOR4 vWhite( 1.0f, 1.0f, 1.0f, 1.0f );
-    static const int s_maxPasses = 3 ;
-    static const int nSamples = 8 ;
-    static D3DXVECTOR4 s_aaColor[s_maxPasses][8] ;
-    static const D3DXCOLOR s_colorWhite(0.63f, 0.63f, 0.63f, 0.0f) ;
-    
-    D3DXVECTOR4 avSampleWeights[MAX_SAMPLES];
-    D3DXVECTOR2 avSampleOffsets[MAX_SAMPLES];
-        
-    m_pd3dDevice->SetRenderState(D3DRS_SRCBLEND, D3DBLEND_ONE) ;
-    m_pd3dDevice->SetRenderState(D3DRS_DESTBLEND, D3DBLEND_ONE) ;
-
-    PDIRECT3DSURFACE9 pSurfSource = NULL;
-    PDIRECT3DSURFACE9 pSurfDest = NULL;
-
-    // Set aside all the star texture surfaces as a convenience
-    PDIRECT3DSURFACE9 apSurfStar[NUM_STAR_TEXTURES] = {0};
-    for( i=0; i < NUM_STAR_TEXTURES; i++ )
-    {
-        hr = m_apTexStar[i]->GetSurfaceLevel( 0, &apSurfStar[i] );
-        if( FAILED(hr) )
-            goto LCleanReturn;
-    }
-
-    // Get the source texture dimensions
-    hr = m_pTexStarSource->GetSurfaceLevel( 0, &pSurfSource );
-    if( FAILED(hr) )
-        goto LCleanReturn;
-
-    D3DSURFACE_DESC desc;
-    hr = pSurfSource->GetDesc( &desc );
-    if( FAILED(hr) )
-        goto LCleanReturn;
-
-    SAFE_RELEASE( pSurfSource );
-
-    float srcW;
-    srcW = (FLOAT) desc.Width;
-    float srcH;
-    srcH= (FLOAT) desc.Height;
-
-    
-   
-    for (p = 0 ; p < s_maxPasses ; p ++)
-    {
-        float ratio;
-        ratio = (float)(p + 1) / (float)s_maxPasses ;
-        
-        for (s = 0 ; s < nSamples ; s ++)
-        {
-            D3DXCOLOR chromaticAberrColor ;
-            D3DXColorLerp(&chromaticAberrColor,
-                &( CStarDef::GetChromaticAberrationColor(s) ),
-                &s_colorWhite,
-                ratio) ;
-
-            D3DXColorLerp( (D3DXCOLOR*)&( s_aaColor[p][s] ),
-                &s_colorWhite, &chromaticAberrColor,
-                m_GlareDef.m_fChromaticAberration ) ;
-        }
-    }
-
-    float radOffset;
-    radOffset = m_GlareDef.m_fStarInclination + starDef.m_fInclination ;
-    
-
-    PDIRECT3DTEXTURE9 pTexSource;
-
-
-    // Direction loop
-    for (d = 0 ; d < starDef.m_nStarLines ; d ++)
-    {
-        CONST STARLINE& starLine = starDef.m_pStarLine[d] ;
-
-        pTexSource = m_pTexStarSource;
-        
-        float rad;
-        rad = radOffset + starLine.fInclination ;
-        float sn, cs;
-        sn = sinf(rad), cs = cosf(rad) ;
-        D3DXVECTOR2 vtStepUV;
-        vtStepUV.x = sn / srcW * starLine.fSampleLength ;
-        vtStepUV.y = cs / srcH * starLine.fSampleLength ;
-        
-        float attnPowScale;
-        attnPowScale = (fTanFoV + 0.1f) * 1.0f *
-                       (160.0f + 120.0f) / (srcW + srcH) * 1.2f ;
-
-        // 1 direction expansion loop
-        m_pd3dDevice->SetRenderState(D3DRS_ALPHABLENDENABLE, FALSE) ;
-        
-        int iWorkTexture;
-        iWorkTexture = 1 ;
-        for (p = 0 ; p < starLine.nPasses ; p ++)
-        {
-            
-            if (p == starLine.nPasses - 1)
-            {
-                // Last pass move to other work buffer
-                pSurfDest = apSurfStar[d+4];
-            }
-            else {
-                pSurfDest = apSurfStar[iWorkTexture];
-            }
-
-            // Sampling configration for each stage
-            for (i = 0 ; i < nSamples ; i ++)
-            {
-                float lum;
-                lum = powf( starLine.fAttenuation, attnPowScale * i );
-                
-                avSampleWeights[i] = s_aaColor[starLine.nPasses - 1 - p][i] *
-                                lum * (p+1.0f) * 0.5f ;
-                                
-                
-                // Offset of sampling coordinate
-                avSampleOffsets[i].x = vtStepUV.x * i ;
-                avSampleOffsets[i].y = vtStepUV.y * i ;
-                if ( fabs(avSampleOffsets[i].x) >= 0.9f ||
-                     fabs(avSampleOffsets[i].y) >= 0.9f )
-                {
-                    avSampleOffsets[i].x = 0.0f ;
-                    avSampleOffsets[i].y = 0.0f ;
-                    avSampleWeights[i] *= 0.0f ;
-                }
-                
-            }
-
-            
-            m_pEffect->SetTechnique("Star");
-            m_pEffect->SetValue("g_avSampleOffsets", avSampleOffsets, sizeof(avSampleOffsets));
-            m_pEffect->SetVectorArray("g_avSampleWeights", avSampleWeights, nSamples);
-            
-            m_pd3dDevice->SetRenderTarget( 0, pSurfDest );
-            m_pd3dDevice->SetTexture( 0, pTexSource );
-            m_pd3dDevice->SetSamplerState( 0, D3DSAMP_MAGFILTER, D3DTEXF_LINEAR );
-            m_pd3dDevice->SetSamplerState( 0, D3DSAMP_MINFILTER, D3DTEXF_LINEAR );
-    
-            
-            hr = m_pEffect->Begin(&uiPassCount, 0);
-            if( FAILED(hr) )
-                return hr;
-            
-            for (uiPass = 0; uiPass < uiPassCount; uiPass++)
-            {
-                m_pEffect->BeginPass(uiPass);
-
-                // Draw a fullscreen quad to sample the RT
-                DrawFullScreenQuad(0.0f, 0.0f, 1.0f, 1.0f);
-
-                m_pEffect->EndPass();
-            }
-            
-            m_pEffect->End();
-
-            // Setup next expansion
-            vtStepUV *= nSamples ;
-            attnPowScale *= nSamples ;
-
-            // Set the work drawn just before to next texture source.
-            pTexSource = m_apTexStar[iWorkTexture];
-
-            iWorkTexture += 1 ;
-            if (iWorkTexture > 2) {
-                iWorkTexture = 1 ;
-            }
-
-        }
-    }
-
-
-    pSurfDest = apSurfStar[0];
-
-    
-    for( i=0; i < starDef.m_nStarLines; i++ )
-    {
-        m_pd3dDevice->SetTexture( i, m_apTexStar[i+4] );
-        m_pd3dDevice->SetSamplerState( i, D3DSAMP_MAGFILTER, D3DTEXF_LINEAR );
-        m_pd3dDevice->SetSamplerState( i, D3DSAMP_MINFILTER, D3DTEXF_LINEAR );
-
-        avSampleWeights[i] = vWhite * 1.0f / (FLOAT) starDef.m_nStarLines;
-    }
-
-    CHAR strTechnique[256];
-    StringCchPrintfA( strTechnique, 256, "MergeTextures_%d", starDef.m_nStarLines );
-
-    m_pEffect->SetTechnique(strTechnique);
-
-    m_pEffect->SetVectorArray("g_avSampleWeights", avSampleWeights, starDef.m_nStarLines);
-    
-    m_pd3dDevice->SetRenderTarget( 0, pSurfDest );
-    
-    hr = m_pEffect->Begin(&uiPassCount, 0);
-    if( FAILED(hr) )
-        goto LCleanReturn;
-    
-    for (uiPass = 0; uiPass < uiPassCount; uiPass++)
-    {
-        m_pEffect->BeginPass(uiPass);
-
-        // Draw a fullscreen quad to sample the RT
-        DrawFullScreenQuad(0.0f, 0.0f, 1.0f, 1.0f);
-
-        m_pEffect->EndPass();
-    }
-    
-    m_pEffect->End();
-
-    for( i=0; i < starDef.m_nStarLines; i++ )
-        m_pd3dDevice->SetTexture( i, NULL );
-
-    
-    hr = S_OK;
-LCleanReturn:
-    for( i=0; i < NUM_STAR_TEXTURES; i++ )
-    {
-        SAFE_RELEASE( apSurfStar[i] );
-    }
-
-    return hr;
-}
-
-
-
-
-//-----------------------------------------------------------------------------
-// Name: RenderBloom()
-// Desc: Render the blooming effect
-//-----------------------------------------------------------------------------
-HRESULT HDRSun::RenderBloom()
-{
-    HRESULT hr = S_OK;
-    UINT uiPassCount, uiPass;
-    int i=0;
-
-
-    D3DXVECTOR2 avSampleOffsets[MAX_SAMPLES];
-    FLOAT       afSampleOffsets[MAX_SAMPLES];
-    D3DXVECTOR4 avSampleWeights[MAX_SAMPLES];
-
-    PDIRECT3DSURFACE9 pSurfScaledHDR;
-    m_pTexSceneScaled->GetSurfaceLevel(0, &pSurfScaledHDR);
-
-    PDIRECT3DSURFACE9 pSurfBloom;
-    m_apTexBloom[0]->GetSurfaceLevel(0, &pSurfBloom);
-
-    PDIRECT3DSURFACE9 pSurfHDR;
-    m_pTexScene->GetSurfaceLevel(0, &pSurfHDR);  
-    
-    PDIRECT3DSURFACE9 pSurfTempBloom;
-    m_apTexBloom[1]->GetSurfaceLevel(0, &pSurfTempBloom);
-
-    PDIRECT3DSURFACE9 pSurfBloomSource;
-    m_apTexBloom[2]->GetSurfaceLevel(0, &pSurfBloomSource);
-
-    // Clear the bloom texture
-    m_pd3dDevice->ColorFill( pSurfBloom, NULL, D3DCOLOR_ARGB(0, 0, 0, 0) );
-
-    if (m_GlareDef.m_fGlareLuminance <= 0.0f ||
-        m_GlareDef.m_fBloomLuminance <= 0.0f)
-    {
-        hr = S_OK;
-        goto LCleanReturn;
-    }
-
-    RECT rectSrc;
-    GetTextureRect( m_pTexBloomSource, &rectSrc );
-    InflateRect( &rectSrc, -1, -1 );
-
-    RECT rectDest;
-    GetTextureRect( m_apTexBloom[2], &rectDest );
-    InflateRect( &rectDest, -1, -1 );
-
-    CoordRect coords;
-    GetTextureCoords( m_pTexBloomSource, &rectSrc, m_apTexBloom[2], &rectDest, &coords );
-   
-    D3DSURFACE_DESC desc;
-    hr = m_pTexBloomSource->GetLevelDesc( 0, &desc );
-    if( FAILED(hr) )
-        return hr;
-
-
-    m_pEffect->SetTechnique("GaussBlur5x5");
-
-    hr = GetSampleOffsets_GaussBlur5x5( desc.Width, desc.Height, avSampleOffsets, avSampleWeights, 1.0f );
-
-    m_pEffect->SetValue("g_avSampleOffsets", avSampleOffsets, sizeof(avSampleOffsets));
-    m_pEffect->SetValue("g_avSampleWeights", avSampleWeights, sizeof(avSampleWeights));
-   
-    m_pd3dDevice->SetRenderTarget(0, pSurfBloomSource );
-    m_pd3dDevice->SetTexture( 0, m_pTexBloomSource );
-    m_pd3dDevice->SetScissorRect( &rectDest );
-    m_pd3dDevice->SetRenderState( D3DRS_SCISSORTESTENABLE, TRUE );
-    m_pd3dDevice->SetSamplerState( 0, D3DSAMP_MINFILTER, D3DTEXF_POINT );
-    m_pd3dDevice->SetSamplerState( 0, D3DSAMP_MAGFILTER, D3DTEXF_POINT );
-       
-    
-    hr = m_pEffect->Begin(&uiPassCount, 0);
-    if( FAILED(hr) )
-        goto LCleanReturn;
-    
-    for (uiPass = 0; uiPass < uiPassCount; uiPass++)
-    {
-        m_pEffect->BeginPass(uiPass);
-
-        // Draw a fullscreen quad to sample the RT
-        DrawFullScreenQuad( coords );
-
-        m_pEffect->EndPass();
-    }
-    m_pEffect->End();
-    m_pd3dDevice->SetRenderState( D3DRS_SCISSORTESTENABLE, FALSE );
-
-    hr = m_apTexBloom[2]->GetLevelDesc( 0, &desc );
-    if( FAILED(hr) )
-        return hr;
-
-    hr = GetSampleOffsets_Bloom( desc.Width, afSampleOffsets, avSampleWeights, 3.0f, 2.0f );
-    for( i=0; i < MAX_SAMPLES; i++ )
-    {
-        avSampleOffsets[i] = D3DXVECTOR2( afSampleOffsets[i], 0.0f );
-    }
-     
-
-    m_pEffect->SetTechnique("Bloom");
-    m_pEffect->SetValue("g_avSampleOffsets", avSampleOffsets, sizeof(avSampleOffsets));
-    m_pEffect->SetValue("g_avSampleWeights", avSampleWeights, sizeof(avSampleWeights));
-   
-    m_pd3dDevice->SetRenderTarget(0, pSurfTempBloom);
-    m_pd3dDevice->SetTexture( 0, m_apTexBloom[2] );
-    m_pd3dDevice->SetScissorRect( &rectDest );
-    m_pd3dDevice->SetRenderState( D3DRS_SCISSORTESTENABLE, TRUE );
-    m_pd3dDevice->SetSamplerState( 0, D3DSAMP_MINFILTER, D3DTEXF_POINT );
-    m_pd3dDevice->SetSamplerState( 0, D3DSAMP_MAGFILTER, D3DTEXF_POINT );
-       
-    
-    m_pEffect->Begin(&uiPassCount, 0);
-    for (uiPass = 0; uiPass < uiPassCount; uiPass++)
-    {
-        m_pEffect->BeginPass(uiPass);
-
-        // Draw a fullscreen quad to sample the RT
-        DrawFullScreenQuad( coords );
-
-        m_pEffect->EndPass();
-    }
-    m_pEffect->End();
-    m_pd3dDevice->SetRenderState( D3DRS_SCISSORTESTENABLE, FALSE );
-    
-
-    hr = m_apTexBloom[1]->GetLevelDesc( 0, &desc );
-    if( FAILED(hr) )
-        return hr;
-
-    hr = GetSampleOffsets_Bloom( desc.Height, afSampleOffsets, avSampleWeights, 3.0f, 2.0f );
-    for( i=0; i < MAX_SAMPLES; i++ )
-    {
-        avSampleOffsets[i] = D3DXVECTOR2( 0.0f, afSampleOffsets[i] );
-    }
-
-    
-    GetTextureRect( m_apTexBloom[1], &rectSrc );
-    InflateRect( &rectSrc, -1, -1 );
-
-    GetTextureCoords( m_apTexBloom[1], &rectSrc, m_apTexBloom[0], NULL, &coords );
-
-    
-    m_pEffect->SetTechnique("Bloom");
-    m_pEffect->SetValue("g_avSampleOffsets", avSampleOffsets, sizeof(avSampleOffsets));
-    m_pEffect->SetValue("g_avSampleWeights", avSampleWeights, sizeof(avSampleWeights));
-    
-    m_pd3dDevice->SetRenderTarget(0, pSurfBloom);
-    m_pd3dDevice->SetTexture(0, m_apTexBloom[1]);
-   m_pd3dDevice->SetSamplerState( 0, D3DSAMP_MINFILTER, D3DTEXF_POINT );
-    m_pd3dDevice->SetSamplerState( 0, D3DSAMP_MAGFILTER, D3DTEXF_POINT );
-       
-   
-    hr = m_pEffect->Begin(&uiPassCount, 0);
-    if( FAILED(hr) )
-        goto LCleanReturn;
-
-    for (uiPass = 0; uiPass < uiPassCount; uiPass++)
-    {
-        m_pEffect->BeginPass(uiPass);
-
-        // Draw a fullscreen quad to sample the RT
-        DrawFullScreenQuad( coords );
-
-        m_pEffect->EndPass();
-    }
-
-    m_pEffect->End();
-   
-  
-    hr = S_OK;
-
-LCleanReturn:
-    SAFE_RELEASE( pSurfBloomSource );
-    SAFE_RELEASE( pSurfTempBloom );
-    SAFE_RELEASE( pSurfBloom );
-    SAFE_RELEASE( pSurfHDR );
-    SAFE_RELEASE( pSurfScaledHDR );
-    
-    return hr;
-}
-
-
-
-//-----------------------------------------------------------------------------
-// Name: DrawFullScreenQuad
-// Desc: Draw a properly aligned quad covering the entire render target
-//-----------------------------------------------------------------------------
-void HDRSun::DrawFullScreenQuad(float fLeftU, float fTopV, float fRightU, float fBottomV)
-{
-    D3DSURFACE_DESC dtdsdRT;
-    PDIRECT3DSURFACE9 pSurfRT;
-
-    // Acquire render target width and height
-    m_pd3dDevice->GetRenderTarget(0, &pSurfRT);
-    pSurfRT->GetDesc(&dtdsdRT);
-    pSurfRT->Release();
-
-    // Ensure that we're directly mapping texels to pixels by offset by 0.5
-    // For more info see the doc page titled "Directly Mapping Texels to Pixels"
-    FLOAT fWidth5 = (FLOAT)dtdsdRT.Width - 0.5f;
-    FLOAT fHeight5 = (FLOAT)dtdsdRT.Height - 0.5f;
-
-    // Draw the quad
-    ScreenVertex svQuad[4];
-
-    svQuad[0].p = D3DXVECTOR4(-0.5f, -0.5f, 0.5f, 1.0f);
-    svQuad[0].t = D3DXVECTOR2(fLeftU, fTopV);
-
-    svQuad[1].p = D3DXVECTOR4(fWidth5, -0.5f, 0.5f, 1.0f);
-    svQuad[1].t = D3DXVECTOR2(fRightU, fTopV);
-
-    svQuad[2].p = D3DXVECTOR4(-0.5f, fHeight5, 0.5f, 1.0f);
-    svQuad[2].t = D3DXVECTOR2(fLeftU, fBottomV);
-
-    svQuad[3].p = D3DXVECTOR4(fWidth5, fHeight5, 0.5f, 1.0f);
-    svQuad[3].t = D3DXVECTOR2(fRightU, fBottomV);
-
-    m_pd3dDevice->SetRenderState(D3DRS_ZENABLE, FALSE);
-    m_pd3dDevice->SetFVF(ScreenVertex::FVF);
-    m_pd3dDevice->DrawPrimitiveUP(D3DPT_TRIANGLESTRIP, 2, svQuad, sizeof(ScreenVertex));
-    m_pd3dDevice->SetRenderState(D3DRS_ZENABLE, TRUE);
-}
-
-
-//-----------------------------------------------------------------------------
-// Name: GetTextureRect()
-// Desc: Get the dimensions of the texture
-//-----------------------------------------------------------------------------
-HRESULT HDRSun::GetTextureRect( PDIRECT3DTEXTURE9 pTexture, RECT* pRect )
-{
-    HRESULT hr = S_OK;
-
-    if( pTexture == NULL || pRect == NULL )
-        return E_INVALIDARG;
-
-    D3DSURFACE_DESC desc;
-    hr = pTexture->GetLevelDesc( 0, &desc );
-    if( FAILED(hr) )
-        return hr;
-
-    pRect->left = 0;
-    pRect->top = 0;
-    pRect->right = desc.Width;
-    pRect->bottom = desc.Height;
-
-    return S_OK;
-}
-
-
-
-
-//-----------------------------------------------------------------------------
-// Name: GetTextureCoords()
-// Desc: Get the texture coordinates to use when rendering into the destination
-//       texture, given the source and destination rectangles
-//-----------------------------------------------------------------------------
-HRESULT HDRSun::GetTextureCoords( PDIRECT3DTEXTURE9 pTexSrc, RECT* pRectSrc, 
-                          PDIRECT3DTEXTURE9 pTexDest, RECT* pRectDest, CoordRect* pCoords )
-{
-    HRESULT hr = S_OK;
-    D3DSURFACE_DESC desc;
-    float tU, tV;
-
-    // Validate arguments
-    if( pTexSrc == NULL || pTexDest == NULL || pCoords == NULL )
-        return E_INVALIDARG;
-
-    // Start with a default mapping of the complete source surface to complete 
-    // destination surface
-    pCoords->fLeftU = 0.0f;
-    pCoords->fTopV = 0.0f;
-    pCoords->fRightU = 1.0f; 
-    pCoords->fBottomV = 1.0f;
-
-    // If not using the complete source surface, adjust the coordinates
-    if( pRectSrc != NULL )
-    {
-        // Get destination texture description
-        hr = pTexSrc->GetLevelDesc( 0, &desc );
-        if( FAILED(hr) )
-            return hr;
-
-        // These delta values are the distance between source texel centers in 
-        // texture address space
-        tU = 1.0f / desc.Width;
-        tV = 1.0f / desc.Height;
-
-        pCoords->fLeftU += pRectSrc->left * tU;
-        pCoords->fTopV += pRectSrc->top * tV;
-        pCoords->fRightU -= (desc.Width - pRectSrc->right) * tU;
-        pCoords->fBottomV -= (desc.Height - pRectSrc->bottom) * tV;
-    }
-
-    // If not drawing to the complete destination surface, adjust the coordinates
-    if( pRectDest != NULL )
-    {
-        // Get source texture description
-        hr = pTexDest->GetLevelDesc( 0, &desc );
-        if( FAILED(hr) )
-            return hr;
-
-        // These delta values are the distance between source texel centers in 
-        // texture address space
-        tU = 1.0f / desc.Width;
-        tV = 1.0f / desc.Height;
-
-        pCoords->fLeftU -= pRectDest->left * tU;
-        pCoords->fTopV -= pRectDest->top * tV;
-        pCoords->fRightU += (desc.Width - pRectDest->right) * tU;
-        pCoords->fBottomV += (desc.Height - pRectDest->bottom) * tV;
-    }
-
-    return S_OK;
-}
-  
-
-
-
-//-----------------------------------------------------------------------------
-// Name: Scene_To_SceneScaled()
-// Desc: Scale down m_pTexScene by 1/4 x 1/4 and place the result in 
-//       m_pTexSceneScaled
-//-----------------------------------------------------------------------------
-HRESULT HDRSun::Scene_To_SceneScaled()
-{
-    HRESULT hr = S_OK;
-    D3DXVECTOR2 avSampleOffsets[MAX_SAMPLES];
-    
-   
-    // Get the new render target surface
-    PDIRECT3DSURFACE9 pSurfScaledScene = NULL;
-    hr = m_pTexSceneScaled->GetSurfaceLevel( 0, &pSurfScaledScene );
-    if( FAILED(hr) )
-        goto LCleanReturn;
-
-    const D3DSURFACE_DESC* pBackBufferDesc = DXUTGetBackBufferSurfaceDesc();
-
-    // Create a 1/4 x 1/4 scale copy of the HDR texture. Since bloom textures
-    // are 1/8 x 1/8 scale, border texels of the HDR texture will be discarded 
-    // to keep the dimensions evenly divisible by 8; this allows for precise 
-    // control over sampling inside pixel shaders.
-    m_pEffect->SetTechnique("DownScale4x4");
-
-    // Place the rectangle in the center of the back buffer surface
-    RECT rectSrc;
-    rectSrc.left = (pBackBufferDesc->Width - m_dwCropWidth) / 2;
-    rectSrc.top = (pBackBufferDesc->Height - m_dwCropHeight) / 2;
-    rectSrc.right = rectSrc.left + m_dwCropWidth;
-    rectSrc.bottom = rectSrc.top + m_dwCropHeight;
-
-    // Get the texture coordinates for the render target
-    CoordRect coords;
-    GetTextureCoords( m_pTexScene, &rectSrc, m_pTexSceneScaled, NULL, &coords );
-
-    // Get the sample offsets used within the pixel shader
-    GetSampleOffsets_DownScale4x4( pBackBufferDesc->Width, pBackBufferDesc->Height, avSampleOffsets );
-    m_pEffect->SetValue("g_avSampleOffsets", avSampleOffsets, sizeof(avSampleOffsets));
-    
-    m_pd3dDevice->SetRenderTarget( 0, pSurfScaledScene );
-    m_pd3dDevice->SetTexture( 0, m_pTexScene );
-    m_pd3dDevice->SetSamplerState( 0, D3DSAMP_MINFILTER, D3DTEXF_POINT );
-    m_pd3dDevice->SetSamplerState( 0, D3DSAMP_ADDRESSU, D3DTADDRESS_CLAMP );
-    m_pd3dDevice->SetSamplerState( 0, D3DSAMP_ADDRESSV, D3DTADDRESS_CLAMP );
-   
-    UINT uiPassCount, uiPass;       
-    hr = m_pEffect->Begin(&uiPassCount, 0);
-    if( FAILED(hr) )
-        goto LCleanReturn;
-
-    for (uiPass = 0; uiPass < uiPassCount; uiPass++)
-    {
-        m_pEffect->BeginPass(uiPass);
-
-        // Draw a fullscreen quad
-        DrawFullScreenQuad( coords );
-
-        m_pEffect->EndPass();
-    }
-
-    m_pEffect->End();
-    
-
-    hr = S_OK;
-LCleanReturn:
-    SAFE_RELEASE( pSurfScaledScene );
-    return hr;
-}
-
-
-
-
-//-----------------------------------------------------------------------------
-// Name: SceneScaled_To_BrightPass
-// Desc: Run the bright-pass filter on m_pTexSceneScaled and place the result
-//       in m_pTexBrightPass
-//-----------------------------------------------------------------------------
-HRESULT HDRSun::SceneScaled_To_BrightPass()
-{
-    HRESULT hr = S_OK;
-
-    D3DXVECTOR2 avSampleOffsets[MAX_SAMPLES];
-    D3DXVECTOR4 avSampleWeights[MAX_SAMPLES];
-
-    
-    // Get the new render target surface
-    PDIRECT3DSURFACE9 pSurfBrightPass;
-    hr = m_pTexBrightPass->GetSurfaceLevel( 0, &pSurfBrightPass );
-    if( FAILED(hr) )
-        goto LCleanReturn;
-
-    
-    D3DSURFACE_DESC desc;
-    m_pTexSceneScaled->GetLevelDesc( 0, &desc );    
-
-    // Get the rectangle describing the sampled portion of the source texture.
-    // Decrease the rectangle to adjust for the single pixel black border.
-    RECT rectSrc;
-    GetTextureRect( m_pTexSceneScaled, &rectSrc );
-    InflateRect( &rectSrc, -1, -1 );
-
-    // Get the destination rectangle.
-    // Decrease the rectangle to adjust for the single pixel black border.
-    RECT rectDest;
-    GetTextureRect( m_pTexBrightPass, &rectDest );
-    InflateRect( &rectDest, -1, -1 );
-
-    // Get the correct texture coordinates to apply to the rendered quad in order 
-    // to sample from the source rectangle and render into the destination rectangle
-    CoordRect coords;
-    GetTextureCoords( m_pTexSceneScaled, &rectSrc, m_pTexBrightPass, &rectDest, &coords );
-
-    // The bright-pass filter removes everything from the scene except lights and
-    // bright reflections
-    m_pEffect->SetTechnique("BrightPassFilter");
-
-    m_pd3dDevice->SetRenderTarget( 0, pSurfBrightPass );
-    m_pd3dDevice->SetTexture( 0, m_pTexSceneScaled );
-    m_pd3dDevice->SetTexture( 1, m_pTexAdaptedLuminanceCur );
-    m_pd3dDevice->SetRenderState( D3DRS_SCISSORTESTENABLE, TRUE );
-    m_pd3dDevice->SetScissorRect( &rectDest );
-    m_pd3dDevice->SetSamplerState( 0, D3DSAMP_MINFILTER, D3DTEXF_POINT );
-    m_pd3dDevice->SetSamplerState( 0, D3DSAMP_MAGFILTER, D3DTEXF_POINT );
-    m_pd3dDevice->SetSamplerState( 1, D3DSAMP_MINFILTER, D3DTEXF_POINT );
-    m_pd3dDevice->SetSamplerState( 1, D3DSAMP_MAGFILTER, D3DTEXF_POINT );
-       
-    UINT uiPass, uiPassCount;
-    hr = m_pEffect->Begin(&uiPassCount, 0);
-    if( FAILED(hr) )
-        goto LCleanReturn;
-    
-    for (uiPass = 0; uiPass < uiPassCount; uiPass++)
-    {
-        m_pEffect->BeginPass(uiPass);
-
-        // Draw a fullscreen quad to sample the RT
-        DrawFullScreenQuad( coords );
-
-        m_pEffect->EndPass();
-    }
-    
-    m_pEffect->End();
-    m_pd3dDevice->SetRenderState( D3DRS_SCISSORTESTENABLE, FALSE );
-
-    hr = S_OK;
-LCleanReturn:
-    SAFE_RELEASE( pSurfBrightPass );
-    return hr;
-}
-
-
-
-
-//-----------------------------------------------------------------------------
-// Name: BrightPass_To_StarSource
-// Desc: Perform a 5x5 gaussian blur on m_pTexBrightPass and place the result
-//       in m_pTexStarSource. The bright-pass filtered image is blurred before
-//       being used for star operations to avoid aliasing artifacts.
-//-----------------------------------------------------------------------------
-HRESULT HDRSun::BrightPass_To_StarSource()
-{
-    HRESULT hr = S_OK;
-
-    D3DXVECTOR2 avSampleOffsets[MAX_SAMPLES];
-    D3DXVECTOR4 avSampleWeights[MAX_SAMPLES];
-
-    // Get the new render target surface
-    PDIRECT3DSURFACE9 pSurfStarSource;
-    hr = m_pTexStarSource->GetSurfaceLevel( 0, &pSurfStarSource );
-    if( FAILED(hr) )
-        goto LCleanReturn;
-
-    
-    // Get the destination rectangle.
-    // Decrease the rectangle to adjust for the single pixel black border.
-    RECT rectDest;
-    GetTextureRect( m_pTexStarSource, &rectDest );
-    InflateRect( &rectDest, -1, -1 );
-
-    // Get the correct texture coordinates to apply to the rendered quad in order 
-    // to sample from the source rectangle and render into the destination rectangle
-    CoordRect coords;
-    GetTextureCoords( m_pTexBrightPass, NULL, m_pTexStarSource, &rectDest, &coords );
-
-    // Get the sample offsets used within the pixel shader
-    D3DSURFACE_DESC desc;
-    hr = m_pTexBrightPass->GetLevelDesc( 0, &desc );
-    if( FAILED(hr) )
-        return hr;
-
-    
-    GetSampleOffsets_GaussBlur5x5( desc.Width, desc.Height, avSampleOffsets, avSampleWeights );
-    m_pEffect->SetValue("g_avSampleOffsets", avSampleOffsets, sizeof(avSampleOffsets));
-    m_pEffect->SetValue("g_avSampleWeights", avSampleWeights, sizeof(avSampleWeights));
-    
-    // The gaussian blur smooths out rough edges to avoid aliasing effects
-    // when the star effect is run
-    m_pEffect->SetTechnique("GaussBlur5x5");
-
-    m_pd3dDevice->SetRenderTarget( 0, pSurfStarSource );
-    m_pd3dDevice->SetTexture( 0, m_pTexBrightPass );
-    m_pd3dDevice->SetScissorRect( &rectDest );
-    m_pd3dDevice->SetRenderState( D3DRS_SCISSORTESTENABLE, TRUE );
-    m_pd3dDevice->SetSamplerState( 0, D3DSAMP_MINFILTER, D3DTEXF_POINT );
-    m_pd3dDevice->SetSamplerState( 0, D3DSAMP_ADDRESSU, D3DTADDRESS_CLAMP );
-    m_pd3dDevice->SetSamplerState( 0, D3DSAMP_ADDRESSV, D3DTADDRESS_CLAMP );
-   
-    UINT uiPassCount, uiPass;       
-    hr = m_pEffect->Begin(&uiPassCount, 0);
-    if( FAILED(hr) )
-        goto LCleanReturn;
-
-    for (uiPass = 0; uiPass < uiPassCount; uiPass++)
-    {
-        m_pEffect->BeginPass(uiPass);
-
-        // Draw a fullscreen quad
-        DrawFullScreenQuad( coords );
-
-        m_pEffect->EndPass();
-    }
-
-    m_pEffect->End();
-    m_pd3dDevice->SetRenderState( D3DRS_SCISSORTESTENABLE, FALSE );
-
-  
-    hr = S_OK;
-LCleanReturn:
-    SAFE_RELEASE( pSurfStarSource);
-    return hr;
-}
-
-
-
-
-//-----------------------------------------------------------------------------
-// Name: StarSource_To_BloomSource
-// Desc: Scale down m_pTexStarSource by 1/2 x 1/2 and place the result in 
-//       m_pTexBloomSource
-//-----------------------------------------------------------------------------
-HRESULT HDRSun::StarSource_To_BloomSource()
-{
-    HRESULT hr = S_OK;
-
-    D3DXVECTOR2 avSampleOffsets[MAX_SAMPLES];
-    
-    // Get the new render target surface
-    PDIRECT3DSURFACE9 pSurfBloomSource;
-    hr = m_pTexBloomSource->GetSurfaceLevel( 0, &pSurfBloomSource );
-    if( FAILED(hr) )
-        goto LCleanReturn;
-
-    
-    // Get the rectangle describing the sampled portion of the source texture.
-    // Decrease the rectangle to adjust for the single pixel black border.
-    RECT rectSrc;
-    GetTextureRect( m_pTexStarSource, &rectSrc );
-    InflateRect( &rectSrc, -1, -1 );
-
-    // Get the destination rectangle.
-    // Decrease the rectangle to adjust for the single pixel black border.
-    RECT rectDest;
-    GetTextureRect( m_pTexBloomSource, &rectDest );
-    InflateRect( &rectDest, -1, -1 );
-
-    // Get the correct texture coordinates to apply to the rendered quad in order 
-    // to sample from the source rectangle and render into the destination rectangle
-    CoordRect coords;
-    GetTextureCoords( m_pTexStarSource, &rectSrc, m_pTexBloomSource, &rectDest, &coords );
-
-    // Get the sample offsets used within the pixel shader
-    D3DSURFACE_DESC desc;
-    hr = m_pTexBrightPass->GetLevelDesc( 0, &desc );
-    if( FAILED(hr) )
-        return hr;
-
-    GetSampleOffsets_DownScale2x2( desc.Width, desc.Height, avSampleOffsets );
-    m_pEffect->SetValue("g_avSampleOffsets", avSampleOffsets, sizeof(avSampleOffsets));
-
-    // Create an exact 1/2 x 1/2 copy of the source texture
-    m_pEffect->SetTechnique("DownScale2x2");
-
-    m_pd3dDevice->SetRenderTarget( 0, pSurfBloomSource );
-    m_pd3dDevice->SetTexture( 0, m_pTexStarSource );
-    m_pd3dDevice->SetScissorRect( &rectDest );
-    m_pd3dDevice->SetRenderState( D3DRS_SCISSORTESTENABLE, TRUE );
-    m_pd3dDevice->SetSamplerState( 0, D3DSAMP_MINFILTER, D3DTEXF_POINT );
-    m_pd3dDevice->SetSamplerState( 0, D3DSAMP_ADDRESSU, D3DTADDRESS_CLAMP );
-    m_pd3dDevice->SetSamplerState( 0, D3DSAMP_ADDRESSV, D3DTADDRESS_CLAMP );
-   
-    UINT uiPassCount, uiPass;       
-    hr = m_pEffect->Begin(&uiPassCount, 0);
-    if( FAILED(hr) )
-        goto LCleanReturn;
-
-    for (uiPass = 0; uiPass < uiPassCount; uiPass++)
-    {
-        m_pEffect->BeginPass(uiPass);
-
-        // Draw a fullscreen quad
-        DrawFullScreenQuad( coords );
-
-        m_pEffect->EndPass();
-    }
-
-    m_pEffect->End();
-    m_pd3dDevice->SetRenderState( D3DRS_SCISSORTESTENABLE, FALSE );
-
-
-    
-    hr = S_OK;
-LCleanReturn:
-    SAFE_RELEASE( pSurfBloomSource);
-    return hr;
-}
-
-
-
-
-//-----------------------------------------------------------------------------
-// Name: GetSampleOffsets_DownScale4x4
-// Desc: Get the texture coordinate offsets to be used inside the DownScale4x4
-//       pixel shader.
-//-----------------------------------------------------------------------------
-HRESULT HDRSun::GetSampleOffsets_DownScale4x4( DWORD dwWidth, DWORD dwHeight, D3DXVECTOR2 avSampleOffsets[] )
-{
-    if( NULL == avSampleOffsets )
-        return E_INVALIDARG;
-
-    float tU = 1.0f / dwWidth;
-    float tV = 1.0f / dwHeight;
-
-    // Sample from the 16 surrounding points. Since the center point will be in
-    // the exact center of 16 texels, a 0.5f offset is needed to specify a texel
-    // center.
-    int index=0;
-    for( int y=0; y < 4; y++ )
-    {
-        for( int x=0; x < 4; x++ )
-        {
-            avSampleOffsets[ index ].x = (x - 1.5f) * tU;
-            avSampleOffsets[ index ].y = (y - 1.5f) * tV;
-                                                      
-            index++;
-        }
-    }
-
-    return S_OK;
-}
-
-
-
-
-//-----------------------------------------------------------------------------
-// Name: GetSampleOffsets_DownScale2x2
-// Desc: Get the texture coordinate offsets to be used inside the DownScale2x2
-//       pixel shader.
-//-----------------------------------------------------------------------------
-HRESULT HDRSun::GetSampleOffsets_DownScale2x2( DWORD dwWidth, DWORD dwHeight, D3DXVECTOR2 avSampleOffsets[] )
-{
-    if( NULL == avSampleOffsets )
-        return E_INVALIDARG;
-
-    float tU = 1.0f / dwWidth;
-    float tV = 1.0f / dwHeight;
-
-    // Sample from the 4 surrounding points. Since the center point will be in
-    // the exact center of 4 texels, a 0.5f offset is needed to specify a texel
-    // center.
-    int index=0;
-    for( int y=0; y < 2; y++ )
-    {
-        for( int x=0; x < 2; x++ )
-        {
-            avSampleOffsets[ index ].x = (x - 0.5f) * tU;
-            avSampleOffsets[ index ].y = (y - 0.5f) * tV;
-                                                      
-            index++;
-        }
-    }
-
-    return S_OK;
-}
-
-
-
-
-//-----------------------------------------------------------------------------
-// Name: GetSampleOffsets_GaussBlur5x5
-// Desc: Get the texture coordinate offsets to be used inside the GaussBlur5x5
-//       pixel shader.
-//-----------------------------------------------------------------------------
-HRESULT HDRSun::GetSampleOffsets_GaussBlur5x5(DWORD dwD3DTexWidth,
-                                                         DWORD dwD3DTexHeight,
-                                                         D3DXVECTOR2* avTexCoordOffset,
-                                                         D3DXVECTOR4* avSampleWeight,
-                                                         FLOAT fMultiplier )
-{
-    float tu = 1.0f / (float)dwD3DTexWidth ;
-    float tv = 1.0f / (float)dwD3DTexHeight ;
-
-    D3DXVECTOR4 vWhite( 1.0f, 1.0f, 1.0f, 1.0f );
-    
-    float totalWeight = 0.0f;
-    int index=0;
-    for( int x = -2; x <= 2; x++ )
-    {
-        for( int y = -2; y <= 2; y++ )
-        {
-            // Exclude pixels with a block distance greater than 2. This will
-            // create a kernel which approximates a 5x5 kernel using only 13
-            // sample points instead of 25; this is necessary since 2.0 shaders
-            // only support 16 texture grabs.
-            if( abs(x) + abs(y) > 2 )
-                continue;
-
-            // Get the unscaled Gaussian intensity for this offset
-            avTexCoordOffset[index] = D3DXVECTOR2( x * tu, y * tv );
-            avSampleWeight[index] = vWhite * GaussianDistribution( (float)x, (float)y, 1.0f );
-            totalWeight += avSampleWeight[index].x;
-
-            index++;
-        }
-    }
-
-    // Divide the current weight by the total weight of all the samples; Gaussian
-    // blur kernels add to 1.0f to ensure that the intensity of the image isn't
-    // changed when the blur occurs. An optional multiplier variable is used to
-    // add or remove image intensity during the blur.
-    for( int i=0; i < index; i++ )
-    {
-        avSampleWeight[i] /= totalWeight;
-        avSampleWeight[i] *= fMultiplier;
-    }
-
-    return S_OK;
-}
-
-
-
-
-//-----------------------------------------------------------------------------
-// Name: GetSampleOffsets_Bloom
-// Desc: Get the texture coordinate offsets to be used inside the Bloom
-//       pixel shader.
-//-----------------------------------------------------------------------------
-HRESULT HDRSun::GetSampleOffsets_Bloom( DWORD dwD3DTexSize,
-                                                   float afTexCoordOffset[15],
-                                                   D3DXVECTOR4* avColorWeight,
-                                                   float fDeviation,
-                                                   float fMultiplier )
-{
-    int i=0;
-    float tu = 1.0f / (float)dwD3DTexSize;
-
-    // Fill the center texel
-    float weight = fMultiplier * GaussianDistribution( 0, 0, fDeviation );
-    avColorWeight[0] = D3DXVECTOR4( weight, weight, weight, 1.0f );
-
-    afTexCoordOffset[0] = 0.0f;
-    
-    // Fill the first half
-    for( i=1; i < 8; i++ )
-    {
-        // Get the Gaussian intensity for this offset
-        weight = fMultiplier * GaussianDistribution( (float)i, 0, fDeviation );
-        afTexCoordOffset[i] = i * tu;
-
-        avColorWeight[i] = D3DXVECTOR4( weight, weight, weight, 1.0f );
-    }
-
-    // Mirror to the second half
-    for( i=8; i < 15; i++ )
-    {
-        avColorWeight[i] = avColorWeight[i-7];
-        afTexCoordOffset[i] = -afTexCoordOffset[i-7];
-    }
-
-    return S_OK;
-}
-
-
-
-
-//-----------------------------------------------------------------------------
-// Name: GetSampleOffsets_Bloom
-// Desc: Get the texture coordinate offsets to be used inside the Bloom
-//       pixel shader.
-//-----------------------------------------------------------------------------
-HRESULT HDRSun::GetSampleOffsets_Star(DWORD dwD3DTexSize,
-                                                float afTexCoordOffset[15],
-                                                D3DXVECTOR4* avColorWeight,
-                                                float fDeviation)
-{
-    int i=0;
-    float tu = 1.0f / (float)dwD3DTexSize;
-
-    // Fill the center texel
-    float weight = 1.0f * GaussianDistribution( 0, 0, fDeviation );
-    avColorWeight[0] = D3DXVECTOR4( weight, weight, weight, 1.0f );
-
-    afTexCoordOffset[0] = 0.0f;
-    
-    // Fill the first half
-    for( i=1; i < 8; i++ )
-    {
-        // Get the Gaussian intensity for this offset
-        weight = 1.0f * GaussianDistribution( (float)i, 0, fDeviation );
-        afTexCoordOffset[i] = i * tu;
-
-        avColorWeight[i] = D3DXVECTOR4( weight, weight, weight, 1.0f );
-    }
-
-    // Mirror to the second half
-    for( i=8; i < 15; i++ )
-    {
-        avColorWeight[i] = avColorWeight[i-7];
-        afTexCoordOffset[i] = -afTexCoordOffset[i-7];
-    }
-
-    return S_OK;
-}
-
+#include "WLHDRSun.h"
+#include "WLGpuProfiler.h"
+
+const DWORD ScreenVertex::FVF = D3DFVF_XYZRHW | D3DFVF_TEX1;
+
+//
+//	The quality tiers. The low one draws a sixteenth of the scene pixels of the high
+//	one, into a target half the size per pixel, and leaves the star out.
+//
+static const HDRSun::QualityTier s_aQualityTiers[HDRSun::NUM_QUALITY_TIERS] =
+{
+	//	name		divisor	packed	multisample	star
+	{	L"High",	1,		false,	true,		true	},	// QUALITY_HIGH
+	{	L"Medium",	2,		false,	false,		true	},	// QUALITY_MEDIUM
+	{	L"Low",		4,		true,	false,		false	},	// QUALITY_LOW
+};
+
+static const CoordRect s_rcFull = { 0.0f, 0.0f, 1.0f, 1.0f };
+static const CoordRect s_rcEmpty = { 0.0f, 0.0f, 0.0f, 0.0f };
+
+static inline bool IsEmptyBounds(const CoordRect& rc)
+{
+	return rc.fLeftU >= rc.fRightU || rc.fTopV >= rc.fBottomV;
+}
+
+static CoordRect UnionBounds(const CoordRect& a, const CoordRect& b)
+{
+	if (IsEmptyBounds(a))
+		return b;
+	if (IsEmptyBounds(b))
+		return a;
+
+	CoordRect rc = { min(a.fLeftU, b.fLeftU), min(a.fTopV, b.fTopV), max(a.fRightU, b.fRightU), max(a.fBottomV, b.fBottomV) };
+	return rc;
+}
+
+//
+//	Constructor
+//
+HDRSun::HDRSun(	float x, float y, float z,			// The World Coordinates of the sun
+			float radius, int stacks, int slices,	// Sun's sphere geometry info
+			D3DXMATRIX mProjection,					// Camera Projection Matrix, will be set in the shader
+			float BloomScale,						// Scale of the bloom effect
+			float StarScale,						// Scale of the star effect
+			int LightIntensity,						// Light intensity of the sun, must be 0..100
+			float BloomIntensity)					// Intensity for the bloom effect
+{
+	// Basic initializations
+	m_mProjection = mProjection;
+	m_pd3dDevice = DXUTGetD3DDevice();
+	m_pEffect = NULL;
+	m_pParams = NULL;
+	m_pFloatMSRT = NULL;							// Multi-Sample float render target
+	m_pFloatMSDS = NULL;							// Depth Stencil surface for the float RT
+	m_pTexScene = NULL;								// HDR render target containing the scene
+	m_eQualityTier = QUALITY_HIGH;
+	m_dwSceneWidth = 0;
+	m_dwSceneHeight = 0;
+	m_SceneFormat = D3DFMT_A16B16G16R16F;
+	m_pTexSceneScaled = NULL;						// Scaled copy of the HDR scene
+	m_pTexBrightPass = NULL;						// Bright-pass filtered copy of the scene
+	m_pTexAdaptedLuminanceCur = NULL;				// The luminance that the user is currenly adapted to
+	m_pTexAdaptedLuminanceLast = NULL;				// The luminance that the user is currenly adapted to
+	m_pTexStarSource = NULL;						// Star effect source texture
+	m_pTexBloomSource = NULL;						// Bloom effect source texture
+	for (int i = 0; i < NUM_BLOOM_TEXTURES; i++)
+		m_apTexBloom[i] = 0;						// Blooming effect working textures
+	for (int i = 0; i < HDR_MAX_BLOOM_LEVELS; i++)
+	{
+		m_apTexBloomDown[i] = 0;					// Dual filter bloom levels
+		m_apTexBloomUp[i] = 0;
+	}
+	for (int i = 0; i < NUM_STAR_TEXTURES; i++)
+		m_apTexStar[i] = 0;							// Star effect working textures
+	for (int i = 0; i < NUM_TONEMAP_TEXTURES; i++)
+		m_apTexToneMap[i] = 0;						// Log average luminance samples 
+													// from the HDR render target
+	m_pmeshSphere = NULL;							// Representation of point light
+	m_pSurfLDR = NULL;
+	m_pSurfDS = NULL;
+	ZeroMemory(m_aReadback, sizeof(m_aReadback));
+	m_iReadback = 0;
+	m_bUseMultiSampleFloat16 = false;				// True when using multisampling on a floating point back buffer
+	m_bSupportsMultiSampleFloat16 = false;
+	m_bSupportsFilterFloat16 = false;
+	m_MaxMultiSampleType = D3DMULTISAMPLE_NONE;		// Non-Zero when m_bUseMultiSampleFloat16 is true
+	m_dwMultiSampleQuality = 0;						// Non-Zero when we have multisampling on a float backbuffer
+	m_bSupportsD16 = false;
+	m_bSupportsD32 = false;
+	m_bSupportsD24X8 = false;
+	m_fRadius = radius;						// Sun's sphere radius
+	m_fStacks = stacks;
+	m_fSlices = slices;	
+	m_fBloomScale = BloomScale;
+	m_fStarScale = StarScale;
+	m_bBoundedPostProcess = true;					// Most frames the sun is a small part of the screen
+	m_bSunBounded = false;
+	m_rcSun = s_rcFull;
+	m_nDrawnSurfaces = 0;
+	m_nBloomInterval = BLOOM_REFRESH_INTERVAL;
+	m_nStarInterval = STAR_REFRESH_INTERVAL;
+	m_nLuminanceInterval = LUMINANCE_REFRESH_INTERVAL;
+	m_nFrame = 0;
+	m_bHistoryValid = false;
+	m_bRefreshBloom = true;
+	m_bRefreshStar = true;
+	m_bRefreshLuminance = true;
+	D3DXMatrixIdentity(&m_mBloomView);
+	D3DXMatrixIdentity(&m_mStarView);
+
+
+    // Set light positions in world space
+    m_avLightPosition = D3DXVECTOR4(x, y, z, 1.0f );
+
+	//
+	//	Initialize the values 
+	//
+	m_bToneMap = true;
+	m_bBlueShift = true;
+
+	// Expose for the middle of the histogram, so the sun and the black of space
+	// don't drag the average around
+	m_eLuminanceMode = LUMINANCE_HISTOGRAM;
+	m_fHistogramLow = 0.1f;							// Ignore the darkest 10%
+	m_fHistogramHigh = 0.95f;						// and the brightest 5%
+	m_fHistogramLuminance = 0.0f;
+
+	// The number of bloom levels follows the bloom scale, see BuildGraph()
+	m_eBloomMode = BLOOM_DUAL_FILTER;
+	m_nBloomLevels = 0;
+	m_nStarLines = 0;
+	m_fStarMergeWeight = 0.0f;
+	m_bStarBlending = false;
+
+	m_eGlareType = (EGLARELIBTYPE)(INT_PTR) GLT_FILTER_SNOWCROSS_SPECTRAL;	
+	// Glare type available types
+	 //   GLT_DEFAULT
+     //   GLT_DISABLE 
+     //   GLT_CAMERA 
+     //   GLT_NATURAL
+     //   GLT_CHEAPLENS 
+     //   GLT_FILTER_CROSSSCREEN
+     //   GLT_FILTER_CROSSSCREEN_SPECTRAL
+     //   GLT_FILTER_SNOWCROSS
+     //   GLT_FILTER_SNOWCROSS_SPECTRAL
+     //   GLT_FILTER_SUNNYCROSS
+     //   GLT_FILTER_SUNNYCROSS_SPECTRAL
+     //   GLT_CINECAM_VERTICALSLITS
+     //   GLT_CINECAM_HORIZONTALSLITS
+	m_GlareDef.Initialize( m_eGlareType );
+	
+	m_fKeyValue = BloomIntensity / 100.0f;	
+
+	m_nLightMantissa = 1 + (LightIntensity % 9);	
+	m_nLightLogIntensity = -4 + (LightIntensity / 9);
+
+	RefreshLights();
+
+	OnCreateDevice();
+	OnResetDevice();
+
+}
+
+HRESULT HDRSun::OnResetDevice()
+{
+    HRESULT hr;
+
+	m_pd3dDevice = DXUTGetD3DDevice();
+	StateCache::Get().GetTransform(D3DTS_PROJECTION,&m_mProjection);
+
+    const D3DSURFACE_DESC* pBackBufferDesc = DXUTGetBackBufferSurfaceDesc();
+
+    // The scene target follows the quality tier. An RGBE scene isn't multisampled,
+    // resolving it would average the exponents.
+    const QualityTier& tier = s_aQualityTiers[m_eQualityTier];
+    m_dwSceneWidth = max( pBackBufferDesc->Width / tier.dwSceneDivisor, (UINT)8 );
+    m_dwSceneHeight = max( pBackBufferDesc->Height / tier.dwSceneDivisor, (UINT)8 );
+    m_SceneFormat = tier.bPackedScene ? D3DFMT_A8R8G8B8 : D3DFMT_A16B16G16R16F;
+    m_bUseMultiSampleFloat16 = m_bSupportsMultiSampleFloat16 && tier.bMultiSample && !tier.bPackedScene;
+
+    // Create the Multi-Sample floating point render target
+    D3DFORMAT dfmt = D3DFMT_UNKNOWN;
+    if(m_bSupportsD16)
+        dfmt = D3DFMT_D16;
+    else if(m_bSupportsD32)
+        dfmt = D3DFMT_D32;
+    else if(m_bSupportsD24X8)
+        dfmt = D3DFMT_D24X8;
+    else
+        m_bUseMultiSampleFloat16 = false;
+
+    if( m_bUseMultiSampleFloat16 )
+    {
+        hr = m_pd3dDevice->CreateRenderTarget( m_dwSceneWidth, m_dwSceneHeight,
+                                               D3DFMT_A16B16G16R16F, 
+                                               m_MaxMultiSampleType, m_dwMultiSampleQuality,
+                                               FALSE, &m_pFloatMSRT, NULL );
+        if( FAILED(hr) )
+            m_bUseMultiSampleFloat16 = false;
+        else
+        {
+            hr = m_pd3dDevice->CreateDepthStencilSurface(  m_dwSceneWidth, m_dwSceneHeight,
+                                               dfmt, 
+                                               m_MaxMultiSampleType, m_dwMultiSampleQuality,
+                                               TRUE, &m_pFloatMSDS, NULL );
+            if( FAILED(hr) )
+            {
+                m_bUseMultiSampleFloat16 = false;
+                SAFE_RELEASE( m_pFloatMSRT );
+            }
+        }
+    }
+
+    // Crop the scene texture so width and height are evenly divisible by 8.
+    // This cropped version of the scene will be used for post processing effects,
+    // and keeping everything evenly divisible allows precise control over
+    // sampling points within the shaders.
+    m_dwCropWidth = m_dwSceneWidth - m_dwSceneWidth % 8;
+    m_dwCropHeight = m_dwSceneHeight - m_dwSceneHeight % 8;
+
+    // The post-processing chain is described as a graph of passes and the render
+    // targets they read and write, see BuildGraph()
+    hr = BuildGraph();
+    if( FAILED(hr) )
+        return hr;
+
+    // Copies of the log luminance texture the CPU reads back for the histogram
+    if( m_eLuminanceMode == LUMINANCE_HISTOGRAM )
+    {
+        for( int i=0; i < NUM_LUMINANCE_READBACKS; i++ )
+        {
+            LuminanceReadback& readback = m_aReadback[i];
+            V_RETURN( m_pd3dDevice->CreateRenderTarget( HDR_TONEMAP_SIZE, HDR_TONEMAP_SIZE, m_LuminanceFormat,
+                                                        D3DMULTISAMPLE_NONE, 0, FALSE, &readback.pTarget, NULL ) );
+            V_RETURN( m_pd3dDevice->CreateOffscreenPlainSurface( HDR_TONEMAP_SIZE, HDR_TONEMAP_SIZE, m_LuminanceFormat,
+                                                                 D3DPOOL_SYSTEMMEM, &readback.pSysMem, NULL ) );
+
+            // Without event queries a copy is read back once its slot comes around
+            if( FAILED( m_pd3dDevice->CreateQuery( D3DQUERYTYPE_EVENT, &readback.pQuery ) ) )
+                readback.pQuery = NULL;
+            readback.bPending = false;
+        }
+        m_iReadback = 0;
+    }
+
+	// Create the sphere that will represent the sun
+	D3DXCreateSphere(
+					m_pd3dDevice,	// Pointer to IDirect3DDevice9
+					m_fRadius,		// Radius
+					m_fSlices,		// Slices
+					m_fStacks,		// Stacks
+					&m_pmeshSphere,	// Pointer to a pointer to a ID3DXMesh
+					0);
+
+    // Its draw is the same every frame, and is replayed unless it can't be recorded
+    m_SphereCommands.Begin();
+    if (m_pmeshSphere && SUCCEEDED(WL::RecordMeshSubset(m_SphereCommands, m_pmeshSphere, 0)))
+        m_SphereCommands.End();
+
+    // Set effect file variables. The projection is shared with the other effects.
+    AssetCache::Get().GetSharedParams().SetMatrix(m_hProjection, m_mProjection);
+    m_pParams->SetFloat(m_hBloomScale, m_fBloomScale);
+    m_pParams->SetFloat(m_hStarScale, m_fStarScale);
+    
+    return S_OK;
+}
+
+//-----------------------------------------------------------------------------
+// Name: BuildGraph()
+// Desc: Describe the post-processing passes, the techniques they use and the
+//       render targets they read and write, then let the graph cull what isn't
+//       needed and allocate the targets
+//-----------------------------------------------------------------------------
+HRESULT HDRSun::BuildGraph()
+{
+    HRESULT hr;
+    int i;
+    PostProcessGraph::Pass hPass;
+
+    const QualityTier& tier = s_aQualityTiers[m_eQualityTier];
+    DWORD dwQuarterWidth = m_dwCropWidth / 4;
+
+    // The graph may hand out new targets, nothing is known about what they hold
+    m_nDrawnSurfaces = 0;
+    DWORD dwQuarterHeight = m_dwCropHeight / 4;
+    DWORD dwEighthWidth = m_dwCropWidth / 8;
+    DWORD dwEighthHeight = m_dwCropHeight / 8;
+
+    bool bBloom = m_GlareDef.m_fGlareLuminance > 0.0f && m_GlareDef.m_fBloomLuminance > 0.0f;
+    bool bStar = m_GlareDef.m_fGlareLuminance > 0.0f && m_GlareDef.m_fStarLuminance > 0.0f;
+
+    // What isn't redone every frame has to be kept for the frames in between
+    DWORD dwBloomFlags = m_nBloomInterval > 1 ? PPG_PERSISTENT : 0;
+    DWORD dwStarFlags = m_nStarInterval > 1 ? PPG_PERSISTENT : 0;
+    DWORD dwLuminanceFlags = m_nLuminanceInterval > 1 ? PPG_PERSISTENT : 0;
+
+    m_Graph.Release();
+
+    //
+    //	Render targets
+    //
+    PostProcessGraph::Target hBackBuffer = m_Graph.ImportTarget();
+
+    // HDR render target containing the scene, and a scaled version of it
+    PostProcessGraph::Target hScene = m_Graph.DeclareTarget( m_dwSceneWidth, m_dwSceneHeight, m_SceneFormat );
+    PostProcessGraph::Target hSceneScaled = m_Graph.DeclareTarget( dwQuarterWidth, dwQuarterHeight, D3DFMT_A16B16G16R16F );
+
+    // The bright-pass filter, star source and bloom source textures have a black
+    // border of single texel thickness to fake border addressing using clamp addressing
+    PostProcessGraph::Target hBrightPass = m_Graph.DeclareTarget( dwQuarterWidth + 2, dwQuarterHeight + 2, D3DFMT_A8R8G8B8, RTP_BORDERED );
+    PostProcessGraph::Target hStarSource = m_Graph.DeclareTarget( dwQuarterWidth + 2, dwQuarterHeight + 2, D3DFMT_A8R8G8B8, RTP_BORDERED );
+    PostProcessGraph::Target hBloomSource = m_Graph.DeclareTarget( dwEighthWidth + 2, dwEighthHeight + 2, D3DFMT_A8R8G8B8, RTP_BORDERED );
+
+    // Two textures hold the luminance that the user is currently adapted to. This
+    // allows for a simple simulation of light adaptation, so they live across frames.
+    PostProcessGraph::Target hAdaptedLuminanceCur = m_Graph.DeclareTarget( 1, 1, m_LuminanceFormat, PPG_PERSISTENT );
+    PostProcessGraph::Target hAdaptedLuminanceLast = m_Graph.DeclareTarget( 1, 1, m_LuminanceFormat, PPG_PERSISTENT );
+
+    // For each scale stage, a texture to hold the intermediate results of the
+    // luminance calculation
+    PostProcessGraph::Target ahToneMap[NUM_TONEMAP_TEXTURES];
+    for( i=0; i < NUM_TONEMAP_TEXTURES; i++ )
+    {
+        int iSampleLen = 1 << (2*i);
+        ahToneMap[i] = m_Graph.DeclareTarget( iSampleLen, iSampleLen, m_LuminanceFormat, i == 0 ? dwLuminanceFlags : 0 );
+    }
+
+    // The temporary blooming effect textures, with a border, and the final one
+    PostProcessGraph::Target ahBloom[NUM_BLOOM_TEXTURES];
+    for( i=1; i < NUM_BLOOM_TEXTURES; i++ )
+        ahBloom[i] = m_Graph.DeclareTarget( dwEighthWidth + 2, dwEighthHeight + 2, D3DFMT_A8R8G8B8, RTP_BORDERED );
+    ahBloom[0] = m_Graph.DeclareTarget( dwEighthWidth, dwEighthHeight, D3DFMT_A8R8G8B8, dwBloomFlags );
+
+    // The dual filter bloom halves the size at every level. Coming back up, level 0
+    // ends in the final bloom texture.
+    bool bDualFilter = m_eBloomMode == BLOOM_DUAL_FILTER;
+    m_nBloomLevels = bDualFilter ? WL::GetBloomLevels( m_fBloomScale, dwEighthWidth, dwEighthHeight ) : 0;
+    PostProcessGraph::Target ahBloomDown[HDR_MAX_BLOOM_LEVELS];
+    PostProcessGraph::Target ahBloomUp[HDR_MAX_BLOOM_LEVELS];
+    for( i=0; i < m_nBloomLevels; i++ )
+    {
+        DWORD dwLevelWidth = max( dwEighthWidth >> i, (DWORD)1 );
+        DWORD dwLevelHeight = max( dwEighthHeight >> i, (DWORD)1 );
+        ahBloomDown[i] = m_Graph.DeclareTarget( dwLevelWidth, dwLevelHeight, D3DFMT_A8R8G8B8 );
+        ahBloomUp[i] = i == 0 ? ahBloom[0] : m_Graph.DeclareTarget( dwLevelWidth, dwLevelHeight, D3DFMT_A8R8G8B8 );
+    }
+
+    // The sample weights and offsets of every star line, for the star source size
+    BuildStarTables( dwQuarterWidth + 2, dwQuarterHeight + 2 );
+
+    // The star effect textures: [1] and [2] are the work textures every line
+    // ping-pongs between. The lines are added into [0] as they finish, or without
+    // blending on float targets, [4+d] holds line d until the lines are merged.
+    PostProcessGraph::Target ahStar[NUM_STAR_TEXTURES];
+    for( i=0; i < NUM_STAR_TEXTURES; i++ )
+    {
+        bool bUsed = i == 0 || i == 1 || i == 2 || (!m_bStarBlending && i >= 4 && i < 4 + m_nStarLines);
+        ahStar[i] = bUsed ? m_Graph.DeclareTarget( dwQuarterWidth, dwQuarterHeight, D3DFMT_A16B16G16R16F, i == 0 ? dwStarFlags : 0 ) : -1;
+    }
+
+    //
+    //	Passes, in the order they run
+    //
+    hPass = m_Graph.AddPass( L"Scene", NULL, PASS_SCENE );
+    m_Graph.Write( hPass, hScene );
+
+    // Create a scaled copy of the scene, decoding it when it is packed
+    hPass = m_Graph.AddPass( L"Scale", tier.bPackedScene ? "DownScale4x4RGBE" : "DownScale4x4", PASS_SCALE );
+    m_Graph.Read( hPass, hScene );
+    m_Graph.Write( hPass, hSceneScaled );
+
+    // Setup tone mapping technique. With the histogram only the first luminance
+    // texture is drawn, the CPU reads it back and does the rest.
+    bool bHistogram = m_eLuminanceMode == LUMINANCE_HISTOGRAM;
+    hPass = m_Graph.AddPass( L"Luminance", "SampleAvgLum", PASS_LUMINANCE );
+    m_Graph.Read( hPass, hSceneScaled );
+    for( i = bHistogram ? NUM_TONEMAP_TEXTURES-1 : 0; i < NUM_TONEMAP_TEXTURES; i++ )
+        m_Graph.Write( hPass, ahToneMap[i] );
+    m_Graph.EnablePass( hPass, m_bToneMap );
+
+    // Calculate the current luminance adaptation level. The histogram result arrives
+    // as an effect parameter a few frames later, but the adaptation still depends on
+    // the luminance pass.
+    hPass = m_Graph.AddPass( L"Adaptation", bHistogram ? "CalculateAdaptedLumHistogram" : "CalculateAdaptedLum", PASS_ADAPTATION );
+    m_Graph.Read( hPass, hAdaptedLuminanceLast );
+    m_Graph.Read( hPass, ahToneMap[bHistogram ? NUM_TONEMAP_TEXTURES-1 : 0] );
+    m_Graph.Write( hPass, hAdaptedLuminanceCur );
+
+    // Now that luminance information has been gathered, the scene can be bright-pass filtered
+    // to remove everything except bright lights and reflections.
+    hPass = m_Graph.AddPass( L"Bright pass", "BrightPassFilter", PASS_BRIGHTPASS );
+    m_Graph.Read( hPass, hSceneScaled );
+    m_Graph.Read( hPass, hAdaptedLuminanceCur );
+    m_Graph.Write( hPass, hBrightPass );
+
+    // Blur the bright-pass filtered image to create the source texture for the star effect
+    hPass = m_Graph.AddPass( L"Star source", "GaussBlur5x5", PASS_STARSOURCE );
+    m_Graph.Read( hPass, hBrightPass );
+    m_Graph.Write( hPass, hStarSource );
+
+    // Scale-down the source texture for the star effect to create the source texture
+    // for the bloom effect
+    hPass = m_Graph.AddPass( L"Bloom source", "DownScale2x2", PASS_BLOOMSOURCE );
+    m_Graph.Read( hPass, hStarSource );
+    m_Graph.Write( hPass, hBloomSource );
+
+    // Render post-process lighting effects. Without them their textures stay black.
+    hPass = m_Graph.AddPass( L"Bloom", "GaussBlur5x5", PASS_BLOOM );
+    m_Graph.Read( hPass, hBloomSource );
+    for( i=0; i < NUM_BLOOM_TEXTURES; i++ )
+        m_Graph.Write( hPass, ahBloom[i] );
+    m_Graph.EnablePass( hPass, bBloom && !bDualFilter );
+
+    // The dual filter bloom starts from the bright pass, so the star source and bloom
+    // source passes are culled when there is no star
+    for( i=0; i < m_nBloomLevels; i++ )
+    {
+        hPass = m_Graph.AddPass( L"Bloom down", "BloomDownsample", PASS_BLOOMDOWN + i );
+        m_Graph.Read( hPass, i == 0 ? hBrightPass : ahBloomDown[i-1] );
+        m_Graph.Write( hPass, ahBloomDown[i] );
+        m_Graph.EnablePass( hPass, bBloom );
+    }
+
+    for( i=m_nBloomLevels-2; i >= 0; i-- )
+    {
+        hPass = m_Graph.AddPass( L"Bloom up", "BloomUpsample", PASS_BLOOMUP + i );
+        m_Graph.Read( hPass, i == m_nBloomLevels-2 ? ahBloomDown[i+1] : ahBloomUp[i+1] );
+        m_Graph.Read( hPass, ahBloomDown[i] );
+        m_Graph.Write( hPass, ahBloomUp[i] );
+        m_Graph.EnablePass( hPass, bBloom );
+    }
+
+    // The tiers that can afford the star
+    DWORD dwStarTiers = 0;
+    for( i=0; i < NUM_QUALITY_TIERS; i++ )
+    {
+        if( s_aQualityTiers[i].bStar )
+            dwStarTiers |= 1 << i;
+    }
+
+    // Only the lines that show get a pass
+    for( i=0; i < m_nStarLines; i++ )
+    {
+        hPass = m_Graph.AddPass( L"Star line", "Star", PASS_STARLINE + i, dwStarTiers );
+        m_Graph.Read( hPass, hStarSource );
+        m_Graph.Write( hPass, ahStar[1] );
+        m_Graph.Write( hPass, ahStar[2] );
+        if( m_bStarBlending )
+        {
+            // Every line after the first adds to what is there
+            if( i > 0 )
+                m_Graph.Read( hPass, ahStar[0] );
+            m_Graph.Write( hPass, ahStar[0] );
+        }
+        else
+        {
+            m_Graph.Write( hPass, ahStar[4+i] );
+        }
+        m_Graph.EnablePass( hPass, bStar );
+    }
+
+    CHAR strTechnique[32];
+    StringCchPrintfA( strTechnique, 32, "MergeTextures_%d", m_nStarLines );
+    hPass = m_Graph.AddPass( L"Star merge", strTechnique, PASS_STARMERGE, dwStarTiers );
+    for( i=0; i < m_nStarLines; i++ )
+        m_Graph.Read( hPass, ahStar[4+i] );
+    m_Graph.Write( hPass, ahStar[0] );
+    m_Graph.EnablePass( hPass, bStar && !m_bStarBlending && m_nStarLines > 0 );
+
+    // Tone map into the back buffer
+    hPass = m_Graph.AddPass( L"Final scene pass", tier.bPackedScene ? "FinalScenePassRGBE" : "FinalScenePass", PASS_FINAL );
+    m_Graph.Read( hPass, hScene );
+    m_Graph.Read( hPass, ahBloom[0] );
+    m_Graph.Read( hPass, ahStar[0] );
+    m_Graph.Read( hPass, hAdaptedLuminanceCur );
+    m_Graph.Write( hPass, hBackBuffer );
+
+    m_Graph.SetTier( m_eQualityTier );
+    hr = m_Graph.Compile( m_pd3dDevice, m_pEffect );
+    if( FAILED(hr) )
+        return hr;
+
+    m_pTexScene = m_Graph.GetTexture( hScene );
+    m_pTexSceneScaled = m_Graph.GetTexture( hSceneScaled );
+    m_pTexBrightPass = m_Graph.GetTexture( hBrightPass );
+    m_pTexStarSource = m_Graph.GetTexture( hStarSource );
+    m_pTexBloomSource = m_Graph.GetTexture( hBloomSource );
+    m_pTexAdaptedLuminanceCur = m_Graph.GetTexture( hAdaptedLuminanceCur );
+    m_pTexAdaptedLuminanceLast = m_Graph.GetTexture( hAdaptedLuminanceLast );
+    for( i=0; i < NUM_TONEMAP_TEXTURES; i++ )
+        m_apTexToneMap[i] = m_Graph.GetTexture( ahToneMap[i] );
+    for( i=0; i < NUM_BLOOM_TEXTURES; i++ )
+        m_apTexBloom[i] = m_Graph.GetTexture( ahBloom[i] );
+    for( i=0; i < m_nBloomLevels; i++ )
+    {
+        m_apTexBloomDown[i] = m_Graph.GetTexture( ahBloomDown[i] );
+        m_apTexBloomUp[i] = m_Graph.GetTexture( ahBloomUp[i] );
+    }
+    for( i=0; i < NUM_STAR_TEXTURES; i++ )
+        m_apTexStar[i] = m_Graph.GetTexture( ahStar[i] );
+
+    // The new targets hold nothing to reuse yet
+    m_bHistoryValid = false;
+
+    return S_OK;
+}
+
+void HDRSun::OnLostDevice()
+{
+
+    int i=0;
+    
+    // The targets are made again, with nothing known about what they hold
+    m_nDrawnSurfaces = 0;
+
+    m_SphereCommands.Invalidate();
+    SAFE_RELEASE(m_pmeshSphere);
+
+    SAFE_RELEASE(m_pFloatMSRT);
+    SAFE_RELEASE(m_pFloatMSDS);
+    SAFE_RELEASE(m_pTexScene);
+    SAFE_RELEASE(m_pTexSceneScaled);
+    SAFE_RELEASE(m_pTexAdaptedLuminanceCur);
+    SAFE_RELEASE(m_pTexAdaptedLuminanceLast);
+    SAFE_RELEASE(m_pTexBrightPass);
+    SAFE_RELEASE(m_pTexBloomSource);
+    SAFE_RELEASE(m_pTexStarSource);
+    
+    for( i=0; i < NUM_TONEMAP_TEXTURES; i++)
+    {
+        SAFE_RELEASE(m_apTexToneMap[i]);
+    }
+
+    for( i=0; i < NUM_STAR_TEXTURES; i++ )
+    {
+        SAFE_RELEASE(m_apTexStar[i]);
+    }
+
+    for( i=0; i < NUM_BLOOM_TEXTURES; i++ )
+    {
+        SAFE_RELEASE(m_apTexBloom[i]);
+    }
+
+    for( i=0; i < HDR_MAX_BLOOM_LEVELS; i++ )
+    {
+        SAFE_RELEASE(m_apTexBloomDown[i]);
+        SAFE_RELEASE(m_apTexBloomUp[i]);
+    }
+
+    for( i=0; i < NUM_LUMINANCE_READBACKS; i++ )
+    {
+        SAFE_RELEASE(m_aReadback[i].pTarget);
+        SAFE_RELEASE(m_aReadback[i].pSysMem);
+        SAFE_RELEASE(m_aReadback[i].pQuery);
+        m_aReadback[i].bPending = false;
+    }
+
+    m_Graph.Release();
+}
+
+void HDRSun::ResetMatrices()
+{
+	StateCache::Get().GetTransform(D3DTS_PROJECTION,&m_mProjection);
+	StateCache::Get().GetTransform(D3DTS_VIEW,&m_mView);
+	if (m_pEffect)
+		AssetCache::Get().GetSharedParams().SetMatrix(m_hProjection, m_mProjection);
+}
+
+
+HRESULT HDRSun::OnCreateDevice()
+{
+	m_pd3dDevice = DXUTGetD3DDevice();
+
+	HRESULT hr;
+
+    // Determine which of D3DFMT_R16F or D3DFMT_R32F to use for luminance texture
+    D3DCAPS9 Caps;
+    IDirect3D9* pD3D = DXUTGetD3DObject();
+    D3DDISPLAYMODE DisplayMode;
+    m_pd3dDevice->GetDeviceCaps( &Caps );
+    m_pd3dDevice->GetDisplayMode( 0, &DisplayMode );
+    // IsDeviceAcceptable already ensured that one of D3DFMT_R16F or D3DFMT_R32F is available.
+    if( FAILURE( pD3D->CheckDeviceFormat( Caps.AdapterOrdinal, Caps.DeviceType,
+                    DisplayMode.Format, D3DUSAGE_RENDERTARGET, 
+                    D3DRTYPE_TEXTURE, D3DFMT_R16F ) ) )
+        m_LuminanceFormat = D3DFMT_R32F;
+    else
+        m_LuminanceFormat = D3DFMT_R16F;
+
+    // With blending on float targets the star lines are added up as they are drawn,
+    // instead of each keeping a texture until they are merged
+    m_bStarBlending = SUCCESS( pD3D->CheckDeviceFormat( Caps.AdapterOrdinal, Caps.DeviceType,
+                    DisplayMode.Format, D3DUSAGE_RENDERTARGET | D3DUSAGE_QUERY_POSTPIXELSHADER_BLENDING,
+                    D3DRTYPE_TEXTURE, D3DFMT_A16B16G16R16F ) );
+
+    // A scene smaller than the back buffer is stretched over it in the final pass,
+    // smoothly where float textures can be filtered
+    m_bSupportsFilterFloat16 = SUCCESS( pD3D->CheckDeviceFormat( Caps.AdapterOrdinal, Caps.DeviceType,
+                    DisplayMode.Format, D3DUSAGE_QUERY_FILTER,
+                    D3DRTYPE_TEXTURE, D3DFMT_A16B16G16R16F ) );
+
+    // Determine whether we can support multisampling on a A16B16G16R16F render target
+    m_bSupportsMultiSampleFloat16 = false;
+    m_MaxMultiSampleType = D3DMULTISAMPLE_NONE;
+    DXUTDeviceSettings settings = DXUTGetDeviceSettings();
+    for( D3DMULTISAMPLE_TYPE imst = D3DMULTISAMPLE_2_SAMPLES; imst <= D3DMULTISAMPLE_16_SAMPLES; imst = (D3DMULTISAMPLE_TYPE)(imst + 1) )
+    {
+        DWORD msQuality = 0;
+        if( SUCCESS( pD3D->CheckDeviceMultiSampleType( Caps.AdapterOrdinal, 
+                                                           Caps.DeviceType, 
+                                                           D3DFMT_A16B16G16R16F, 
+                                                           settings.pp.Windowed, 
+                                                           imst, &msQuality ) ) )
+        {
+            m_bSupportsMultiSampleFloat16 = true;
+            m_MaxMultiSampleType = imst;
+            if( msQuality > 0 )
+                m_dwMultiSampleQuality = msQuality-1;
+            else
+                m_dwMultiSampleQuality = msQuality;
+        }
+    }
+
+    m_bSupportsD16 = false;
+    if( SUCCESS( pD3D->CheckDeviceFormat( settings.AdapterOrdinal, settings.DeviceType,
+                                            settings.AdapterFormat, D3DUSAGE_DEPTHSTENCIL,
+                                            D3DRTYPE_SURFACE, D3DFMT_D16 ) ) )
+    {
+        if( SUCCESS( pD3D->CheckDepthStencilMatch( settings.AdapterOrdinal, settings.DeviceType,
+                                            settings.AdapterFormat, D3DFMT_A16B16G16R16F, 
+                                            D3DFMT_D16 ) ) )
+        {
+            m_bSupportsD16 = true;
+        }
+    }
+    m_bSupportsD32 = false;
+    if( SUCCESS( pD3D->CheckDeviceFormat( settings.AdapterOrdinal, settings.DeviceType,
+                                            settings.AdapterFormat, D3DUSAGE_DEPTHSTENCIL,
+                                            D3DRTYPE_SURFACE, D3DFMT_D32 ) ) )
+    {
+        if( SUCCESS( pD3D->CheckDepthStencilMatch( settings.AdapterOrdinal, settings.DeviceType,
+                                                settings.AdapterFormat, D3DFMT_A16B16G16R16F, 
+                                                D3DFMT_D32 ) ) )
+        {
+            m_bSupportsD32 = true;
+        }
+    }
+    m_bSupportsD24X8 = false;
+    if( SUCCESS( pD3D->CheckDeviceFormat( settings.AdapterOrdinal, settings.DeviceType,
+                                            settings.AdapterFormat, D3DUSAGE_DEPTHSTENCIL,
+                                            D3DRTYPE_SURFACE, D3DFMT_D24X8 ) ) )
+    {
+        if( SUCCESS( pD3D->CheckDepthStencilMatch( settings.AdapterOrdinal, settings.DeviceType,
+                                                settings.AdapterFormat, D3DFMT_A16B16G16R16F, 
+                                                D3DFMT_D24X8 ) ) )
+        {
+            m_bSupportsD24X8 = true;
+        }
+    }
+
+    DWORD dwShaderFlags = D3DXFX_NOT_CLONEABLE | WL_SHADER_FLAGS;
+    #ifdef DEBUG_VS
+        dwShaderFlags |= D3DXSHADER_FORCE_VS_SOFTWARE_NOOPT;
+    #endif
+    #ifdef DEBUG_PS
+        dwShaderFlags |= D3DXSHADER_FORCE_PS_SOFTWARE_NOOPT;
+    #endif
+
+	// Read the D3DX effect file
+    // If this fails, there should be debug output as to 
+    // they the .fx file failed to compile
+    SAFE_RELEASE(m_pEffect);
+    m_pParams = NULL;
+    m_pEffect = AssetCache::Get().GetEffect( L"data\\fx\\HDRLighting.fx", dwShaderFlags );
+    if( m_pEffect == NULL )
+        return E_FAIL;
+
+    // Look the parameters up once, they are set through the handles every frame
+    m_pParams = AssetCache::Get().GetEffectParams( m_pEffect );
+    m_hProjection = AssetCache::Get().GetSharedParams().GetParam( "Projection" );
+    m_hBloomScale = m_pParams->GetParam( "g_fBloomScale" );
+    m_hStarScale = m_pParams->GetParam( "g_fStarScale" );
+    m_hEnableToneMap = m_pParams->GetParam( "g_bEnableToneMap" );
+    m_hEnableBlueShift = m_pParams->GetParam( "g_bEnableBlueShift" );
+    m_hEnableTexture = m_pParams->GetParam( "g_bEnableTexture" );
+    m_hLightPositionView = m_pParams->GetParam( "g_avLightPositionView" );
+    m_hLightIntensity = m_pParams->GetParam( "g_avLightIntensity" );
+    m_hObjectToView = m_pParams->GetParam( "g_mObjectToView" );
+    m_hEmissive = m_pParams->GetParam( "g_vEmissive" );
+    m_hPhongExponent = m_pParams->GetParam( "g_fPhongExponent" );
+    m_hPhongCoefficient = m_pParams->GetParam( "g_fPhongCoefficient" );
+    m_hDiffuseCoefficient = m_pParams->GetParam( "g_fDiffuseCoefficient" );
+    m_hMiddleGray = m_pParams->GetParam( "g_fMiddleGray" );
+    m_hBloomOffset = m_pParams->GetParam( "g_vBloomOffset" );
+    m_hStarOffset = m_pParams->GetParam( "g_vStarOffset" );
+    m_hSampleOffsets = m_pParams->GetParam( "g_avSampleOffsets" );
+    m_hSampleWeights = m_pParams->GetParam( "g_avSampleWeights" );
+    m_hElapsedTime = m_pParams->GetParam( "g_fElapsedTime" );
+    m_hSceneLuminance = m_pParams->GetParam( "g_fSceneLuminance" );
+    m_hRenderScene = m_pEffect->GetTechniqueByName( "RenderScene" );
+    m_hRenderSceneRGBE = m_pEffect->GetTechniqueByName( "RenderSceneRGBE" );
+
+	return S_OK;
+
+}
+
+
+void HDRSun::OnDestroyDevice()
+{
+    m_pParams = NULL;
+    SAFE_RELEASE(m_pEffect);
+}
+
+//
+//	Destructor
+//
+HDRSun::~HDRSun()
+{
+    int i=0;
+
+    SAFE_RELEASE(m_pmeshSphere);
+
+    SAFE_RELEASE(m_pFloatMSRT);
+    SAFE_RELEASE(m_pFloatMSDS);
+    SAFE_RELEASE(m_pTexScene);
+    SAFE_RELEASE(m_pTexSceneScaled);
+    SAFE_RELEASE(m_pTexAdaptedLuminanceCur);
+    SAFE_RELEASE(m_pTexAdaptedLuminanceLast);
+    SAFE_RELEASE(m_pTexBrightPass);
+    SAFE_RELEASE(m_pTexBloomSource);
+    SAFE_RELEASE(m_pTexStarSource);
+    
+    for( i=0; i < NUM_TONEMAP_TEXTURES; i++)
+    {
+        SAFE_RELEASE(m_apTexToneMap[i]);
+    }
+
+    for( i=0; i < NUM_STAR_TEXTURES; i++ )
+    {
+        SAFE_RELEASE(m_apTexStar[i]);
+    }
+
+    for( i=0; i < NUM_BLOOM_TEXTURES; i++ )
+    {
+        SAFE_RELEASE(m_apTexBloom[i]);
+    }
+
+    for( i=0; i < HDR_MAX_BLOOM_LEVELS; i++ )
+    {
+        SAFE_RELEASE(m_apTexBloomDown[i]);
+        SAFE_RELEASE(m_apTexBloomUp[i]);
+    }
+
+	SAFE_RELEASE(m_pEffect);
+
+}
+
+//-----------------------------------------------------------------------------
+// Name: RefreshLights
+// Desc: Set the light intensities to match the current log luminance
+//-----------------------------------------------------------------------------
+HRESULT HDRSun::RefreshLights()
+{
+    m_avLightIntensity.x = m_nLightMantissa * (float) pow(10.0f, m_nLightLogIntensity);
+    m_avLightIntensity.y = m_nLightMantissa * (float) pow(10.0f, m_nLightLogIntensity);
+    m_avLightIntensity.z = m_nLightMantissa * (float) pow(10.0f, m_nLightLogIntensity);
+    m_avLightIntensity.w = 1.0f;
+
+    // A different intensity shows at once, not when the bloom comes around
+    m_bHistoryValid = false;
+
+    return S_OK;
+}
+
+
+//-----------------------------------------------------------------------------
+// Name: AdjustLight
+// Desc: Increment or decrement the light at the given index
+//-----------------------------------------------------------------------------
+HRESULT HDRSun::AdjustLight(bool bIncrement)
+{
+
+	if( bIncrement && m_nLightLogIntensity < 7 )
+    {
+        m_nLightMantissa++;
+        if( m_nLightMantissa > 9 )
+        {
+            m_nLightMantissa = 1;
+            m_nLightLogIntensity++;
+        }
+    }
+    
+    if( !bIncrement && m_nLightLogIntensity > -4 )
+    {
+        m_nLightMantissa--;
+        if( m_nLightMantissa < 1 )
+        {
+            m_nLightMantissa = 9;
+            m_nLightLogIntensity--;
+        }
+    }
+
+    RefreshLights();
+    return S_OK;
+}
+
+//-----------------------------------------------------------------------------
+// Name: Draw
+// Desc: Prepares the shaders and renders the sun for this frame
+//-----------------------------------------------------------------------------
+void HDRSun::Draw(D3DXMATRIX mView)				// The View Coordinates Matrix
+{
+	WL_PROFILE_STAGE(L"HDRSun::Draw");
+	HRESULT hr;
+
+	// Set the flag to refresh the user's simulated adaption level.
+    // Frame move is not called when the scene is paused or single-stepped. 
+    // If the scene is paused, the user's adaptation level needs to remain
+    // unchanged.
+    m_bAdaptationInvalid = true;
+    m_mView = mView;
+
+    // Calculate the position of the light in view space
+    D3DXVECTOR4 avLightViewPosition; 
+    D3DXVec4Transform(&avLightViewPosition, &m_avLightPosition, &mView);
+
+    // Set frame shader constants
+    m_pParams->SetBool(m_hEnableToneMap, m_bToneMap);
+    m_pParams->SetBool(m_hEnableBlueShift, m_bBlueShift);
+    m_pParams->SetVector(m_hLightPositionView, avLightViewPosition);
+    m_pParams->SetVector(m_hLightIntensity, m_avLightIntensity);
+
+    // Store the old render target, the final pass draws into it
+    V( m_pd3dDevice->GetRenderTarget(0, &m_pSurfLDR) );
+    V( m_pd3dDevice->GetDepthStencilSurface( &m_pSurfDS ) );
+
+    // Where on screen the sun is, for the passes that only run around it
+    UpdateSunBounds( avLightViewPosition );
+
+    // Which of the heavy stages are redone this frame. The star is a frame
+    // behind the bloom, so the two don't come around together.
+    m_bRefreshBloom = !m_bHistoryValid || m_nFrame % m_nBloomInterval == 0;
+    m_bRefreshStar = !m_bHistoryValid || (m_nFrame + 1) % m_nStarInterval == 0;
+    m_bRefreshLuminance = !m_bHistoryValid || m_nFrame % m_nLuminanceInterval == 0;
+    m_bHistoryValid = true;
+    m_nFrame++;
+    if( m_bRefreshBloom )
+        m_mBloomView = mView;
+    if( m_bRefreshStar )
+        m_mStarView = mView;
+
+    // Run the passes that survived BuildGraph()
+    V( m_Graph.Execute( PostProcessCallback, this ) );
+
+    V( m_pd3dDevice->SetRenderTarget(0, m_pSurfLDR) );
+    V( StateCache::Get().SetRenderState(D3DRS_ZENABLE, TRUE) );
+
+    // Release surfaces
+    SAFE_RELEASE(m_pSurfLDR);
+    SAFE_RELEASE(m_pSurfDS);
+}
+
+
+//-----------------------------------------------------------------------------
+// Name: PostProcessCallback
+// Desc: Runs one pass of the post-processing graph
+//-----------------------------------------------------------------------------
+HRESULT CALLBACK HDRSun::PostProcessCallback(UINT nPassID, void* pUserContext)
+{
+    HDRSun* pSun = (HDRSun*)pUserContext;
+
+    // A stage that isn't due leaves what it drew before in its targets
+    if( !pSun->IsPassDue( nPassID ) )
+        return S_OK;
+
+    switch( nPassID )
+    {
+        case PASS_SCENE:        return pSun->RenderScenePass();
+        case PASS_SCALE:        return pSun->Scene_To_SceneScaled();
+        case PASS_LUMINANCE:    return pSun->MeasureLuminance();
+        case PASS_BRIGHTPASS:   return pSun->SceneScaled_To_BrightPass();
+        case PASS_STARSOURCE:   return pSun->BrightPass_To_StarSource();
+        case PASS_BLOOMSOURCE:  return pSun->StarSource_To_BloomSource();
+        case PASS_BLOOM:        return pSun->RenderBloom();
+        case PASS_STARMERGE:    return pSun->MergeStar();
+        case PASS_FINAL:        return pSun->FinalScenePass();
+
+        case PASS_ADAPTATION:
+            // If FrameMove has been called, the user's adaptation level has also changed
+            // and should be updated
+            if( !pSun->m_bAdaptationInvalid )
+                return S_OK;
+            pSun->m_bAdaptationInvalid = false;
+            return pSun->CalculateAdaptation();
+    }
+
+    if( nPassID >= PASS_BLOOMDOWN && nPassID < PASS_BLOOMUP )
+        return pSun->RenderBloomDownsample( nPassID - PASS_BLOOMDOWN );
+    if( nPassID >= PASS_BLOOMUP && nPassID < PASS_STARLINE )
+        return pSun->RenderBloomUpsample( nPassID - PASS_BLOOMUP );
+    if( nPassID >= PASS_STARLINE && nPassID < PASS_STARMERGE )
+        return pSun->RenderStarLine( nPassID - PASS_STARLINE );
+
+    return E_INVALIDARG;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// Name: IsPassDue
+// Desc: Whether a pass runs this frame. The bright pass and star source feed
+//       both the bloom and the star, and run when either is redone.
+//-----------------------------------------------------------------------------
+bool HDRSun::IsPassDue(UINT nPassID)
+{
+    switch( nPassID )
+    {
+        case PASS_LUMINANCE:    return m_bRefreshLuminance;
+        case PASS_BRIGHTPASS:   return m_bRefreshBloom || m_bRefreshStar;
+        case PASS_STARSOURCE:   return m_bRefreshStar || (m_bRefreshBloom && m_eBloomMode == BLOOM_GAUSSIAN);
+        case PASS_BLOOMSOURCE:
+        case PASS_BLOOM:        return m_bRefreshBloom;
+        case PASS_STARMERGE:    return m_bRefreshStar;
+    }
+
+    if( nPassID >= PASS_BLOOMDOWN && nPassID < PASS_STARLINE )
+        return m_bRefreshBloom;
+    if( nPassID >= PASS_STARLINE && nPassID < PASS_STARMERGE )
+        return m_bRefreshStar;
+
+    return true;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// Name: GetHistoryOffset
+// Desc: How far to move a bloom or star drawn with an earlier view so it sits
+//       on the sun again, in texture coordinates. The sun is the only thing
+//       they come from, so moving them with it is all the reprojection they
+//       need.
+//-----------------------------------------------------------------------------
+D3DXVECTOR2 HDRSun::GetHistoryOffset(const D3DXMATRIX& mHistoryView)
+{
+    D3DXVECTOR4 vThen, vNow;
+    D3DXVec4Transform( &vThen, &m_avLightPosition, &mHistoryView );
+    D3DXVec4Transform( &vNow, &m_avLightPosition, &m_mView );
+
+    // Behind the near plane the sun has no place on screen to follow
+    float fNear = m_mProjection._34 != 0.0f ? -m_mProjection._43 / m_mProjection._33 : 0.0f;
+    if( vThen.z <= fNear || vNow.z <= fNear )
+        return D3DXVECTOR2( 0.0f, 0.0f );
+
+    return ViewToCrop( D3DXVECTOR3( vThen.x, vThen.y, vThen.z ) ) -
+           ViewToCrop( D3DXVECTOR3( vNow.x, vNow.y, vNow.z ) );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// Name: ViewToCrop
+// Desc: Project a point in front of the camera into fractions of the cropped
+//       scene, left to right and top to bottom
+//-----------------------------------------------------------------------------
+D3DXVECTOR2 HDRSun::ViewToCrop(const D3DXVECTOR3& vView)
+{
+    D3DXVECTOR3 vProjected;
+    D3DXVec3TransformCoord( &vProjected, &vView, &m_mProjection );
+
+    // From clip space to scene pixels, then to the cropped part of the scene
+    float fCropLeft = (float)((m_dwSceneWidth - m_dwCropWidth) / 2);
+    float fCropTop = (float)((m_dwSceneHeight - m_dwCropHeight) / 2);
+    return D3DXVECTOR2( ((vProjected.x + 1.0f) * 0.5f * m_dwSceneWidth - fCropLeft) / m_dwCropWidth,
+                        ((1.0f - vProjected.y) * 0.5f * m_dwSceneHeight - fCropTop) / m_dwCropHeight );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// Name: UpdateSunBounds
+// Desc: Project the sun's sphere to find the rectangle it covers on screen, in
+//       fractions of the cropped scene. Post-processing is only bounded by it
+//       while the sun is small, and is skipped when the sun is off screen.
+//-----------------------------------------------------------------------------
+void HDRSun::UpdateSunBounds(const D3DXVECTOR4& vLightViewPosition)
+{
+    int i;
+
+    m_bSunBounded = false;
+    m_rcSun = s_rcFull;
+    if( !m_bBoundedPostProcess || m_mProjection._34 == 0.0f || m_dwCropWidth == 0 || m_dwCropHeight == 0 )
+        return;
+
+    // Distance to the near plane of the perspective projection
+    float fNear = -m_mProjection._43 / m_mProjection._33;
+    float fRadius = m_fRadius * SUN_SPHERE_SCALE;
+    const D3DXVECTOR4& v = vLightViewPosition;
+
+    // A sun behind the near plane leaves nothing to post-process. One the near
+    // plane cuts through can cover any part of the screen.
+    if( v.z + fRadius < fNear )
+    {
+        m_bSunBounded = true;
+        m_rcSun = s_rcEmpty;
+        return;
+    }
+    if( v.z - fRadius < fNear )
+        return;
+
+    // The projected corners of the cube around the sphere bound it on screen
+    CoordRect rc;
+    for( i=0; i < 8; i++ )
+    {
+        D3DXVECTOR3 vCorner( v.x + ((i & 1) ? fRadius : -fRadius),
+                             v.y + ((i & 2) ? fRadius : -fRadius),
+                             v.z + ((i & 4) ? fRadius : -fRadius) );
+        D3DXVECTOR2 vCrop = ViewToCrop( vCorner );
+
+        if( i == 0 )
+        {
+            rc.fLeftU = rc.fRightU = vCrop.x;
+            rc.fTopV = rc.fBottomV = vCrop.y;
+            continue;
+        }
+        rc.fLeftU = min( rc.fLeftU, vCrop.x );
+        rc.fTopV = min( rc.fTopV, vCrop.y );
+        rc.fRightU = max( rc.fRightU, vCrop.x );
+        rc.fBottomV = max( rc.fBottomV, vCrop.y );
+    }
+
+    rc.fLeftU = max( rc.fLeftU, 0.0f );
+    rc.fTopV = max( rc.fTopV, 0.0f );
+    rc.fRightU = min( rc.fRightU, 1.0f );
+    rc.fBottomV = min( rc.fBottomV, 1.0f );
+    if( IsEmptyBounds( rc ) )
+    {
+        m_bSunBounded = true;
+        m_rcSun = s_rcEmpty;
+        return;
+    }
+
+    // A large sun spreads the kernels over the whole screen anyway, and the
+    // clears would only add to the cost
+    if( (rc.fRightU - rc.fLeftU) * (rc.fBottomV - rc.fTopV) > SUN_BOUNDED_COVERAGE )
+        return;
+
+    m_bSunBounded = true;
+    m_rcSun = rc;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// Name: GrowBounds
+// Desc: Grow a rectangle in fractions of the cropped scene by a number of
+//       texels of a target dwDivisor times smaller than the crop. An empty
+//       rectangle stays empty.
+//-----------------------------------------------------------------------------
+CoordRect HDRSun::GrowBounds(const CoordRect& rc, float fTexelsU, float fTexelsV, DWORD dwDivisor)
+{
+    if( IsEmptyBounds( rc ) )
+        return rc;
+
+    float fU = fTexelsU * dwDivisor / m_dwCropWidth;
+    float fV = fTexelsV * dwDivisor / m_dwCropHeight;
+    CoordRect grown = { rc.fLeftU - fU, rc.fTopV - fV, rc.fRightU + fU, rc.fBottomV + fV };
+    return grown;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// Name: GetDrawnRect
+// Desc: The part of a target the passes may have left something other than
+//       black in. A target not seen before may hold anything. NULL when there
+//       are more targets than MAX_DRAWN_SURFACES.
+//-----------------------------------------------------------------------------
+RECT* HDRSun::GetDrawnRect(PDIRECT3DSURFACE9 pSurf)
+{
+    for( int i = 0; i < m_nDrawnSurfaces; i++ )
+    {
+        if( m_aDrawnSurfaces[i].pSurf == pSurf )
+            return &m_aDrawnSurfaces[i].rect;
+    }
+
+    D3DSURFACE_DESC desc;
+    if( m_nDrawnSurfaces == MAX_DRAWN_SURFACES || FAILED( pSurf->GetDesc( &desc ) ) )
+        return NULL;
+
+    DrawnSurface& drawn = m_aDrawnSurfaces[m_nDrawnSurfaces++];
+    drawn.pSurf = pSurf;
+    SetRect( &drawn.rect, 0, 0, desc.Width, desc.Height );
+    return &drawn.rect;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// Name: SetDrawnAll
+// Desc: For a pass that writes all of its target without GetPassRect(). The
+//       pool hands the same texture to targets whose lifetimes don't overlap,
+//       so a later pass on the same surface has to know that all of it may be
+//       other than black.
+//-----------------------------------------------------------------------------
+void HDRSun::SetDrawnAll(PDIRECT3DSURFACE9 pSurf)
+{
+    RECT* pRectDrawn = GetDrawnRect( pSurf );
+    D3DSURFACE_DESC desc;
+    if( pRectDrawn != NULL && SUCCEEDED( pSurf->GetDesc( &desc ) ) )
+        SetRect( pRectDrawn, 0, 0, desc.Width, desc.Height );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// Name: ClearOutside
+// Desc: Clear the part of rectClear outside rectKeep to black, as up to four
+//       bands around rectKeep
+//-----------------------------------------------------------------------------
+void HDRSun::ClearOutside(PDIRECT3DSURFACE9 pSurf, const RECT& rectClear, const RECT& rectKeep)
+{
+    RECT rectInside;
+    if( !IntersectRect( &rectInside, &rectClear, &rectKeep ) )
+    {
+        if( !IsRectEmpty( &rectClear ) )
+            m_pd3dDevice->ColorFill( pSurf, &rectClear, D3DCOLOR_ARGB(0, 0, 0, 0) );
+        return;
+    }
+
+    RECT aBands[4];
+    SetRect( &aBands[0], rectClear.left, rectClear.top, rectClear.right, rectInside.top );
+    SetRect( &aBands[1], rectClear.left, rectInside.bottom, rectClear.right, rectClear.bottom );
+    SetRect( &aBands[2], rectClear.left, rectInside.top, rectInside.left, rectInside.bottom );
+    SetRect( &aBands[3], rectInside.right, rectInside.top, rectClear.right, rectInside.bottom );
+    for( int i = 0; i < 4; i++ )
+    {
+        if( !IsRectEmpty( &aBands[i] ) )
+            m_pd3dDevice->ColorFill( pSurf, &aBands[i], D3DCOLOR_ARGB(0, 0, 0, 0) );
+    }
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// Name: GetPassRect
+// Desc: The part of rectDest a pass draws, which is all of it unless the
+//       post-processing is bounded by the sun this frame. Whatever earlier
+//       passes left in the target outside of it is cleared to black for the
+//       passes that read it, unless bClear is false because the pass adds to
+//       what is there. Only what was drawn since the last clear is cleared, so
+//       the cost follows the size of the sun. Returns false when there is
+//       nothing to draw.
+//-----------------------------------------------------------------------------
+bool HDRSun::GetPassRect(PDIRECT3DSURFACE9 pSurfDest, const RECT& rectDest, const CoordRect& rcBounds,
+                         bool bClear, RECT* pRectDraw)
+{
+    RECT* pRectDrawn = GetDrawnRect( pSurfDest );
+
+    *pRectDraw = rectDest;
+    if( !m_bSunBounded )
+    {
+        if( pRectDrawn != NULL )
+            UnionRect( pRectDrawn, pRectDrawn, &rectDest );
+        return true;
+    }
+
+    if( IsEmptyBounds( rcBounds ) )
+    {
+        SetRectEmpty( pRectDraw );
+    }
+    else
+    {
+        float fWidth = (float)(rectDest.right - rectDest.left);
+        float fHeight = (float)(rectDest.bottom - rectDest.top);
+
+        RECT rectBounds;
+        rectBounds.left = rectDest.left + (LONG)floorf( rcBounds.fLeftU * fWidth );
+        rectBounds.top = rectDest.top + (LONG)floorf( rcBounds.fTopV * fHeight );
+        rectBounds.right = rectDest.left + (LONG)ceilf( rcBounds.fRightU * fWidth );
+        rectBounds.bottom = rectDest.top + (LONG)ceilf( rcBounds.fBottomV * fHeight );
+        if( !IntersectRect( pRectDraw, &rectDest, &rectBounds ) )
+            SetRectEmpty( pRectDraw );
+    }
+
+    if( pRectDrawn == NULL )
+    {
+        if( bClear && !EqualRect( pRectDraw, &rectDest ) )
+            m_pd3dDevice->ColorFill( pSurfDest, NULL, D3DCOLOR_ARGB(0, 0, 0, 0) );
+    }
+    else if( bClear )
+    {
+        // The pass overwrites all of pRectDraw
+        ClearOutside( pSurfDest, *pRectDrawn, *pRectDraw );
+        *pRectDrawn = *pRectDraw;
+    }
+    else
+    {
+        UnionRect( pRectDrawn, pRectDrawn, pRectDraw );
+    }
+
+    return !IsRectEmpty( pRectDraw );
+}
+
+
+//-----------------------------------------------------------------------------
+// Name: RenderScenePass
+// Desc: Render the HDR scene into m_pTexScene
+//-----------------------------------------------------------------------------
+HRESULT HDRSun::RenderScenePass()
+{
+    HRESULT hr;
+    PDIRECT3DSURFACE9 pSurfHDR; // High dynamic range surface to store 
+                                // intermediate floating point color values
+
+    // Setup HDR render target
+    V_RETURN( m_pTexScene->GetSurfaceLevel(0, &pSurfHDR) );
+    if( m_bUseMultiSampleFloat16 )
+    {
+        V( m_pd3dDevice->SetRenderTarget(0, m_pFloatMSRT ) );
+        V( m_pd3dDevice->SetDepthStencilSurface( m_pFloatMSDS ) );
+    }
+    else
+    {
+        V( m_pd3dDevice->SetRenderTarget(0, pSurfHDR) );
+    }
+    
+    // Clear the viewport
+    V( m_pd3dDevice->Clear(0, NULL, D3DCLEAR_TARGET | D3DCLEAR_ZBUFFER, D3DCOLOR_RGBA(0, 0, 0, 0), 1.0f, 0));
+    SetDrawnAll( pSurfHDR );
+
+    // Render the HDR Scene
+    hr = RenderScene(m_mView);
+
+    // If using floating point multi sampling, stretchrect to the rendertarget
+    if( m_bUseMultiSampleFloat16 )
+    {
+        V( m_pd3dDevice->StretchRect( m_pFloatMSRT, NULL, pSurfHDR, NULL, D3DTEXF_NONE ) );
+        V( m_pd3dDevice->SetRenderTarget(0, pSurfHDR) );
+        V( m_pd3dDevice->SetDepthStencilSurface( m_pSurfDS ) );
+    }
+
+    SAFE_RELEASE(pSurfHDR);
+    return hr;
+}
+
+
+//-----------------------------------------------------------------------------
+// Name: FinalScenePass
+// Desc: Draw the high dynamic range scene texture to the low dynamic range
+//       back buffer. As part of this final pass, the scene will be tone-mapped
+//       using the user's current adapted luminance, blue shift will occur
+//       if the scene is determined to be very dark, and the post-process lighting
+//       effect textures will be added to the scene.
+//-----------------------------------------------------------------------------
+HRESULT HDRSun::FinalScenePass()
+{
+    HRESULT hr;
+    UINT uiPassCount, uiPass;
+    
+    V( m_pParams->SetFloat(m_hMiddleGray, m_fKeyValue) );
+
+    // A bloom or star from an earlier frame is moved to where the sun is now.
+    // Moved off the edge, they stretch the edge texels rather than wrap around.
+    D3DXVECTOR2 vBloomOffset = GetHistoryOffset( m_mBloomView );
+    D3DXVECTOR2 vStarOffset = GetHistoryOffset( m_mStarView );
+    V( m_pParams->SetValue(m_hBloomOffset, &vBloomOffset, sizeof(D3DXVECTOR2)) );
+    V( m_pParams->SetValue(m_hStarOffset, &vStarOffset, sizeof(D3DXVECTOR2)) );
+    m_Graph.SetSamplerState( 1, D3DSAMP_ADDRESSU, D3DTADDRESS_CLAMP );
+    m_Graph.SetSamplerState( 1, D3DSAMP_ADDRESSV, D3DTADDRESS_CLAMP );
+    m_Graph.SetSamplerState( 2, D3DSAMP_ADDRESSU, D3DTADDRESS_CLAMP );
+    m_Graph.SetSamplerState( 2, D3DSAMP_ADDRESSV, D3DTADDRESS_CLAMP );
+    
+    m_Graph.SetRenderTarget( m_pSurfLDR );
+    SetDrawnAll( m_pSurfLDR );
+    m_Graph.SetTexture( 0, m_pTexScene );
+    m_Graph.SetTexture( 1, m_apTexBloom[0] );
+    m_Graph.SetTexture( 2, m_apTexStar[0] );
+    m_Graph.SetTexture( 3, m_pTexAdaptedLuminanceCur );
+
+    // A smaller scene is stretched over the back buffer. RGBE texels can't be
+    // blended by the filter, so a packed scene stays point sampled.
+    const QualityTier& tier = s_aQualityTiers[m_eQualityTier];
+    DWORD dwSceneFilter = D3DTEXF_POINT;
+    if( tier.dwSceneDivisor > 1 && !tier.bPackedScene && m_bSupportsFilterFloat16 )
+        dwSceneFilter = D3DTEXF_LINEAR;
+    m_Graph.SetSamplerState( 0, D3DSAMP_MAGFILTER, dwSceneFilter );
+    m_Graph.SetSamplerState( 0, D3DSAMP_MINFILTER, dwSceneFilter );
+    m_Graph.SetSamplerState( 1, D3DSAMP_MAGFILTER, D3DTEXF_LINEAR );
+    m_Graph.SetSamplerState( 1, D3DSAMP_MINFILTER, D3DTEXF_LINEAR );
+    m_Graph.SetSamplerState( 2, D3DSAMP_MAGFILTER, D3DTEXF_LINEAR );
+    m_Graph.SetSamplerState( 2, D3DSAMP_MINFILTER, D3DTEXF_LINEAR );
+    m_Graph.SetSamplerState( 3, D3DSAMP_MAGFILTER, D3DTEXF_POINT );
+    m_Graph.SetSamplerState( 3, D3DSAMP_MINFILTER, D3DTEXF_POINT );
+    
+    V_RETURN( m_pEffect->Begin(&uiPassCount, 0) );
+
+    // We enable alpha blending so that in the case of drawing something in the backbuffer like
+    // a star map where z-buffering is disabled, we don't lose the information
+    m_Graph.SetRenderState(D3DRS_ALPHABLENDENABLE, TRUE);
+    for (uiPass = 0; uiPass < uiPassCount; uiPass++)
+    {
+        V( m_pEffect->BeginPass(uiPass) );
+            
+        DrawFullScreenQuad( 0.0f, 0.0f, 1.0f, 1.0f );
+
+        V( m_pEffect->EndPass() );
+    }
+    m_Graph.SetRenderState(D3DRS_ALPHABLENDENABLE, FALSE);
+
+    V( m_pEffect->End() );
+
+    m_Graph.SetTexture( 1, NULL );
+    m_Graph.SetTexture( 2, NULL );
+    m_Graph.SetTexture( 3, NULL );
+
+    return S_OK;
+}
+
+
+//-----------------------------------------------------------------------------
+// Name: RenderScene()
+// Desc: Render the world objects and lights
+//-----------------------------------------------------------------------------
+HRESULT HDRSun::RenderScene(D3DXMATRIX mView)
+{
+    HRESULT hr = S_OK;
+
+    UINT uiPassCount, uiPass;
+    D3DXMATRIXA16 mWorld;
+    D3DXMATRIXA16 mTrans;
+    D3DXMATRIXA16 mRotate;
+    D3DXMATRIXA16 mObjectToView;
+
+    StateCache::Get().SetSamplerState( 0, D3DSAMP_ADDRESSU, D3DTADDRESS_WRAP );
+    StateCache::Get().SetSamplerState( 0, D3DSAMP_ADDRESSV, D3DTADDRESS_WRAP );
+    
+    m_pEffect->SetTechnique( s_aQualityTiers[m_eQualityTier].bPackedScene ? m_hRenderSceneRGBE : m_hRenderScene );
+    m_pParams->SetMatrix(m_hObjectToView, mView);
+    
+    hr = m_pEffect->Begin(&uiPassCount, 0);
+    if( FAILED(hr) )
+        return hr;
+
+    for (uiPass = 0; uiPass < uiPassCount; uiPass++)
+    {
+        m_pEffect->BeginPass(uiPass);
+
+        // Turn off emissive lighting
+        D3DXVECTOR4 vNull( 0.0f, 0.0f, 0.0f, 0.0f );
+        m_pParams->SetVector(m_hEmissive, vNull); 
+        
+        //// Enable texture
+        //m_pParams->SetBool(m_hEnableTexture, true);
+        //m_pd3dDevice->SetSamplerState( 0, D3DSAMP_MAGFILTER, D3DTEXF_LINEAR );
+        //m_pd3dDevice->SetSamplerState( 0, D3DSAMP_MINFILTER, D3DTEXF_LINEAR );
+    
+
+        // Draw the light sphere.
+        m_pParams->SetFloat(m_hPhongExponent, 5.0f);
+        m_pParams->SetFloat(m_hPhongCoefficient, 1.0f);
+        m_pParams->SetFloat(m_hDiffuseCoefficient, 1.0f);
+        m_pParams->SetBool(m_hEnableTexture, false);
+        
+
+        // Just position the point light -- no need to orient it
+        D3DXMATRIXA16 mScale;
+        D3DXMatrixScaling( &mScale, SUN_SPHERE_SCALE, SUN_SPHERE_SCALE, SUN_SPHERE_SCALE );
+        
+        D3DXMatrixTranslation(&mWorld, m_avLightPosition.x, m_avLightPosition.y, m_avLightPosition.z);
+        mWorld = mScale * mWorld;
+        mObjectToView = mWorld * mView;
+        m_pParams->SetMatrix(m_hObjectToView, mObjectToView);
+
+        // A light which illuminates objects at 80 lum/sr should be drawn
+        // at 3183 lumens/meter^2/steradian, which equates to a multiplier
+        // of 39.78 per lumen.
+        D3DXVECTOR4 vEmissive = EMISSIVE_COEFFICIENT * m_avLightIntensity;
+        m_pParams->SetVector(m_hEmissive, vEmissive);    
+
+        m_pEffect->CommitChanges();
+        if (m_SphereCommands.IsRecorded())
+        {
+            StateCacheDevice device(m_pd3dDevice);
+            m_SphereCommands.Replay(&device);
+        }
+        else
+        {
+            m_pmeshSphere->DrawSubset(0);
+            StateCache::Get().CountDraws();
+        }
+ 
+        m_pEffect->EndPass();
+    }
+
+    m_pEffect->End();
+
+    return S_OK;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// Name: MeasureLuminance()
+// Desc: Measure the average log luminance in the scene.
+//-----------------------------------------------------------------------------
+HRESULT HDRSun::MeasureLuminance()
+{
+    HRESULT hr = S_OK;
+    UINT uiPassCount, uiPass;
+    int i, x, y, index;
+    D3DXVECTOR2 avSampleOffsets[MAX_SAMPLES];
+
+    
+    DWORD dwCurTexture = NUM_TONEMAP_TEXTURES-1;
+
+    // Sample log average luminance
+    PDIRECT3DSURFACE9 apSurfToneMap[NUM_TONEMAP_TEXTURES] = {0};
+
+    // Retrieve the tonemap surfaces, only the first one is there with the histogram
+    for( i=0; i < NUM_TONEMAP_TEXTURES; i++ )
+    {
+        if( m_apTexToneMap[i] == NULL )
+            continue;
+
+        hr = m_apTexToneMap[i]->GetSurfaceLevel( 0, &apSurfToneMap[i] );
+        if( FAILED(hr) )
+            goto LCleanReturn;
+    }
+
+    D3DSURFACE_DESC desc;
+    m_apTexToneMap[dwCurTexture]->GetLevelDesc( 0, &desc );
+
+    
+    // Initialize the sample offsets for the initial luminance pass.
+    float tU, tV;
+    tU = 1.0f / (3.0f * desc.Width);
+    tV = 1.0f / (3.0f * desc.Height);
+    
+    index=0;
+    for( x = -1; x <= 1; x++ )
+    {
+        for( y = -1; y <= 1; y++ )
+        {
+            avSampleOffsets[index].x = x * tU;
+            avSampleOffsets[index].y = y * tV;
+
+            index++;
+        }
+    }
+
+    
+    // After this pass, the m_apTexToneMap[NUM_TONEMAP_TEXTURES-1] texture will contain
+    // a scaled, grayscale copy of the HDR scene. Individual texels contain the log 
+    // of average luminance values for points sampled on the HDR texture.
+    m_pParams->SetValue(m_hSampleOffsets, avSampleOffsets, sizeof(avSampleOffsets));
+    
+    m_Graph.SetRenderTarget( apSurfToneMap[dwCurTexture] );
+    SetDrawnAll( apSurfToneMap[dwCurTexture] );
+    m_Graph.SetTexture(0, m_pTexSceneScaled);
+    m_Graph.SetSamplerState( 0, D3DSAMP_MAGFILTER, D3DTEXF_LINEAR );
+    m_Graph.SetSamplerState( 0, D3DSAMP_MINFILTER, D3DTEXF_LINEAR );
+    m_Graph.SetSamplerState( 1, D3DSAMP_MAGFILTER, D3DTEXF_LINEAR );
+    m_Graph.SetSamplerState( 1, D3DSAMP_MINFILTER, D3DTEXF_LINEAR );
+    
+    
+    hr = m_pEffect->Begin(&uiPassCount, 0);
+    if( FAILED(hr) )
+        goto LCleanReturn;
+
+    for (uiPass = 0; uiPass < uiPassCount; uiPass++)
+    {
+        m_pEffect->BeginPass(uiPass);
+
+        // Draw a fullscreen quad to sample the RT
+        DrawFullScreenQuad(0.0f, 0.0f, 1.0f, 1.0f);
+
+        m_pEffect->EndPass();
+    }
+
+    m_pEffect->End();
+
+    // The histogram is built from this texture on the CPU instead of scaling it down
+    if( m_eLuminanceMode == LUMINANCE_HISTOGRAM )
+    {
+        hr = ReadLuminanceHistogram( apSurfToneMap[dwCurTexture] );
+        goto LCleanReturn;
+    }
+
+    dwCurTexture--;
+    
+    // Initialize the sample offsets for the iterative luminance passes
+    while( dwCurTexture > 0 )
+    {
+        m_apTexToneMap[dwCurTexture+1]->GetLevelDesc( 0, &desc );
+        GetSampleOffsets_DownScale4x4( desc.Width, desc.Height, avSampleOffsets );
+    
+
+        // Each of these passes continue to scale down the log of average
+        // luminance texture created above, storing intermediate results in 
+        // m_apTexToneMap[1] through m_apTexToneMap[NUM_TONEMAP_TEXTURES-1].
+        m_Graph.SetTechnique("ResampleAvgLum");
+        m_pParams->SetValue(m_hSampleOffsets, avSampleOffsets, sizeof(avSampleOffsets));
+
+        m_Graph.SetRenderTarget( apSurfToneMap[dwCurTexture] );
+        SetDrawnAll( apSurfToneMap[dwCurTexture] );
+        m_Graph.SetTexture(0, m_apTexToneMap[dwCurTexture+1]);
+        m_Graph.SetSamplerState( 0, D3DSAMP_MAGFILTER, D3DTEXF_POINT );
+        m_Graph.SetSamplerState( 0, D3DSAMP_MINFILTER, D3DTEXF_POINT );
+    
+        
+        hr = m_pEffect->Begin(&uiPassCount, 0);
+        if( FAILED(hr) )
+            goto LCleanReturn;
+        
+        for (uiPass = 0; uiPass < uiPassCount; uiPass++)
+        {
+            m_pEffect->BeginPass(uiPass);
+
+            // Draw a fullscreen quad to sample the RT
+            DrawFullScreenQuad(0.0f, 0.0f, 1.0f, 1.0f);
+
+            m_pEffect->EndPass();
+        }
+
+        m_pEffect->End();
+        dwCurTexture--;
+    }
+
+    // Downsample to 1x1
+    m_apTexToneMap[1]->GetLevelDesc( 0, &desc );
+    GetSampleOffsets_DownScale4x4( desc.Width, desc.Height, avSampleOffsets );
+    
+ 
+    // Perform the final pass of the average luminance calculation. This pass
+    // scales the 4x4 log of average luminance texture from above and performs
+    // an exp() operation to return a single texel cooresponding to the average
+    // luminance of the scene in m_apTexToneMap[0].
+    m_Graph.SetTechnique("ResampleAvgLumExp");
+    m_pParams->SetValue(m_hSampleOffsets, avSampleOffsets, sizeof(avSampleOffsets));
+    
+    m_Graph.SetRenderTarget( apSurfToneMap[0] );
+    SetDrawnAll( apSurfToneMap[0] );
+    m_Graph.SetTexture(0, m_apTexToneMap[1]);
+    m_Graph.SetSamplerState( 0, D3DSAMP_MAGFILTER, D3DTEXF_POINT );
+    m_Graph.SetSamplerState( 0, D3DSAMP_MINFILTER, D3DTEXF_POINT );
+    
+     
+    hr = m_pEffect->Begin(&uiPassCount, 0);
+    if( FAILED(hr) )
+        goto LCleanReturn;
+
+    for (uiPass = 0; uiPass < uiPassCount; uiPass++)
+    {
+        m_pEffect->BeginPass(uiPass);
+
+        // Draw a fullscreen quad to sample the RT
+        DrawFullScreenQuad(0.0f, 0.0f, 1.0f, 1.0f);
+
+        m_pEffect->EndPass();
+    }
+
+    m_pEffect->End();
+ 
+
+    hr = S_OK;
+LCleanReturn:
+    for( i=0; i < NUM_TONEMAP_TEXTURES; i++ )
+    {
+        SAFE_RELEASE( apSurfToneMap[i] );
+    }
+
+    return hr;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// Name: CalculateAdaptation()
+// Desc: Increment the user's adapted luminance
+//-----------------------------------------------------------------------------
+HRESULT HDRSun::CalculateAdaptation()
+{
+    HRESULT hr = S_OK;
+    UINT uiPass, uiPassCount;
+
+    // Swap current & last luminance
+    PDIRECT3DTEXTURE9 pTexSwap = m_pTexAdaptedLuminanceLast;
+    m_pTexAdaptedLuminanceLast = m_pTexAdaptedLuminanceCur;
+    m_pTexAdaptedLuminanceCur = pTexSwap;
+    
+    PDIRECT3DSURFACE9 pSurfAdaptedLum = NULL;
+    V( m_pTexAdaptedLuminanceCur->GetSurfaceLevel(0, &pSurfAdaptedLum) );
+
+    // This simulates the light adaptation that occurs when moving from a 
+    // dark area to a bright area, or vice versa. The m_pTexAdaptedLuminance
+    // texture stores a single texel cooresponding to the user's adapted 
+    // level.
+    m_pParams->SetFloat(m_hElapsedTime, DXUTGetElapsedTime());
+    if( m_eLuminanceMode == LUMINANCE_HISTOGRAM )
+        m_pParams->SetFloat(m_hSceneLuminance, m_bToneMap ? m_fHistogramLuminance : 0.0f);
+    
+    m_Graph.SetRenderTarget( pSurfAdaptedLum );
+    SetDrawnAll( pSurfAdaptedLum );
+    m_Graph.SetTexture(0, m_pTexAdaptedLuminanceLast);
+    m_Graph.SetTexture(1, m_apTexToneMap[0]);
+    m_Graph.SetSamplerState( 0, D3DSAMP_MAGFILTER, D3DTEXF_POINT );
+    m_Graph.SetSamplerState( 0, D3DSAMP_MINFILTER, D3DTEXF_POINT );
+    m_Graph.SetSamplerState( 1, D3DSAMP_MAGFILTER, D3DTEXF_POINT );
+    m_Graph.SetSamplerState( 1, D3DSAMP_MINFILTER, D3DTEXF_POINT );
+
+    
+    V( m_pEffect->Begin(&uiPassCount, 0) );
+    
+    for (uiPass = 0; uiPass < uiPassCount; uiPass++)
+    {
+        m_pEffect->BeginPass(uiPass);
+
+        // Draw a fullscreen quad to sample the RT
+        DrawFullScreenQuad(0.0f, 0.0f, 1.0f, 1.0f);
+
+        m_pEffect->EndPass();
+    }
+    
+    m_pEffect->End();
+
+
+    SAFE_RELEASE( pSurfAdaptedLum );
+    return S_OK;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// Name: ReadLuminanceHistogram()
+// Desc: Copy the log luminance texture into the readback ring, and build the
+//       histogram from the copy made NUM_LUMINANCE_READBACKS frames ago if the
+//       GPU is done with it. The CPU never waits on the GPU, a copy that isn't
+//       ready by the time its slot comes around again is skipped.
+//-----------------------------------------------------------------------------
+HRESULT HDRSun::ReadLuminanceHistogram(PDIRECT3DSURFACE9 pSurfLogLum)
+{
+    HRESULT hr;
+    LuminanceReadback& readback = m_aReadback[m_iReadback];
+    m_iReadback = (m_iReadback + 1) % NUM_LUMINANCE_READBACKS;
+
+    if( readback.pTarget == NULL )
+        return E_FAIL;
+
+    if( readback.bPending &&
+        (readback.pQuery == NULL || readback.pQuery->GetData( NULL, 0, 0 ) == S_OK) &&
+        SUCCEEDED( m_pd3dDevice->GetRenderTargetData( readback.pTarget, readback.pSysMem ) ) )
+    {
+        D3DLOCKED_RECT lr;
+        if( SUCCEEDED( readback.pSysMem->LockRect( &lr, NULL, D3DLOCK_READONLY ) ) )
+        {
+            float afLogLum[HDR_TONEMAP_SIZE * HDR_TONEMAP_SIZE];
+            for( int y=0; y < HDR_TONEMAP_SIZE; y++ )
+            {
+                BYTE* pRow = (BYTE*)lr.pBits + y * lr.Pitch;
+                if( m_LuminanceFormat == D3DFMT_R16F )
+                    D3DXFloat16To32Array( afLogLum + y * HDR_TONEMAP_SIZE, (D3DXFLOAT16*)pRow, HDR_TONEMAP_SIZE );
+                else
+                    memcpy( afLogLum + y * HDR_TONEMAP_SIZE, pRow, HDR_TONEMAP_SIZE * sizeof(float) );
+            }
+            readback.pSysMem->UnlockRect();
+
+            WL::BuildLuminanceHistogram( afLogLum, HDR_TONEMAP_SIZE * HDR_TONEMAP_SIZE, &m_Histogram );
+            m_fHistogramLuminance = WL::GetHistogramLuminance( m_Histogram, m_fHistogramLow, m_fHistogramHigh );
+        }
+    }
+
+    V_RETURN( m_pd3dDevice->StretchRect( pSurfLogLum, NULL, readback.pTarget, NULL, D3DTEXF_NONE ) );
+    if( readback.pQuery )
+        readback.pQuery->Issue( D3DISSUE_END );
+    readback.bPending = true;
+
+    return S_OK;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// Name: BuildStarTables()
+// Desc: Work out the sample offsets and weights of every pass of every star
+//       line. They only depend on the glare definition and the size of the star
+//       source, which both only change along with the graph. Lines that come
+//       out black are left out.
+//-----------------------------------------------------------------------------
+void HDRSun::BuildStarTables(DWORD dwSrcWidth, DWORD dwSrcHeight)
+{
+    int d, i, p, s; // Loop variables
+
+    const CStarDef& starDef = m_GlareDef.m_starDef ;
+    const float fTanFoV = atanf(D3DX_PI/8) ;
+    static const int nSamples = 8 ;
+    static const D3DXCOLOR s_colorWhite(0.63f, 0.63f, 0.63f, 0.0f) ;
+    D3DXVECTOR4 aaColor[MAX_STAR_PASSES][8] ;
+
+    float srcW = (FLOAT) dwSrcWidth;
+    float srcH = (FLOAT) dwSrcHeight;
+
+    for (p = 0 ; p < MAX_STAR_PASSES ; p ++)
+    {
+        float ratio;
+        ratio = (float)(p + 1) / (float)MAX_STAR_PASSES ;
+        
+        for (s = 0 ; s < nSamples ; s ++)
+        {
+            D3DXCOLOR chromaticAberrColor ;
+            D3DXColorLerp(&chromaticAberrColor,
+                &( CStarDef::GetChromaticAberrationColor(s) ),
+                &s_colorWhite,
+                ratio) ;
+
+            D3DXColorLerp( (D3DXCOLOR*)&( aaColor[p][s] ),
+                &s_colorWhite, &chromaticAberrColor,
+                m_GlareDef.m_fChromaticAberration ) ;
+        }
+    }
+
+    float radOffset = m_GlareDef.m_fStarInclination + starDef.m_fInclination ;
+    int nStarLines = min( starDef.m_nStarLines, MAX_STAR_LINES );
+
+    // Added up as they are drawn, the lines are averaged by their last pass
+    float fLineWeight = m_bStarBlending && nStarLines > 0 ? 1.0f / nStarLines : 1.0f;
+
+    m_nStarLines = 0;
+    for (d = 0 ; d < nStarLines ; d ++)
+    {
+        CONST STARLINE& starLine = starDef.m_aStarLine[d] ;
+        StarLineTable& table = m_aStarLines[m_nStarLines] ;
+        table.nPasses = min( starLine.nPasses, MAX_STAR_PASSES );
+
+        float rad = radOffset + starLine.fInclination ;
+        float sn = sinf(rad), cs = cosf(rad) ;
+        D3DXVECTOR2 vtStepUV;
+        vtStepUV.x = sn / srcW * starLine.fSampleLength ;
+        vtStepUV.y = cs / srcH * starLine.fSampleLength ;
+        
+        float attnPowScale = (fTanFoV + 0.1f) * 1.0f *
+                             (160.0f + 120.0f) / (srcW + srcH) * 1.2f ;
+
+        // A pass without any weight leaves the whole line black
+        bool bVisible = table.nPasses > 0;
+        for (p = 0 ; p < table.nPasses ; p ++)
+        {
+            StarPassTable& pass = table.aPasses[p] ;
+            ZeroMemory( pass.avSampleOffsets, sizeof(pass.avSampleOffsets) );
+
+            float fScale = (p == table.nPasses - 1) ? fLineWeight : 1.0f;
+            bool bWeight = false;
+            for (i = 0 ; i < nSamples ; i ++)
+            {
+                float lum;
+                lum = powf( starLine.fAttenuation, attnPowScale * i );
+                
+                pass.avSampleWeights[i] = aaColor[table.nPasses - 1 - p][i] *
+                                lum * (p+1.0f) * 0.5f * fScale ;
+                
+                // Offset of sampling coordinate
+                pass.avSampleOffsets[i].x = vtStepUV.x * i ;
+                pass.avSampleOffsets[i].y = vtStepUV.y * i ;
+                if ( fabs(pass.avSampleOffsets[i].x) >= 0.9f ||
+                     fabs(pass.avSampleOffsets[i].y) >= 0.9f )
+                {
+                    pass.avSampleOffsets[i].x = 0.0f ;
+                    pass.avSampleOffsets[i].y = 0.0f ;
+                    pass.avSampleWeights[i] *= 0.0f ;
+                }
+
+                bWeight |= pass.avSampleWeights[i].x > 0.0f || pass.avSampleWeights[i].y > 0.0f ||
+                           pass.avSampleWeights[i].z > 0.0f;
+            }
+            bVisible &= bWeight;
+
+            // Setup next expansion
+            vtStepUV *= nSamples ;
+            attnPowScale *= nSamples ;
+        }
+
+        if (bVisible)
+            m_nStarLines++ ;
+    }
+
+    m_fStarMergeWeight = nStarLines > 0 ? 1.0f / nStarLines : 0.0f;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// Name: RenderStarLine()
+// Desc: Render one line of the star effect, expanding it over a few passes that
+//       ping-pong between m_apTexStar[1] and [2]. The last pass adds the line
+//       to m_apTexStar[0], or writes m_apTexStar[4+d] for MergeStar().
+//-----------------------------------------------------------------------------
+HRESULT HDRSun::RenderStarLine(int d)
+{
+    HRESULT hr = S_OK;
+    UINT uiPassCount, uiPass;
+    int i, p; // Loop variables
+    DWORD dwSrcBlend = D3DBLEND_ONE, dwDestBlend = D3DBLEND_ZERO;
+
+    const StarLineTable& table = m_aStarLines[d];
+    bool bBlend = m_bStarBlending && d > 0;
+
+    PDIRECT3DTEXTURE9 pTexSource = m_pTexStarSource;
+
+    // The last pass goes to the line's own texture, the others to the work textures
+    PDIRECT3DSURFACE9 apSurfDest[3] = {0};
+    for( i=0; i < 3; i++ )
+    {
+        hr = m_apTexStar[i == 0 ? (m_bStarBlending ? 0 : d+4) : i]->GetSurfaceLevel( 0, &apSurfDest[i] );
+        if( FAILED(hr) )
+            goto LCleanReturn;
+    }
+
+    // All the star textures have the size of the first one. The line starts from
+    // where the star source was drawn and grows along its samples.
+    RECT rectDest;
+    GetTextureRect( m_apTexStar[0], &rectDest );
+    CoordRect rcLine;
+    rcLine = m_rcStarSource;
+    if( d == 0 )
+        m_rcStar = s_rcEmpty;
+
+    // 1 direction expansion loop
+    m_Graph.SetRenderState(D3DRS_ALPHABLENDENABLE, FALSE) ;
+    
+    int iWorkTexture;
+    iWorkTexture = 1 ;
+    for (p = 0 ; p < table.nPasses ; p ++)
+    {
+        bool bLastPass = p == table.nPasses - 1;
+        PDIRECT3DSURFACE9 pSurfDest;
+        if (bLastPass)
+        {
+            // Last pass move to other work buffer
+            pSurfDest = apSurfDest[0];
+        }
+        else {
+            pSurfDest = apSurfDest[iWorkTexture];
+        }
+
+        m_pParams->SetValue(m_hSampleOffsets, table.aPasses[p].avSampleOffsets, sizeof(table.aPasses[p].avSampleOffsets));
+        m_pParams->SetVectorArray(m_hSampleWeights, table.aPasses[p].avSampleWeights, 8);
+
+        // A texel lights up when one of its samples lands where the source is lit,
+        // one texel further for the filter. Lines added to what is there don't clear.
+        CoordRect rcPass = rcLine;
+        if( !IsEmptyBounds( rcLine ) )
+        {
+            for (i = 0 ; i < 8 ; i ++)
+            {
+                const D3DXVECTOR2& vOffset = table.aPasses[p].avSampleOffsets[i];
+                rcPass.fLeftU = min( rcPass.fLeftU, rcLine.fLeftU - vOffset.x );
+                rcPass.fTopV = min( rcPass.fTopV, rcLine.fTopV - vOffset.y );
+                rcPass.fRightU = max( rcPass.fRightU, rcLine.fRightU - vOffset.x );
+                rcPass.fBottomV = max( rcPass.fBottomV, rcLine.fBottomV - vOffset.y );
+            }
+        }
+        rcLine = GrowBounds( rcPass, 1.0f, 1.0f, 4 );
+
+        RECT rectDraw;
+        bool bDraw = GetPassRect( pSurfDest, rectDest, rcLine, !(bLastPass && bBlend), &rectDraw );
+        
+        m_Graph.SetRenderTarget( pSurfDest );
+        m_Graph.SetTexture( 0, pTexSource );
+        m_Graph.SetSamplerState( 0, D3DSAMP_MAGFILTER, D3DTEXF_LINEAR );
+        m_Graph.SetSamplerState( 0, D3DSAMP_MINFILTER, D3DTEXF_LINEAR );
+
+        // Add the line to the ones drawn before it. The final pass blends with
+        // whatever blend state it finds, so that is put back afterwards.
+        if (bLastPass && bBlend)
+        {
+            StateCache::Get().GetRenderState( D3DRS_SRCBLEND, &dwSrcBlend );
+            StateCache::Get().GetRenderState( D3DRS_DESTBLEND, &dwDestBlend );
+            m_Graph.SetRenderState( D3DRS_SRCBLEND, D3DBLEND_ONE );
+            m_Graph.SetRenderState( D3DRS_DESTBLEND, D3DBLEND_ONE );
+            m_Graph.SetRenderState( D3DRS_ALPHABLENDENABLE, TRUE );
+        }
+        
+        hr = bDraw ? m_pEffect->Begin(&uiPassCount, 0) : S_OK;
+        if( bDraw && SUCCEEDED(hr) )
+        {
+            for (uiPass = 0; uiPass < uiPassCount; uiPass++)
+            {
+                m_pEffect->BeginPass(uiPass);
+
+                // Draw a fullscreen quad to sample the RT
+                DrawFullScreenQuad(0.0f, 0.0f, 1.0f, 1.0f, &rectDraw);
+
+                m_pEffect->EndPass();
+            }
+            
+            m_pEffect->End();
+        }
+
+        if (bLastPass && bBlend)
+        {
+            m_Graph.SetRenderState( D3DRS_ALPHABLENDENABLE, FALSE );
+            m_Graph.SetRenderState( D3DRS_SRCBLEND, dwSrcBlend );
+            m_Graph.SetRenderState( D3DRS_DESTBLEND, dwDestBlend );
+        }
+
+        if( FAILED(hr) )
+            goto LCleanReturn;
+
+        // Set the work drawn just before to next texture source.
+        pTexSource = m_apTexStar[iWorkTexture];
+
+        iWorkTexture += 1 ;
+        if (iWorkTexture > 2) {
+            iWorkTexture = 1 ;
+        }
+
+    }
+
+    m_rcStar = UnionBounds( m_rcStar, rcLine );
+
+    hr = S_OK;
+LCleanReturn:
+    for( i=0; i < 3; i++ )
+    {
+        SAFE_RELEASE( apSurfDest[i] );
+    }
+
+    return hr;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// Name: MergeStar()
+// Desc: Merge the star lines into m_apTexStar[0]
+//-----------------------------------------------------------------------------
+HRESULT HDRSun::MergeStar()
+{
+    HRESULT hr = S_OK;
+    UINT uiPassCount, uiPass;
+    int i;
+
+    const D3DXVECTOR4 vWhite( 1.0f, 1.0f, 1.0f, 1.0f );
+    D3DXVECTOR4 avSampleWeights[MAX_SAMPLES];
+
+    PDIRECT3DSURFACE9 pSurfDest = NULL;
+    hr = m_apTexStar[0]->GetSurfaceLevel( 0, &pSurfDest );
+    if( FAILED(hr) )
+        return hr;
+
+    // The lines left out as black still count in the average
+    for( i=0; i < m_nStarLines; i++ )
+    {
+        m_Graph.SetTexture( i, m_apTexStar[i+4] );
+        m_Graph.SetSamplerState( i, D3DSAMP_MAGFILTER, D3DTEXF_LINEAR );
+        m_Graph.SetSamplerState( i, D3DSAMP_MINFILTER, D3DTEXF_LINEAR );
+
+        avSampleWeights[i] = vWhite * m_fStarMergeWeight;
+    }
+
+    m_pParams->SetVectorArray(m_hSampleWeights, avSampleWeights, m_nStarLines);
+
+    // Only where one of the lines reaches
+    RECT rectDest, rectDraw;
+    GetTextureRect( m_apTexStar[0], &rectDest );
+    if( GetPassRect( pSurfDest, rectDest, m_rcStar, true, &rectDraw ) )
+    {
+        m_Graph.SetRenderTarget( pSurfDest );
+        
+        hr = m_pEffect->Begin(&uiPassCount, 0);
+        if( FAILED(hr) )
+            goto LCleanReturn;
+        
+        for (uiPass = 0; uiPass < uiPassCount; uiPass++)
+        {
+            m_pEffect->BeginPass(uiPass);
+
+            // Draw a fullscreen quad to sample the RT
+            DrawFullScreenQuad(0.0f, 0.0f, 1.0f, 1.0f, &rectDraw);
+
+            m_pEffect->EndPass();
+        }
+        
+        m_pEffect->End();
+    }
+
+    for( i=0; i < m_nStarLines; i++ )
+        m_Graph.SetTexture( i, NULL );
+
+    hr = S_OK;
+LCleanReturn:
+    SAFE_RELEASE( pSurfDest );
+    return hr;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// Name: RenderBloom()
+// Desc: Render the blooming effect
+//-----------------------------------------------------------------------------
+HRESULT HDRSun::RenderBloom()
+{
+    HRESULT hr = S_OK;
+    UINT uiPassCount, uiPass;
+    int i=0;
+
+
+    D3DXVECTOR2 avSampleOffsets[MAX_SAMPLES];
+    FLOAT       afSampleOffsets[MAX_SAMPLES];
+    D3DXVECTOR4 avSampleWeights[MAX_SAMPLES];
+
+    PDIRECT3DSURFACE9 pSurfBloom;
+    m_apTexBloom[0]->GetSurfaceLevel(0, &pSurfBloom);
+
+    PDIRECT3DSURFACE9 pSurfTempBloom;
+    m_apTexBloom[1]->GetSurfaceLevel(0, &pSurfTempBloom);
+
+    PDIRECT3DSURFACE9 pSurfBloomSource;
+    m_apTexBloom[2]->GetSurfaceLevel(0, &pSurfBloomSource);
+
+    // Every pass reaches further from the sun than the one before
+    CoordRect rcBloom;
+    RECT rectDraw;
+    bool bDraw;
+
+    RECT rectSrc;
+    GetTextureRect( m_pTexBloomSource, &rectSrc );
+    InflateRect( &rectSrc, -1, -1 );
+
+    RECT rectDest;
+    GetTextureRect( m_apTexBloom[2], &rectDest );
+    InflateRect( &rectDest, -1, -1 );
+
+    CoordRect coords;
+    GetTextureCoords( m_pTexBloomSource, &rectSrc, m_apTexBloom[2], &rectDest, &coords );
+   
+    D3DSURFACE_DESC desc;
+    hr = m_pTexBloomSource->GetLevelDesc( 0, &desc );
+    if( FAILED(hr) )
+        return hr;
+
+    hr = GetSampleOffsets_GaussBlur5x5( desc.Width, desc.Height, avSampleOffsets, avSampleWeights, 1.0f );
+
+    m_pParams->SetValue(m_hSampleOffsets, avSampleOffsets, sizeof(avSampleOffsets));
+    m_pParams->SetValue(m_hSampleWeights, avSampleWeights, sizeof(avSampleWeights));
+   
+    rcBloom = GrowBounds( m_rcBloomSource, 3.0f, 3.0f, 8 );
+    bDraw = GetPassRect( pSurfBloomSource, rectDest, rcBloom, true, &rectDraw );
+
+    m_Graph.SetRenderTarget( pSurfBloomSource );
+    m_Graph.SetTexture( 0, m_pTexBloomSource );
+    m_pd3dDevice->SetScissorRect( &rectDraw );
+    m_Graph.SetRenderState( D3DRS_SCISSORTESTENABLE, TRUE );
+    m_Graph.SetSamplerState( 0, D3DSAMP_MINFILTER, D3DTEXF_POINT );
+    m_Graph.SetSamplerState( 0, D3DSAMP_MAGFILTER, D3DTEXF_POINT );
+       
+    if( bDraw )
+    {
+        hr = m_pEffect->Begin(&uiPassCount, 0);
+        if( FAILED(hr) )
+            goto LCleanReturn;
+        
+        for (uiPass = 0; uiPass < uiPassCount; uiPass++)
+        {
+            m_pEffect->BeginPass(uiPass);
+
+            // Draw a fullscreen quad to sample the RT
+            DrawFullScreenQuad( coords, &rectDraw );
+
+            m_pEffect->EndPass();
+        }
+        m_pEffect->End();
+    }
+    m_Graph.SetRenderState( D3DRS_SCISSORTESTENABLE, FALSE );
+
+    hr = m_apTexBloom[2]->GetLevelDesc( 0, &desc );
+    if( FAILED(hr) )
+        return hr;
+
+    hr = GetSampleOffsets_Bloom( desc.Width, afSampleOffsets, avSampleWeights, 2.0f );
+    for( i=0; i < MAX_SAMPLES; i++ )
+    {
+        avSampleOffsets[i] = D3DXVECTOR2( afSampleOffsets[i], 0.0f );
+    }
+     
+
+    m_Graph.SetTechnique("Bloom");
+    m_pParams->SetValue(m_hSampleOffsets, avSampleOffsets, sizeof(avSampleOffsets));
+    m_pParams->SetValue(m_hSampleWeights, avSampleWeights, sizeof(avSampleWeights));
+   
+    // The 15 taps reach 7 texels to either side
+    rcBloom = GrowBounds( rcBloom, 8.0f, 0.0f, 8 );
+    bDraw = GetPassRect( pSurfTempBloom, rectDest, rcBloom, true, &rectDraw );
+
+    m_Graph.SetRenderTarget( pSurfTempBloom );
+    m_Graph.SetTexture( 0, m_apTexBloom[2] );
+    m_pd3dDevice->SetScissorRect( &rectDraw );
+    m_Graph.SetRenderState( D3DRS_SCISSORTESTENABLE, TRUE );
+    m_Graph.SetSamplerState( 0, D3DSAMP_MINFILTER, D3DTEXF_POINT );
+    m_Graph.SetSamplerState( 0, D3DSAMP_MAGFILTER, D3DTEXF_POINT );
+       
+    if( bDraw )
+    {
+        m_pEffect->Begin(&uiPassCount, 0);
+        for (uiPass = 0; uiPass < uiPassCount; uiPass++)
+        {
+            m_pEffect->BeginPass(uiPass);
+
+            // Draw a fullscreen quad to sample the RT
+            DrawFullScreenQuad( coords, &rectDraw );
+
+            m_pEffect->EndPass();
+        }
+        m_pEffect->End();
+    }
+    m_Graph.SetRenderState( D3DRS_SCISSORTESTENABLE, FALSE );
+    
+
+    hr = m_apTexBloom[1]->GetLevelDesc( 0, &desc );
+    if( FAILED(hr) )
+        return hr;
+
+    hr = GetSampleOffsets_Bloom( desc.Height, afSampleOffsets, avSampleWeights, 2.0f );
+    for( i=0; i < MAX_SAMPLES; i++ )
+    {
+        avSampleOffsets[i] = D3DXVECTOR2( 0.0f, afSampleOffsets[i] );
+    }
+
+    
+    GetTextureRect( m_apTexBloom[1], &rectSrc );
+    InflateRect( &rectSrc, -1, -1 );
+
+    GetTextureCoords( m_apTexBloom[1], &rectSrc, m_apTexBloom[0], NULL, &coords );
+
+    // The final bloom texture has no border
+    rcBloom = GrowBounds( rcBloom, 0.0f, 8.0f, 8 );
+    GetTextureRect( m_apTexBloom[0], &rectDest );
+    bDraw = GetPassRect( pSurfBloom, rectDest, rcBloom, true, &rectDraw );
+    if( !bDraw )
+        goto LCleanReturn;
+    
+    m_Graph.SetTechnique("Bloom");
+    m_pParams->SetValue(m_hSampleOffsets, avSampleOffsets, sizeof(avSampleOffsets));
+    m_pParams->SetValue(m_hSampleWeights, avSampleWeights, sizeof(avSampleWeights));
+    
+    m_Graph.SetRenderTarget( pSurfBloom );
+    m_Graph.SetTexture(0, m_apTexBloom[1]);
+   m_Graph.SetSamplerState( 0, D3DSAMP_MINFILTER, D3DTEXF_POINT );
+    m_Graph.SetSamplerState( 0, D3DSAMP_MAGFILTER, D3DTEXF_POINT );
+       
+   
+    hr = m_pEffect->Begin(&uiPassCount, 0);
+    if( FAILED(hr) )
+        goto LCleanReturn;
+
+    for (uiPass = 0; uiPass < uiPassCount; uiPass++)
+    {
+        m_pEffect->BeginPass(uiPass);
+
+        // Draw a fullscreen quad to sample the RT
+        DrawFullScreenQuad( coords, &rectDraw );
+
+        m_pEffect->EndPass();
+    }
+
+    m_pEffect->End();
+   
+  
+    hr = S_OK;
+
+LCleanReturn:
+    SAFE_RELEASE( pSurfBloomSource );
+    SAFE_RELEASE( pSurfTempBloom );
+    SAFE_RELEASE( pSurfBloom );
+    
+    return hr;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// Name: RenderBloomDownsample()
+// Desc: Scale one level of the dual filter bloom down by half, from the bright
+//       pass texture for the first level
+//-----------------------------------------------------------------------------
+HRESULT HDRSun::RenderBloomDownsample(int iLevel)
+{
+    HRESULT hr;
+    UINT uiPassCount, uiPass;
+    D3DXVECTOR2 avSampleOffsets[MAX_SAMPLES];
+    D3DXVECTOR4 avSampleWeights[MAX_SAMPLES];
+
+    PDIRECT3DTEXTURE9 pTexSrc = iLevel == 0 ? m_pTexBrightPass : m_apTexBloomDown[iLevel-1];
+    PDIRECT3DTEXTURE9 pTexDest = m_apTexBloomDown[iLevel];
+
+    // The bright pass texture has a black border, which keeps the edges of the
+    // screen from smearing into the bloom
+    RECT rectSrc;
+    GetTextureRect( pTexSrc, &rectSrc );
+    if( iLevel == 0 )
+        InflateRect( &rectSrc, -1, -1 );
+
+    CoordRect coords;
+    GetTextureCoords( pTexSrc, &rectSrc, pTexDest, NULL, &coords );
+
+    D3DSURFACE_DESC desc;
+    V_RETURN( pTexSrc->GetLevelDesc( 0, &desc ) );
+
+    GetSampleOffsets_BloomDownsample( desc.Width, desc.Height, avSampleOffsets, avSampleWeights );
+    m_pParams->SetValue(m_hSampleOffsets, avSampleOffsets, sizeof(avSampleOffsets));
+    m_pParams->SetValue(m_hSampleWeights, avSampleWeights, sizeof(avSampleWeights));
+
+    PDIRECT3DSURFACE9 pSurfDest;
+    V_RETURN( pTexDest->GetSurfaceLevel( 0, &pSurfDest ) );
+
+    // The bilinear taps reach a texel of the source past what it holds
+    m_arcBloomDown[iLevel] = GrowBounds( iLevel == 0 ? m_rcBrightPass : m_arcBloomDown[iLevel-1],
+                                         2.0f, 2.0f, 8 << iLevel );
+    RECT rectDest, rectDraw;
+    GetTextureRect( pTexDest, &rectDest );
+    bool bDraw = GetPassRect( pSurfDest, rectDest, m_arcBloomDown[iLevel], true, &rectDraw );
+
+    m_Graph.SetRenderTarget( pSurfDest );
+    m_Graph.SetTexture( 0, pTexSrc );
+    m_Graph.SetSamplerState( 0, D3DSAMP_MINFILTER, D3DTEXF_LINEAR );
+    m_Graph.SetSamplerState( 0, D3DSAMP_MAGFILTER, D3DTEXF_LINEAR );
+    m_Graph.SetSamplerState( 0, D3DSAMP_ADDRESSU, D3DTADDRESS_CLAMP );
+    m_Graph.SetSamplerState( 0, D3DSAMP_ADDRESSV, D3DTADDRESS_CLAMP );
+
+    hr = bDraw ? m_pEffect->Begin(&uiPassCount, 0) : S_OK;
+    if( bDraw && SUCCEEDED(hr) )
+    {
+        for (uiPass = 0; uiPass < uiPassCount; uiPass++)
+        {
+            m_pEffect->BeginPass(uiPass);
+            DrawFullScreenQuad( coords, &rectDraw );
+            m_pEffect->EndPass();
+        }
+        m_pEffect->End();
+    }
+
+    SAFE_RELEASE( pSurfDest );
+    return hr;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// Name: RenderBloomUpsample()
+// Desc: Blend a tent filtered copy of the level below into the downsample of
+//       this level. Level 0 ends in m_apTexBloom[0].
+//-----------------------------------------------------------------------------
+HRESULT HDRSun::RenderBloomUpsample(int iLevel)
+{
+    HRESULT hr;
+    UINT uiPassCount, uiPass;
+    D3DXVECTOR2 avSampleOffsets[MAX_SAMPLES];
+    D3DXVECTOR4 avSampleWeights[MAX_SAMPLES];
+
+    PDIRECT3DTEXTURE9 pTexSrc = iLevel == m_nBloomLevels-2 ? m_apTexBloomDown[iLevel+1] : m_apTexBloomUp[iLevel+1];
+    PDIRECT3DTEXTURE9 pTexDest = m_apTexBloomUp[iLevel];
+
+    D3DSURFACE_DESC desc;
+    V_RETURN( pTexSrc->GetLevelDesc( 0, &desc ) );
+
+    // Brightened only on the way into the final texture, to clip as little as
+    // possible in the 8 bit levels
+    GetSampleOffsets_BloomUpsample( desc.Width, desc.Height, avSampleOffsets, avSampleWeights,
+                                    iLevel == 0 ? HDR_DUAL_BLOOM_GAIN : 1.0f );
+    m_pParams->SetValue(m_hSampleOffsets, avSampleOffsets, sizeof(avSampleOffsets));
+    m_pParams->SetValue(m_hSampleWeights, avSampleWeights, sizeof(avSampleWeights));
+
+    PDIRECT3DSURFACE9 pSurfDest;
+    V_RETURN( pTexDest->GetSurfaceLevel( 0, &pSurfDest ) );
+
+    // The tent reaches a texel of the level below past what it holds
+    const CoordRect& rcSrc = iLevel == m_nBloomLevels-2 ? m_arcBloomDown[iLevel+1] : m_arcBloomUp[iLevel+1];
+    m_arcBloomUp[iLevel] = UnionBounds( m_arcBloomDown[iLevel], GrowBounds( rcSrc, 2.0f, 2.0f, 8 << (iLevel+1) ) );
+    RECT rectDest, rectDraw;
+    GetTextureRect( pTexDest, &rectDest );
+    bool bDraw = GetPassRect( pSurfDest, rectDest, m_arcBloomUp[iLevel], true, &rectDraw );
+
+    m_Graph.SetRenderTarget( pSurfDest );
+    m_Graph.SetTexture( 0, pTexSrc );
+    m_Graph.SetTexture( 1, m_apTexBloomDown[iLevel] );
+    m_Graph.SetSamplerState( 0, D3DSAMP_MINFILTER, D3DTEXF_LINEAR );
+    m_Graph.SetSamplerState( 0, D3DSAMP_MAGFILTER, D3DTEXF_LINEAR );
+    m_Graph.SetSamplerState( 0, D3DSAMP_ADDRESSU, D3DTADDRESS_CLAMP );
+    m_Graph.SetSamplerState( 0, D3DSAMP_ADDRESSV, D3DTADDRESS_CLAMP );
+    m_Graph.SetSamplerState( 1, D3DSAMP_MINFILTER, D3DTEXF_POINT );
+    m_Graph.SetSamplerState( 1, D3DSAMP_MAGFILTER, D3DTEXF_POINT );
+
+    hr = bDraw ? m_pEffect->Begin(&uiPassCount, 0) : S_OK;
+    if( bDraw && SUCCEEDED(hr) )
+    {
+        for (uiPass = 0; uiPass < uiPassCount; uiPass++)
+        {
+            m_pEffect->BeginPass(uiPass);
+            DrawFullScreenQuad( 0.0f, 0.0f, 1.0f, 1.0f, &rectDraw );
+            m_pEffect->EndPass();
+        }
+        m_pEffect->End();
+    }
+
+    m_Graph.SetTexture( 1, NULL );
+    SAFE_RELEASE( pSurfDest );
+    return hr;
+}
+
+
+
+//-----------------------------------------------------------------------------
+// Name: DrawFullScreenQuad
+// Desc: Draw a properly aligned quad covering the entire render target, or
+//       only the part of it in pRectDraw with the texture coordinates that
+//       part has in the whole quad
+//-----------------------------------------------------------------------------
+void HDRSun::DrawFullScreenQuad(float fLeftU, float fTopV, float fRightU, float fBottomV, const RECT* pRectDraw)
+{
+    D3DSURFACE_DESC dtdsdRT;
+
+    // Acquire render target width and height
+    m_Graph.GetRenderTargetDesc(&dtdsdRT);
+
+    FLOAT fLeft = 0.0f;
+    FLOAT fTop = 0.0f;
+    FLOAT fRight = (FLOAT)dtdsdRT.Width;
+    FLOAT fBottom = (FLOAT)dtdsdRT.Height;
+    if( pRectDraw != NULL )
+    {
+        FLOAT fTexelU = (fRightU - fLeftU) / fRight;
+        FLOAT fTexelV = (fBottomV - fTopV) / fBottom;
+
+        fLeft = (FLOAT)pRectDraw->left;
+        fTop = (FLOAT)pRectDraw->top;
+        fRight = (FLOAT)pRectDraw->right;
+        fBottom = (FLOAT)pRectDraw->bottom;
+
+        fRightU = fLeftU + fRight * fTexelU;
+        fBottomV = fTopV + fBottom * fTexelV;
+        fLeftU += fLeft * fTexelU;
+        fTopV += fTop * fTexelV;
+    }
+
+    // Ensure that we're directly mapping texels to pixels by offset by 0.5
+    // For more info see the doc page titled "Directly Mapping Texels to Pixels"
+    fLeft -= 0.5f;
+    fTop -= 0.5f;
+    fRight -= 0.5f;
+    fBottom -= 0.5f;
+
+    // Draw the quad
+    ScreenVertex svQuad[4];
+
+    svQuad[0].p = D3DXVECTOR4(fLeft, fTop, 0.5f, 1.0f);
+    svQuad[0].t = D3DXVECTOR2(fLeftU, fTopV);
+
+    svQuad[1].p = D3DXVECTOR4(fRight, fTop, 0.5f, 1.0f);
+    svQuad[1].t = D3DXVECTOR2(fRightU, fTopV);
+
+    svQuad[2].p = D3DXVECTOR4(fLeft, fBottom, 0.5f, 1.0f);
+    svQuad[2].t = D3DXVECTOR2(fLeftU, fBottomV);
+
+    svQuad[3].p = D3DXVECTOR4(fRight, fBottom, 0.5f, 1.0f);
+    svQuad[3].t = D3DXVECTOR2(fRightU, fBottomV);
+
+    // Depth stays off for the whole post-processing chain, Draw() turns it back on
+    m_Graph.SetRenderState(D3DRS_ZENABLE, FALSE);
+    m_pd3dDevice->SetFVF(ScreenVertex::FVF);
+    m_pd3dDevice->DrawPrimitiveUP(D3DPT_TRIANGLESTRIP, 2, svQuad, sizeof(ScreenVertex));
+    StateCache::Get().CountDraws();
+}
+
+
+//-----------------------------------------------------------------------------
+// Name: GetTextureRect()
+// Desc: Get the dimensions of the texture
+//-----------------------------------------------------------------------------
+HRESULT HDRSun::GetTextureRect( PDIRECT3DTEXTURE9 pTexture, RECT* pRect )
+{
+    HRESULT hr = S_OK;
+
+    if( pTexture == NULL || pRect == NULL )
+        return E_INVALIDARG;
+
+    D3DSURFACE_DESC desc;
+    hr = pTexture->GetLevelDesc( 0, &desc );
+    if( FAILED(hr) )
+        return hr;
+
+    pRect->left = 0;
+    pRect->top = 0;
+    pRect->right = desc.Width;
+    pRect->bottom = desc.Height;
+
+    return S_OK;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// Name: GetTextureCoords()
+// Desc: Get the texture coordinates to use when rendering into the destination
+//       texture, given the source and destination rectangles
+//-----------------------------------------------------------------------------
+HRESULT HDRSun::GetTextureCoords( PDIRECT3DTEXTURE9 pTexSrc, RECT* pRectSrc, 
+                          PDIRECT3DTEXTURE9 pTexDest, RECT* pRectDest, CoordRect* pCoords )
+{
+    HRESULT hr = S_OK;
+    D3DSURFACE_DESC desc;
+    float tU, tV;
+
+    // Validate arguments
+    if( pTexSrc == NULL || pTexDest == NULL || pCoords == NULL )
+        return E_INVALIDARG;
+
+    // Start with a default mapping of the complete source surface to complete 
+    // destination surface
+    pCoords->fLeftU = 0.0f;
+    pCoords->fTopV = 0.0f;
+    pCoords->fRightU = 1.0f; 
+    pCoords->fBottomV = 1.0f;
+
+    // If not using the complete source surface, adjust the coordinates
+    if( pRectSrc != NULL )
+    {
+        // Get destination texture description
+        hr = pTexSrc->GetLevelDesc( 0, &desc );
+        if( FAILED(hr) )
+            return hr;
+
+        // These delta values are the distance between source texel centers in 
+        // texture address space
+        tU = 1.0f / desc.Width;
+        tV = 1.0f / desc.Height;
+
+        pCoords->fLeftU += pRectSrc->left * tU;
+        pCoords->fTopV += pRectSrc->top * tV;
+        pCoords->fRightU -= (desc.Width - pRectSrc->right) * tU;
+        pCoords->fBottomV -= (desc.Height - pRectSrc->bottom) * tV;
+    }
+
+    // If not drawing to the complete destination surface, adjust the coordinates
+    if( pRectDest != NULL )
+    {
+        // Get source texture description
+        hr = pTexDest->GetLevelDesc( 0, &desc );
+        if( FAILED(hr) )
+            return hr;
+
+        // These delta values are the distance between source texel centers in 
+        // texture address space
+        tU = 1.0f / desc.Width;
+        tV = 1.0f / desc.Height;
+
+        pCoords->fLeftU -= pRectDest->left * tU;
+        pCoords->fTopV -= pRectDest->top * tV;
+        pCoords->fRightU += (desc.Width - pRectDest->right) * tU;
+        pCoords->fBottomV += (desc.Height - pRectDest->bottom) * tV;
+    }
+
+    return S_OK;
+}
+  
+
+
+
+//-----------------------------------------------------------------------------
+// Name: Scene_To_SceneScaled()
+// Desc: Scale down m_pTexScene by 1/4 x 1/4 and place the result in 
+//       m_pTexSceneScaled
+//-----------------------------------------------------------------------------
+HRESULT HDRSun::Scene_To_SceneScaled()
+{
+    HRESULT hr = S_OK;
+    D3DXVECTOR2 avSampleOffsets[MAX_SAMPLES];
+    
+   
+    // Get the new render target surface
+    PDIRECT3DSURFACE9 pSurfScaledScene = NULL;
+    hr = m_pTexSceneScaled->GetSurfaceLevel( 0, &pSurfScaledScene );
+    if( FAILED(hr) )
+        goto LCleanReturn;
+
+    // Create a 1/4 x 1/4 scale copy of the HDR texture. Since bloom textures
+    // are 1/8 x 1/8 scale, border texels of the HDR texture will be discarded 
+    // to keep the dimensions evenly divisible by 8; this allows for precise 
+    // control over sampling inside pixel shaders.
+
+    // Place the rectangle in the center of the scene surface
+    RECT rectSrc;
+    rectSrc.left = (m_dwSceneWidth - m_dwCropWidth) / 2;
+    rectSrc.top = (m_dwSceneHeight - m_dwCropHeight) / 2;
+    rectSrc.right = rectSrc.left + m_dwCropWidth;
+    rectSrc.bottom = rectSrc.top + m_dwCropHeight;
+
+    // Get the texture coordinates for the render target
+    CoordRect coords;
+    GetTextureCoords( m_pTexScene, &rectSrc, m_pTexSceneScaled, NULL, &coords );
+
+    // Get the sample offsets used within the pixel shader
+    GetSampleOffsets_DownScale4x4( m_dwSceneWidth, m_dwSceneHeight, avSampleOffsets );
+    m_pParams->SetValue(m_hSampleOffsets, avSampleOffsets, sizeof(avSampleOffsets));
+    
+    m_Graph.SetRenderTarget( pSurfScaledScene );
+    SetDrawnAll( pSurfScaledScene );
+    m_Graph.SetTexture( 0, m_pTexScene );
+    m_Graph.SetSamplerState( 0, D3DSAMP_MINFILTER, D3DTEXF_POINT );
+    m_Graph.SetSamplerState( 0, D3DSAMP_ADDRESSU, D3DTADDRESS_CLAMP );
+    m_Graph.SetSamplerState( 0, D3DSAMP_ADDRESSV, D3DTADDRESS_CLAMP );
+   
+    UINT uiPassCount, uiPass;       
+    hr = m_pEffect->Begin(&uiPassCount, 0);
+    if( FAILED(hr) )
+        goto LCleanReturn;
+
+    for (uiPass = 0; uiPass < uiPassCount; uiPass++)
+    {
+        m_pEffect->BeginPass(uiPass);
+
+        // Draw a fullscreen quad
+        DrawFullScreenQuad( coords );
+
+        m_pEffect->EndPass();
+    }
+
+    m_pEffect->End();
+    
+
+    hr = S_OK;
+LCleanReturn:
+    SAFE_RELEASE( pSurfScaledScene );
+    return hr;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// Name: SceneScaled_To_BrightPass
+// Desc: Run the bright-pass filter on m_pTexSceneScaled and place the result
+//       in m_pTexBrightPass
+//-----------------------------------------------------------------------------
+HRESULT HDRSun::SceneScaled_To_BrightPass()
+{
+    HRESULT hr = S_OK;
+
+    D3DXVECTOR2 avSampleOffsets[MAX_SAMPLES];
+    D3DXVECTOR4 avSampleWeights[MAX_SAMPLES];
+
+    
+    // Get the new render target surface
+    PDIRECT3DSURFACE9 pSurfBrightPass;
+    hr = m_pTexBrightPass->GetSurfaceLevel( 0, &pSurfBrightPass );
+    if( FAILED(hr) )
+        goto LCleanReturn;
+
+    
+    D3DSURFACE_DESC desc;
+    m_pTexSceneScaled->GetLevelDesc( 0, &desc );    
+
+    // Get the rectangle describing the sampled portion of the source texture.
+    // Decrease the rectangle to adjust for the single pixel black border.
+    RECT rectSrc;
+    GetTextureRect( m_pTexSceneScaled, &rectSrc );
+    InflateRect( &rectSrc, -1, -1 );
+
+    // Get the destination rectangle.
+    // Decrease the rectangle to adjust for the single pixel black border.
+    RECT rectDest;
+    GetTextureRect( m_pTexBrightPass, &rectDest );
+    InflateRect( &rectDest, -1, -1 );
+
+    // Get the correct texture coordinates to apply to the rendered quad in order 
+    // to sample from the source rectangle and render into the destination rectangle
+    CoordRect coords;
+    GetTextureCoords( m_pTexSceneScaled, &rectSrc, m_pTexBrightPass, &rectDest, &coords );
+
+    // The sun is the only light in the scene, the rest of the target stays black
+    m_rcBrightPass = GrowBounds( m_rcSun, 1.0f, 1.0f, 4 );
+    RECT rectDraw;
+    if( !GetPassRect( pSurfBrightPass, rectDest, m_rcBrightPass, true, &rectDraw ) )
+        goto LCleanReturn;
+
+    // The bright-pass filter removes everything from the scene except lights and
+    // bright reflections
+
+    m_Graph.SetRenderTarget( pSurfBrightPass );
+    m_Graph.SetTexture( 0, m_pTexSceneScaled );
+    m_Graph.SetTexture( 1, m_pTexAdaptedLuminanceCur );
+    m_Graph.SetRenderState( D3DRS_SCISSORTESTENABLE, TRUE );
+    m_pd3dDevice->SetScissorRect( &rectDraw );
+    m_Graph.SetSamplerState( 0, D3DSAMP_MINFILTER, D3DTEXF_POINT );
+    m_Graph.SetSamplerState( 0, D3DSAMP_MAGFILTER, D3DTEXF_POINT );
+    m_Graph.SetSamplerState( 1, D3DSAMP_MINFILTER, D3DTEXF_POINT );
+    m_Graph.SetSamplerState( 1, D3DSAMP_MAGFILTER, D3DTEXF_POINT );
+       
+    UINT uiPass, uiPassCount;
+    hr = m_pEffect->Begin(&uiPassCount, 0);
+    if( FAILED(hr) )
+        goto LCleanReturn;
+    
+    for (uiPass = 0; uiPass < uiPassCount; uiPass++)
+    {
+        m_pEffect->BeginPass(uiPass);
+
+        // Draw a fullscreen quad to sample the RT
+        DrawFullScreenQuad( coords, &rectDraw );
+
+        m_pEffect->EndPass();
+    }
+    
+    m_pEffect->End();
+    m_Graph.SetRenderState( D3DRS_SCISSORTESTENABLE, FALSE );
+
+    hr = S_OK;
+LCleanReturn:
+    SAFE_RELEASE( pSurfBrightPass );
+    return hr;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// Name: BrightPass_To_StarSource
+// Desc: Perform a 5x5 gaussian blur on m_pTexBrightPass and place the result
+//       in m_pTexStarSource. The bright-pass filtered image is blurred before
+//       being used for star operations to avoid aliasing artifacts.
+//-----------------------------------------------------------------------------
+HRESULT HDRSun::BrightPass_To_StarSource()
+{
+    HRESULT hr = S_OK;
+
+    D3DXVECTOR2 avSampleOffsets[MAX_SAMPLES];
+    D3DXVECTOR4 avSampleWeights[MAX_SAMPLES];
+
+    // Get the new render target surface
+    PDIRECT3DSURFACE9 pSurfStarSource;
+    hr = m_pTexStarSource->GetSurfaceLevel( 0, &pSurfStarSource );
+    if( FAILED(hr) )
+        goto LCleanReturn;
+
+    
+    // Get the destination rectangle.
+    // Decrease the rectangle to adjust for the single pixel black border.
+    RECT rectDest;
+    GetTextureRect( m_pTexStarSource, &rectDest );
+    InflateRect( &rectDest, -1, -1 );
+
+    // Get the correct texture coordinates to apply to the rendered quad in order 
+    // to sample from the source rectangle and render into the destination rectangle
+    CoordRect coords;
+    GetTextureCoords( m_pTexBrightPass, NULL, m_pTexStarSource, &rectDest, &coords );
+
+    // Get the sample offsets used within the pixel shader
+    D3DSURFACE_DESC desc;
+    hr = m_pTexBrightPass->GetLevelDesc( 0, &desc );
+    if( FAILED(hr) )
+        return hr;
+
+    
+    GetSampleOffsets_GaussBlur5x5( desc.Width, desc.Height, avSampleOffsets, avSampleWeights );
+    m_pParams->SetValue(m_hSampleOffsets, avSampleOffsets, sizeof(avSampleOffsets));
+    m_pParams->SetValue(m_hSampleWeights, avSampleWeights, sizeof(avSampleWeights));
+
+    // The blur reaches two texels past the bright pass
+    m_rcStarSource = GrowBounds( m_rcBrightPass, 3.0f, 3.0f, 4 );
+    RECT rectDraw;
+    if( !GetPassRect( pSurfStarSource, rectDest, m_rcStarSource, true, &rectDraw ) )
+        goto LCleanReturn;
+    
+    // The gaussian blur smooths out rough edges to avoid aliasing effects
+    // when the star effect is run
+
+    m_Graph.SetRenderTarget( pSurfStarSource );
+    m_Graph.SetTexture( 0, m_pTexBrightPass );
+    m_pd3dDevice->SetScissorRect( &rectDraw );
+    m_Graph.SetRenderState( D3DRS_SCISSORTESTENABLE, TRUE );
+    m_Graph.SetSamplerState( 0, D3DSAMP_MINFILTER, D3DTEXF_POINT );
+    m_Graph.SetSamplerState( 0, D3DSAMP_ADDRESSU, D3DTADDRESS_CLAMP );
+    m_Graph.SetSamplerState( 0, D3DSAMP_ADDRESSV, D3DTADDRESS_CLAMP );
+   
+    UINT uiPassCount, uiPass;       
+    hr = m_pEffect->Begin(&uiPassCount, 0);
+    if( FAILED(hr) )
+        goto LCleanReturn;
+
+    for (uiPass = 0; uiPass < uiPassCount; uiPass++)
+    {
+        m_pEffect->BeginPass(uiPass);
+
+        // Draw a fullscreen quad
+        DrawFullScreenQuad( coords, &rectDraw );
+
+        m_pEffect->EndPass();
+    }
+
+    m_pEffect->End();
+    m_Graph.SetRenderState( D3DRS_SCISSORTESTENABLE, FALSE );
+
+  
+    hr = S_OK;
+LCleanReturn:
+    SAFE_RELEASE( pSurfStarSource);
+    return hr;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// Name: StarSource_To_BloomSource
+// Desc: Scale down m_pTexStarSource by 1/2 x 1/2 and place the result in 
+//       m_pTexBloomSource
+//-----------------------------------------------------------------------------
+HRESULT HDRSun::StarSource_To_BloomSource()
+{
+    HRESULT hr = S_OK;
+
+    D3DXVECTOR2 avSampleOffsets[MAX_SAMPLES];
+    
+    // Get the new render target surface
+    PDIRECT3DSURFACE9 pSurfBloomSource;
+    hr = m_pTexBloomSource->GetSurfaceLevel( 0, &pSurfBloomSource );
+    if( FAILED(hr) )
+        goto LCleanReturn;
+
+    
+    // Get the rectangle describing the sampled portion of the source texture.
+    // Decrease the rectangle to adjust for the single pixel black border.
+    RECT rectSrc;
+    GetTextureRect( m_pTexStarSource, &rectSrc );
+    InflateRect( &rectSrc, -1, -1 );
+
+    // Get the destination rectangle.
+    // Decrease the rectangle to adjust for the single pixel black border.
+    RECT rectDest;
+    GetTextureRect( m_pTexBloomSource, &rectDest );
+    InflateRect( &rectDest, -1, -1 );
+
+    // Get the correct texture coordinates to apply to the rendered quad in order 
+    // to sample from the source rectangle and render into the destination rectangle
+    CoordRect coords;
+    GetTextureCoords( m_pTexStarSource, &rectSrc, m_pTexBloomSource, &rectDest, &coords );
+
+    // Get the sample offsets used within the pixel shader
+    D3DSURFACE_DESC desc;
+    hr = m_pTexBrightPass->GetLevelDesc( 0, &desc );
+    if( FAILED(hr) )
+        return hr;
+
+    GetSampleOffsets_DownScale2x2( desc.Width, desc.Height, avSampleOffsets );
+    m_pParams->SetValue(m_hSampleOffsets, avSampleOffsets, sizeof(avSampleOffsets));
+
+    m_rcBloomSource = GrowBounds( m_rcStarSource, 1.0f, 1.0f, 8 );
+    RECT rectDraw;
+    if( !GetPassRect( pSurfBloomSource, rectDest, m_rcBloomSource, true, &rectDraw ) )
+        goto LCleanReturn;
+
+    // Create an exact 1/2 x 1/2 copy of the source texture
+
+    m_Graph.SetRenderTarget( pSurfBloomSource );
+    m_Graph.SetTexture( 0, m_pTexStarSource );
+    m_pd3dDevice->SetScissorRect( &rectDraw );
+    m_Graph.SetRenderState( D3DRS_SCISSORTESTENABLE, TRUE );
+    m_Graph.SetSamplerState( 0, D3DSAMP_MINFILTER, D3DTEXF_POINT );
+    m_Graph.SetSamplerState( 0, D3DSAMP_ADDRESSU, D3DTADDRESS_CLAMP );
+    m_Graph.SetSamplerState( 0, D3DSAMP_ADDRESSV, D3DTADDRESS_CLAMP );
+   
+    UINT uiPassCount, uiPass;       
+    hr = m_pEffect->Begin(&uiPassCount, 0);
+    if( FAILED(hr) )
+        goto LCleanReturn;
+
+    for (uiPass = 0; uiPass < uiPassCount; uiPass++)
+    {
+        m_pEffect->BeginPass(uiPass);
+
+        // Draw a fullscreen quad
+        DrawFullScreenQuad( coords, &rectDraw );
+
+        m_pEffect->EndPass();
+    }
+
+    m_pEffect->End();
+    m_Graph.SetRenderState( D3DRS_SCISSORTESTENABLE, FALSE );
+
+
+    
+    hr = S_OK;
+LCleanReturn:
+    SAFE_RELEASE( pSurfBloomSource);
+    return hr;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// Name: GetSampleOffsets_DownScale4x4
+// Desc: Get the texture coordinate offsets to be used inside the DownScale4x4
+//       pixel shader.
+//-----------------------------------------------------------------------------
+HRESULT HDRSun::GetSampleOffsets_DownScale4x4( DWORD dwWidth, DWORD dwHeight, D3DXVECTOR2 avSampleOffsets[] )
+{
+    if( NULL == avSampleOffsets )
+        return E_INVALIDARG;
+
+    float tU = 1.0f / dwWidth;
+    float tV = 1.0f / dwHeight;
+
+    // Sample from the 16 surrounding points. Since the center point will be in
+    // the exact center of 16 texels, a 0.5f offset is needed to specify a texel
+    // center.
+    int index=0;
+    for( int y=0; y < 4; y++ )
+    {
+        for( int x=0; x < 4; x++ )
+        {
+            avSampleOffsets[ index ].x = (x - 1.5f) * tU;
+            avSampleOffsets[ index ].y = (y - 1.5f) * tV;
+                                                      
+            index++;
+        }
+    }
+
+    return S_OK;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// Name: GetSampleOffsets_DownScale2x2
+// Desc: Get the texture coordinate offsets to be used inside the DownScale2x2
+//       pixel shader.
+//-----------------------------------------------------------------------------
+HRESULT HDRSun::GetSampleOffsets_DownScale2x2( DWORD dwWidth, DWORD dwHeight, D3DXVECTOR2 avSampleOffsets[] )
+{
+    if( NULL == avSampleOffsets )
+        return E_INVALIDARG;
+
+    float tU = 1.0f / dwWidth;
+    float tV = 1.0f / dwHeight;
+
+    // Sample from the 4 surrounding points. Since the center point will be in
+    // the exact center of 4 texels, a 0.5f offset is needed to specify a texel
+    // center.
+    int index=0;
+    for( int y=0; y < 2; y++ )
+    {
+        for( int x=0; x < 2; x++ )
+        {
+            avSampleOffsets[ index ].x = (x - 0.5f) * tU;
+            avSampleOffsets[ index ].y = (y - 0.5f) * tV;
+                                                      
+            index++;
+        }
+    }
+
+    return S_OK;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// Name: GetSampleOffsets_BloomDownsample
+// Desc: Get the texture coordinate offsets to be used inside the BloomDownsample
+//       pixel shader. The four samples sit on the corners between source texels,
+//       so with linear filtering they average a 4x4 block.
+//-----------------------------------------------------------------------------
+HRESULT HDRSun::GetSampleOffsets_BloomDownsample( DWORD dwWidth, DWORD dwHeight,
+                                                  D3DXVECTOR2* avTexCoordOffset,
+                                                  D3DXVECTOR4* avSampleWeights )
+{
+    float tU = 1.0f / dwWidth;
+    float tV = 1.0f / dwHeight;
+
+    int index=0;
+    for( int y=-1; y <= 1; y += 2 )
+    {
+        for( int x=-1; x <= 1; x += 2 )
+        {
+            avTexCoordOffset[index] = D3DXVECTOR2( x * tU, y * tV );
+            avSampleWeights[index] = D3DXVECTOR4( 0.25f, 0.25f, 0.25f, 0.25f );
+            index++;
+        }
+    }
+
+    return S_OK;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// Name: GetSampleOffsets_BloomUpsample
+// Desc: Get the texture coordinate offsets to be used inside the BloomUpsample
+//       pixel shader: a 3x3 tent over the level below, for half of the result.
+//       The last weight is for the level's own downsample, the other half.
+//-----------------------------------------------------------------------------
+HRESULT HDRSun::GetSampleOffsets_BloomUpsample( DWORD dwWidth, DWORD dwHeight,
+                                                D3DXVECTOR2* avTexCoordOffset,
+                                                D3DXVECTOR4* avSampleWeights,
+                                                FLOAT fMultiplier )
+{
+    float tU = 1.0f / dwWidth;
+    float tV = 1.0f / dwHeight;
+
+    int index=0;
+    for( int y=-1; y <= 1; y++ )
+    {
+        for( int x=-1; x <= 1; x++ )
+        {
+            float weight = fMultiplier * (2 - abs(x)) * (2 - abs(y)) / 32.0f;
+            avTexCoordOffset[index] = D3DXVECTOR2( x * tU, y * tV );
+            avSampleWeights[index] = D3DXVECTOR4( weight, weight, weight, weight );
+            index++;
+        }
+    }
+
+    float weight = 0.5f * fMultiplier;
+    avTexCoordOffset[index] = D3DXVECTOR2( 0.0f, 0.0f );
+    avSampleWeights[index] = D3DXVECTOR4( weight, weight, weight, weight );
+
+    return S_OK;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// Name: GetSampleOffsets_GaussBlur5x5
+// Desc: Get the texture coordinate offsets to be used inside the GaussBlur5x5
+//       pixel shader.
+//-----------------------------------------------------------------------------
+HRESULT HDRSun::GetSampleOffsets_GaussBlur5x5(DWORD dwD3DTexWidth,
+                                                         DWORD dwD3DTexHeight,
+                                                         D3DXVECTOR2* avTexCoordOffset,
+                                                         D3DXVECTOR4* avSampleWeight,
+                                                         FLOAT fMultiplier )
+{
+    float tu = 1.0f / (float)dwD3DTexWidth ;
+    float tv = 1.0f / (float)dwD3DTexHeight ;
+
+    // The kernel approximates a 5x5 Gaussian with 13 samples instead of 25, since
+    // 2.0 shaders only support 16 texture grabs. Its weights already add up to 1.0f
+    // so that the blur keeps the intensity of the image; an optional multiplier
+    // variable is used to add or remove image intensity during the blur.
+    for( int i=0; i < 13; i++ )
+    {
+        const WL::KernelSample& sample = WL::HDR_GAUSS_BLUR_5X5_KERNEL[i];
+        float weight = sample.fWeight * fMultiplier;
+
+        avTexCoordOffset[i] = D3DXVECTOR2( sample.x * tu, sample.y * tv );
+        avSampleWeight[i] = D3DXVECTOR4( weight, weight, weight, weight );
+    }
+
+    return S_OK;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// Name: GetSampleOffsets_Bloom
+// Desc: Get the texture coordinate offsets to be used inside the Bloom
+//       pixel shader. The weights come from WL::HDR_BLOOM_KERNEL.
+//-----------------------------------------------------------------------------
+HRESULT HDRSun::GetSampleOffsets_Bloom( DWORD dwD3DTexSize,
+                                                   float afTexCoordOffset[15],
+                                                   D3DXVECTOR4* avColorWeight,
+                                                   float fMultiplier )
+{
+    int i=0;
+    float tu = 1.0f / (float)dwD3DTexSize;
+
+    // Fill the first half, starting with the center texel
+    for( i=0; i < 8; i++ )
+    {
+        float weight = fMultiplier * WL::HDR_BLOOM_KERNEL[i];
+        afTexCoordOffset[i] = i * tu;
+
+        avColorWeight[i] = D3DXVECTOR4( weight, weight, weight, 1.0f );
+    }
+
+    // Mirror to the second half
+    for( i=8; i < 15; i++ )
+    {
+        avColorWeight[i] = avColorWeight[i-7];
+        afTexCoordOffset[i] = -afTexCoordOffset[i-7];
+    }
+
+    return S_OK;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// Name: SetLuminanceMode
+// Desc: Switch between the averaging passes and the histogram. The graph and
+//       the readback surfaces depend on it, so the device objects are rebuilt.
+//-----------------------------------------------------------------------------
+void HDRSun::SetLuminanceMode(ELuminanceMode eMode)
+{
+    if( eMode == m_eLuminanceMode )
+        return;
+
+    m_eLuminanceMode = eMode;
+    if( m_pd3dDevice )
+    {
+        OnLostDevice();
+        OnResetDevice();
+    }
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// Name: SetBloomMode
+// Desc: Switch between the Gaussian and the dual filter bloom. Like the luminance
+//       mode, it takes a new graph.
+//-----------------------------------------------------------------------------
+void HDRSun::SetBloomMode(EBloomMode eMode)
+{
+    if( eMode == m_eBloomMode )
+        return;
+
+    m_eBloomMode = eMode;
+    if( m_pd3dDevice )
+    {
+        OnLostDevice();
+        OnResetDevice();
+    }
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// Name: SetQualityTier
+// Desc: Switch to another quality tier. The scene target, the multisampled
+//       surfaces and the graph are all released and built again for it.
+//-----------------------------------------------------------------------------
+void HDRSun::SetQualityTier(EQualityTier eTier)
+{
+    if( eTier == m_eQualityTier || eTier < 0 || eTier >= NUM_QUALITY_TIERS )
+        return;
+
+    m_eQualityTier = eTier;
+    if( m_pd3dDevice )
+    {
+        OnLostDevice();
+        OnResetDevice();
+    }
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// Name: GetQualityTierDesc
+// Desc: What a quality tier renders
+//-----------------------------------------------------------------------------
+const HDRSun::QualityTier& HDRSun::GetQualityTierDesc(EQualityTier eTier)
+{
+    return s_aQualityTiers[eTier];
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// Name: GetSunCoverage
+// Desc: Part of the cropped scene the sun's rectangle covered last frame, all
+//       of it when the post-processing wasn't bounded
+//-----------------------------------------------------------------------------
+float HDRSun::GetSunCoverage() const
+{
+    if( !m_bSunBounded )
+        return 1.0f;
+    if( IsEmptyBounds( m_rcSun ) )
+        return 0.0f;
+
+    return (m_rcSun.fRightU - m_rcSun.fLeftU) * (m_rcSun.fBottomV - m_rcSun.fTopV);
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// Name: SetRefreshIntervals
+// Desc: Set how often the bloom and star are redrawn and the luminance is
+//       measured. Their targets are only kept between frames when they are
+//       reused, so the graph is rebuilt when that changes.
+//-----------------------------------------------------------------------------
+void HDRSun::SetRefreshIntervals(int nBloom, int nStar, int nLuminance)
+{
+    nBloom = max( nBloom, 1 );
+    nStar = max( nStar, 1 );
+    nLuminance = max( nLuminance, 1 );
+
+    bool bRebuild = (nBloom > 1) != (m_nBloomInterval > 1) ||
+                    (nStar > 1) != (m_nStarInterval > 1) ||
+                    (nLuminance > 1) != (m_nLuminanceInterval > 1);
+
+    m_nBloomInterval = nBloom;
+    m_nStarInterval = nStar;
+    m_nLuminanceInterval = nLuminance;
+    if( bRebuild && m_pd3dDevice )
+    {
+        OnLostDevice();
+        OnResetDevice();
+    }
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// Name: GetBloomPassCosts
+// Desc: The bloom passes of the current mode at the current size
+//-----------------------------------------------------------------------------
+int HDRSun::GetBloomPassCosts(WL::BloomPassCost* aCosts, int nMaxCosts)
+{
+    return WL::GetBloomPassCosts( m_eBloomMode == BLOOM_DUAL_FILTER, m_nBloomLevels,
+                                  m_dwCropWidth / 8, m_dwCropHeight / 8, aCosts, nMaxCosts );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// Name: GetReferenceSettings
+// Desc: Fill in the effect parameters and star lines the way Draw() uses them,
+//       for the CPU version of the post-processing in WL::HDRReference
+//-----------------------------------------------------------------------------
+void HDRSun::GetReferenceSettings(WL::HDRReferenceSettings* pSettings)
+{
+    const CStarDef& starDef = m_GlareDef.m_starDef;
+
+    pSettings->fMiddleGray = m_fKeyValue;
+    pSettings->fElapsedTime = DXUTGetElapsedTime();
+    pSettings->fBloomScale = m_fBloomScale;
+    pSettings->fStarScale = m_fStarScale;
+    pSettings->bToneMap = m_bToneMap;
+    pSettings->bBlueShift = m_bBlueShift;
+    pSettings->bBloom = m_GlareDef.m_fGlareLuminance > 0.0f && m_GlareDef.m_fBloomLuminance > 0.0f;
+    pSettings->bStar = m_GlareDef.m_fGlareLuminance > 0.0f && m_GlareDef.m_fStarLuminance > 0.0f &&
+                       s_aQualityTiers[m_eQualityTier].bStar;
+    pSettings->bDualFilterBloom = m_eBloomMode == BLOOM_DUAL_FILTER;
+    pSettings->bHistogram = m_eLuminanceMode == LUMINANCE_HISTOGRAM;
+    pSettings->fHistogramLow = m_fHistogramLow;
+    pSettings->fHistogramHigh = m_fHistogramHigh;
+
+    pSettings->fStarInclination = m_GlareDef.m_fStarInclination + starDef.m_fInclination;
+    pSettings->fChromaticAberration = m_GlareDef.m_fChromaticAberration;
+    pSettings->nStarLines = min( starDef.m_nStarLines, min( MAX_STAR_LINES, HDR_MAX_STAR_LINES ) );
+    for( int i=0; i < pSettings->nStarLines; i++ )
+    {
+        pSettings->aStarLines[i].nPasses = starDef.m_aStarLine[i].nPasses;
+        pSettings->aStarLines[i].fSampleLength = starDef.m_aStarLine[i].fSampleLength;
+        pSettings->aStarLines[i].fAttenuation = starDef.m_aStarLine[i].fAttenuation;
+        pSettings->aStarLines[i].fInclination = starDef.m_aStarLine[i].fInclination;
+    }
+}
+
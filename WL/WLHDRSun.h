@@ -1,188 +1,432 @@
-#ifndef _WLHDRSUN_H_
-#define _WLHDRSUN_H_
-
-#include "dxstdafx.h"
-#include "glaredefd3d.h"
-#include "WL.h"
-
-//-----------------------------------------------------------------------------
-// Constants and custom types
-//-----------------------------------------------------------------------------
-#define MAX_SAMPLES           16      // Maximum number of texture grabs
-
-#define NUM_LIGHTS            2       // Number of lights in the scene
-
-#define EMISSIVE_COEFFICIENT  39.78f  // Emissive color multiplier for each lumen
-                                      // of light intensity                                    
-#define NUM_TONEMAP_TEXTURES  4       // Number of stages in the 4x4 down-scaling 
-                                      // of average luminance textures
-#define NUM_STAR_TEXTURES     12      // Number of textures used for the star
-                                      // post-processing effect
-#define NUM_BLOOM_TEXTURES    3       // Number of textures used for the bloom
-                                      // post-processing effect
-                                    
-// Texture coordinate rectangle
-struct CoordRect
-{
-    float fLeftU, fTopV;
-    float fRightU, fBottomV;
-};
-
-
-// Screen quad vertex format
-struct ScreenVertex
-{
-    D3DXVECTOR4 p; // position
-    D3DXVECTOR2 t; // texture coordinate
-
-    static const DWORD FVF;
-};
-
-class HDRSun 
-{
-public:
-	//
-	//	Constructor
-	//
-	HDRSun(	float x, float y, float z,					// The World Coordinates of the sun
-			float radius, int stacks, int slices,		// Sun's sphere geometry info
-			D3DXMATRIX mProjection,						// Camera Projection Matrix, will be set in the shader
-			float BloomScale = 3.0f,					// Scale of the bloom effect
-			float StarScale = 0.5f,						// Scale of the star effect
-			int LightIntensity = 52,					// Light intensity of the sun, must be 0..100
-			float BloomIntensity = 28.0f);				// Intensity for the bloom effect
-
-	//
-	//	Destructor
-	//
-	~HDRSun();
-
-	//
-	//	Render the sun
-	//
-	void Draw(D3DXMATRIX mView);
-
-	//
-	//	Handle device changes
-	//
-	HRESULT OnCreateDevice();
-	HRESULT OnResetDevice();
-	void OnLostDevice();
-	void OnDestroyDevice();
-	void ResetMatrices();
-
-private:
-	//--------------------------------------------------------------------------------------
-	// Private member variables
-	//--------------------------------------------------------------------------------------
-	IDirect3DDevice9*   m_pd3dDevice;					// D3D Device object
-
-	ID3DXEffect*        m_pEffect;						// D3DX effect interface
-	D3DFORMAT           m_LuminanceFormat;				// Format to use for luminance map
-
-	PDIRECT3DSURFACE9	m_pFloatMSRT;					// Multi-Sample float render target
-	PDIRECT3DSURFACE9	m_pFloatMSDS;					// Depth Stencil surface for the float RT
-	PDIRECT3DTEXTURE9	m_pTexScene;					// HDR render target containing the scene
-	PDIRECT3DTEXTURE9	m_pTexSceneScaled;				// Scaled copy of the HDR scene
-	PDIRECT3DTEXTURE9	m_pTexBrightPass;				// Bright-pass filtered copy of the scene
-	PDIRECT3DTEXTURE9	m_pTexAdaptedLuminanceCur;		// The luminance that the user is currenly adapted to
-	PDIRECT3DTEXTURE9	m_pTexAdaptedLuminanceLast;		// The luminance that the user is currenly adapted to
-	PDIRECT3DTEXTURE9	m_pTexStarSource;				// Star effect source texture
-	PDIRECT3DTEXTURE9	m_pTexBloomSource;				// Bloom effect source texture
-
-
-	PDIRECT3DTEXTURE9	m_apTexBloom[NUM_BLOOM_TEXTURES];		// Blooming effect working textures
-	PDIRECT3DTEXTURE9	m_apTexStar[NUM_STAR_TEXTURES];			// Star effect working textures
-	PDIRECT3DTEXTURE9	m_apTexToneMap[NUM_TONEMAP_TEXTURES];	// Log average luminance samples 
-																// from the HDR render target
-
-	LPD3DXMESH			m_pmeshSphere;					// Representation of point light
-
-	CGlareDef			m_GlareDef;						// Glare defintion
-	EGLARELIBTYPE		m_eGlareType;					// Enumerated glare type
-
-	D3DXVECTOR4			m_avLightPosition;				// Light positions in world space
-	D3DXVECTOR4			m_avLightIntensity;				// Light floating point intensities
-	int					m_nLightLogIntensity;			// Light intensities on a log scale
-	int					m_nLightMantissa;				// Mantissa of the light intensity
-
-	DWORD				m_dwCropWidth;					// Width of the cropped scene texture
-	DWORD				m_dwCropHeight;					// Height of the cropped scene texture
-
-	float				m_fKeyValue;					// Middle gray key value for tone mapping
-
-	bool				m_bToneMap;						// True when scene is to be tone mapped            
-	bool				m_bBlueShift;					// True when blue shift is to be factored in
-	bool				m_bAdaptationInvalid;			// True when adaptation level needs refreshing
-	bool				m_bUseMultiSampleFloat16;		// True when using multisampling on a floating point back buffer
-	D3DMULTISAMPLE_TYPE m_MaxMultiSampleType;			// Non-Zero when m_bUseMultiSampleFloat16 is true
-	DWORD				m_dwMultiSampleQuality;			// Non-Zero when we have multisampling on a float backbuffer
-	bool				m_bSupportsD16;
-	bool				m_bSupportsD32;
-	bool				m_bSupportsD24X8;
-
-	D3DXMATRIX			m_mView;
-	D3DXMATRIX			m_mProjection;
-	float				m_fRadius;						// Sun's sphere radius
-	int					m_fStacks;
-	int					m_fSlices;
-	float				m_fBloomScale;
-	float				m_fStarScale;
-
-
-private:
-	//--------------------------------------------------------------------------------------
-	// Private methods
-	//--------------------------------------------------------------------------------------
-
-	// Post-processing source textures creation
-	HRESULT Scene_To_SceneScaled();
-	HRESULT SceneScaled_To_BrightPass();
-	HRESULT BrightPass_To_StarSource();
-	HRESULT StarSource_To_BloomSource();
-
-	// Post-processing helper functions
-	HRESULT GetTextureRect( PDIRECT3DTEXTURE9 pTexture, RECT* pRect );
-	HRESULT GetTextureCoords( PDIRECT3DTEXTURE9 pTexSrc, RECT* pRectSrc, PDIRECT3DTEXTURE9 pTexDest, RECT* pRectDest, CoordRect* pCoords );
-
-	// Sample offset calculation. These offsets are passed to corresponding
-	// pixel shaders.
-	HRESULT GetSampleOffsets_GaussBlur5x5(DWORD dwD3DTexWidth, DWORD dwD3DTexHeight, D3DXVECTOR2* avTexCoordOffset, D3DXVECTOR4* avSampleWeights, FLOAT fMultiplier = 1.0f );
-	HRESULT GetSampleOffsets_Bloom(DWORD dwD3DTexSize, float afTexCoordOffset[15], D3DXVECTOR4* avColorWeight, float fDeviation, FLOAT fMultiplier=1.0f);    
-	HRESULT GetSampleOffsets_Star(DWORD dwD3DTexSize, float afTexCoordOffset[15], D3DXVECTOR4* avColorWeight, float fDeviation);    
-	HRESULT GetSampleOffsets_DownScale4x4( DWORD dwWidth, DWORD dwHeight, D3DXVECTOR2 avSampleOffsets[] );
-	HRESULT GetSampleOffsets_DownScale2x2( DWORD dwWidth, DWORD dwHeight, D3DXVECTOR2 avSampleOffsets[] );
-
-	// Tone mapping and post-process lighting effects
-	HRESULT MeasureLuminance();
-	HRESULT CalculateAdaptation();
-	HRESULT RenderStar();
-	HRESULT RenderBloom();
-
-	// Methods to control scene lights
-	HRESULT AdjustLight(bool bIncrement); 
-	HRESULT RefreshLights();
-
-	HRESULT RenderScene(D3DXMATRIX mView);
-	void    RenderText();
-	HRESULT ClearTexture( LPDIRECT3DTEXTURE9 pTexture );
-
-	VOID    DrawFullScreenQuad(float fLeftU, float fTopV, float fRightU, float fBottomV);
-	VOID    DrawFullScreenQuad(CoordRect c) { DrawFullScreenQuad( c.fLeftU, c.fTopV, c.fRightU, c.fBottomV ); }
-
-	inline float GaussianDistribution( float x, float y, float rho )
-	{
-		float g = 1.0f / sqrtf( 2.0f * D3DX_PI * rho * rho );
-		g *= expf( -(x*x + y*y)/(2*rho*rho) );
-
-		return g;
-	}
-
-	inline bool SUCCESS(HRESULT hr) { return (hr >= 0); }
-	inline bool FAILURE(HRESULT hr) { return (hr < 0); }
-//	inline void VERIFY(HRESULT hr) { if( FAILURE(hr) ) { DXUTTrace( __FILE__, (DWORD)__LINE__, hr, L"Failed Verification", true ); } }
-	
-};
-
-
+#ifndef _WLHDRSUN_H_
+#define _WLHDRSUN_H_
+
+#include "dxstdafx.h"
+#include "glaredefd3d.h"
+#include "WLPostProcessGraph.h"
+#include "WLHDRReference.h"
+#include "WLEffectParams.h"
+#include "WL.h"
+
+//-----------------------------------------------------------------------------
+// Constants and custom types
+//-----------------------------------------------------------------------------
+#define MAX_SAMPLES           16      // Maximum number of texture grabs
+
+#define NUM_LIGHTS            2       // Number of lights in the scene
+
+#define EMISSIVE_COEFFICIENT  39.78f  // Emissive color multiplier for each lumen
+                                      // of light intensity                                    
+#define NUM_TONEMAP_TEXTURES  4       // Number of stages in the 4x4 down-scaling 
+                                      // of average luminance textures
+#define NUM_STAR_TEXTURES     12      // Number of textures used for the star
+                                      // post-processing effect
+#define NUM_BLOOM_TEXTURES    3       // Number of textures used for the bloom
+                                      // post-processing effect
+#define MAX_STAR_LINES        8       // Most star lines there is a MergeTextures
+                                      // technique for
+#define MAX_STAR_PASSES       3       // Passes a star line expands over
+#define NUM_LUMINANCE_READBACKS 3     // Frames the luminance histogram lags behind
+#define SUN_SPHERE_SCALE      0.05f   // RenderScene() draws the sphere this much smaller
+#define SUN_BOUNDED_COVERAGE  0.25f   // Largest part of the screen the sun covers while
+                                      // post-processing stays around it
+#define BLOOM_REFRESH_INTERVAL 2      // Frames between redrawing the bloom,
+#define STAR_REFRESH_INTERVAL  3      // the star
+#define LUMINANCE_REFRESH_INTERVAL 4  // and measuring the scene luminance
+#define MAX_DRAWN_SURFACES    48      // Targets GetPassRect() knows the drawn part of
+                                    
+// Texture coordinate rectangle
+struct CoordRect
+{
+    float fLeftU, fTopV;
+    float fRightU, fBottomV;
+};
+
+
+// Screen quad vertex format
+struct ScreenVertex
+{
+    D3DXVECTOR4 p; // position
+    D3DXVECTOR2 t; // texture coordinate
+
+    static const DWORD FVF;
+};
+
+class HDRSun 
+{
+public:
+	//
+	//	How the scene luminance for tone mapping is measured
+	//
+	enum ELuminanceMode
+	{
+		LUMINANCE_AVERAGE,			// Average log luminance, scaled down on the GPU
+		LUMINANCE_HISTOGRAM			// Histogram read back, average of the middle part
+	};
+
+	//
+	//	How the bloom is blurred
+	//
+	enum EBloomMode
+	{
+		BLOOM_GAUSSIAN,				// Fixed 5x5 and 15 tap passes at 1/8 size
+		BLOOM_DUAL_FILTER			// Pyramid of 4 tap downsamples and tent upsamples
+	};
+
+	//
+	//	What the HDR scene costs, from the best looking to the cheapest
+	//
+	enum EQualityTier
+	{
+		QUALITY_HIGH,				// Full size FP16 scene, multisampled, bloom and star
+		QUALITY_MEDIUM,				// Half size FP16 scene, bloom and star
+		QUALITY_LOW,				// Quarter size RGBE scene, bloom only
+		NUM_QUALITY_TIERS
+	};
+
+	struct QualityTier
+	{
+		LPCWSTR		strName;
+		DWORD		dwSceneDivisor;				// Scene target is the back buffer over this
+		bool		bPackedScene;				// RGBE in A8R8G8B8 instead of A16B16G16R16F
+		bool		bMultiSample;				// Multisample the scene where the device can
+		bool		bStar;
+	};
+
+	//
+	//	Constructor
+	//
+	HDRSun(	float x, float y, float z,					// The World Coordinates of the sun
+			float radius, int stacks, int slices,		// Sun's sphere geometry info
+			D3DXMATRIX mProjection,						// Camera Projection Matrix, will be set in the shader
+			float BloomScale = 3.0f,					// Scale of the bloom effect
+			float StarScale = 0.5f,						// Scale of the star effect
+			int LightIntensity = 52,					// Light intensity of the sun, must be 0..100
+			float BloomIntensity = 28.0f);				// Intensity for the bloom effect
+
+	//
+	//	Destructor
+	//
+	~HDRSun();
+
+	//
+	//	Render the sun
+	//
+	void Draw(D3DXMATRIX mView);
+
+	//
+	//	Handle device changes
+	//
+	HRESULT OnCreateDevice();
+	HRESULT OnResetDevice();
+	void OnLostDevice();
+	void OnDestroyDevice();
+	void ResetMatrices();
+
+	inline const RenderTargetPool::Stats& GetTargetStats() const { return m_Graph.GetTargetStats(); }
+	inline const PostProcessGraph::Stats& GetGraphStats() const { return m_Graph.GetStats(); }
+
+	//
+	//	What WL::HDRReference needs to run the same post-processing on the CPU
+	//
+	void GetReferenceSettings(WL::HDRReferenceSettings* pSettings);
+
+	void SetLuminanceMode(ELuminanceMode eMode);
+	inline ELuminanceMode GetLuminanceMode() const { return m_eLuminanceMode; }
+	inline float GetHistogramLuminance() const { return m_fHistogramLuminance; }
+
+	void SetBloomMode(EBloomMode eMode);
+	inline EBloomMode GetBloomMode() const { return m_eBloomMode; }
+	inline int GetBloomLevels() const { return m_nBloomLevels; }
+
+	//
+	//	Switching tiers rebuilds the scene target and the graph
+	//
+	void SetQualityTier(EQualityTier eTier);
+	inline EQualityTier GetQualityTier() const { return m_eQualityTier; }
+	static const QualityTier& GetQualityTierDesc(EQualityTier eTier);
+	inline DWORD GetSceneWidth() const { return m_dwSceneWidth; }
+	inline DWORD GetSceneHeight() const { return m_dwSceneHeight; }
+	inline bool IsMultiSampled() const { return m_bUseMultiSampleFloat16; }
+
+	//
+	//	While the sun is small on screen, the bright pass, bloom and star only run over
+	//	its rectangle and as far around it as their kernels reach. The rest of their
+	//	targets is cleared.
+	//
+	inline void SetBoundedPostProcess(bool bBounded) { m_bBoundedPostProcess = bBounded; }
+	inline bool GetBoundedPostProcess() const { return m_bBoundedPostProcess; }
+	inline bool IsSunBounded() const { return m_bSunBounded; }
+	float GetSunCoverage() const;						// Part of the screen the sun's rectangle covers
+
+	//
+	//	The bloom and star are redrawn every few frames and moved along with the sun in
+	//	between, and the scene luminance is measured every few frames. An interval of 1
+	//	redoes them every frame.
+	//
+	void SetRefreshIntervals(int nBloom, int nStar, int nLuminance);
+	inline int GetBloomInterval() const { return m_nBloomInterval; }
+	inline int GetStarInterval() const { return m_nStarInterval; }
+	inline int GetLuminanceInterval() const { return m_nLuminanceInterval; }
+
+	//
+	//	GPU time of every stage of the graph, a few frames old
+	//
+	inline UINT GetStageTimes(PostProcessGraph::StageTime* aStages, UINT nMaxStages) { return m_Graph.GetStageTimes( aStages, nMaxStages ); }
+
+	//
+	//	The passes of the current bloom mode and their sizes, returns how many there are
+	//
+	int GetBloomPassCosts(WL::BloomPassCost* aCosts, int nMaxCosts);
+
+private:
+	//
+	//	Post-processing passes, in the order Draw() runs them
+	//
+	enum EPass
+	{
+		PASS_SCENE,
+		PASS_SCALE,
+		PASS_LUMINANCE,
+		PASS_ADAPTATION,
+		PASS_BRIGHTPASS,
+		PASS_STARSOURCE,
+		PASS_BLOOMSOURCE,
+		PASS_BLOOM,
+		PASS_BLOOMDOWN,										// One pass per dual filter level
+		PASS_BLOOMUP = PASS_BLOOMDOWN + HDR_MAX_BLOOM_LEVELS,
+		PASS_STARLINE = PASS_BLOOMUP + HDR_MAX_BLOOM_LEVELS,	// One pass per star line
+		PASS_STARMERGE = PASS_STARLINE + MAX_STAR_LINES,
+		PASS_FINAL
+	};
+
+	//--------------------------------------------------------------------------------------
+	// Private member variables
+	//--------------------------------------------------------------------------------------
+	IDirect3DDevice9*   m_pd3dDevice;					// D3D Device object
+
+	ID3DXEffect*        m_pEffect;						// D3DX effect interface
+	EffectParams*		m_pParams;						// Its parameters, set through the handles below
+	D3DXHANDLE			m_hRenderScene;
+	D3DXHANDLE			m_hRenderSceneRGBE;
+	EffectParams::Param	m_hProjection;					// Shared with the other effects
+	EffectParams::Param	m_hBloomScale;
+	EffectParams::Param	m_hStarScale;
+	EffectParams::Param	m_hEnableToneMap;
+	EffectParams::Param	m_hEnableBlueShift;
+	EffectParams::Param	m_hEnableTexture;
+	EffectParams::Param	m_hLightPositionView;
+	EffectParams::Param	m_hLightIntensity;
+	EffectParams::Param	m_hObjectToView;
+	EffectParams::Param	m_hEmissive;
+	EffectParams::Param	m_hPhongExponent;
+	EffectParams::Param	m_hPhongCoefficient;
+	EffectParams::Param	m_hDiffuseCoefficient;
+	EffectParams::Param	m_hMiddleGray;
+	EffectParams::Param	m_hBloomOffset;
+	EffectParams::Param	m_hStarOffset;
+	EffectParams::Param	m_hSampleOffsets;
+	EffectParams::Param	m_hSampleWeights;
+	EffectParams::Param	m_hElapsedTime;
+	EffectParams::Param	m_hSceneLuminance;
+	D3DFORMAT           m_LuminanceFormat;				// Format to use for luminance map
+
+	PDIRECT3DSURFACE9	m_pFloatMSRT;					// Multi-Sample float render target
+	PDIRECT3DSURFACE9	m_pFloatMSDS;					// Depth Stencil surface for the float RT
+	PDIRECT3DTEXTURE9	m_pTexScene;					// HDR render target containing the scene
+	EQualityTier		m_eQualityTier;
+	DWORD				m_dwSceneWidth;					// Size of the scene texture, for the tier
+	DWORD				m_dwSceneHeight;
+	D3DFORMAT			m_SceneFormat;
+	PDIRECT3DTEXTURE9	m_pTexSceneScaled;				// Scaled copy of the HDR scene
+	PDIRECT3DTEXTURE9	m_pTexBrightPass;				// Bright-pass filtered copy of the scene
+	PDIRECT3DTEXTURE9	m_pTexAdaptedLuminanceCur;		// The luminance that the user is currenly adapted to
+	PDIRECT3DTEXTURE9	m_pTexAdaptedLuminanceLast;		// The luminance that the user is currenly adapted to
+	PDIRECT3DTEXTURE9	m_pTexStarSource;				// Star effect source texture
+	PDIRECT3DTEXTURE9	m_pTexBloomSource;				// Bloom effect source texture
+
+
+	PDIRECT3DTEXTURE9	m_apTexBloom[NUM_BLOOM_TEXTURES];		// Blooming effect working textures
+	PDIRECT3DTEXTURE9	m_apTexBloomDown[HDR_MAX_BLOOM_LEVELS];	// Dual filter downsamples
+	PDIRECT3DTEXTURE9	m_apTexBloomUp[HDR_MAX_BLOOM_LEVELS];	// and upsamples, [0] is m_apTexBloom[0]
+	PDIRECT3DTEXTURE9	m_apTexStar[NUM_STAR_TEXTURES];			// Star effect working textures
+	PDIRECT3DTEXTURE9	m_apTexToneMap[NUM_TONEMAP_TEXTURES];	// Log average luminance samples 
+																// from the HDR render target
+	PostProcessGraph	m_Graph;						// The passes and where the textures above come from
+	PDIRECT3DSURFACE9	m_pSurfLDR;						// Back buffer during Draw()
+	PDIRECT3DSURFACE9	m_pSurfDS;						// Its depth stencil surface
+
+	struct LuminanceReadback
+	{
+		PDIRECT3DSURFACE9	pTarget;					// Copy of the log luminance texture
+		PDIRECT3DSURFACE9	pSysMem;					// Where the CPU reads it
+		LPDIRECT3DQUERY9	pQuery;						// Signals the copy is done
+		bool				bPending;
+	};
+
+	ELuminanceMode		m_eLuminanceMode;
+	LuminanceReadback	m_aReadback[NUM_LUMINANCE_READBACKS];	// Ring of luminance readbacks
+	int					m_iReadback;					// Next one to use
+	WL::LuminanceHistogram m_Histogram;
+	float				m_fHistogramLow;				// Fractions of the histogram averaged
+	float				m_fHistogramHigh;
+	float				m_fHistogramLuminance;			// Last scene luminance from the histogram
+
+	EBloomMode			m_eBloomMode;
+	int					m_nBloomLevels;					// Dual filter levels, from m_fBloomScale
+
+	struct StarPassTable
+	{
+		D3DXVECTOR2		avSampleOffsets[MAX_SAMPLES];	// As g_avSampleOffsets wants them
+		D3DXVECTOR4		avSampleWeights[8];
+	};
+
+	struct StarLineTable
+	{
+		int				nPasses;
+		StarPassTable	aPasses[MAX_STAR_PASSES];
+	};
+
+	StarLineTable		m_aStarLines[MAX_STAR_LINES];	// The star lines that aren't black
+	int					m_nStarLines;
+	float				m_fStarMergeWeight;				// One over all the lines of the star
+	bool				m_bStarBlending;				// Float targets can blend, lines are added up
+
+	LPD3DXMESH			m_pmeshSphere;					// Representation of point light
+	CommandBuffer		m_SphereCommands;				// Its draw, recorded when it is made
+
+	CGlareDef			m_GlareDef;						// Glare defintion
+	EGLARELIBTYPE		m_eGlareType;					// Enumerated glare type
+
+	D3DXVECTOR4			m_avLightPosition;				// Light positions in world space
+	D3DXVECTOR4			m_avLightIntensity;				// Light floating point intensities
+	int					m_nLightLogIntensity;			// Light intensities on a log scale
+	int					m_nLightMantissa;				// Mantissa of the light intensity
+
+	DWORD				m_dwCropWidth;					// Width of the cropped scene texture
+	DWORD				m_dwCropHeight;					// Height of the cropped scene texture
+
+	bool				m_bBoundedPostProcess;			// Post-process around the sun only, while it is small
+	bool				m_bSunBounded;					// Doing so this frame
+	CoordRect			m_rcSun;						// The sun on screen, in fractions of the cropped scene
+	CoordRect			m_rcBrightPass;					// What the passes draw this frame, the same way
+	CoordRect			m_rcStarSource;
+	CoordRect			m_rcBloomSource;
+	CoordRect			m_arcBloomDown[HDR_MAX_BLOOM_LEVELS];
+	CoordRect			m_arcBloomUp[HDR_MAX_BLOOM_LEVELS];
+	CoordRect			m_rcStar;						// All the star lines together
+
+	struct DrawnSurface
+	{
+		PDIRECT3DSURFACE9	pSurf;
+		RECT				rect;						// Where it may not be black
+	};
+	DrawnSurface		m_aDrawnSurfaces[MAX_DRAWN_SURFACES];
+	int					m_nDrawnSurfaces;
+
+	int					m_nBloomInterval;				// Frames between redrawing the bloom
+	int					m_nStarInterval;				// and the star,
+	int					m_nLuminanceInterval;			// and measuring the scene luminance
+	UINT				m_nFrame;
+	bool				m_bHistoryValid;				// What earlier frames drew can be reused
+	bool				m_bRefreshBloom;				// Redone this frame
+	bool				m_bRefreshStar;
+	bool				m_bRefreshLuminance;
+	D3DXMATRIX			m_mBloomView;					// View the bloom was drawn with
+	D3DXMATRIX			m_mStarView;					// and the star
+
+	float				m_fKeyValue;					// Middle gray key value for tone mapping
+
+	bool				m_bToneMap;						// True when scene is to be tone mapped            
+	bool				m_bBlueShift;					// True when blue shift is to be factored in
+	bool				m_bAdaptationInvalid;			// True when adaptation level needs refreshing
+	bool				m_bUseMultiSampleFloat16;		// True when using multisampling on a floating point back buffer
+	bool				m_bSupportsMultiSampleFloat16;	// The device can, whether the tier does or not
+	bool				m_bSupportsFilterFloat16;		// Float textures can be sampled linearly
+	D3DMULTISAMPLE_TYPE m_MaxMultiSampleType;			// Non-Zero when m_bUseMultiSampleFloat16 is true
+	DWORD				m_dwMultiSampleQuality;			// Non-Zero when we have multisampling on a float backbuffer
+	bool				m_bSupportsD16;
+	bool				m_bSupportsD32;
+	bool				m_bSupportsD24X8;
+
+	D3DXMATRIX			m_mView;
+	D3DXMATRIX			m_mProjection;
+	float				m_fRadius;						// Sun's sphere radius
+	int					m_fStacks;
+	int					m_fSlices;
+	float				m_fBloomScale;
+	float				m_fStarScale;
+
+
+private:
+	//--------------------------------------------------------------------------------------
+	// Private methods
+	//--------------------------------------------------------------------------------------
+
+	// Post-processing source textures creation
+	HRESULT Scene_To_SceneScaled();
+	HRESULT SceneScaled_To_BrightPass();
+	HRESULT BrightPass_To_StarSource();
+	HRESULT StarSource_To_BloomSource();
+
+	// Post-processing helper functions
+	HRESULT GetTextureRect( PDIRECT3DTEXTURE9 pTexture, RECT* pRect );
+	HRESULT GetTextureCoords( PDIRECT3DTEXTURE9 pTexSrc, RECT* pRectSrc, PDIRECT3DTEXTURE9 pTexDest, RECT* pRectDest, CoordRect* pCoords );
+
+	// Sample offset calculation. These offsets are passed to corresponding
+	// pixel shaders.
+	HRESULT GetSampleOffsets_GaussBlur5x5(DWORD dwD3DTexWidth, DWORD dwD3DTexHeight, D3DXVECTOR2* avTexCoordOffset, D3DXVECTOR4* avSampleWeights, FLOAT fMultiplier = 1.0f );
+	HRESULT GetSampleOffsets_Bloom(DWORD dwD3DTexSize, float afTexCoordOffset[15], D3DXVECTOR4* avColorWeight, FLOAT fMultiplier=1.0f);    
+	HRESULT GetSampleOffsets_DownScale4x4( DWORD dwWidth, DWORD dwHeight, D3DXVECTOR2 avSampleOffsets[] );
+	HRESULT GetSampleOffsets_DownScale2x2( DWORD dwWidth, DWORD dwHeight, D3DXVECTOR2 avSampleOffsets[] );
+	HRESULT GetSampleOffsets_BloomDownsample( DWORD dwWidth, DWORD dwHeight, D3DXVECTOR2* avTexCoordOffset, D3DXVECTOR4* avSampleWeights );
+	HRESULT GetSampleOffsets_BloomUpsample( DWORD dwWidth, DWORD dwHeight, D3DXVECTOR2* avTexCoordOffset, D3DXVECTOR4* avSampleWeights, FLOAT fMultiplier = 1.0f );
+
+	// Tone mapping and post-process lighting effects
+	HRESULT MeasureLuminance();
+	HRESULT CalculateAdaptation();
+	HRESULT ReadLuminanceHistogram(PDIRECT3DSURFACE9 pSurfLogLum);
+	void    BuildStarTables(DWORD dwSrcWidth, DWORD dwSrcHeight);
+	HRESULT RenderStarLine(int d);
+	HRESULT MergeStar();
+	HRESULT RenderBloom();
+	HRESULT RenderBloomDownsample(int iLevel);
+	HRESULT RenderBloomUpsample(int iLevel);
+
+	// Methods to control scene lights
+	HRESULT AdjustLight(bool bIncrement); 
+	HRESULT RefreshLights();
+
+	HRESULT RenderScene(D3DXMATRIX mView);
+	HRESULT RenderScenePass();
+	HRESULT FinalScenePass();
+
+	// Post-processing around the sun only
+	D3DXVECTOR2 ViewToCrop(const D3DXVECTOR3& vView);
+	void    UpdateSunBounds(const D3DXVECTOR4& vLightViewPosition);
+	CoordRect GrowBounds(const CoordRect& rc, float fTexelsU, float fTexelsV, DWORD dwDivisor);
+	bool    GetPassRect(PDIRECT3DSURFACE9 pSurfDest, const RECT& rectDest, const CoordRect& rcBounds, bool bClear, RECT* pRectDraw);
+	RECT*   GetDrawnRect(PDIRECT3DSURFACE9 pSurf);
+	void    SetDrawnAll(PDIRECT3DSURFACE9 pSurf);
+	void    ClearOutside(PDIRECT3DSURFACE9 pSurf, const RECT& rectClear, const RECT& rectKeep);
+
+	// Reusing the bloom, star and luminance of earlier frames
+	bool    IsPassDue(UINT nPassID);
+	D3DXVECTOR2 GetHistoryOffset(const D3DXMATRIX& mHistoryView);
+
+	// Post-processing graph
+	HRESULT BuildGraph();
+	static HRESULT CALLBACK PostProcessCallback(UINT nPassID, void* pUserContext);
+	void    RenderText();
+
+	VOID    DrawFullScreenQuad(float fLeftU, float fTopV, float fRightU, float fBottomV, const RECT* pRectDraw = NULL);
+	VOID    DrawFullScreenQuad(CoordRect c, const RECT* pRectDraw = NULL) { DrawFullScreenQuad( c.fLeftU, c.fTopV, c.fRightU, c.fBottomV, pRectDraw ); }
+
+	inline bool SUCCESS(HRESULT hr) { return (hr >= 0); }
+	inline bool FAILURE(HRESULT hr) { return (hr < 0); }
+//	inline void VERIFY(HRESULT hr) { if( FAILURE(hr) ) { DXUTTrace( __FILE__, (DWORD)__LINE__, hr, L"Failed Verification", true ); } }
+	
+};
+
+
 #endif // _WLHDRSUN_H_
\ No newline at end of file
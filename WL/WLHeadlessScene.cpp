@@ -0,0 +1,103 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: WLHeadlessScene.cpp
+//
+// Author: snez
+//
+// Desc: The scene's simulation under the benchmark's camera, with the drawing stubbed.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "WLHeadlessScene.h"
+#include <string.h>
+
+#define VIEW_WIDTH			1024.0f			// Pixels
+#define VIEW_HEIGHT			768.0f
+
+WL::HeadlessScene::HeadlessScene(const TerrainSettings& settings, int nThreads)
+{
+	m_Settings = settings;
+	m_nThreads = nThreads;
+	memset(&m_Counters, 0, sizeof(m_Counters));
+}
+
+bool WL::HeadlessScene::Create()
+{
+	return m_Terrain.Create(m_Settings, m_nThreads);
+}
+
+void WL::HeadlessScene::Release()
+{
+	m_Terrain.Release();
+}
+
+void WL::HeadlessScene::SetCameraMode(int iMode)
+{
+	m_Simulation.SetCameraMode(iMode);
+}
+
+void WL::HeadlessScene::CameraRotateAngle(bool bRight)
+{
+	m_Simulation.RotateCamera(bRight);
+}
+
+//
+//	SpaceScene::Update() without the pipeline
+//
+void WL::HeadlessScene::Update(float fDelta)
+{
+	m_Simulation.Step(fDelta);
+	m_Simulation.Flip();
+}
+
+void WL::HeadlessScene::Render(float)
+{
+	const SceneSimulation::CameraSnapshot& camera = m_Simulation.GetCameraSnapshot();
+	memset(&m_Counters, 0, sizeof(m_Counters));
+
+	int aiObjects[SCENE_OBJECTS];
+	int nObjects = m_Simulation.GetDrawnObjects(aiObjects);
+	for (int i = 0; i < nObjects; i++)
+	{
+		const SceneObject* pObject = m_Simulation.GetSceneObject(aiObjects[i]);
+		if (aiObjects[i] == SCENE_PROCEDURAL_PLANET)
+		{
+			m_Counters.nDrawCalls += DrawPlanet(pObject, camera.mView);
+			continue;
+		}
+
+		unsigned int nParticles = pObject->GetParticleCount();
+		m_Counters.nParticles += nParticles;
+		m_Counters.nDrawCalls += 1 + nParticles;
+	}
+}
+
+void WL::HeadlessScene::GetCounters(BenchmarkCounters& counters)
+{
+	counters = m_Counters;
+}
+
+//
+//	The chunks ProceduralPlanet::Render() would draw. A chunk that hasn't arrived isn't
+//	drawn, its parent is.
+//
+int WL::HeadlessScene::DrawPlanet(const SceneObject* pPlanet, const D3DXMATRIX& mView)
+{
+	D3DXMATRIX mProj;
+	D3DXMatrixPerspectiveFovLH(&mProj, m_Simulation.GetFov(), VIEW_WIDTH / VIEW_HEIGHT, SCENE_NEAR_PLANE, SCENE_FAR_PLANE);
+
+	float vCamera[3];
+	float aFrustum[6][4];
+	float fPixelsPerRadian;
+	if (!GetTerrainView(pPlanet->GetRenderMatrix(), mView, mProj, VIEW_HEIGHT, vCamera, aFrustum, &fPixelsPerRadian))
+		return 0;
+
+	int nChunks = m_Terrain.Select(vCamera, fPixelsPerRadian, aFrustum, m_apChunks, HEADLESS_SCENE_MAX_CHUNKS);
+	int nDrawn = 0;
+	for (int i = 0; i < nChunks; i++)
+	{
+		if (m_apChunks[i]->pData)
+			nDrawn++;
+	}
+	return nDrawn;
+}
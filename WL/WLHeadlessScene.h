@@ -0,0 +1,69 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: WLHeadlessScene.h
+//
+// Author: snez
+//
+// Desc: SpaceScene without a device, for the benchmark. The SceneSimulation the game
+//       steps runs as it is: the objects move, the comet and the ship emit their
+//       particles and the camera flies the orbits of its modes. Only the drawing is
+//       stubbed, Render() counts the draw calls SpaceScene would make for the objects
+//       of the camera mode:
+//
+//         - a particle is one, as ParticleSystem::Draw() draws them one at a time
+//         - a mesh is one, its subsets are only known from the file
+//         - the procedural planet's chunks are picked like ProceduralPlanet::Render()
+//           does, generating the missing ones, and a chunk with its data is one
+//
+//       The sky, the sun and the post-processing need Direct3D and are left out, so
+//       nPostPasses and nStateChanges stay 0.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __WLHeadlessScene_H__
+#define __WLHeadlessScene_H__
+
+#include "WLBenchmark.h"
+#include "WLSceneSimulation.h"
+#include "WLTerrain.h"
+
+#define HEADLESS_SCENE_MAX_CHUNKS	4096		// PROCEDURAL_PLANET_MAX_CHUNKS
+
+namespace WL
+{
+
+	class HeadlessScene : public BenchmarkScene
+	{
+	public:
+		//
+		//	Chunks are generated on the thread that draws unless nThreads says
+		//	otherwise, as TerrainQuadtree::Create() takes it, so two runs do the same work
+		//
+		HeadlessScene(const TerrainSettings& settings = TerrainSettings(), int nThreads = -1);
+
+		bool Create();
+		void Release();
+
+		virtual void SetCameraMode(int iMode);
+		virtual void CameraRotateAngle(bool bRight);
+		virtual void Update(float fDelta);
+		virtual void Render(float);
+		virtual void GetCounters(BenchmarkCounters& counters);
+
+		inline const SceneSimulation& GetSimulation() const { return m_Simulation; }
+		inline const TerrainQuadtree::Stats& GetStats() const { return m_Terrain.GetStats(); }
+
+	private:
+		int DrawPlanet(const SceneObject* pPlanet, const D3DXMATRIX& mView);
+
+		SceneSimulation				m_Simulation;
+		TerrainSettings				m_Settings;
+		int							m_nThreads;
+		TerrainQuadtree				m_Terrain;
+		TerrainQuadtree::Chunk*		m_apChunks[HEADLESS_SCENE_MAX_CHUNKS];
+		BenchmarkCounters			m_Counters;				// Of the last Render()
+	};
+
+}
+
+#endif // __WLHeadlessScene_H__
@@ -0,0 +1,243 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: WLParticleEmitter.cpp
+//
+// Author: snez
+//
+// Desc: Particles born, aged and published for drawing, without a device.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "WLParticleEmitter.h"
+#include "WLBenchmark.h"
+#include "WLProfiler.h"
+#include <math.h>
+
+WL::Particle::Particle()
+{
+	alive = false;
+	size = sizeDelta = life = 0;
+	color = colorDelta = D3DXCOLOR(0,0,0,0);
+	velocity = position = D3DXVECTOR3(0,0,0);
+}
+
+void WL::Particle::Init(D3DXVECTOR3& position,D3DXVECTOR3& velocity,D3DXCOLOR& color,D3DXCOLOR& colorDelta,float life,float size,float sizeDelta)
+{
+	alive = true;
+	this->position = position;
+	this->velocity = velocity;
+	this->color = color;
+	this->colorDelta = colorDelta;
+	this->life = life;
+	this->size = size;
+	this->sizeDelta = sizeDelta;
+}
+
+void WL::Particle::Update(float timeDelta)
+{
+	if (!alive)
+		return;
+
+	if ( (life -= timeDelta) <= 0)
+	{
+		alive = false;
+		return;
+	}
+
+	position += velocity * timeDelta;
+	color += colorDelta * timeDelta;
+	size += sizeDelta * timeDelta;
+}
+
+
+//--------------------------------------------------------------------------------------//
+
+
+WL::ParticleEmitter::ParticleEmitter(const D3DXVECTOR3& position, float emPitch, float emYaw, float pitchVar, float yawVar, int numParticles)
+{
+	emitter = position;
+	particleCount = numParticles < MAX_PARTICLES ? numParticles : MAX_PARTICLES;
+
+	// pitch must be between -90 and 90 degrees
+	pitch = emPitch * DEG_TO_RAD;
+	Limit(&pitch, -90.0f * DEG_TO_RAD, 90.0f * DEG_TO_RAD);
+
+	// pitch must be between -360 and 360 degrees
+	yaw = emYaw * DEG_TO_RAD;
+	Limit(&yaw,  -360.0f * DEG_TO_RAD, 360.0f * DEG_TO_RAD);
+
+	// pitchVariation must be between 0 and 180 degrees
+	pitchVariation = pitchVar * DEG_TO_RAD;
+	Limit(&pitchVariation, 0, 180.0f * DEG_TO_RAD);
+
+	// yawVariation must be between 0 and 360 degrees
+	yawVariation = yawVar * DEG_TO_RAD;
+	Limit(&yawVariation, 0, 360.0f * DEG_TO_RAD);
+
+	particleBuffer = new Particle*[particleCount];
+	for (int i = 0; i < particleCount; i++)
+		particleBuffer[i] = new Particle();
+
+	aliveParticles = 0;
+	colorStart = colorEnd = colorStartVar = colorEndVar = D3DXCOLOR(0,0,0,0);
+	maxLife = minLife = 0;
+	minVelocity = maxVelocity = 0;
+	particleSize = particleSizeVar = 0;
+	emitting = false;
+
+	randomState = GetRandomStream();
+
+	// The renderer starts with the empty system, until the first step is published
+	Publish();
+	Flip();
+}
+
+WL::ParticleEmitter::~ParticleEmitter()
+{
+	for(int i = 0; i < particleCount; i++)
+		delete particleBuffer[i];
+	delete[] particleBuffer;
+}
+
+void WL::ParticleEmitter::SetColor(const D3DXCOLOR& start, const D3DXCOLOR& startVar, const D3DXCOLOR& end, const D3DXCOLOR& endVar)
+{
+	colorStart = start;
+	colorEnd = end;
+	colorStartVar = startVar;
+	colorEndVar = endVar;
+}
+
+void WL::ParticleEmitter::SetLife(float min,float max)
+{
+	minLife = min;
+	maxLife = max;
+}
+
+void WL::ParticleEmitter::SetSize(float startSize,float endSize)
+{
+	particleSize = startSize;
+	particleSizeVar = (endSize - startSize);
+}
+
+void WL::ParticleEmitter::SetPosition(const D3DXVECTOR3& pos)
+{
+	emitter = pos;
+}
+
+void WL::ParticleEmitter::Start()
+{
+	emitting = true;
+}
+
+void WL::ParticleEmitter::Stop()
+{
+	emitting = false;
+}
+
+void WL::ParticleEmitter::SetVelocity(float min, float max)
+{
+	minVelocity = min;
+	maxVelocity = max;
+}
+
+inline float WL::ParticleEmitter::GetRandomNum(float min, float max)
+{
+	// A linear congruential step, the top 24 bits are the random ones
+	randomState = randomState * 1664525u + 1013904223u;
+	return (( (float) (randomState >> 8) / 16777216.0f ) * (max - min)) + min;
+}
+
+inline void WL::ParticleEmitter::Limit(float* x, float min, float max)
+{
+	*x = (*x < min) ? min : (*x < max) ? *x : max;
+}
+
+void WL::ParticleEmitter::RotationToDirection(float pitch,float yaw,D3DXVECTOR3& direction)
+{
+	direction.x = -sin(yaw) * cos(pitch);
+	direction.y = sin(pitch);
+	direction.z = cos(pitch) * cos(yaw);
+}
+
+void WL::ParticleEmitter::InitParticle(Particle* p)
+{
+	D3DXVECTOR3 position;
+	D3DXVECTOR3 velocity;
+	D3DXCOLOR colorS;
+	D3DXCOLOR colorE;
+	D3DXCOLOR colorDelta;
+
+	position = emitter;
+
+	float partPitch = (GetRandomNum(-0.5f,0.5f) * pitchVariation) + pitch;
+	float partYaw = (GetRandomNum(-0.5f,0.5f) * yawVariation) + yaw;
+
+	RotationToDirection(partPitch,partYaw,velocity);
+
+	float r = GetRandomNum(minVelocity,maxVelocity);
+	velocity *= r;
+
+	float life = GetRandomNum(minLife,maxLife);
+
+	colorS = colorStart + colorStartVar * GetRandomNum();
+	colorE = colorEnd + colorEndVar * GetRandomNum();
+
+	Limit(&colorS.r);
+	Limit(&colorS.g);
+	Limit(&colorS.b);
+	Limit(&colorS.a);
+
+	Limit(&colorE.r);
+	Limit(&colorE.g);
+	Limit(&colorE.b);
+	Limit(&colorE.a);
+
+	colorDelta = (colorE - colorS)  / life;
+
+	p->Init(position,velocity,colorS,colorDelta,life,particleSize,particleSizeVar / life);
+}
+
+void WL::ParticleEmitter::Update(float timeDelta)
+{
+	WL_PROFILE_ZONE(L"ParticleEmitter::Update");
+	if (!emitting && aliveParticles <= 0)
+		return;
+
+	aliveParticles = 0;
+	for (int i = 0; i < particleCount; i++)
+	{
+		if (particleBuffer[i]->IsAlive())
+			particleBuffer[i]->Update(timeDelta);
+
+		if (particleBuffer[i]->IsAlive())
+			aliveParticles++;
+		else if (emitting)
+		{
+			InitParticle(particleBuffer[i]);
+			aliveParticles++;
+		}
+	}
+}
+
+//
+//	Copies the live particles for the renderer. With the simulation on its own thread this
+//	runs on it, into the frame the renderer isn't reading.
+//
+void WL::ParticleEmitter::Publish()
+{
+	ParticleFrame& frame = frames.Back();
+	frame.emitter = emitter;
+	frame.particles.clear();
+
+	for (int i = 0; i < particleCount; i++)
+	{
+		if (particleBuffer[i]->IsAlive())
+		{
+			ParticleInstance instance;
+			instance.position = particleBuffer[i]->GetPosition();
+			instance.color = (DWORD) particleBuffer[i]->GetColor();
+			instance.size = particleBuffer[i]->GetSize();
+			frame.particles.push_back(instance);
+		}
+	}
+}
@@ -0,0 +1,131 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: WLParticleEmitter.h
+//
+// Author: snez
+//
+// Desc: The simulated half of a particle system: the particles, where they are born and
+//       how they age. Every step is published for ParticleSystem to draw, the same way
+//       the objects publish theirs, so the emitter itself never touches the device and
+//       runs in the headless build.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __WLParticleEmitter_H__
+#define __WLParticleEmitter_H__
+
+#include <vector>
+#include "WLD3DTypes.h"
+#include "WLSnapshot.h"
+
+#define DEG_TO_RAD ( D3DX_PI/180.f ) // convert from degrees to radians
+#define RAD_TO_DEG ( 180.f/D3DX_PI ) // convert from radians to degrees
+
+namespace WL
+{
+
+	class Particle
+	{
+	private:
+
+		D3DXCOLOR color;		// Particle color
+		D3DXCOLOR colorDelta;	// How much to change the color in one time slice
+		D3DXVECTOR3 position;	// Particle position
+		D3DXVECTOR3 velocity;	// Particle velocity
+		float life;				// Particle remaining life
+		float size;				// Current particle size
+		float sizeDelta;		// How much to change the size in one time slice
+		bool alive;				// Is the particle alive?
+
+	public:
+
+		Particle();
+		~Particle() {};
+		void Init(D3DXVECTOR3& position,D3DXVECTOR3& velocity,D3DXCOLOR& color,D3DXCOLOR& colorDelta,float life,float size,float sizeDelta);
+		void Update(float timeDelta);
+		inline D3DXVECTOR3& GetPosition() { return position; }
+		inline D3DXCOLOR& GetColor() { return color; }
+		inline float GetSize() { return size; }
+		inline bool IsAlive() { return alive; }
+	};
+
+	// What is drawn of a live particle
+	struct ParticleInstance
+	{
+		D3DXVECTOR3 position;
+		D3DCOLOR color;
+		float size;
+	};
+
+	// The particles of one simulation step, as the renderer sees them
+	struct ParticleFrame
+	{
+		D3DXVECTOR3 emitter;
+		std::vector<ParticleInstance> particles;
+	};
+
+	class ParticleEmitter
+	{
+	private:
+
+		enum { MAX_PARTICLES = 1000 };
+
+		D3DXVECTOR3 emitter;			// position of the emitter
+		int particleCount;
+		int aliveParticles;				// number of alive particles
+
+		float pitch;					// pitch of the emitter
+		float yaw;						// yaw of the emitter
+		float pitchVariation;			// spread in y axis , around x axis
+		float yawVariation;				// spread in x axis , around y axis
+
+		float particleSize;				// starting particle size
+		float particleSizeVar;			// how much the size will change
+
+		float maxLife;					// maximum life for a particle
+		float minLife;					// minimum life for a particle
+		float maxVelocity;				// maximum velocity for a particle
+		float minVelocity;				// minimum velocity for a particle
+
+		Particle** particleBuffer;		// the particle buffer
+		D3DXCOLOR colorStart;			// start color
+		D3DXCOLOR colorEnd;				// end color
+		D3DXCOLOR colorStartVar;		// start color
+		D3DXCOLOR colorEndVar;			// end color
+
+		bool emitting;					// Is the emitter working?
+		unsigned int randomState;		// The emitter's own random numbers, so no other rand() user shifts them
+
+		Snapshot<ParticleFrame> frames;	// Published by the simulation, drawn by ParticleSystem
+
+		inline float GetRandomNum(float min = 0.0f, float max = 1.0f);
+		inline void Limit(float* x, float min = 0.0f, float max = 1.0f);
+		void RotationToDirection(float pitch,float yaw,D3DXVECTOR3& direction);
+		void InitParticle(Particle* p);
+
+		ParticleEmitter(const ParticleEmitter&);				// Owns its particles
+		ParticleEmitter& operator = (const ParticleEmitter&);
+
+	public:
+
+		ParticleEmitter(const D3DXVECTOR3& position, float emPitch, float emYaw, float pitchVar, float yawVar, int numParticles);
+		~ParticleEmitter();
+		void Update(float timeDelta);
+		void Publish();						// Hands the particles to the renderer, after Update
+		inline void Flip() { frames.Flip(); }
+		void Start();
+		void Stop();
+		bool IsEmitting() const { return emitting; }
+		void SetColor(const D3DXCOLOR& start, const D3DXCOLOR& startVar, const D3DXCOLOR& end, const D3DXCOLOR& endVar);
+		void SetLife(float min,float max);
+		void SetSize(float startSize,float endSize);
+		void SetVelocity(float min,float max);
+		void SetPosition(const D3DXVECTOR3& pos);
+		inline const ParticleFrame& GetFrame() const { return frames.Front(); }		// The published one
+		inline unsigned int GetDrawnCount() const { return (unsigned int)frames.Front().particles.size(); }
+		inline int GetMaxCount() const { return particleCount; }
+	};
+
+}
+
+#endif // __WLParticleEmitter_H__
@@ -1,201 +1,200 @@
-#include "WLPlanet.h"
-
-// This function is used in the class and is not meant to be visible outside of it
-D3DXVECTOR4 operator*(const D3DXVECTOR4& v, const D3DXMATRIX& m){
-	return D3DXVECTOR4(	v.x * m._11 + v.y * m._21 + v.z * m._31 + v.w * m._41,
-					v.x * m._12 + v.y * m._22 + v.z * m._32 + v.w * m._42,
-					v.x * m._13 + v.y * m._23 + v.z * m._33 + v.w * m._43,
-					v.x * m._14 + v.y * m._24 + v.z * m._34 + v.w * m._44);
-};
-
-
-Planet::Planet(LPCWSTR xfile, LPCWSTR fxfile /* = NULL */, 
-			   float R /* = 0.5f */, float G /* = 0.5f */, float B /* = 0.5f */, 
-			   float thickness /* = 0.1f */, int detail /* = 7 */, float Bias /* = 0.2f */)
-{
-	HRESULT hr;
-	m_pd3dDevice = DXUTGetD3DDevice();
-	m_pMesh = new XMesh();
-	hr = m_pMesh->LoadFile(xfile);
-	if (FAILED(hr))
-	{
-		delete m_pMesh;
-		m_pMesh = NULL;
-		DXUTTrace(__FILE__,(DWORD)__LINE__, hr, L"Failed to create Planet mesh.", true);
-	}	
-
-	//	Create the glow effect
-	m_pEffect = NULL;
-	dwShaderFlags = 0;
-	if (fxfile != NULL)
-	{
-		m_hWorld = NULL;
-		m_hView = NULL;
-		m_hProj = NULL;
-		m_hLightDir = NULL;
-
-		//dwShaderFlags |= D3DXSHADER_FORCE_VS_SOFTWARE_NOOPT;
-		//dwShaderFlags |= D3DXSHADER_FORCE_PS_SOFTWARE_NOOPT;
-		//dwShaderFlags |= D3DXSHADER_NO_PRESHADER;
-		dwShaderFlags |= D3DXSHADER_DEBUG;
-
-		// Read the D3DX effect file
-		hr = D3DXCreateEffectFromFile( 
-				m_pd3dDevice, 
-				fxfile, 
-				NULL, // CONST D3DXMACRO* pDefines,
-				NULL, // LPD3DXINCLUDE pInclude,
-				dwShaderFlags, 
-				NULL, // Shared Pool
-				&m_pEffect, 
-				NULL );
-
-		if (FAILED(hr))
-		{
-			SAFE_RELEASE(m_pEffect);
-			DXUTTrace(__FILE__,(DWORD)__LINE__, hr, L"Failed to create Planet effect from file.", true);
-		} else {
-			m_hTechnique = m_pEffect->GetTechniqueByName("TGlowAndTexture");
-			m_hWorld = m_pEffect->GetParameterByName( 0, "World" );
-			m_hView = m_pEffect->GetParameterByName( 0, "View" );
-			m_hProj = m_pEffect->GetParameterByName( 0, "Projection" );
-			m_hLightDir = m_pEffect->GetParameterByName( 0, "LightDir" );
-			m_hTexture = m_pEffect->GetParameterByName( 0, "Tex0" );
-			m_hThickness = m_pEffect->GetParameterByName( 0, "GlowThickness" );
-			m_hAmbientColor = m_pEffect->GetParameterByName( 0, "GlowAmbient" );
-			m_hBias = m_pEffect->GetParameterByName( 0, "Bias" );
-
-			if (detail < 1) detail = 1;
-			m_iDetail = detail;
-			D3DXVECTOR4 ambientColor(R/float(m_iDetail),G/float(m_iDetail),B/float(m_iDetail),1.0f);
-
-			if (Bias > 1.0f) Bias = 1.0f;
-			m_fThickness = thickness;
-
-			// Update the effect's variables 
-			m_pEffect->SetTexture( m_hTexture, m_pMesh->GetTexture(0));
-			m_pEffect->SetVector( m_hAmbientColor, &ambientColor);
-			m_pEffect->SetFloat( m_hBias, Bias);
-			
-		}
-	}
-
-};
-
-void Planet::Render()
-{
-	HRESULT hr;
-	m_pd3dDevice->SetTransform(D3DTS_WORLD, &m_mWorldMatrix);
-
-	if (m_pEffect)
-	{
-        UINT iPass, cPasses;
-	    D3DXMATRIX m_mViewMatrix;
-		D3DXMATRIX m_mProjMatrix;
-
-		m_pd3dDevice->SetRenderState(D3DRS_ZWRITEENABLE, false);
-
-		float factor = 0.0f;
-		float tmp_thickness = m_fThickness;
-		
-		m_pd3dDevice->GetTransform(D3DTS_VIEW, &m_mViewMatrix);
-		m_pd3dDevice->GetTransform(D3DTS_PROJECTION, &m_mProjMatrix);
-
-		V( m_pEffect->SetMatrix( m_hWorld, &m_mWorldMatrix ) );			
-		V( m_pEffect->SetMatrix( m_hView, &m_mViewMatrix) );
-		V( m_pEffect->SetMatrix( m_hProj, &m_mProjMatrix ));
-
-		// Get the light direction
-		D3DLIGHT9 dirLight; 
-		D3DXVECTOR4 ld(0.0f, 0.0f, 0.0f, 0.0f); 
-		m_pd3dDevice->GetLight(0,&dirLight); 
-		ld.x = dirLight.Direction.x; 
-		ld.y = dirLight.Direction.y; 
-		ld.z = dirLight.Direction.z; 
-		static bool once = true; 
-
-		// Transform the light direction before passing it to the shader
-		static D3DXMATRIX inverse; 
-		if (once) { 
-			D3DXVECTOR3 position( 0.0f, 0.0f, -1.0f ); 
-			D3DXVECTOR3 target(0.0f, 0.0f, 0.0f); 
-			D3DXVECTOR3 up(0.0f, 1.0f, 0.0f); 
-			D3DXMatrixLookAtLH(&inverse, &position, &target, &up); 
-			D3DXMatrixInverse(&inverse, 0, &inverse); 
-			once = false; 
-		} 
-		ld = ld * m_mViewMatrix * inverse;
-		V( m_pEffect->SetVector( m_hLightDir, &ld ));
-
-		// Set the initial thickness
-		factor = m_fThickness/float(m_iDetail);
-		V( m_pEffect->SetFloat( m_hThickness, factor ));
-
-		// Change the technique to add multiple glowing layers
-		tmp_thickness = factor;
-
-		V( m_pEffect->SetTechnique("TGlowOnly") );
-		for (int i = 1; i <= m_iDetail; i++)
-		{
-			if (i == m_iDetail)
-			{
-				m_pd3dDevice->SetRenderState(D3DRS_ZWRITEENABLE, true);
-				m_pMesh->Render();
-				m_pd3dDevice->SetRenderState(D3DRS_ZWRITEENABLE, false);
-			}
-
-			m_pEffect->Begin(&cPasses, 0);
-
-			V( m_pEffect->SetFloat( m_hThickness, tmp_thickness ));
-
-			for (iPass = 0; iPass < cPasses; iPass++)
-			{
-				m_pEffect->BeginPass(iPass);
-				// Only call CommitChanges if any state changes have happened
-				// after BeginPass is called
-				//m_pEffect->CommitChanges();
-
-				// Render the mesh with the applied technique
-				m_pMesh->Render();
-
-				m_pEffect->EndPass();
-			}
-			m_pEffect->End();
-			tmp_thickness += factor;
-		}
-
-		m_pd3dDevice->SetRenderState(D3DRS_ZWRITEENABLE, true);
-
-	}
-	else
-	{
-		if (m_pMesh) 
-		{
-			m_pMesh->Render();
-		}		
-	}
-
-};
-
-void Planet::OnResetDevice()
-{
-    if( m_pEffect )
-        m_pEffect->OnResetDevice();
-};
-
-void Planet::OnLostDevice()
-{
-    if( m_pEffect )
-        m_pEffect->OnLostDevice();
-};
-
-void Planet::OnDestroyDevice()
-{
-    SAFE_RELEASE(m_pEffect);
-}
-
-Planet::~Planet()
-{
-	SAFE_RELEASE(m_pEffect);
-	SAFE_DELETE(m_pMesh);
+#include "WLPlanet.h"
+#include "WLGpuProfiler.h"
+
+
+Planet::Planet(const WL::SceneObject* pSimulated, LPCWSTR xfile, LPCWSTR fxfile /* = NULL */, 
+			   float R /* = 0.5f */, float G /* = 0.5f */, float B /* = 0.5f */, 
+			   float thickness /* = 0.1f */, int detail /* = 7 */, float Bias /* = 0.2f */)
+	: GeneralObject(pSimulated)
+{
+	m_pd3dDevice = DXUTGetD3DDevice();
+	pMesh = AssetCache::Get().GetMesh(xfile);
+	if (pMesh == NULL)
+		DXUTTrace(__FILE__,(DWORD)__LINE__, E_FAIL, L"Failed to create Planet mesh.", true);
+
+	//	Create the glow effect
+	m_pEffect = NULL;
+	m_pParams = NULL;
+	m_hAtmosphere = NULL;
+	m_bLayeredGlow = false;
+	dwShaderFlags = 0;
+	if (fxfile != NULL)
+	{
+		//dwShaderFlags |= D3DXSHADER_FORCE_VS_SOFTWARE_NOOPT;
+		//dwShaderFlags |= D3DXSHADER_FORCE_PS_SOFTWARE_NOOPT;
+		//dwShaderFlags |= D3DXSHADER_NO_PRESHADER;
+		dwShaderFlags |= WL_SHADER_FLAGS;
+
+		// Read the D3DX effect file, or share the one already loaded
+		m_pEffect = AssetCache::Get().GetEffect(fxfile, dwShaderFlags);
+
+		if (m_pEffect == NULL)
+		{
+			DXUTTrace(__FILE__,(DWORD)__LINE__, E_FAIL, L"Failed to create Planet effect from file.", true);
+		} else {
+			m_hTechnique = m_pEffect->GetTechniqueByName("TGlowAndTexture");
+			m_hGlowOnly = m_pEffect->GetTechniqueByName("TGlowOnly");
+			m_hAtmosphere = m_pEffect->GetTechniqueByName("TAtmosphere");
+			if (m_hAtmosphere && FAILED(m_pEffect->ValidateTechnique(m_hAtmosphere)))
+				m_hAtmosphere = NULL;
+
+			// The view, projection and light direction are shared by all the effects and
+			// set once a frame by the scene, only the planet's own parameters are here
+			m_pParams = AssetCache::Get().GetEffectParams(m_pEffect);
+			m_hWorld = m_pParams->GetParam( "World" );
+			m_hTexture = m_pParams->GetParam( "Tex0" );
+			m_hThickness = m_pParams->GetParam( "GlowThickness" );
+			m_hAmbientColor = m_pParams->GetParam( "GlowAmbient" );
+			m_hBias = m_pParams->GetParam( "Bias" );
+
+			if (detail < 1) detail = 1;
+			m_iDetail = detail;
+			m_vAmbientColor = D3DXVECTOR4(R/float(m_iDetail),G/float(m_iDetail),B/float(m_iDetail),1.0f);
+			m_vAtmosphereColor = D3DXVECTOR4(R,G,B,1.0f);
+
+			if (Bias > 1.0f) Bias = 1.0f;
+			m_fBias = Bias;
+			m_fThickness = thickness;
+
+		}
+	}
+
+};
+
+void Planet::Render()
+{
+	WL_PROFILE_STAGE(L"Planet::Render");
+	HRESULT hr;
+	StateCache::Get().SetTransform(D3DTS_WORLD, &GetRenderMatrix());
+
+	if (m_pEffect)
+	{
+		StateCache::Get().SetRenderState(D3DRS_ZWRITEENABLE, false);
+
+		// The effect may be shared with other planets, so all of our variables are set here,
+		// and the ones the effect has already cost nothing.
+		// The texture streams in, so the placeholder may have been replaced since last frame.
+		V( m_pParams->SetMatrix( m_hWorld, GetRenderMatrix() ) );
+		V( m_pParams->SetTexture( m_hTexture, pMesh->GetTexture(0) ));
+		V( m_pParams->SetFloat( m_hBias, m_fBias ));
+
+		if (IsLayeredGlow())
+			RenderLayers();
+		else
+			RenderAtmosphere();
+
+		StateCache::Get().SetRenderState(D3DRS_ZWRITEENABLE, true);
+
+	}
+	else
+	{
+		if (pMesh) 
+		{
+			pMesh->Render();
+		}		
+	}
+
+};
+
+//
+//	A planet with an atmosphere is drawn whole by its effect, after the opaque objects and
+//	with the blended ones, so the atmosphere lands on what is behind it
+//
+void Planet::Submit(RenderQueue& queue)
+{
+	if (m_pEffect == NULL)
+	{
+		GeneralObject::Submit(queue);
+		return;
+	}
+
+	queue.Submit(RenderQueue::PASS_TRANSPARENT, m_pEffect, NULL, GetRenderPosition(), DrawObject, this, 0, RQ_SETS_TEXTURES);
+}
+
+//
+//	The atmosphere as m_iDetail hulls of growing thickness, the inner ones drawn before
+//	the planet so it covers them, the outermost over it
+//
+void Planet::RenderLayers()
+{
+	HRESULT hr;
+	UINT iPass, cPasses;
+
+	V( m_pParams->SetVector( m_hAmbientColor, m_vAmbientColor ));
+
+	// Set the initial thickness
+	float factor = m_fThickness/float(m_iDetail);
+
+	// Change the technique to add multiple glowing layers
+	float tmp_thickness = factor;
+
+	V( m_pEffect->SetTechnique( m_hGlowOnly ) );
+	for (int i = 1; i <= m_iDetail; i++)
+	{
+		if (i == m_iDetail)
+		{
+			StateCache::Get().SetRenderState(D3DRS_ZWRITEENABLE, true);
+			pMesh->Render();
+			StateCache::Get().SetRenderState(D3DRS_ZWRITEENABLE, false);
+		}
+
+		m_pEffect->Begin(&cPasses, 0);
+
+		V( m_pParams->SetFloat( m_hThickness, tmp_thickness ));
+
+		for (iPass = 0; iPass < cPasses; iPass++)
+		{
+			m_pEffect->BeginPass(iPass);
+			// Only call CommitChanges if any state changes have happened
+			// after BeginPass is called
+			//m_pEffect->CommitChanges();
+
+			// Render the mesh with the applied technique
+			pMesh->Render();
+
+			m_pEffect->EndPass();
+		}
+		m_pEffect->End();
+		tmp_thickness += factor;
+	}
+}
+
+//
+//	The planet, then the whole atmosphere in one draw of its outer hull. The pixel shader
+//	adds up what the layers would have along each view ray, so the cost no longer grows
+//	with m_iDetail.
+//
+void Planet::RenderAtmosphere()
+{
+	HRESULT hr;
+	UINT iPass, cPasses;
+
+	StateCache::Get().SetRenderState(D3DRS_ZWRITEENABLE, true);
+	pMesh->Render();
+	StateCache::Get().SetRenderState(D3DRS_ZWRITEENABLE, false);
+
+	V( m_pParams->SetVector( m_hAmbientColor, m_vAtmosphereColor ));
+	V( m_pParams->SetFloat( m_hThickness, m_fThickness ));
+	V( m_pEffect->SetTechnique( m_hAtmosphere ) );
+
+	m_pEffect->Begin(&cPasses, 0);
+	for (iPass = 0; iPass < cPasses; iPass++)
+	{
+		m_pEffect->BeginPass(iPass);
+		pMesh->Render();
+		m_pEffect->EndPass();
+	}
+	m_pEffect->End();
+}
+
+void Planet::OnDestroyDevice()
+{
+	m_pParams = NULL;
+    SAFE_RELEASE(m_pEffect);
+}
+
+Planet::~Planet()
+{
+	SAFE_RELEASE(m_pEffect);
+	SAFE_RELEASE(pMesh);
 }
\ No newline at end of file
@@ -1,39 +1,50 @@
-#pragma once
-
-#include "dxstdafx.h"
-#include "..\XMesh.h"
-#include "WL.h"
-
-class Planet : public GeneralObject 
-{
-private:
-
-	IDirect3DDevice9* m_pd3dDevice;
-	XMesh* m_pMesh;
-
-	// Effect Variables
-	ID3DXEffect* m_pEffect;
-	DWORD dwShaderFlags;
-	D3DXHANDLE              m_hWorld;               // Handle to world matrix
-	D3DXHANDLE              m_hView;                // Handle to view matrix
-	D3DXHANDLE              m_hProj;                // Handle to projection matrix
-	D3DXHANDLE				m_hLightDir;			// Handle to light direction vector3
-	D3DXHANDLE				m_hTexture;				// Handle to a texture
-	D3DXHANDLE				m_hThickness;			// Handle to glow effect thickness
-	D3DXHANDLE				m_hTechnique;			// Handle to a shader technique
-	D3DXHANDLE				m_hAmbientColor;		// The color of the planet atmosphere
-	D3DXHANDLE				m_hBias;				// Bias for how much the atmosphere exceeds the 90 degree cutoff (0.0f-1.0f)
-	float					m_fThickness;			// The thickness of the planet's atmosphere
-	int						m_iDetail;				// The amount of layers to draw for the atmosphere
-
-public:
-
-	Planet(LPCWSTR xfile, LPCWSTR fxfile = NULL, float R = 0.5f, float G = 0.5f, float B = 0.5f, 
-		   float thickness = 0.1f, int detail = 7, float Bias = 0.2f);
-
-	~Planet();
-	void Render();
-	void OnResetDevice();
-	void OnLostDevice();
-	void OnDestroyDevice();
+#pragma once
+
+#include "dxstdafx.h"
+#include "..\XMesh.h"
+#include "WL.h"
+#include "WLEffectParams.h"
+
+class Planet : public GeneralObject 
+{
+private:
+
+	IDirect3DDevice9* m_pd3dDevice;
+
+	// Effect Variables
+	ID3DXEffect* m_pEffect;
+	EffectParams* m_pParams;						// Shared with the other planets using the effect
+	DWORD dwShaderFlags;
+	EffectParams::Param		m_hWorld;               // Handle to world matrix
+	EffectParams::Param		m_hTexture;				// Handle to a texture
+	EffectParams::Param		m_hThickness;			// Handle to glow effect thickness
+	EffectParams::Param		m_hAmbientColor;		// The color of the planet atmosphere
+	EffectParams::Param		m_hBias;				// Bias for how much the atmosphere exceeds the 90 degree cutoff (0.0f-1.0f)
+	D3DXHANDLE				m_hTechnique;			// Handle to a shader technique
+	D3DXHANDLE				m_hGlowOnly;			// The atmosphere layers
+	D3DXHANDLE				m_hAtmosphere;			// Single pass atmosphere, NULL where the device can't run it
+	D3DXVECTOR4				m_vAmbientColor;		// Atmosphere color, divided between the layers
+	D3DXVECTOR4				m_vAtmosphereColor;		// Atmosphere color, for the single pass
+	float					m_fBias;
+	float					m_fThickness;			// The thickness of the planet's atmosphere
+	int						m_iDetail;				// The amount of layers to draw for the atmosphere
+	bool					m_bLayeredGlow;			// Draw the layers even where the single pass runs
+
+	void RenderLayers();
+	void RenderAtmosphere();
+
+public:
+
+	Planet(const WL::SceneObject* pSimulated, LPCWSTR xfile, LPCWSTR fxfile = NULL, float R = 0.5f, float G = 0.5f, float B = 0.5f, 
+		   float thickness = 0.1f, int detail = 7, float Bias = 0.2f);
+
+	~Planet();
+	void Render();
+	void Submit(RenderQueue& queue);
+
+	// The atmosphere is drawn in a single pass where the device supports it, the layers
+	// cost a draw of the mesh each
+	inline void SetLayeredGlow(bool bLayered) { m_bLayeredGlow = bLayered; }
+	inline bool IsLayeredGlow() const { return m_bLayeredGlow || m_hAtmosphere == NULL; }
+	void OnDestroyDevice();
 };
\ No newline at end of file
@@ -0,0 +1,257 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: WLPlatform.cpp
+//
+// Author: snez
+//
+// Desc: Thin wrappers around the operating system threading and timing primitives.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "WLPlatform.h"
+
+#ifndef _WIN32
+	#include <time.h>
+	#include <sched.h>
+	#include <unistd.h>
+#endif
+
+//
+//	Timing
+//
+double WL::GetTimeSeconds()
+{
+#ifdef _WIN32
+	static LARGE_INTEGER s_frequency = { 0 };
+	if (s_frequency.QuadPart == 0)
+		QueryPerformanceFrequency(&s_frequency);
+
+	LARGE_INTEGER now;
+	QueryPerformanceCounter(&now);
+	return double(now.QuadPart) / double(s_frequency.QuadPart);
+#else
+	timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return double(ts.tv_sec) + double(ts.tv_nsec) * 1e-9;
+#endif
+}
+
+int WL::GetProcessorCount()
+{
+#ifdef _WIN32
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	return (info.dwNumberOfProcessors > 0) ? int(info.dwNumberOfProcessors) : 1;
+#else
+	long count = sysconf(_SC_NPROCESSORS_ONLN);
+	return (count > 0) ? int(count) : 1;
+#endif
+}
+
+void WL::YieldThread()
+{
+#ifdef _WIN32
+	Sleep(0);
+#else
+	sched_yield();
+#endif
+}
+
+unsigned long WL::GetCurrentThreadID()
+{
+#ifdef _WIN32
+	return (unsigned long)GetCurrentThreadId();
+#else
+	return (unsigned long)pthread_self();
+#endif
+}
+
+//
+//	Atomics
+//
+long WL::AtomicIncrement(volatile long* pValue)
+{
+#ifdef _WIN32
+	return InterlockedIncrement(pValue);
+#else
+	return __sync_add_and_fetch(pValue, 1);
+#endif
+}
+
+long WL::AtomicDecrement(volatile long* pValue)
+{
+#ifdef _WIN32
+	return InterlockedDecrement(pValue);
+#else
+	return __sync_sub_and_fetch(pValue, 1);
+#endif
+}
+
+long WL::AtomicRead(volatile long* pValue)
+{
+#ifdef _WIN32
+	return InterlockedCompareExchange(pValue, 0, 0);
+#else
+	return __sync_fetch_and_add(pValue, 0);
+#endif
+}
+
+//
+//	Mutex
+//
+WL::Mutex::Mutex()
+{
+#ifdef _WIN32
+	InitializeCriticalSection(&m_cs);
+#else
+	pthread_mutex_init(&m_mutex, NULL);
+#endif
+}
+
+WL::Mutex::~Mutex()
+{
+#ifdef _WIN32
+	DeleteCriticalSection(&m_cs);
+#else
+	pthread_mutex_destroy(&m_mutex);
+#endif
+}
+
+void WL::Mutex::Lock()
+{
+#ifdef _WIN32
+	EnterCriticalSection(&m_cs);
+#else
+	pthread_mutex_lock(&m_mutex);
+#endif
+}
+
+void WL::Mutex::Unlock()
+{
+#ifdef _WIN32
+	LeaveCriticalSection(&m_cs);
+#else
+	pthread_mutex_unlock(&m_mutex);
+#endif
+}
+
+//
+//	Semaphore
+//
+WL::Semaphore::Semaphore(long initialCount)
+{
+#ifdef _WIN32
+	m_hSemaphore = CreateSemaphore(NULL, initialCount, 0x7fffffff, NULL);
+#else
+	pthread_mutex_init(&m_mutex, NULL);
+	pthread_cond_init(&m_cond, NULL);
+	m_nCount = initialCount;
+#endif
+}
+
+WL::Semaphore::~Semaphore()
+{
+#ifdef _WIN32
+	if (m_hSemaphore)
+		CloseHandle(m_hSemaphore);
+#else
+	pthread_cond_destroy(&m_cond);
+	pthread_mutex_destroy(&m_mutex);
+#endif
+}
+
+void WL::Semaphore::Post(long count)
+{
+#ifdef _WIN32
+	ReleaseSemaphore(m_hSemaphore, count, NULL);
+#else
+	pthread_mutex_lock(&m_mutex);
+	m_nCount += count;
+	if (count == 1)
+		pthread_cond_signal(&m_cond);
+	else
+		pthread_cond_broadcast(&m_cond);
+	pthread_mutex_unlock(&m_mutex);
+#endif
+}
+
+void WL::Semaphore::Wait()
+{
+#ifdef _WIN32
+	WaitForSingleObject(m_hSemaphore, INFINITE);
+#else
+	pthread_mutex_lock(&m_mutex);
+	while (m_nCount <= 0)
+		pthread_cond_wait(&m_cond, &m_mutex);
+	m_nCount--;
+	pthread_mutex_unlock(&m_mutex);
+#endif
+}
+
+//
+//	Thread
+//
+WL::Thread::Thread()
+{
+	m_pfnEntry = NULL;
+	m_pContext = NULL;
+	m_bRunning = false;
+#ifdef _WIN32
+	m_hThread = NULL;
+#endif
+}
+
+WL::Thread::~Thread()
+{
+	Join();
+}
+
+bool WL::Thread::Start(EntryPoint pfnEntry, void* pContext)
+{
+	if (m_bRunning || pfnEntry == NULL)
+		return false;
+
+	m_pfnEntry = pfnEntry;
+	m_pContext = pContext;
+
+#ifdef _WIN32
+	m_hThread = CreateThread(NULL, 0, ThreadProc, this, 0, NULL);
+	m_bRunning = (m_hThread != NULL);
+#else
+	m_bRunning = (pthread_create(&m_thread, NULL, ThreadProc, this) == 0);
+#endif
+
+	return m_bRunning;
+}
+
+void WL::Thread::Join()
+{
+	if (!m_bRunning)
+		return;
+
+#ifdef _WIN32
+	WaitForSingleObject(m_hThread, INFINITE);
+	CloseHandle(m_hThread);
+	m_hThread = NULL;
+#else
+	pthread_join(m_thread, NULL);
+#endif
+
+	m_bRunning = false;
+}
+
+#ifdef _WIN32
+DWORD WINAPI WL::Thread::ThreadProc(LPVOID pParam)
+{
+	Thread* pThread = (Thread*)pParam;
+	pThread->m_pfnEntry(pThread->m_pContext);
+	return 0;
+}
+#else
+void* WL::Thread::ThreadProc(void* pParam)
+{
+	Thread* pThread = (Thread*)pParam;
+	pThread->m_pfnEntry(pThread->m_pContext);
+	return NULL;
+}
+#endif
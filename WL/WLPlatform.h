@@ -0,0 +1,148 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: WLPlatform.h
+//
+// Author: snez
+//
+// Desc: Thin wrappers around the operating system threading and timing primitives.
+//       Nothing in here depends on Direct3D, so code built on top of it can also be
+//       compiled on machines without a GPU.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __WLPlatform_H__
+#define __WLPlatform_H__
+
+#ifdef _WIN32
+	#include <windows.h>
+#else
+	#include <pthread.h>
+#endif
+
+namespace WL
+{
+
+	//
+	//	Timing
+	//
+
+	// High resolution time stamp in seconds, only meaningful as a difference
+	double GetTimeSeconds();
+
+	// Number of logical processors available to the process
+	int GetProcessorCount();
+
+	// Give up the rest of the current time slice
+	void YieldThread();
+
+	// Identifier of the calling thread
+	unsigned long GetCurrentThreadID();
+
+	//
+	//	Atomics
+	//
+
+	long AtomicIncrement(volatile long* pValue);
+	long AtomicDecrement(volatile long* pValue);
+
+	// Reads after every read and write before it, like the other atomics
+	long AtomicRead(volatile long* pValue);
+
+	//
+	//	Mutual exclusion
+	//
+	class Mutex
+	{
+	public:
+		Mutex();
+		~Mutex();
+
+		void Lock();
+		void Unlock();
+
+	private:
+		Mutex(const Mutex&);
+		Mutex& operator=(const Mutex&);
+
+#ifdef _WIN32
+		CRITICAL_SECTION	m_cs;
+#else
+		pthread_mutex_t		m_mutex;
+#endif
+	};
+
+	//
+	//	Locks a mutex for the lifetime of the object
+	//
+	class ScopedLock
+	{
+	public:
+		ScopedLock(Mutex& mutex) : m_mutex(mutex) { m_mutex.Lock(); }
+		~ScopedLock() { m_mutex.Unlock(); }
+
+	private:
+		ScopedLock(const ScopedLock&);
+		ScopedLock& operator=(const ScopedLock&);
+
+		Mutex& m_mutex;
+	};
+
+	//
+	//	Counting semaphore
+	//
+	class Semaphore
+	{
+	public:
+		Semaphore(long initialCount = 0);
+		~Semaphore();
+
+		void Post(long count = 1);
+		void Wait();
+
+	private:
+		Semaphore(const Semaphore&);
+		Semaphore& operator=(const Semaphore&);
+
+#ifdef _WIN32
+		HANDLE				m_hSemaphore;
+#else
+		pthread_mutex_t		m_mutex;
+		pthread_cond_t		m_cond;
+		long				m_nCount;
+#endif
+	};
+
+	//
+	//	A joinable worker thread
+	//
+	class Thread
+	{
+	public:
+		typedef void (*EntryPoint)(void* pContext);
+
+		Thread();
+		~Thread();
+
+		bool Start(EntryPoint pfnEntry, void* pContext);
+		void Join();
+		inline bool IsRunning() const { return m_bRunning; }
+
+	private:
+		Thread(const Thread&);
+		Thread& operator=(const Thread&);
+
+		EntryPoint			m_pfnEntry;
+		void*				m_pContext;
+		bool				m_bRunning;
+#ifdef _WIN32
+		HANDLE				m_hThread;
+		static DWORD WINAPI ThreadProc(LPVOID pParam);
+#else
+		pthread_t			m_thread;
+		static void* ThreadProc(void* pParam);
+#endif
+	};
+
+}
+
+#endif // __WLPlatform_H__
@@ -0,0 +1,427 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: WLPostProcessGraph.cpp
+//
+// Author: snez
+//
+// Desc: Post-processing passes with declared inputs and outputs.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "WLPostProcessGraph.h"
+#include "WLGpuProfiler.h"
+#include "WLStateCache.h"
+
+PostProcessGraph::PostProcessGraph()
+{
+	m_nTier = 0;
+	m_pd3dDevice = NULL;
+	m_pEffect = NULL;
+	ZeroMemory(&m_Stats, sizeof(m_Stats));
+	InvalidateState();
+}
+
+PostProcessGraph::~PostProcessGraph()
+{
+	Release();
+}
+
+PostProcessGraph::Target PostProcessGraph::DeclareTarget(UINT width, UINT height, D3DFORMAT format, DWORD dwFlags)
+{
+	TargetDecl target;
+	target.Width = width;
+	target.Height = height;
+	target.Format = format;
+	target.Flags = dwFlags;
+	target.bImported = false;
+	target.hPoolTarget = -1;
+
+	if (FAILED(m_Targets.Add(target)))
+		return -1;
+
+	return m_Targets.GetSize() - 1;
+}
+
+PostProcessGraph::Target PostProcessGraph::ImportTarget()
+{
+	Target hTarget = DeclareTarget(0, 0, D3DFMT_UNKNOWN);
+	if (hTarget >= 0)
+		m_Targets[hTarget].bImported = true;
+	return hTarget;
+}
+
+PostProcessGraph::Pass PostProcessGraph::AddPass(LPCWSTR strName, LPCSTR strTechnique, UINT nPassID, DWORD dwTierMask)
+{
+	PassDecl pass;
+	ZeroMemory(&pass, sizeof(pass));
+	StringCchCopyW(pass.strName, 32, strName);
+	pass.strZone = WL::Profiler::Get().Intern(pass.strName);
+	if (strTechnique)
+		StringCchCopyA(pass.strTechnique, 32, strTechnique);
+	pass.nPassID = nPassID;
+	pass.dwTierMask = dwTierMask;
+	pass.bEnabled = true;
+
+	if (FAILED(m_Passes.Add(pass)))
+		return -1;
+
+	m_Stats.nPasses = m_Passes.GetSize();
+	return m_Passes.GetSize() - 1;
+}
+
+void PostProcessGraph::Read(Pass hPass, Target hTarget)
+{
+	if (hPass < 0 || hTarget < 0)
+		return;
+
+	PassDecl& pass = m_Passes[hPass];
+	if (pass.nReads < PPG_MAX_PASS_TARGETS)
+		pass.aReads[pass.nReads++] = hTarget;
+}
+
+void PostProcessGraph::Write(Pass hPass, Target hTarget)
+{
+	if (hPass < 0 || hTarget < 0)
+		return;
+
+	PassDecl& pass = m_Passes[hPass];
+	if (pass.nWrites < PPG_MAX_PASS_TARGETS)
+		pass.aWrites[pass.nWrites++] = hTarget;
+}
+
+void PostProcessGraph::EnablePass(Pass hPass, bool bEnable)
+{
+	if (hPass >= 0)
+		m_Passes[hPass].bEnabled = bEnable;
+}
+
+void PostProcessGraph::SetTier(UINT nTier)
+{
+	m_nTier = nTier;
+}
+
+bool PostProcessGraph::IsPassLive(Pass hPass)
+{
+	return hPass >= 0 && hPass < m_Passes.GetSize() && m_Passes[hPass].bLive;
+}
+
+HRESULT PostProcessGraph::Compile(IDirect3DDevice9* pd3dDevice, ID3DXEffect* pEffect)
+{
+	int nTargets = m_Targets.GetSize();
+	int nPasses = m_Passes.GetSize();
+
+	m_pd3dDevice = pd3dDevice;
+	m_pEffect = pEffect;
+	m_Pool.Release();
+	m_Stats.fGpuTime = 0.0f;
+
+	// Walk back from the imported targets: a pass is needed if something needed reads
+	// what it writes, and then whatever it reads is needed as well
+	bool* abNeeded = new bool[nTargets + 1];
+	for (int t = 0; t < nTargets; t++)
+		abNeeded[t] = m_Targets[t].bImported;
+
+	m_Stats.nLivePasses = 0;
+	for (int p = nPasses - 1; p >= 0; p--)
+	{
+		PassDecl& pass = m_Passes[p];
+		pass.bLive = pass.bEnabled && (m_nTier >= 32 || (pass.dwTierMask & (1 << m_nTier)) != 0);
+
+		bool bUsed = false;
+		for (int w = 0; w < pass.nWrites; w++)
+			bUsed |= abNeeded[pass.aWrites[w]];
+		pass.bLive &= bUsed;
+
+		if (!pass.bLive)
+			continue;
+
+		for (int r = 0; r < pass.nReads; r++)
+			abNeeded[pass.aReads[r]] = true;
+
+		pass.hTechnique = (pEffect && pass.strTechnique[0]) ? pEffect->GetTechniqueByName(pass.strTechnique) : NULL;
+		m_Stats.nLivePasses++;
+	}
+
+	// The lifetime of a target runs from the first live pass touching it to the last one,
+	// counting live passes only
+	int* aFirst = new int[nTargets + 1];
+	int* aLast = new int[nTargets + 1];
+	bool* abWritten = new bool[nTargets + 1];
+	for (int t = 0; t < nTargets; t++)
+	{
+		aFirst[t] = INT_MAX;
+		aLast[t] = -1;
+		abWritten[t] = false;
+	}
+
+	int nStage = 0;
+	for (int p = 0; p < nPasses; p++)
+	{
+		PassDecl& pass = m_Passes[p];
+		if (!pass.bLive)
+			continue;
+
+		for (int r = 0; r < pass.nReads; r++)
+		{
+			aFirst[pass.aReads[r]] = min(aFirst[pass.aReads[r]], nStage);
+			aLast[pass.aReads[r]] = max(aLast[pass.aReads[r]], nStage);
+		}
+		for (int w = 0; w < pass.nWrites; w++)
+		{
+			aFirst[pass.aWrites[w]] = min(aFirst[pass.aWrites[w]], nStage);
+			aLast[pass.aWrites[w]] = max(aLast[pass.aWrites[w]], nStage);
+			abWritten[pass.aWrites[w]] = true;
+		}
+		nStage++;
+	}
+
+	for (int t = 0; t < nTargets; t++)
+	{
+		TargetDecl& target = m_Targets[t];
+		target.hPoolTarget = -1;
+		if (target.bImported || aLast[t] < 0)
+			continue;
+
+		// Never written means it stays as cleared, so it can't share with anything
+		bool bPersistent = (target.Flags & PPG_PERSISTENT) != 0 || !abWritten[t];
+		target.hPoolTarget = m_Pool.Declare(target.Width, target.Height, target.Format,
+											bPersistent ? RTP_PERSISTENT : aFirst[t], aLast[t],
+											target.Flags & RTP_BORDERED);
+	}
+
+	delete[] abNeeded;
+	delete[] aFirst;
+	delete[] aLast;
+	delete[] abWritten;
+
+	HRESULT hr = m_Pool.Allocate(pd3dDevice);
+	if (FAILED(hr))
+		return hr;
+
+	return S_OK;
+}
+
+HRESULT PostProcessGraph::Execute(LPPOSTPROCESSPASSCALLBACK pCallback, void* pUserContext)
+{
+	HRESULT hr;
+	HRESULT hrResult = S_OK;
+
+	InvalidateState();
+	m_Stats.nStateChanges = 0;
+	m_Stats.nCachedChanges = 0;
+	m_Stats.nRedundantChanges = 0;
+
+	// The GPU times come from the profiler, of a frame a few behind
+	UpdateGpuTime();
+
+	for (int p = 0; p < m_Passes.GetSize(); p++)
+	{
+		PassDecl& pass = m_Passes[p];
+		if (!pass.bLive)
+			continue;
+
+		CDXUTPerfEventGenerator g( DXUT_PERFEVENTCOLOR, pass.strName );
+		WL_PROFILE_STAGE( pass.strZone );
+
+		if (pass.hTechnique)
+		{
+			if (pass.hTechnique != m_hTechnique)
+			{
+				m_pEffect->SetTechnique(pass.hTechnique);
+				m_hTechnique = pass.hTechnique;
+				m_Stats.nStateChanges++;
+			}
+			else
+			{
+				m_Stats.nRedundantChanges++;
+			}
+		}
+
+		// A failing pass leaves its output as it was, the rest still run
+		hr = pCallback(pass.nPassID, pUserContext);
+		if (FAILED(hr))
+			hrResult = DXUT_ERR(pass.strName, hr);
+
+		if (pass.hTechnique == NULL)
+			InvalidateState();
+	}
+
+	InvalidateState();
+	return hrResult;
+}
+
+void PostProcessGraph::Release()
+{
+	m_Pool.Release();
+	m_Stats.fGpuTime = 0.0f;
+	m_Targets.RemoveAll();
+	m_Passes.RemoveAll();
+	m_Stats.nPasses = m_Stats.nLivePasses = 0;
+	m_pEffect = NULL;
+	InvalidateState();
+}
+
+LPDIRECT3DTEXTURE9 PostProcessGraph::GetTexture(Target hTarget)
+{
+	if (hTarget < 0 || hTarget >= m_Targets.GetSize())
+		return NULL;
+
+	return m_Pool.GetTexture(m_Targets[hTarget].hPoolTarget);
+}
+
+UINT PostProcessGraph::GetStageTimes(StageTime* aStages, UINT nMaxStages)
+{
+	WL::GpuProfiler& profiler = WL::GpuProfiler::Get();
+	if (!profiler.HasTimestamps())
+		return 0;
+
+	// Passes sharing a name are one stage of the profiler already
+	UINT nStages = 0;
+	for (int p = 0; p < m_Passes.GetSize(); p++)
+	{
+		PassDecl& pass = m_Passes[p];
+		if (!pass.bLive)
+			continue;
+
+		UINT s = 0;
+		while (s < nStages && aStages[s].strName != pass.strZone)
+			s++;
+
+		double fTime;
+		if (s < nStages || nStages == nMaxStages || !profiler.GetStageTime(pass.strZone, &fTime))
+			continue;
+
+		aStages[s].strName = pass.strZone;
+		aStages[s].fTime = (float)fTime;
+		nStages++;
+	}
+
+	return nStages;
+}
+
+//
+//	The live passes as the GPU profiler last read them, a name counted once
+//
+void PostProcessGraph::UpdateGpuTime()
+{
+	WL::GpuProfiler& profiler = WL::GpuProfiler::Get();
+	float fTotal = 0.0f;
+	for (int p = 0; p < m_Passes.GetSize(); p++)
+	{
+		PassDecl& pass = m_Passes[p];
+		if (!pass.bLive)
+			continue;
+
+		int q = 0;
+		while (q < p && (!m_Passes[q].bLive || m_Passes[q].strZone != pass.strZone))
+			q++;
+
+		double fTime;
+		if (q == p && profiler.GetStageTime(pass.strZone, &fTime))
+			fTotal += (float)fTime;
+	}
+	m_Stats.fGpuTime = fTotal;
+}
+
+void PostProcessGraph::InvalidateState()
+{
+	m_pRenderTarget = NULL;
+	m_hTechnique = NULL;
+	ZeroMemory(m_abTextureKnown, sizeof(m_abTextureKnown));
+	ZeroMemory(m_adwSamplerKnown, sizeof(m_adwSamplerKnown));
+	ZeroMemory(m_abRenderStateKnown, sizeof(m_abRenderStateKnown));
+}
+
+void PostProcessGraph::SetRenderTarget(LPDIRECT3DSURFACE9 pSurface)
+{
+	if (pSurface == m_pRenderTarget)
+	{
+		m_Stats.nRedundantChanges++;
+		return;
+	}
+
+	m_pd3dDevice->SetRenderTarget(0, pSurface);
+	m_pRenderTarget = pSurface;
+	m_Stats.nStateChanges++;
+}
+
+void PostProcessGraph::SetTexture(DWORD dwStage, LPDIRECT3DBASETEXTURE9 pTexture)
+{
+	if (dwStage < PPG_MAX_SAMPLERS)
+	{
+		if (m_abTextureKnown[dwStage] && m_apTextures[dwStage] == pTexture)
+		{
+			m_Stats.nRedundantChanges++;
+			return;
+		}
+		m_apTextures[dwStage] = pTexture;
+		m_abTextureKnown[dwStage] = true;
+	}
+
+	m_pd3dDevice->SetTexture(dwStage, pTexture);
+	m_Stats.nStateChanges++;
+}
+
+void PostProcessGraph::SetSamplerState(DWORD dwSampler, D3DSAMPLERSTATETYPE type, DWORD dwValue)
+{
+	if (dwSampler < PPG_MAX_SAMPLERS && (DWORD)type < MAX_SAMPLER_STATES)
+	{
+		DWORD dwBit = 1 << type;
+		if ((m_adwSamplerKnown[dwSampler] & dwBit) && m_adwSamplerStates[dwSampler][type] == dwValue)
+		{
+			m_Stats.nRedundantChanges++;
+			return;
+		}
+		m_adwSamplerStates[dwSampler][type] = dwValue;
+		m_adwSamplerKnown[dwSampler] |= dwBit;
+	}
+
+	StateCache::Get().SetSamplerState(dwSampler, type, dwValue);
+	m_Stats.nStateChanges++;
+	m_Stats.nCachedChanges++;
+}
+
+void PostProcessGraph::SetRenderState(D3DRENDERSTATETYPE state, DWORD dwValue)
+{
+	if ((DWORD)state < MAX_RENDER_STATES)
+	{
+		if (m_abRenderStateKnown[state] && m_adwRenderStates[state] == dwValue)
+		{
+			m_Stats.nRedundantChanges++;
+			return;
+		}
+		m_adwRenderStates[state] = dwValue;
+		m_abRenderStateKnown[state] = TRUE;
+	}
+
+	StateCache::Get().SetRenderState(state, dwValue);
+	m_Stats.nStateChanges++;
+	m_Stats.nCachedChanges++;
+}
+
+void PostProcessGraph::SetTechnique(LPCSTR strTechnique)
+{
+	D3DXHANDLE hTechnique = m_pEffect->GetTechniqueByName(strTechnique);
+	if (hTechnique == m_hTechnique && hTechnique != NULL)
+	{
+		m_Stats.nRedundantChanges++;
+		return;
+	}
+
+	m_pEffect->SetTechnique(hTechnique);
+	m_hTechnique = hTechnique;
+	m_Stats.nStateChanges++;
+}
+
+HRESULT PostProcessGraph::GetRenderTargetDesc(D3DSURFACE_DESC* pDesc)
+{
+	if (m_pRenderTarget)
+		return m_pRenderTarget->GetDesc(pDesc);
+
+	HRESULT hr;
+	LPDIRECT3DSURFACE9 pSurface = NULL;
+	V_RETURN( m_pd3dDevice->GetRenderTarget(0, &pSurface) );
+	hr = pSurface->GetDesc(pDesc);
+	SAFE_RELEASE(pSurface);
+	return hr;
+}
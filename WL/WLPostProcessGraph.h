@@ -0,0 +1,179 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: WLPostProcessGraph.h
+//
+// Author: snez
+//
+// Desc: A chain of post-processing passes described up front. Every pass names the
+//       technique it draws with and the render targets it reads and writes. Compile()
+//       drops the passes whose results nobody uses, works out how long each target lives
+//       and gets the targets from a RenderTargetPool, so targets of passes far apart share
+//       memory. Execute() then runs the remaining passes in order through a callback.
+//
+//       While the passes run, the render target, textures, sampler and render states they
+//       set through the graph are remembered, and setting a value that is already in place
+//       costs nothing. The states go on to the device through the StateCache, so it knows
+//       them once the graph is done.
+//
+//       Every pass is a stage of the profilers, named like the pass. Where the device has
+//       timestamp queries the GPU profiler measures it, a few frames late, so nothing
+//       waits on the GPU for the results.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __WLPostProcessGraph_H__
+#define __WLPostProcessGraph_H__
+
+#include "dxstdafx.h"
+#include "WLRenderTargetPool.h"
+
+#define PPG_PERSISTENT			0x100		// Target keeps its contents across frames
+#define PPG_ALL_TIERS			0xffffffff	// Pass runs at every quality tier
+
+#define PPG_MAX_PASS_TARGETS	12			// Most targets a pass may read, and write
+#define PPG_MAX_SAMPLERS		8
+
+//
+//	Called for every pass that survived Compile(), with the ID it was added with
+//
+typedef HRESULT (CALLBACK *LPPOSTPROCESSPASSCALLBACK)(UINT nPassID, void* pUserContext);
+
+class PostProcessGraph
+{
+public:
+	typedef int Target;
+	typedef int Pass;
+
+	struct Stats
+	{
+		UINT	nPasses;			// Passes added
+		UINT	nLivePasses;		// Passes left after culling
+		UINT	nStateChanges;		// State changes that reached the device last frame
+		UINT	nCachedChanges;		// Of those, the ones handed to the StateCache, which may drop them
+		UINT	nRedundantChanges;	// State changes dropped last frame
+		float	fGpuTime;			// Milliseconds the live passes took on the GPU, as last read
+	};
+
+	//
+	//	GPU time of the passes sharing a name, like the lines of the star
+	//
+	struct StageTime
+	{
+		LPCWSTR	strName;
+		float	fTime;				// Milliseconds
+	};
+
+	PostProcessGraph();
+	~PostProcessGraph();
+
+	//
+	//	Building the graph. Flags are RTP_BORDERED and PPG_PERSISTENT. An imported
+	//	target (the back buffer) is not allocated by the graph, and whatever writes it
+	//	is what the graph is for.
+	//
+	Target DeclareTarget(UINT width, UINT height, D3DFORMAT format, DWORD dwFlags = 0);
+	Target ImportTarget();
+	Pass AddPass(LPCWSTR strName, LPCSTR strTechnique, UINT nPassID, DWORD dwTierMask = PPG_ALL_TIERS);
+	void Read(Pass hPass, Target hTarget);
+	void Write(Pass hPass, Target hTarget);
+	void EnablePass(Pass hPass, bool bEnable);
+	void SetTier(UINT nTier);
+
+	//
+	//	Culls the passes, then allocates the targets of the ones left. Targets read by a
+	//	pass but written by none (say the star, with the star passes disabled) are cleared
+	//	to black once and kept.
+	//
+	HRESULT Compile(IDirect3DDevice9* pd3dDevice, ID3DXEffect* pEffect);
+
+	//
+	//	Runs the live passes. Passes added without a technique set the device up on their
+	//	own, and the graph forgets the state it knew about after them.
+	//
+	HRESULT Execute(LPPOSTPROCESSPASSCALLBACK pCallback, void* pUserContext);
+
+	//
+	//	Release the targets and forget the graph (on lost device)
+	//
+	void Release();
+
+	LPDIRECT3DTEXTURE9 GetTexture(Target hTarget);		// New reference, NULL if culled
+	bool IsPassLive(Pass hPass);
+
+	//
+	//	The GPU times of the live passes, in the order they first run. Returns how many
+	//	stages there are, none without timestamp queries.
+	//
+	UINT GetStageTimes(StageTime* aStages, UINT nMaxStages);
+
+	//
+	//	State setting for the passes, only calls that change something reach the device
+	//
+	void SetRenderTarget(LPDIRECT3DSURFACE9 pSurface);
+	void SetTexture(DWORD dwStage, LPDIRECT3DBASETEXTURE9 pTexture);
+	void SetSamplerState(DWORD dwSampler, D3DSAMPLERSTATETYPE type, DWORD dwValue);
+	void SetRenderState(D3DRENDERSTATETYPE state, DWORD dwValue);
+	void SetTechnique(LPCSTR strTechnique);
+	void InvalidateState();
+	void UpdateGpuTime();
+
+	//
+	//	Description of the current render target, without asking the device when the
+	//	graph set it
+	//
+	HRESULT GetRenderTargetDesc(D3DSURFACE_DESC* pDesc);
+
+	inline const Stats& GetStats() const { return m_Stats; }
+	inline const RenderTargetPool::Stats& GetTargetStats() const { return m_Pool.GetStats(); }
+
+private:
+	enum { MAX_RENDER_STATES = 256, MAX_SAMPLER_STATES = 14 };
+
+	struct TargetDecl
+	{
+		UINT						Width;
+		UINT						Height;
+		D3DFORMAT					Format;
+		DWORD						Flags;
+		bool						bImported;
+		RenderTargetPool::Handle	hPoolTarget;
+	};
+
+	struct PassDecl
+	{
+		WCHAR		strName[32];
+		const WCHAR*	strZone;						// strName, kept by the profilers
+		CHAR		strTechnique[32];
+		D3DXHANDLE	hTechnique;
+		UINT		nPassID;
+		DWORD		dwTierMask;
+		bool		bEnabled;
+		bool		bLive;
+		int			nReads;
+		int			nWrites;
+		Target		aReads[PPG_MAX_PASS_TARGETS];
+		Target		aWrites[PPG_MAX_PASS_TARGETS];
+	};
+
+	CGrowableArray<TargetDecl>	m_Targets;
+	CGrowableArray<PassDecl>	m_Passes;
+	RenderTargetPool			m_Pool;
+	UINT						m_nTier;
+
+	IDirect3DDevice9*			m_pd3dDevice;
+	ID3DXEffect*				m_pEffect;
+
+	// What the device is known to be set to while the passes run
+	LPDIRECT3DSURFACE9			m_pRenderTarget;
+	D3DXHANDLE					m_hTechnique;
+	LPDIRECT3DBASETEXTURE9		m_apTextures[PPG_MAX_SAMPLERS];
+	bool						m_abTextureKnown[PPG_MAX_SAMPLERS];
+	DWORD						m_adwSamplerStates[PPG_MAX_SAMPLERS][MAX_SAMPLER_STATES];
+	DWORD						m_adwSamplerKnown[PPG_MAX_SAMPLERS];		// Bit per state type
+	DWORD						m_adwRenderStates[MAX_RENDER_STATES];
+	BYTE						m_abRenderStateKnown[MAX_RENDER_STATES];
+
+	Stats						m_Stats;
+};
+
+#endif // __WLPostProcessGraph_H__
@@ -0,0 +1,162 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: WLProceduralPlanet.cpp
+//
+// Author: snez
+//
+// Desc: A planet drawn from the chunks of a TerrainQuadtree.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "WLProceduralPlanet.h"
+#include "WLStateCache.h"
+
+#define TERRAIN_FVF		(D3DFVF_XYZ | D3DFVF_NORMAL | D3DFVF_DIFFUSE)
+
+ProceduralPlanet::ProceduralPlanet(const WL::SceneObject* pSimulated, const WL::TerrainSettings& settings /* = WL::TerrainSettings() */)
+	: GeneralObject(pSimulated)
+{
+	m_Settings = settings;
+	m_pIndexBuffer = NULL;
+	m_Terrain.SetEvictCallback(EvictChunk, this);
+
+	OnCreateDevice(DXUTGetD3DDevice());
+}
+
+ProceduralPlanet::~ProceduralPlanet()
+{
+	OnDestroyDevice();
+}
+
+//
+//	The chunks are made again for a new device, with the vertex buffers they are drawn from
+//
+HRESULT ProceduralPlanet::OnCreateDevice(IDirect3DDevice9* pd3dDevice)
+{
+	m_pd3dDevice = pd3dDevice;
+	if (!m_Terrain.Create(m_Settings))
+	{
+		DXUTTrace(__FILE__, (DWORD)__LINE__, E_FAIL, L"Failed to start the terrain threads.", true);
+		return E_FAIL;
+	}
+
+	// Every chunk has the same triangles
+	SAFE_RELEASE(m_pIndexBuffer);
+	HRESULT hr = m_pd3dDevice->CreateIndexBuffer(
+					WL::TerrainChunkData::INDICES * sizeof(WORD),
+					D3DUSAGE_WRITEONLY,
+					D3DFMT_INDEX16,
+					D3DPOOL_MANAGED,
+					&m_pIndexBuffer, NULL);
+
+	WORD* pIndices = NULL;
+	if (SUCCEEDED(hr) && SUCCEEDED(m_pIndexBuffer->Lock(0, 0, (void**)&pIndices, 0)))
+	{
+		WL::GetTerrainChunkIndices(pIndices);
+		m_pIndexBuffer->Unlock();
+	}
+	else
+	{
+		DXUTTrace(__FILE__, (DWORD)__LINE__, hr, L"Failed to create the terrain index buffer.", true);
+		SAFE_RELEASE(m_pIndexBuffer);
+		return FAILED(hr) ? hr : E_FAIL;
+	}
+
+	return D3D_OK;
+}
+
+void ProceduralPlanet::OnDestroyDevice()
+{
+	// Waits for the chunks being generated, and hands back every vertex buffer
+	m_Terrain.Release();
+	SAFE_RELEASE(m_pIndexBuffer);
+}
+
+void ProceduralPlanet::EvictChunk(WL::TerrainQuadtree::Chunk* pChunk, void* pContext)
+{
+	LPDIRECT3DVERTEXBUFFER9 pVertexBuffer = (LPDIRECT3DVERTEXBUFFER9)pChunk->pUserData;
+	SAFE_RELEASE(pVertexBuffer);
+	pChunk->pUserData = NULL;
+}
+
+//
+//	The vertex buffer of a chunk, made the first time the chunk is drawn
+//
+LPDIRECT3DVERTEXBUFFER9 ProceduralPlanet::GetVertexBuffer(WL::TerrainQuadtree::Chunk* pChunk)
+{
+	if (pChunk->pUserData)
+		return (LPDIRECT3DVERTEXBUFFER9)pChunk->pUserData;
+
+	LPDIRECT3DVERTEXBUFFER9 pVertexBuffer = NULL;
+	if (FAILED(m_pd3dDevice->CreateVertexBuffer(
+					sizeof(pChunk->pData->aVertices),
+					D3DUSAGE_WRITEONLY,
+					TERRAIN_FVF,
+					D3DPOOL_MANAGED,
+					&pVertexBuffer, NULL)))
+		return NULL;
+
+	void* pVertices = NULL;
+	if (FAILED(pVertexBuffer->Lock(0, 0, &pVertices, 0)))
+	{
+		SAFE_RELEASE(pVertexBuffer);
+		return NULL;
+	}
+	memcpy(pVertices, pChunk->pData->aVertices, sizeof(pChunk->pData->aVertices));
+	pVertexBuffer->Unlock();
+
+	pChunk->pUserData = pVertexBuffer;
+	return pVertexBuffer;
+}
+
+void ProceduralPlanet::Render()
+{
+	if (m_pIndexBuffer == NULL)
+		return;
+
+	D3DXMATRIX mView, mProj;
+	StateCache::Get().GetTransform(D3DTS_VIEW, &mView);
+	StateCache::Get().GetTransform(D3DTS_PROJECTION, &mProj);
+
+	// The camera and the frustum in planet space, as HeadlessScene picks the chunks
+	const D3DXMATRIX& mWorld = GetRenderMatrix();
+	D3DVIEWPORT9 viewport;
+	m_pd3dDevice->GetViewport(&viewport);
+
+	float vCamera[3];
+	float aFrustum[6][4];
+	float fPixelsPerRadian;
+	if (!WL::GetTerrainView(mWorld, mView, mProj, (float)viewport.Height, vCamera, aFrustum, &fPixelsPerRadian))
+		return;
+
+	int nChunks = m_Terrain.Select(vCamera, fPixelsPerRadian, aFrustum, m_apChunks, PROCEDURAL_PLANET_MAX_CHUNKS);
+
+	// The vertex colors stand in for the material
+	StateCache::Get().SetRenderState(D3DRS_DIFFUSEMATERIALSOURCE, D3DMCS_COLOR1);
+	StateCache::Get().SetRenderState(D3DRS_AMBIENTMATERIALSOURCE, D3DMCS_COLOR1);
+	m_pd3dDevice->SetTexture(0, NULL);
+	m_pd3dDevice->SetFVF(TERRAIN_FVF);
+	m_pd3dDevice->SetIndices(m_pIndexBuffer);
+
+	for (int i = 0; i < nChunks; i++)
+	{
+		LPDIRECT3DVERTEXBUFFER9 pVertexBuffer = GetVertexBuffer(m_apChunks[i]);
+		if (pVertexBuffer == NULL)
+			continue;
+
+		// The vertices are relative to the chunk center, which keeps them precise near the ground
+		const float* vCenter = m_apChunks[i]->pData->vCenter;
+		D3DXMATRIX mChunk;
+		D3DXMatrixTranslation(&mChunk, vCenter[0], vCenter[1], vCenter[2]);
+		mChunk *= mWorld;
+
+		StateCache::Get().SetTransform(D3DTS_WORLD, &mChunk);
+		m_pd3dDevice->SetStreamSource(0, pVertexBuffer, 0, sizeof(WL::TerrainVertex));
+		m_pd3dDevice->DrawIndexedPrimitive(D3DPT_TRIANGLELIST, 0, 0, WL::TerrainChunkData::VERTICES,
+										   0, WL::TerrainChunkData::INDICES / 3);
+		StateCache::Get().CountDraws();
+	}
+
+	StateCache::Get().SetRenderState(D3DRS_AMBIENTMATERIALSOURCE, D3DMCS_MATERIAL);
+	StateCache::Get().SetTransform(D3DTS_WORLD, &mWorld);
+}
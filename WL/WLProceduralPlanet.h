@@ -0,0 +1,46 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: WLProceduralPlanet.h
+//
+// Author: snez
+//
+// Desc: A planet whose surface is generated instead of loaded. The chunks a TerrainQuadtree
+//       picks for the camera are drawn from vertex buffers made as the chunks arrive, all
+//       sharing one index buffer, so the camera can go from orbit down to the ground with
+//       only the detail it sees in memory.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __WLProceduralPlanet_H__
+#define __WLProceduralPlanet_H__
+
+#include "dxstdafx.h"
+#include "WLGeneralObject.h"
+#include "WLTerrain.h"
+
+#define PROCEDURAL_PLANET_MAX_CHUNKS	4096		// Chunks drawn in a frame at most
+
+class ProceduralPlanet : public GeneralObject
+{
+public:
+	ProceduralPlanet(const WL::SceneObject* pSimulated, const WL::TerrainSettings& settings = WL::TerrainSettings());
+	~ProceduralPlanet();
+
+	void Render();
+	HRESULT OnCreateDevice(IDirect3DDevice9* pd3dDevice);
+	void OnDestroyDevice();
+
+	inline const WL::TerrainQuadtree::Stats& GetStats() const { return m_Terrain.GetStats(); }
+
+private:
+	static void EvictChunk(WL::TerrainQuadtree::Chunk* pChunk, void* pContext);
+	LPDIRECT3DVERTEXBUFFER9 GetVertexBuffer(WL::TerrainQuadtree::Chunk* pChunk);
+
+	IDirect3DDevice9*				m_pd3dDevice;
+	WL::TerrainSettings				m_Settings;
+	WL::TerrainQuadtree				m_Terrain;
+	LPDIRECT3DINDEXBUFFER9			m_pIndexBuffer;
+	WL::TerrainQuadtree::Chunk*		m_apChunks[PROCEDURAL_PLANET_MAX_CHUNKS];
+};
+
+#endif // __WLProceduralPlanet_H__
@@ -0,0 +1,350 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: WLProfiler.cpp
+//
+// Author: snez
+//
+// Desc: Scoped CPU zones written into per thread rings, added up once a frame.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "WLProfiler.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <wchar.h>
+
+#ifdef _WIN32
+	#define WL_THREAD_LOCAL __declspec(thread)
+#else
+	#define WL_THREAD_LOCAL __thread
+#endif
+
+namespace WL
+{
+
+	//
+	//	The ring of a thread. Only the thread writes it, and it publishes an event by
+	//	counting it in nWritten after the event is whole. Readers take the events below
+	//	nWritten, and drop the ones the writer may have lapped while they read: event n
+	//	shares its slot with event n + RING_SIZE, which the writer starts on as soon as
+	//	nWritten reaches n + RING_SIZE.
+	//
+	struct ProfilerThread
+	{
+		struct Event
+		{
+			const wchar_t*	strName;
+			double			fStart;
+			double			fEnd;
+			int				nDepth;
+		};
+
+		int				iThread;
+		unsigned long	nThreadID;
+		int				nDepth;				// Zones running, only touched by the thread
+		volatile long	nWritten;
+		long			nCollected;			// Events EndFrame() has seen, only touched by it
+		Event			aEvents[Profiler::RING_SIZE];
+	};
+
+}
+
+static WL_THREAD_LOCAL WL::ProfilerThread* t_pThread = NULL;
+
+//
+//	After event n was copied out of the ring, whether the writer may have been writing
+//	its slot meanwhile. The count is read only once the copy is done.
+//
+static inline bool IsLapped(WL::ProfilerThread* pThread, long n)
+{
+	return n + WL::Profiler::RING_SIZE <= WL::AtomicRead(&pThread->nWritten);
+}
+
+volatile bool WL::Profiler::s_bEnabled = false;
+
+WL::Profiler& WL::Profiler::Get()
+{
+	static Profiler s_profiler;
+	return s_profiler;
+}
+
+WL::Profiler::Profiler()
+{
+	m_nThreads = 0;
+	m_pstrNames = NULL;
+	m_nNames = 0;
+	m_nMaxNames = 0;
+	m_nZones = 0;
+	m_nLastZones = 0;
+	m_fFrameStart = GetTimeSeconds();
+	m_fLastFrameTime = 0.0;
+}
+
+//
+//	The rings outlive the threads that wrote them, their events are still collected
+//
+WL::Profiler::~Profiler()
+{
+	for (int i = 0; i < m_nThreads; i++)
+		delete m_apThreads[i];
+	for (int i = 0; i < m_nNames; i++)
+		free(m_pstrNames[i]);
+	free(m_pstrNames);
+}
+
+void WL::Profiler::SetEnabled(bool bEnabled)
+{
+	if (bEnabled && !s_bEnabled)
+	{
+		// Don't count the time the profiler was off in the first frame
+		m_fFrameStart = GetTimeSeconds();
+		m_nZones = 0;
+	}
+	s_bEnabled = bEnabled;
+}
+
+const wchar_t* WL::Profiler::Intern(const wchar_t* strName)
+{
+	ScopedLock lock(m_Mutex);
+
+	for (int i = 0; i < m_nNames; i++)
+		if (wcscmp(m_pstrNames[i], strName) == 0)
+			return m_pstrNames[i];
+
+	if (m_nNames == m_nMaxNames)
+	{
+		int nMaxNames = m_nMaxNames ? m_nMaxNames * 2 : 32;
+		wchar_t** pstrNames = (wchar_t**)realloc(m_pstrNames, nMaxNames * sizeof(wchar_t*));
+		if (pstrNames == NULL)
+			return L"?";
+		m_pstrNames = pstrNames;
+		m_nMaxNames = nMaxNames;
+	}
+
+	size_t nBytes = (wcslen(strName) + 1) * sizeof(wchar_t);
+	wchar_t* strCopy = (wchar_t*)malloc(nBytes);
+	if (strCopy == NULL)
+		return L"?";
+	memcpy(strCopy, strName, nBytes);
+
+	m_pstrNames[m_nNames++] = strCopy;
+	return strCopy;
+}
+
+//
+//	The ring of the calling thread, made the first time it profiles. NULL once all the
+//	rings are taken, and the thread's zones are dropped.
+//
+WL::ProfilerThread* WL::Profiler::GetThread()
+{
+	if (t_pThread)
+		return t_pThread;
+
+	ScopedLock lock(m_Mutex);
+	if (m_nThreads == MAX_THREADS)
+		return NULL;
+
+	ProfilerThread* pThread = new ProfilerThread;
+	pThread->iThread = m_nThreads;
+	pThread->nThreadID = GetCurrentThreadID();
+	pThread->nDepth = 0;
+	pThread->nWritten = 0;
+	pThread->nCollected = 0;
+
+	m_apThreads[m_nThreads++] = pThread;
+	t_pThread = pThread;
+	return pThread;
+}
+
+int WL::Profiler::GetThreads(ProfilerThread** apThreads)
+{
+	ScopedLock lock(m_Mutex);
+	for (int i = 0; i < m_nThreads; i++)
+		apThreads[i] = m_apThreads[i];
+	return m_nThreads;
+}
+
+double WL::Profiler::BeginZone()
+{
+	ProfilerThread* pThread = GetThread();
+	if (pThread == NULL)
+		return -1.0;
+
+	pThread->nDepth++;
+	return GetTimeSeconds();
+}
+
+void WL::Profiler::EndZone(const wchar_t* strName, double fStart)
+{
+	double fEnd = GetTimeSeconds();
+
+	ProfilerThread* pThread = t_pThread;
+	pThread->nDepth--;
+
+	ProfilerThread::Event& event = pThread->aEvents[pThread->nWritten % RING_SIZE];
+	event.strName = strName;
+	event.fStart = fStart;
+	event.fEnd = fEnd;
+	event.nDepth = pThread->nDepth;
+
+	// The increment orders the writes above before it
+	AtomicIncrement(&pThread->nWritten);
+}
+
+void WL::Profiler::AddEvent(int iThread, const wchar_t* strName, int nDepth, double fStart, double fEnd)
+{
+	int i = 0;
+	while (i < m_nZones && (m_aZones[i].iThread != iThread || m_aZones[i].nDepth != nDepth ||
+							wcscmp(m_aZones[i].strName, strName) != 0))
+		i++;
+
+	if (i == m_nZones)
+	{
+		if (m_nZones == MAX_ZONES)
+			return;
+
+		m_aZones[i].strName = strName;
+		m_aZones[i].iThread = iThread;
+		m_aZones[i].nDepth = nDepth;
+		m_aZones[i].nCalls = 0;
+		m_aZones[i].fTime = 0.0;
+		m_aZones[i].fFirstStart = fStart;
+		m_nZones++;
+	}
+
+	Zone& zone = m_aZones[i];
+	zone.nCalls++;
+	zone.fTime += (fEnd - fStart) * 1000.0;
+	if (fStart < zone.fFirstStart)
+		zone.fFirstStart = fStart;
+}
+
+void WL::Profiler::EndFrame()
+{
+	if (!s_bEnabled)
+		return;
+
+	ProfilerThread* apThreads[MAX_THREADS];
+	int nThreads = GetThreads(apThreads);
+
+	for (int t = 0; t < nThreads; t++)
+	{
+		ProfilerThread* pThread = apThreads[t];
+		long nWritten = AtomicRead(&pThread->nWritten);
+		long nFirst = pThread->nCollected;
+		if (nFirst < nWritten - RING_SIZE)
+			nFirst = nWritten - RING_SIZE;
+
+		for (long n = nFirst; n < nWritten; n++)
+		{
+			ProfilerThread::Event event = pThread->aEvents[n % RING_SIZE];
+
+			// Lapped by the writer while it was copied
+			if (IsLapped(pThread, n))
+				continue;
+
+			AddEvent(pThread->iThread, event.strName, event.nDepth, event.fStart, event.fEnd);
+		}
+		pThread->nCollected = nWritten;
+	}
+
+	// Parents start before their children, so the start orders the zones like a tree
+	for (int i = 1; i < m_nZones; i++)
+	{
+		Zone zone = m_aZones[i];
+		int j = i;
+		while (j > 0 && (m_aZones[j - 1].iThread > zone.iThread ||
+						 (m_aZones[j - 1].iThread == zone.iThread && m_aZones[j - 1].fFirstStart > zone.fFirstStart)))
+		{
+			m_aZones[j] = m_aZones[j - 1];
+			j--;
+		}
+		m_aZones[j] = zone;
+	}
+
+	memcpy(m_aLastZones, m_aZones, m_nZones * sizeof(Zone));
+	m_nLastZones = m_nZones;
+	m_nZones = 0;
+
+	double fNow = GetTimeSeconds();
+	m_fLastFrameTime = (fNow - m_fFrameStart) * 1000.0;
+	m_fFrameStart = fNow;
+}
+
+//
+//	Names are written as they are, only ASCII is expected in them
+//
+static void WriteTraceName(FILE* pFile, const wchar_t* strName)
+{
+	for (; *strName; strName++)
+	{
+		wchar_t c = *strName;
+		if (c < 0x20 || c >= 0x7f)
+			c = L'?';
+		if (c == L'"' || c == L'\\')
+			fputc('\\', pFile);
+		fputc((char)c, pFile);
+	}
+}
+
+bool WL::Profiler::WriteChromeTrace(const wchar_t* strFileName)
+{
+	// The file name goes through the narrow runtime, so it is ASCII too
+	char strPath[260];
+	size_t n = 0;
+	for (; strFileName[n] && n < sizeof(strPath) - 1; n++)
+		strPath[n] = (strFileName[n] < 0x80) ? (char)strFileName[n] : '_';
+	strPath[n] = 0;
+
+	FILE* pFile = fopen(strPath, "w");
+	if (pFile == NULL)
+		return false;
+
+	ProfilerThread* apThreads[MAX_THREADS];
+	int nThreads = GetThreads(apThreads);
+
+	// Time stamps are microseconds from the oldest event kept
+	double fOrigin = -1.0;
+	for (int t = 0; t < nThreads; t++)
+	{
+		long nWritten = AtomicRead(&apThreads[t]->nWritten);
+		long nFirst = nWritten > RING_SIZE ? nWritten - RING_SIZE : 0;
+		if (nFirst < nWritten)
+		{
+			double fStart = apThreads[t]->aEvents[nFirst % RING_SIZE].fStart;
+			if (fOrigin < 0.0 || fStart < fOrigin)
+				fOrigin = fStart;
+		}
+	}
+
+	fprintf(pFile, "{\"traceEvents\":[\n");
+	bool bFirst = true;
+	for (int t = 0; t < nThreads; t++)
+	{
+		ProfilerThread* pThread = apThreads[t];
+
+		fprintf(pFile, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%lu,\"args\":{\"name\":\"Thread %d\"}}",
+				bFirst ? "" : ",\n", pThread->nThreadID, pThread->iThread);
+		bFirst = false;
+
+		long nWritten = AtomicRead(&pThread->nWritten);
+		long nFirst = nWritten > RING_SIZE ? nWritten - RING_SIZE : 0;
+		for (long n = nFirst; n < nWritten; n++)
+		{
+			ProfilerThread::Event event = pThread->aEvents[n % RING_SIZE];
+			if (IsLapped(pThread, n))
+				continue;
+
+			fprintf(pFile, ",\n{\"name\":\"");
+			WriteTraceName(pFile, event.strName);
+			fprintf(pFile, "\",\"cat\":\"cpu\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%lu}",
+					(event.fStart - fOrigin) * 1000000.0, (event.fEnd - event.fStart) * 1000000.0, pThread->nThreadID);
+		}
+	}
+	fprintf(pFile, "\n],\"displayTimeUnit\":\"ms\"}\n");
+
+	bool bResult = ferror(pFile) == 0;
+	fclose(pFile);
+	return bResult;
+}
@@ -0,0 +1,153 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: WLProfiler.h
+//
+// Author: snez
+//
+// Desc: A CPU profiler made of scoped zones. A zone times the block it is declared in
+//       and, once the block ends, writes the time into a ring of events that belongs to
+//       the thread. No lock is taken and nothing allocates on the way. Zones nest, and
+//       every event keeps how deep it was.
+//
+//       Once a frame EndFrame() collects the events the threads finished and adds them up
+//       by name and depth for the overlay. WriteChromeTrace() saves whatever the rings
+//       still hold as a trace that chrome://tracing opens.
+//
+//       While the profiler is off a zone costs a test of one flag. Defining WL_PROFILING
+//       as 0 takes the zones out of the build.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __WLProfiler_H__
+#define __WLProfiler_H__
+
+#include "WLPlatform.h"
+
+#ifndef WL_PROFILING
+	#define WL_PROFILING 1
+#endif
+
+namespace WL
+{
+
+	struct ProfilerThread;
+
+	class Profiler
+	{
+	public:
+		//
+		//	The time of the zones sharing a name and depth on a thread, over a frame
+		//
+		struct Zone
+		{
+			const wchar_t*	strName;
+			int				iThread;			// In the order the threads first profiled
+			int				nDepth;
+			unsigned int	nCalls;
+			double			fTime;				// Milliseconds
+			double			fFirstStart;		// Seconds, orders the zones like they ran
+		};
+
+		enum
+		{
+			MAX_THREADS = 16,
+			MAX_ZONES = 64,						// On the overlay, a frame
+			RING_SIZE = 4096					// Events kept per thread, a frame must not wrap it
+		};
+
+		static Profiler& Get();
+
+		inline static bool IsEnabled() { return s_bEnabled; }
+		void SetEnabled(bool bEnabled);
+
+		//
+		//	A copy of strName that is never freed, for zones named by a buffer that may go
+		//	away before the events do
+		//
+		const wchar_t* Intern(const wchar_t* strName);
+
+		//
+		//	Collects the events finished since the last call. Zones still running are
+		//	counted in the frame they end in.
+		//
+		void EndFrame();
+
+		inline int GetZoneCount() const { return m_nLastZones; }
+		inline const Zone& GetZone(int i) const { return m_aLastZones[i]; }
+		inline double GetFrameTime() const { return m_fLastFrameTime; }		// Milliseconds
+
+		//
+		//	Saves the events in the rings in the Chrome trace format
+		//
+		bool WriteChromeTrace(const wchar_t* strFileName);
+
+		// Used by ProfileZone
+		double BeginZone();
+		void EndZone(const wchar_t* strName, double fStart);
+
+	private:
+		Profiler();
+		~Profiler();
+		Profiler(const Profiler&);
+		Profiler& operator=(const Profiler&);
+
+		ProfilerThread* GetThread();
+		int GetThreads(ProfilerThread** apThreads);
+		void AddEvent(int iThread, const wchar_t* strName, int nDepth, double fStart, double fEnd);
+
+		static volatile bool	s_bEnabled;
+
+		Mutex				m_Mutex;				// Registering threads and interning names
+		ProfilerThread*		m_apThreads[MAX_THREADS];
+		int					m_nThreads;
+		wchar_t**			m_pstrNames;
+		int					m_nNames;
+		int					m_nMaxNames;
+
+		Zone				m_aZones[MAX_ZONES];	// Of the frame being collected
+		int					m_nZones;
+		Zone				m_aLastZones[MAX_ZONES];
+		int					m_nLastZones;
+		double				m_fFrameStart;
+		double				m_fLastFrameTime;
+	};
+
+	//
+	//	Times the scope it is declared in
+	//
+	class ProfileZone
+	{
+	public:
+		inline explicit ProfileZone(const wchar_t* strName) : m_strName(strName), m_fStart(-1.0)
+		{
+			if (Profiler::IsEnabled())
+				m_fStart = Profiler::Get().BeginZone();
+		}
+
+		inline ~ProfileZone()
+		{
+			// A zone that started is ended even if the profiler was turned off meanwhile,
+			// so the depth stays right
+			if (m_fStart >= 0.0)
+				Profiler::Get().EndZone(m_strName, m_fStart);
+		}
+
+	private:
+		ProfileZone(const ProfileZone&);
+		ProfileZone& operator=(const ProfileZone&);
+
+		const wchar_t*	m_strName;
+		double			m_fStart;
+	};
+
+}
+
+#if WL_PROFILING
+	#define WL_PROFILE_CONCAT2(a, b)	a##b
+	#define WL_PROFILE_CONCAT(a, b)		WL_PROFILE_CONCAT2(a, b)
+	#define WL_PROFILE_ZONE(name)		WL::ProfileZone WL_PROFILE_CONCAT(profileZone, __LINE__)(name)
+#else
+	#define WL_PROFILE_ZONE(name)
+#endif
+
+#endif // __WLProfiler_H__
@@ -0,0 +1,177 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: WLRenderQueue.cpp
+//
+// Author: snez
+//
+// Desc: The packets of a frame, sorted by their state and drawn in that order.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "WLRenderQueue.h"
+#include "WLGpuProfiler.h"
+
+//
+//	Key layout, from the most significant bit
+//
+//	  Opaque:		pass 4 | effect 12 | texture 16 | distance 32
+//	  Transparent:	pass 4 | far to near 32 | effect 12 | texture 16
+//
+#define RQ_EFFECT_BITS		12
+#define RQ_TEXTURE_BITS		16
+
+RenderQueue::RenderQueue()
+{
+	m_vCamera = D3DXVECTOR3(0, 0, 0);
+	ZeroMemory(&m_Stats, sizeof(m_Stats));
+}
+
+void RenderQueue::Begin(const D3DXVECTOR3& vCamera)
+{
+	m_vCamera = vCamera;
+	m_Packets.clear();
+	m_Items.clear();
+}
+
+//
+//	The effects and textures are told apart by their addresses. Two of them landing on the
+//	same id only cost a state change that sorting could have saved, never a wrong draw,
+//	since the packet keeps the pointers themselves. NULL is always 0, so the fixed
+//	function packets come first.
+//
+UINT RenderQueue::HashPointer(const void* p, int nBits)
+{
+	if (p == NULL)
+		return 0;
+
+	// Allocations are aligned, the low bits say nothing
+	UINT n = (UINT)((UINT_PTR)p >> 4);
+	n *= 2654435761u;
+	n >>= 32 - nBits;
+	return n ? n : 1;
+}
+
+void RenderQueue::Submit(EPass ePass, ID3DXEffect* pEffect, LPDIRECT3DBASETEXTURE9 pTexture, const D3DXVECTOR3& vPosition,
+						 DrawFunction pfnDraw, void* pObject, UINT nParam, DWORD dwFlags)
+{
+	Packet packet;
+	packet.ePass = ePass;
+	packet.pEffect = pEffect;
+	packet.pTexture = pTexture;
+	packet.pfnDraw = pfnDraw;
+	packet.pObject = pObject;
+	packet.nParam = nParam;
+	packet.dwFlags = dwFlags;
+
+	// A positive float orders the same as its bits, so the squared distance is the key
+	D3DXVECTOR3 vDistance = vPosition - m_vCamera;
+	float fDistance = D3DXVec3LengthSq(&vDistance);
+	UINT nDistance = *(UINT*)&fDistance;
+
+	UINT64 nEffect = HashPointer(pEffect, RQ_EFFECT_BITS);
+	UINT64 nTexture = HashPointer(pTexture, RQ_TEXTURE_BITS);
+	UINT64 nKey = (UINT64)ePass << 60;
+	if (ePass == PASS_OPAQUE)
+		nKey |= (nEffect << 48) | (nTexture << 32) | nDistance;
+	else
+		nKey |= ((UINT64)~nDistance << 28) | (nEffect << 16) | nTexture;
+
+	SortItem item;
+	item.nKey = nKey;
+	item.iPacket = (UINT)m_Packets.size();
+
+	m_Packets.push_back(packet);
+	m_Items.push_back(item);
+}
+
+//
+//	Least significant digit first, eight bits at a time. Every pass is stable, so the
+//	order of the lower digits survives the higher ones, and packets with equal keys stay
+//	in the order they were submitted. A digit all the keys share is skipped.
+//
+void RenderQueue::Sort()
+{
+	UINT nItems = (UINT)m_Items.size();
+	if (nItems < 2)
+		return;
+
+	m_Scratch.resize(nItems);
+	SortItem* pSrc = &m_Items[0];
+	SortItem* pDst = &m_Scratch[0];
+
+	for (int nShift = 0; nShift < 64; nShift += 8)
+	{
+		UINT anCount[256];
+		ZeroMemory(anCount, sizeof(anCount));
+		for (UINT i = 0; i < nItems; i++)
+			anCount[(pSrc[i].nKey >> nShift) & 0xff]++;
+
+		if (anCount[(pSrc[0].nKey >> nShift) & 0xff] == nItems)
+			continue;
+
+		UINT nOffset = 0;
+		for (int i = 0; i < 256; i++)
+		{
+			UINT n = anCount[i];
+			anCount[i] = nOffset;
+			nOffset += n;
+		}
+
+		for (UINT i = 0; i < nItems; i++)
+			pDst[anCount[(pSrc[i].nKey >> nShift) & 0xff]++] = pSrc[i];
+
+		SortItem* pTemp = pSrc;
+		pSrc = pDst;
+		pDst = pTemp;
+	}
+
+	if (pSrc != &m_Items[0])
+		m_Items.swap(m_Scratch);
+}
+
+void RenderQueue::Execute(IDirect3DDevice9* pd3dDevice)
+{
+	WL_PROFILE_STAGE(L"RenderQueue::Execute");
+	ZeroMemory(&m_Stats, sizeof(m_Stats));
+	m_Stats.nPackets = (UINT)m_Packets.size();
+	if (m_Packets.empty())
+		return;
+
+	// What drawing in the order the objects came would have switched
+	for (UINT i = 1; i < m_Packets.size(); i++)
+	{
+		if (m_Packets[i].pEffect != m_Packets[i - 1].pEffect)
+			m_Stats.nUnsortedChanges++;
+		if (m_Packets[i].pTexture != m_Packets[i - 1].pTexture)
+			m_Stats.nUnsortedChanges++;
+	}
+
+	Sort();
+
+	// Whatever was drawn before the queue left stage 0 unknown
+	bool bTextureKnown = false;
+	LPDIRECT3DBASETEXTURE9 pTexture = NULL;
+
+	for (UINT i = 0; i < m_Items.size(); i++)
+	{
+		const Packet& packet = m_Packets[m_Items[i].iPacket];
+
+		if (i == 0 || packet.ePass != m_Packets[m_Items[i - 1].iPacket].ePass)
+			m_Stats.nPassChanges++;
+		if (i == 0 || packet.pEffect != m_Packets[m_Items[i - 1].iPacket].pEffect)
+			m_Stats.nEffectChanges++;
+
+		if (!(packet.dwFlags & RQ_SETS_TEXTURES) && (!bTextureKnown || packet.pTexture != pTexture))
+		{
+			pd3dDevice->SetTexture(0, packet.pTexture);
+			pTexture = packet.pTexture;
+			bTextureKnown = true;
+			m_Stats.nTextureChanges++;
+		}
+
+		packet.pfnDraw(packet.pObject, packet.nParam);
+
+		if (packet.dwFlags & RQ_SETS_TEXTURES)
+			bTextureKnown = false;
+	}
+}
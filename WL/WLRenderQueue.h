@@ -0,0 +1,104 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: WLRenderQueue.h
+//
+// Author: snez
+//
+// Desc: The draws of a frame, collected before any of them runs. Every object submits
+//       packets, a mesh subset or a particle system each, with a key made of the pass,
+//       the effect, the texture and the distance from the camera. The keys are radix
+//       sorted and the packets drawn in that order, so packets sharing an effect or a
+//       texture follow each other and the texture is set once for all of them.
+//
+//       Opaque packets are drawn front to back within each effect and texture, so the
+//       depth test throws away what is hidden. Transparent packets are drawn back to
+//       front, the distance coming before the effect and texture in their keys.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __WLRenderQueue_H__
+#define __WLRenderQueue_H__
+
+#include "dxstdafx.h"
+#include <vector>
+
+#define RQ_SETS_TEXTURES		0x1			// The draw sets its own textures, the queue leaves them to it
+
+class RenderQueue
+{
+public:
+	//
+	//	In the order they are drawn
+	//
+	enum EPass
+	{
+		PASS_OPAQUE,
+		PASS_TRANSPARENT,
+		PASS_OVERLAY,
+	};
+
+	//
+	//	Draws one packet. Unless the packet was submitted with RQ_SETS_TEXTURES, its
+	//	texture is set on stage 0 and the draw must leave it there.
+	//
+	typedef void (*DrawFunction)(void* pObject, UINT nParam);
+
+	struct Stats
+	{
+		UINT	nPackets;
+		UINT	nPassChanges;
+		UINT	nEffectChanges;
+		UINT	nTextureChanges;		// That reached the device
+		UINT	nUnsortedChanges;		// Effect and texture changes the submission order would have had
+	};
+
+	RenderQueue();
+
+	//
+	//	Starts collecting the packets of a frame, seen from vCamera
+	//
+	void Begin(const D3DXVECTOR3& vCamera);
+
+	//
+	//	A NULL effect draws with the fixed function pipeline. vPosition is in world space
+	//	and only used for the distance.
+	//
+	void Submit(EPass ePass, ID3DXEffect* pEffect, LPDIRECT3DBASETEXTURE9 pTexture, const D3DXVECTOR3& vPosition,
+				DrawFunction pfnDraw, void* pObject, UINT nParam = 0, DWORD dwFlags = 0);
+
+	//
+	//	Sorts and draws the packets
+	//
+	void Execute(IDirect3DDevice9* pd3dDevice);
+
+	inline const Stats& GetStats() const { return m_Stats; }
+
+private:
+	struct Packet
+	{
+		EPass					ePass;
+		ID3DXEffect*			pEffect;
+		LPDIRECT3DBASETEXTURE9	pTexture;
+		DrawFunction			pfnDraw;
+		void*					pObject;
+		UINT					nParam;
+		DWORD					dwFlags;
+	};
+
+	struct SortItem
+	{
+		UINT64		nKey;
+		UINT		iPacket;
+	};
+
+	static UINT HashPointer(const void* p, int nBits);
+	void Sort();
+
+	D3DXVECTOR3				m_vCamera;
+	std::vector<Packet>		m_Packets;			// Kept between frames, so they don't allocate
+	std::vector<SortItem>	m_Items;
+	std::vector<SortItem>	m_Scratch;
+	Stats					m_Stats;
+};
+
+#endif // __WLRenderQueue_H__
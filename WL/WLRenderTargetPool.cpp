@@ -0,0 +1,224 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: WLRenderTargetPool.cpp
+//
+// Author: snez
+//
+// Desc: Render targets shared between post-processing stages that don't overlap.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "WLRenderTargetPool.h"
+
+RenderTargetPool::RenderTargetPool()
+{
+	ZeroMemory(&m_Stats, sizeof(m_Stats));
+}
+
+RenderTargetPool::~RenderTargetPool()
+{
+	Release();
+}
+
+UINT RenderTargetPool::GetBytesPerPixel(D3DFORMAT format)
+{
+	switch (format)
+	{
+		case D3DFMT_A32B32G32R32F:
+			return 16;
+		case D3DFMT_A16B16G16R16F:
+		case D3DFMT_A16B16G16R16:
+		case D3DFMT_G32R32F:
+			return 8;
+		case D3DFMT_A8R8G8B8:
+		case D3DFMT_X8R8G8B8:
+		case D3DFMT_A8B8G8R8:
+		case D3DFMT_A2R10G10B10:
+		case D3DFMT_A2B10G10R10:
+		case D3DFMT_G16R16F:
+		case D3DFMT_R32F:
+			return 4;
+		case D3DFMT_R16F:
+		case D3DFMT_R5G6B5:
+		case D3DFMT_A1R5G5B5:
+		case D3DFMT_L16:
+			return 2;
+		case D3DFMT_A8:
+		case D3DFMT_L8:
+			return 1;
+	}
+	return 4;
+}
+
+RenderTargetPool::Handle RenderTargetPool::Declare(UINT width, UINT height, D3DFORMAT format,
+												   int nFirst, int nLast, DWORD dwFlags)
+{
+	Target target;
+	target.Width = width;
+	target.Height = height;
+	target.Format = format;
+	target.Flags = dwFlags;
+	target.First = nFirst;
+	target.Last = nFirst == RTP_PERSISTENT ? RTP_PERSISTENT : max(nFirst, nLast);
+	target.Texture = -1;
+
+	if (FAILED(m_Targets.Add(target)))
+		return -1;
+
+	return m_Targets.GetSize() - 1;
+}
+
+HRESULT RenderTargetPool::Allocate(IDirect3DDevice9* pd3dDevice)
+{
+	HRESULT hr;
+	int nTargets = m_Targets.GetSize();
+
+	// Place the targets in the order they come to life, persistent ones first
+	int* aOrder = new int[nTargets];
+	for (int i = 0; i < nTargets; i++)
+	{
+		int j = i;
+		while (j > 0 && m_Targets[aOrder[j - 1]].First > m_Targets[i].First)
+		{
+			aOrder[j] = aOrder[j - 1];
+			j--;
+		}
+		aOrder[j] = i;
+	}
+
+	m_Stats.nTargets = nTargets;
+	m_Stats.nTotalBytes = 0;
+	m_Stats.nAllocatedBytes = 0;
+
+	for (int i = 0; i < nTargets; i++)
+	{
+		Target& target = m_Targets[aOrder[i]];
+		bool bPersistent = target.First == RTP_PERSISTENT;
+		UINT nBytes = target.Width * target.Height * GetBytesPerPixel(target.Format);
+		m_Stats.nTotalBytes += nBytes;
+
+		// Of the textures that are free again by the time this target starts, take the
+		// one freed last, so earlier ones stay available for longer gaps
+		int iBest = -1;
+		if (!bPersistent)
+		{
+			for (int t = 0; t < m_Textures.GetSize(); t++)
+			{
+				Texture& texture = m_Textures[t];
+				if (texture.bPersistent || texture.Last >= target.First)
+					continue;
+				if (texture.Width != target.Width || texture.Height != target.Height ||
+					texture.Format != target.Format || texture.Flags != target.Flags)
+					continue;
+				if (iBest < 0 || texture.Last > m_Textures[iBest].Last)
+					iBest = t;
+			}
+		}
+
+		if (iBest >= 0)
+		{
+			m_Textures[iBest].Last = target.Last;
+			target.Texture = iBest;
+			continue;
+		}
+
+		Texture texture;
+		texture.Width = target.Width;
+		texture.Height = target.Height;
+		texture.Format = target.Format;
+		texture.Flags = target.Flags;
+		texture.Last = target.Last;
+		texture.bPersistent = bPersistent;
+		texture.pTexture = NULL;
+
+		hr = pd3dDevice->CreateTexture(target.Width, target.Height, 1, D3DUSAGE_RENDERTARGET,
+									   target.Format, D3DPOOL_DEFAULT, &texture.pTexture, NULL);
+		if (FAILED(hr))
+		{
+			delete[] aOrder;
+			return DXUT_ERR(L"CreateTexture", hr);
+		}
+
+		// Start out black, bordered targets rely on it
+		LPDIRECT3DSURFACE9 pSurface = NULL;
+		if (SUCCEEDED(texture.pTexture->GetSurfaceLevel(0, &pSurface)))
+		{
+			pd3dDevice->ColorFill(pSurface, NULL, D3DCOLOR_ARGB(0, 0, 0, 0));
+			SAFE_RELEASE(pSurface);
+		}
+
+		if (FAILED(m_Textures.Add(texture)))
+		{
+			SAFE_RELEASE(texture.pTexture);
+			delete[] aOrder;
+			return E_OUTOFMEMORY;
+		}
+
+		target.Texture = m_Textures.GetSize() - 1;
+		m_Stats.nAllocatedBytes += nBytes;
+	}
+
+	delete[] aOrder;
+
+	m_Stats.nTextures = m_Textures.GetSize();
+	ComputePeak();
+
+	return S_OK;
+}
+
+//
+//	The most memory that has to be live at once, the least any sharing could get to
+//
+void RenderTargetPool::ComputePeak()
+{
+	int nFirst = INT_MAX;
+	int nLast = INT_MIN;
+	for (int i = 0; i < m_Targets.GetSize(); i++)
+	{
+		if (m_Targets[i].First == RTP_PERSISTENT)
+			continue;
+		nFirst = min(nFirst, m_Targets[i].First);
+		nLast = max(nLast, m_Targets[i].Last);
+	}
+
+	// Only persistent targets, they are all live at any stage
+	if (nFirst > nLast)
+		nFirst = nLast = 0;
+
+	m_Stats.nPeakBytes = 0;
+	for (int stage = nFirst; stage <= nLast; stage++)
+	{
+		UINT nBytes = 0;
+		for (int i = 0; i < m_Targets.GetSize(); i++)
+		{
+			Target& target = m_Targets[i];
+			bool bLive = target.First == RTP_PERSISTENT || (target.First <= stage && stage <= target.Last);
+			if (bLive)
+				nBytes += target.Width * target.Height * GetBytesPerPixel(target.Format);
+		}
+		m_Stats.nPeakBytes = max(m_Stats.nPeakBytes, nBytes);
+	}
+}
+
+LPDIRECT3DTEXTURE9 RenderTargetPool::GetTexture(Handle hTarget)
+{
+	if (hTarget < 0 || hTarget >= m_Targets.GetSize())
+		return NULL;
+
+	int iTexture = m_Targets[hTarget].Texture;
+	if (iTexture < 0)
+		return NULL;
+
+	LPDIRECT3DTEXTURE9 pTexture = m_Textures[iTexture].pTexture;
+	pTexture->AddRef();
+	return pTexture;
+}
+
+void RenderTargetPool::Release()
+{
+	for (int i = 0; i < m_Textures.GetSize(); i++)
+		SAFE_RELEASE(m_Textures[i].pTexture);
+
+	m_Textures.RemoveAll();
+	m_Targets.RemoveAll();
+}
@@ -0,0 +1,96 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: WLRenderTargetPool.h
+//
+// Author: snez
+//
+// Desc: Render targets for a chain of post-processing stages. Each target is declared with
+//       the first and last stage that touches it, and targets of the same size and format
+//       whose stages don't overlap end up sharing one texture. Targets that have to keep
+//       their contents from one frame to the next are declared persistent and get a
+//       texture of their own.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __WLRenderTargetPool_H__
+#define __WLRenderTargetPool_H__
+
+#include "dxstdafx.h"
+
+#define RTP_PERSISTENT		-1		// Pass as the first stage of a target that lives across frames
+#define RTP_BORDERED		0x1		// Target keeps a one texel black border (written with scissor)
+
+class RenderTargetPool
+{
+public:
+	typedef int Handle;
+
+	struct Stats
+	{
+		UINT	nTargets;			// Targets declared
+		UINT	nTextures;			// Textures actually created
+		UINT	nTotalBytes;		// Memory the targets would take without sharing
+		UINT	nAllocatedBytes;	// Memory of the textures created
+		UINT	nPeakBytes;			// Largest amount of memory live during any one stage
+	};
+
+	RenderTargetPool();
+	~RenderTargetPool();
+
+	//
+	//	Declare a target used from stage nFirst to stage nLast, both included. Stages are
+	//	just increasing numbers in the order the passes run in. Declarations are collected
+	//	until Allocate() and dropped again by Release().
+	//
+	Handle Declare(UINT width, UINT height, D3DFORMAT format, int nFirst, int nLast, DWORD dwFlags = 0);
+
+	//
+	//	Works out which targets can share a texture and creates the textures
+	//
+	HRESULT Allocate(IDirect3DDevice9* pd3dDevice);
+
+	//
+	//	The texture behind a target, with a new reference
+	//
+	LPDIRECT3DTEXTURE9 GetTexture(Handle hTarget);
+
+	//
+	//	Release the textures and forget the declarations (on lost device)
+	//
+	void Release();
+
+	inline const Stats& GetStats() const { return m_Stats; }
+
+	static UINT GetBytesPerPixel(D3DFORMAT format);
+
+private:
+	struct Target
+	{
+		UINT		Width;
+		UINT		Height;
+		D3DFORMAT	Format;
+		DWORD		Flags;
+		int			First;
+		int			Last;
+		int			Texture;		// Index into m_Textures once allocated
+	};
+
+	struct Texture
+	{
+		UINT				Width;
+		UINT				Height;
+		D3DFORMAT			Format;
+		DWORD				Flags;
+		int					Last;		// Last stage of the latest target placed in it
+		bool				bPersistent;
+		LPDIRECT3DTEXTURE9	pTexture;
+	};
+
+	void ComputePeak();
+
+	CGrowableArray<Target>		m_Targets;
+	CGrowableArray<Texture>		m_Textures;
+	Stats						m_Stats;
+};
+
+#endif // __WLRenderTargetPool_H__
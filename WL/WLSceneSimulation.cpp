@@ -0,0 +1,351 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: WLSceneSimulation.cpp
+//
+// Author: snez
+//
+// Desc: The objects, particles and camera of the scene, stepped without a device.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "WLSceneSimulation.h"
+#include "WLProfiler.h"
+#include <math.h>
+
+//
+//	Objects
+//
+WL::SceneObject::SceneObject()
+{
+	m_vVelocity = D3DXVECTOR3(0,0,0);
+	D3DXMatrixIdentity(&m_mWorldMatrix);
+	m_RenderMatrix.Back() = m_mWorldMatrix;
+	m_RenderMatrix.Flip();
+}
+
+void WL::SceneObject::Publish()
+{
+	m_RenderMatrix.Back() = m_mWorldMatrix;
+}
+
+void WL::SceneObject::Flip()
+{
+	m_RenderMatrix.Flip();
+}
+
+D3DXVECTOR3 WL::SceneObject::GetPosition() const
+{
+	return D3DXVECTOR3(m_mWorldMatrix._41, m_mWorldMatrix._42, m_mWorldMatrix._43);
+}
+
+void WL::SceneObject::SetPosition(const D3DXVECTOR3& vPosition)
+{
+	m_mWorldMatrix._41 = vPosition.x;
+	m_mWorldMatrix._42 = vPosition.y;
+	m_mWorldMatrix._43 = vPosition.z;
+}
+
+D3DXVECTOR3 WL::SceneObject::GetRenderPosition() const
+{
+	const D3DXMATRIX& matrix = GetRenderMatrix();
+	return D3DXVECTOR3(matrix._41, matrix._42, matrix._43);
+}
+
+WL::CometObject::CometObject()
+	: m_Tail(D3DXVECTOR3(0,0,0), 30.0f,-25.0f, 30.0f, 30.0f, 500)
+{
+	m_Tail.SetColor(D3DXCOLOR(1.0f,1.0f,0.0f,1.0f), D3DXCOLOR(0.6f,0.6f,0.6f,0.0f), D3DXCOLOR(1.0f,0.0f,0.0f,0.0f), D3DXCOLOR(0.1f,0.1f,0.1f,0.0f));
+	m_Tail.SetLife(1.0f,20.0f);
+	m_Tail.SetSize(3.0f,15.0f);
+	m_Tail.SetVelocity(2.0f,6.0f);
+	m_Tail.Start();
+
+	m_vVelocity = D3DXVECTOR3(-0.2f,-0.2f,0);
+}
+
+void WL::CometObject::Update(float fDelta)
+{
+	D3DXMATRIX matTemp;
+	D3DXMATRIX matRot;
+
+	D3DXMatrixIdentity(&matRot);
+	D3DXMatrixRotationX(&matTemp, fDelta * (10 * DEG_TO_RAD) );
+	D3DXMatrixMultiply(&matRot, &matRot, &matTemp);
+	D3DXMatrixRotationX(&matTemp, fDelta * (10 * DEG_TO_RAD));
+	D3DXMatrixMultiply(&matRot, &matRot, &matTemp);
+
+	D3DXMatrixMultiply(&m_mWorldMatrix, &matRot, &m_mWorldMatrix);
+
+	D3DXVECTOR3 pos = GetPosition();
+	pos += m_vVelocity * fDelta;
+	SetPosition(pos);
+	m_Tail.SetPosition(pos);
+	m_Tail.Update(fDelta);
+}
+
+void WL::CometObject::Publish()
+{
+	SceneObject::Publish();
+	m_Tail.Publish();
+}
+
+void WL::CometObject::Flip()
+{
+	SceneObject::Flip();
+	m_Tail.Flip();
+}
+
+WL::SpaceshipObject::SpaceshipObject()
+	: m_Exhaust(D3DXVECTOR3(0,0,0), 0.0f,0.0f, 30.0f, 30.0f, 200),
+	  m_Dust(D3DXVECTOR3(0,0,0), 0.0f,0.0f, 40.0f, 40.0f, 1000)
+{
+	m_Exhaust.SetColor(D3DXCOLOR(1.0f,0.8f,0.5f,1.0f), D3DXCOLOR(0.1f,0.1f,0.1f,0.0f), D3DXCOLOR(0.0f,0.0f,1.0f,0.0f), D3DXCOLOR(0.1f,0.1f,0.1f,0.0f));
+	m_Exhaust.SetLife(0.4f,0.8f);
+	m_Exhaust.SetSize(2.0f,6.0f);
+	m_Exhaust.SetVelocity(0,36.0f);
+	m_Exhaust.Start();
+
+	m_Dust.SetColor(D3DXCOLOR(0.8f,0.8f,1.0f,1.0f), D3DXCOLOR(0.6f,0.6f,0.0f,0.0f), D3DXCOLOR(0.0f,0.0f,0.0f,0.0f), D3DXCOLOR(0.1f,0.1f,0.1f,0.0f));
+	m_Dust.SetLife(2.0f,10.0f);
+	m_Dust.SetSize(0.0f,4.0f);
+	m_Dust.SetVelocity(50,150.0f);
+	m_Dust.Start();
+
+	//m_vVelocity = D3DXVECTOR3(0,0,-1.0f);
+	m_vVelocity = D3DXVECTOR3(0,0, 0);
+}
+
+void WL::SpaceshipObject::Update(float fDelta)
+{
+	D3DXVECTOR3 pos = GetPosition();
+	pos += m_vVelocity * fDelta;
+	SetPosition(pos);
+	pos.z += 8.0f;
+	m_Exhaust.SetPosition(pos);
+	m_Exhaust.Update(fDelta);
+	pos.z -= 108.0f;
+	m_Dust.SetPosition(pos);
+	m_Dust.Update(fDelta);
+}
+
+void WL::SpaceshipObject::Publish()
+{
+	SceneObject::Publish();
+	m_Exhaust.Publish();
+	m_Dust.Publish();
+}
+
+void WL::SpaceshipObject::Flip()
+{
+	SceneObject::Flip();
+	m_Exhaust.Flip();
+	m_Dust.Flip();
+}
+
+//
+//	Camera
+//
+const WL::SceneCamera::Mode WL::SceneCamera::s_aModes[SCENE_CAMERA_MODES] =
+{
+	{ 90.0f, 75.0f, 0.0f, D3DX_PI * 0.12f, D3DX_PI * 2.0f, 30.0f, -1 },
+	{ 60.0f, 60.0f, 10.0f, D3DX_PI * 0.32f, 70.0f * DEG_TO_RAD, 45.0f, SCENE_SPACESHIP },
+	{ 120.0f, 120.0f, 0.0f, D3DX_PI * 0.22f, 115.0f * DEG_TO_RAD, 70.0f, SCENE_COMET },
+	{ 58.0f, 58.0f, 4.0f, D3DX_PI * 0.32f, 0.0f, 90.0f, SCENE_PROCEDURAL_PLANET },	// Low over the procedural planet, whose radius is 50
+};
+
+WL::SceneCamera::SceneCamera()
+{
+	m_iMode = 0;
+	for (int i = 0; i < SCENE_CAMERA_MODES; i++)
+		m_afAngles[i] = s_aModes[i].fStartAngle;
+	m_vRotationPoint = D3DXVECTOR3(0,0,0);
+	m_fFov = s_aModes[0].fFov;
+	Update(0.0f);
+}
+
+void WL::SceneCamera::SetMode(int iMode, const D3DXVECTOR3& vRotationPoint)
+{
+	m_iMode = iMode;
+	m_vRotationPoint = vRotationPoint;
+	m_fFov = s_aModes[iMode].fFov;
+	Update(0.0f);
+}
+
+void WL::SceneCamera::Rotate(float fAngle)
+{
+	m_afAngles[m_iMode] += fAngle;
+	Update(0.0f);
+}
+
+void WL::SceneCamera::Update(float fDelta)
+{
+	// The camera circles the point, looking at it, and goes round once every
+	// 2 pi * fRotateDelay seconds
+	const Mode& mode = s_aModes[m_iMode];
+	float& fAngle = m_afAngles[m_iMode];
+	m_vPosition = D3DXVECTOR3(cosf(fAngle) * mode.fDistanceX + m_vRotationPoint.x,
+							  mode.fHeight + m_vRotationPoint.y,
+							  sinf(fAngle) * mode.fDistanceY + m_vRotationPoint.z);
+
+	D3DXVECTOR3 up(0.0f, 1.0f, 0.0f);
+	D3DXMatrixLookAtLH(&m_mView, &m_vPosition, &m_vRotationPoint, &up);
+
+	// compute the position for the next frame
+	fAngle += fDelta / mode.fRotateDelay;
+	if (fAngle >= 6.28f)
+		fAngle = 0.0f;
+}
+
+bool WL::SceneCamera::Zoom(float fAmount)
+{
+	if (m_fFov + fAmount > 1.0f || m_fFov + fAmount < 0.0f)
+		return false;
+
+	m_fFov += fAmount;
+	return true;
+}
+
+//
+//	Scene
+//
+WL::SceneSimulation::SceneSimulation()
+{
+	m_apObjects[SCENE_MOON] = new SceneObject();
+	m_apObjects[SCENE_VENUS] = new SceneObject();
+	m_apObjects[SCENE_COMET] = new CometObject();
+	m_apObjects[SCENE_SPACESHIP] = new SpaceshipObject();
+	m_apObjects[SCENE_PROCEDURAL_PLANET] = new SceneObject();
+
+	D3DXMATRIX matrix;
+	D3DXMatrixTranslation(&matrix, 0.0f, 0.0f, -15.0f);
+	m_apObjects[SCENE_MOON]->SetMatrix(matrix);
+	D3DXMatrixScaling(&matrix, 5.0f, 5.0f, 5.0f);
+	m_apObjects[SCENE_VENUS]->SetMatrix(matrix);
+	D3DXMatrixTranslation(&matrix, -150.0f, 50.0f, 400.0f);
+	m_apObjects[SCENE_COMET]->SetMatrix(matrix);
+	D3DXMatrixTranslation(&matrix, 100.0f, 0.0f, 16.0f);
+	m_apObjects[SCENE_SPACESHIP]->SetMatrix(matrix);
+	D3DXMatrixTranslation(&matrix, -400.0f, 0.0f, -250.0f);
+	m_apObjects[SCENE_PROCEDURAL_PLANET]->SetMatrix(matrix);
+
+	SetCameraMode(0);
+
+	// The first frame draws the scene as it was set up
+	Publish();
+	Flip();
+}
+
+WL::SceneSimulation::~SceneSimulation()
+{
+	for (int i = 0; i < SCENE_OBJECTS; i++)
+		delete m_apObjects[i];
+}
+
+void WL::SceneSimulation::Step(float fDelta)
+{
+	WL_PROFILE_ZONE(L"SceneSimulation::Step");
+	for (int i = 0; i < SCENE_OBJECTS; i++)
+		m_apObjects[i]->Update(fDelta);
+
+	m_Camera.Update(fDelta);
+	Publish();
+}
+
+void WL::SceneSimulation::Publish()
+{
+	for (int i = 0; i < SCENE_OBJECTS; i++)
+		m_apObjects[i]->Publish();
+
+	CameraSnapshot& camera = m_CameraSnapshot.Back();
+	camera.vPosition = m_Camera.GetPosition();
+	camera.mView = m_Camera.GetView();
+}
+
+void WL::SceneSimulation::Flip()
+{
+	for (int i = 0; i < SCENE_OBJECTS; i++)
+		m_apObjects[i]->Flip();
+
+	m_CameraSnapshot.Flip();
+}
+
+void WL::SceneSimulation::SetCameraMode(int iMode)
+{
+	if (iMode < 0 || iMode >= SCENE_CAMERA_MODES)
+		return;
+
+	int iOrbited = SceneCamera::s_aModes[iMode].iOrbited;
+	m_Camera.SetMode(iMode, iOrbited < 0 ? D3DXVECTOR3(0,0,0) : m_apObjects[iOrbited]->GetPosition());
+}
+
+void WL::SceneSimulation::RotateCamera(bool bRight)
+{
+	m_Camera.Rotate(bRight ? D3DX_PI / 32.0f : -D3DX_PI / 32.0f);
+}
+
+int WL::SceneSimulation::GetDrawnObjects(int aiObjects[SCENE_OBJECTS]) const
+{
+	int nObjects = 0;
+	switch (m_Camera.GetMode())
+	{
+		case 0:
+		case 2:
+			aiObjects[nObjects++] = SCENE_MOON;
+			aiObjects[nObjects++] = SCENE_VENUS;
+			aiObjects[nObjects++] = SCENE_COMET;
+			break;
+		case 1:
+			aiObjects[nObjects++] = SCENE_SPACESHIP;
+			break;
+		case 3:
+			aiObjects[nObjects++] = SCENE_PROCEDURAL_PLANET;
+			break;
+	}
+	return nObjects;
+}
+
+unsigned int WL::SceneSimulation::GetParticleCount() const
+{
+	int aiObjects[SCENE_OBJECTS];
+	int nObjects = GetDrawnObjects(aiObjects);
+
+	unsigned int nParticles = 0;
+	for (int i = 0; i < nObjects; i++)
+		nParticles += m_apObjects[aiObjects[i]]->GetParticleCount();
+	return nParticles;
+}
+
+//
+//	Terrain
+//
+bool WL::GetTerrainView(const D3DXMATRIX& mWorld, const D3DXMATRIX& mView, const D3DXMATRIX& mProj, float fViewportHeight,
+						float vCamera[3], float aFrustum[6][4], float* pfPixelsPerRadian)
+{
+	// The camera in planet space
+	D3DXMATRIX mWorldView = mWorld * mView;
+	D3DXMATRIX mInvWorldView;
+	if (D3DXMatrixInverse(&mInvWorldView, NULL, &mWorldView) == NULL)
+		return false;
+	vCamera[0] = mInvWorldView._41;
+	vCamera[1] = mInvWorldView._42;
+	vCamera[2] = mInvWorldView._43;
+
+	// The frustum planes in planet space, from the columns of world * view * projection
+	D3DXMATRIX m = mWorldView * mProj;
+	const float aPlanes[6][4] =
+	{
+		{ m._14 + m._11, m._24 + m._21, m._34 + m._31, m._44 + m._41 },		// Left
+		{ m._14 - m._11, m._24 - m._21, m._34 - m._31, m._44 - m._41 },		// Right
+		{ m._14 + m._12, m._24 + m._22, m._34 + m._32, m._44 + m._42 },		// Bottom
+		{ m._14 - m._12, m._24 - m._22, m._34 - m._32, m._44 - m._42 },		// Top
+		{ m._13, m._23, m._33, m._43 },										// Near
+		{ m._14 - m._13, m._24 - m._23, m._34 - m._33, m._44 - m._43 },		// Far
+	};
+	for (int p = 0; p < 6; p++)
+		for (int i = 0; i < 4; i++)
+			aFrustum[p][i] = aPlanes[p][i];
+
+	// Pixels per radian of the vertical field of view
+	*pfPixelsPerRadian = fViewportHeight / (2.0f * atanf(1.0f / mProj._22));
+	return true;
+}
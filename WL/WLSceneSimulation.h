@@ -0,0 +1,204 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: WLSceneSimulation.h
+//
+// Author: snez
+//
+// Desc: What SpaceScene simulates, apart from what it draws: the objects moving, the
+//       particles of the comet and the ship, and the camera flying its orbit around
+//       them. Every step is published into snapshots, which the game's objects draw
+//       from and HeadlessScene counts the draws of, so the game and the headless
+//       benchmark run the same simulation.
+//
+//       Nothing in here depends on Direct3D, the math is the D3DX of WLD3DTypes.h.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __WLSceneSimulation_H__
+#define __WLSceneSimulation_H__
+
+#include "WLD3DTypes.h"
+#include "WLSnapshot.h"
+#include "WLParticleEmitter.h"
+
+#define SCENE_OBJECTS		5		// The planets, the comet, the ship and the procedural planet
+#define SCENE_CAMERA_MODES	4
+#define SCENE_NEAR_PLANE	1.0f
+#define SCENE_FAR_PLANE		1000.0f
+
+namespace WL
+{
+
+	enum ESceneObject
+	{
+		SCENE_MOON,
+		SCENE_VENUS,
+		SCENE_COMET,
+		SCENE_SPACESHIP,
+		SCENE_PROCEDURAL_PLANET
+	};
+
+	//
+	//	An object of the scene as the simulation sees it, where it is and how it moves
+	//
+	class SceneObject
+	{
+	public:
+		SceneObject();
+		virtual ~SceneObject() {}
+
+		virtual void Update(float) {}
+
+		// Hands the state of the step just simulated to the renderer, which sees it after Flip().
+		// Publish may run on the simulation thread, Flip runs with the simulation stopped.
+		virtual void Publish();
+		virtual void Flip();
+		virtual unsigned int GetParticleCount() const { return 0; }		// In the published step
+
+		inline void SetMatrix(const D3DXMATRIX& matrix) { m_mWorldMatrix = matrix; }
+		inline const D3DXMATRIX& GetMatrix() const { return m_mWorldMatrix; }
+		D3DXVECTOR3 GetPosition() const;
+		void SetPosition(const D3DXVECTOR3& vPosition);
+		inline const D3DXVECTOR3& GetVelocity() const { return m_vVelocity; }
+		inline void SetVelocity(const D3DXVECTOR3& vVelocity) { m_vVelocity = vVelocity; }
+
+		inline const D3DXMATRIX& GetRenderMatrix() const { return m_RenderMatrix.Front(); }
+		D3DXVECTOR3 GetRenderPosition() const;
+
+	protected:
+		D3DXMATRIX				m_mWorldMatrix;			// Simulated
+		D3DXVECTOR3				m_vVelocity;
+		Snapshot<D3DXMATRIX>	m_RenderMatrix;			// Published by the simulation, drawn with
+	};
+
+	//
+	//	Tumbles along, a tail of particles behind it
+	//
+	class CometObject : public SceneObject
+	{
+	public:
+		CometObject();
+
+		virtual void Update(float fDelta);
+		virtual void Publish();
+		virtual void Flip();
+		virtual unsigned int GetParticleCount() const { return m_Tail.GetDrawnCount(); }
+
+		inline const ParticleEmitter& GetTail() const { return m_Tail; }
+
+	private:
+		ParticleEmitter		m_Tail;
+	};
+
+	//
+	//	Stands still with its engines on, flying through a stream of dust
+	//
+	class SpaceshipObject : public SceneObject
+	{
+	public:
+		SpaceshipObject();
+
+		virtual void Update(float fDelta);
+		virtual void Publish();
+		virtual void Flip();
+		virtual unsigned int GetParticleCount() const { return m_Exhaust.GetDrawnCount() + m_Dust.GetDrawnCount(); }
+
+		inline const ParticleEmitter& GetExhaust() const { return m_Exhaust; }
+		inline const ParticleEmitter& GetDust() const { return m_Dust; }
+
+	private:
+		ParticleEmitter		m_Exhaust;
+		ParticleEmitter		m_Dust;
+	};
+
+	//
+	//	The camera circles a point of the scene, every mode its own orbit
+	//
+	class SceneCamera
+	{
+	public:
+		struct Mode
+		{
+			float	fDistanceX;
+			float	fDistanceY;				// An ellipse, unless it is fDistanceX
+			float	fHeight;				// Over the point orbited
+			float	fFov;					// Vertical, radians
+			float	fStartAngle;			// The first time the mode is set
+			float	fRotateDelay;			// Seconds per radian
+			int		iOrbited;				// The ESceneObject, or -1 for the origin
+		};
+
+		static const Mode s_aModes[SCENE_CAMERA_MODES];
+
+		SceneCamera();
+
+		// The point is where the mode's object is when it is set, the angle where the
+		// mode was left
+		void SetMode(int iMode, const D3DXVECTOR3& vRotationPoint);
+		void Rotate(float fAngle);
+		void Update(float fDelta);					// Places the camera, then moves it on
+		bool Zoom(float fAmount);					// False if the field of view would leave 0..1
+
+		inline int GetMode() const { return m_iMode; }
+		inline float GetFov() const { return m_fFov; }
+		inline const D3DXVECTOR3& GetPosition() const { return m_vPosition; }
+		inline const D3DXMATRIX& GetView() const { return m_mView; }
+
+	private:
+		int				m_iMode;
+		float			m_afAngles[SCENE_CAMERA_MODES];		// Kept for each mode
+		D3DXVECTOR3		m_vRotationPoint;
+		float			m_fFov;
+		D3DXVECTOR3		m_vPosition;
+		D3DXMATRIX		m_mView;
+	};
+
+	class SceneSimulation
+	{
+	public:
+		// What the renderer sees of the camera, published by every step
+		struct CameraSnapshot
+		{
+			D3DXVECTOR3		vPosition;
+			D3DXMATRIX		mView;
+		};
+
+		SceneSimulation();
+		~SceneSimulation();
+
+		// Simulates and publishes a step. Touches no device, it may run on a worker thread.
+		void Step(float fDelta);
+		void Publish();
+		void Flip();
+
+		void SetCameraMode(int iMode);
+		void RotateCamera(bool bRight);
+		inline bool Zoom(float fAmount) { return m_Camera.Zoom(fAmount); }
+		inline int GetCameraMode() const { return m_Camera.GetMode(); }
+		inline float GetFov() const { return m_Camera.GetFov(); }
+
+		int GetDrawnObjects(int aiObjects[SCENE_OBJECTS]) const;	// The ESceneObjects the camera mode draws
+		unsigned int GetParticleCount() const;						// Of those, in the published step
+
+		inline const SceneObject* GetSceneObject(int i) const { return m_apObjects[i]; }
+		inline const CometObject* GetComet() const { return (const CometObject*)m_apObjects[SCENE_COMET]; }
+		inline const SpaceshipObject* GetSpaceship() const { return (const SpaceshipObject*)m_apObjects[SCENE_SPACESHIP]; }
+		inline const CameraSnapshot& GetCameraSnapshot() const { return m_CameraSnapshot.Front(); }
+
+	private:
+		SceneObject*				m_apObjects[SCENE_OBJECTS];
+		SceneCamera					m_Camera;
+		Snapshot<CameraSnapshot>	m_CameraSnapshot;
+	};
+
+	//
+	//	What a TerrainQuadtree selects with, for a planet drawn with the matrices given: the
+	//	camera and the frustum planes in planet space, inside positive, and the pixels a
+	//	radian of the view covers. False when the view can't be inverted.
+	//
+	bool GetTerrainView(const D3DXMATRIX& mWorld, const D3DXMATRIX& mView, const D3DXMATRIX& mProj, float fViewportHeight,
+						float vCamera[3], float aFrustum[6][4], float* pfPixelsPerRadian);
+
+}
+
+#endif // __WLSceneSimulation_H__
@@ -0,0 +1,41 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: WLSnapshot.h
+//
+// Author: snez
+//
+// Desc: What the simulation hands the renderer, kept twice. The simulation publishes a
+//       step into the back copy while the renderer reads the front one, and Flip() swaps
+//       them once both are done, on the thread that waited for the simulation. Neither
+//       copy is written while it is the front.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __WLSnapshot_H__
+#define __WLSnapshot_H__
+
+namespace WL
+{
+
+	template <class T>
+	class Snapshot
+	{
+	public:
+		Snapshot() : m_iFront(0) {}
+
+		// Read by the renderer
+		inline const T& Front() const { return m_aBuffers[m_iFront]; }
+
+		// Written by the simulation
+		inline T& Back() { return m_aBuffers[1 - m_iFront]; }
+
+		inline void Flip() { m_iFront = 1 - m_iFront; }
+
+	private:
+		T		m_aBuffers[2];
+		int		m_iFront;
+	};
+
+}
+
+#endif // __WLSnapshot_H__
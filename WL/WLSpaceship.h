@@ -1,20 +1,20 @@
-#pragma once
-
-#include "WLGeneralObject.h"
-#include "..\Particle.h"
-
-class Spaceship : public GeneralObject 
-{
-protected:
-
-	ParticleSystem* partSys;
-	ParticleSystem* partDust;
-
-public:
-
-	Spaceship(LPCWSTR xfile);
-	~Spaceship();
-
-	void Render();
-	void Update(float timeDelta);
+#pragma once
+
+#include "WLGeneralObject.h"
+#include "..\Particle.h"
+
+class Spaceship : public GeneralObject 
+{
+protected:
+
+	ParticleSystem* partSys;
+	ParticleSystem* partDust;
+
+public:
+
+	Spaceship(const WL::SpaceshipObject* pSimulated, LPCWSTR xfile);
+	~Spaceship();
+
+	void Render();
+	void Submit(RenderQueue& queue);
 };
\ No newline at end of file
@@ -0,0 +1,51 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: WLStarmapCommands.cpp
+//
+// Author: snez
+//
+// Desc: Recording of the starmap's draw calls.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "WLStarmapCommands.h"
+
+void RecordStarmapCommands(CommandBuffer& commands, IDirect3DVertexBuffer9* pVB, UINT nStride, DWORD dwFVF,
+						   UINT nStars, const D3DMATRIX* pWorld)
+{
+	// No fancy texture wrapping
+	commands.SetRenderState(D3DRS_WRAP0, 0); 
+
+	// Disable lighting
+	commands.SetRenderState(D3DRS_LIGHTING, false);
+
+	// Don't write starmap to the depth buffer; in this way, 
+	// the starmap will never occlude goemtry, which it should not
+	// since it is "infinitely" far away.
+	commands.SetRenderState(D3DRS_ZWRITEENABLE, false);
+	commands.SetRenderState(D3DRS_ZENABLE, false);
+
+	// The world is left to the objects drawn next, they all set their own
+	commands.SetTransformRef(D3DTS_WORLD, pWorld);
+
+	// Switch to fixed pipe (Release the set shader if there is one).
+	// Note that FX set shaders.
+	commands.SetVertexShader(0);
+	commands.SetPixelShader(0);
+
+	commands.SetFVF(dwFVF);
+	commands.SetStreamSource(0, pVB, 0, nStride);
+	commands.SetTexture(0, 0); // Disable textures
+
+	// Draw the stars
+	commands.DrawPrimitive(
+		D3DPT_POINTLIST,
+		0,					// Base Vertex Index
+		nStars
+		);
+
+	// Restore render states.
+	commands.SetRenderState(D3DRS_LIGHTING, true);
+	commands.SetRenderState(D3DRS_ZWRITEENABLE, true);
+	commands.SetRenderState(D3DRS_ZENABLE, true);
+}
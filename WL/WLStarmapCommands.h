@@ -0,0 +1,25 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: WLStarmapCommands.h
+//
+// Author: snez
+//
+// Desc: The calls that draw the starmap, recorded into a command buffer. They only need
+//       the starmap's vertex buffer and world matrix, so they are kept apart from
+//       Starmap, which builds those with D3DX, and the recording is checked headless.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __WLStarmapCommands_H__
+#define __WLStarmapCommands_H__
+
+#include "WLCommandBuffer.h"
+
+//
+//	nStars points of pVB, with the fixed pipeline and without the depth buffer. pWorld
+//	is read when the buffer is replayed.
+//
+void RecordStarmapCommands(CommandBuffer& commands, IDirect3DVertexBuffer9* pVB, UINT nStride, DWORD dwFVF,
+						   UINT nStars, const D3DMATRIX* pWorld);
+
+#endif // __WLStarmapCommands_H__
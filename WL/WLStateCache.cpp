@@ -0,0 +1,268 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: WLStateCache.cpp
+//
+// Author: snez
+//
+// Desc: The device state the scene objects set, so redundant calls don't reach the device.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "WLStateCache.h"
+
+// The render states a device has, all but D3DRS_DEBUGMONITORTOKEN which can't be read
+static const D3DRENDERSTATETYPE s_aRenderStates[] =
+{
+	D3DRS_ZENABLE, D3DRS_FILLMODE, D3DRS_SHADEMODE, D3DRS_ZWRITEENABLE, D3DRS_ALPHATESTENABLE,
+	D3DRS_LASTPIXEL, D3DRS_SRCBLEND, D3DRS_DESTBLEND, D3DRS_CULLMODE, D3DRS_ZFUNC, D3DRS_ALPHAREF,
+	D3DRS_ALPHAFUNC, D3DRS_DITHERENABLE, D3DRS_ALPHABLENDENABLE, D3DRS_FOGENABLE,
+	D3DRS_SPECULARENABLE, D3DRS_FOGCOLOR, D3DRS_FOGTABLEMODE, D3DRS_FOGSTART, D3DRS_FOGEND,
+	D3DRS_FOGDENSITY, D3DRS_RANGEFOGENABLE, D3DRS_STENCILENABLE, D3DRS_STENCILFAIL,
+	D3DRS_STENCILZFAIL, D3DRS_STENCILPASS, D3DRS_STENCILFUNC, D3DRS_STENCILREF, D3DRS_STENCILMASK,
+	D3DRS_STENCILWRITEMASK, D3DRS_TEXTUREFACTOR, D3DRS_WRAP0, D3DRS_WRAP1, D3DRS_WRAP2, D3DRS_WRAP3,
+	D3DRS_WRAP4, D3DRS_WRAP5, D3DRS_WRAP6, D3DRS_WRAP7, D3DRS_CLIPPING, D3DRS_LIGHTING, D3DRS_AMBIENT,
+	D3DRS_FOGVERTEXMODE, D3DRS_COLORVERTEX, D3DRS_LOCALVIEWER, D3DRS_NORMALIZENORMALS,
+	D3DRS_DIFFUSEMATERIALSOURCE, D3DRS_SPECULARMATERIALSOURCE, D3DRS_AMBIENTMATERIALSOURCE,
+	D3DRS_EMISSIVEMATERIALSOURCE, D3DRS_VERTEXBLEND, D3DRS_CLIPPLANEENABLE, D3DRS_POINTSIZE,
+	D3DRS_POINTSIZE_MIN, D3DRS_POINTSPRITEENABLE, D3DRS_POINTSCALEENABLE, D3DRS_POINTSCALE_A,
+	D3DRS_POINTSCALE_B, D3DRS_POINTSCALE_C, D3DRS_MULTISAMPLEANTIALIAS, D3DRS_MULTISAMPLEMASK,
+	D3DRS_PATCHEDGESTYLE, D3DRS_POINTSIZE_MAX, D3DRS_INDEXEDVERTEXBLENDENABLE,
+	D3DRS_COLORWRITEENABLE, D3DRS_TWEENFACTOR, D3DRS_BLENDOP, D3DRS_POSITIONDEGREE,
+	D3DRS_NORMALDEGREE, D3DRS_SCISSORTESTENABLE, D3DRS_SLOPESCALEDEPTHBIAS,
+	D3DRS_ANTIALIASEDLINEENABLE, D3DRS_MINTESSELLATIONLEVEL, D3DRS_MAXTESSELLATIONLEVEL,
+	D3DRS_ADAPTIVETESS_X, D3DRS_ADAPTIVETESS_Y, D3DRS_ADAPTIVETESS_Z, D3DRS_ADAPTIVETESS_W,
+	D3DRS_ENABLEADAPTIVETESSELLATION, D3DRS_TWOSIDEDSTENCILMODE, D3DRS_CCW_STENCILFAIL,
+	D3DRS_CCW_STENCILZFAIL, D3DRS_CCW_STENCILPASS, D3DRS_CCW_STENCILFUNC, D3DRS_COLORWRITEENABLE1,
+	D3DRS_COLORWRITEENABLE2, D3DRS_COLORWRITEENABLE3, D3DRS_BLENDFACTOR, D3DRS_SRGBWRITEENABLE,
+	D3DRS_DEPTHBIAS, D3DRS_WRAP8, D3DRS_WRAP9, D3DRS_WRAP10, D3DRS_WRAP11, D3DRS_WRAP12,
+	D3DRS_WRAP13, D3DRS_WRAP14, D3DRS_WRAP15, D3DRS_SEPARATEALPHABLENDENABLE,
+	D3DRS_SRCBLENDALPHA, D3DRS_DESTBLENDALPHA, D3DRS_BLENDOPALPHA
+};
+
+static const D3DTEXTURESTAGESTATETYPE s_aStageStates[] =
+{
+	D3DTSS_COLOROP, D3DTSS_COLORARG1, D3DTSS_COLORARG2, D3DTSS_ALPHAOP, D3DTSS_ALPHAARG1,
+	D3DTSS_ALPHAARG2, D3DTSS_BUMPENVMAT00, D3DTSS_BUMPENVMAT01, D3DTSS_BUMPENVMAT10,
+	D3DTSS_BUMPENVMAT11, D3DTSS_TEXCOORDINDEX, D3DTSS_BUMPENVLSCALE, D3DTSS_BUMPENVLOFFSET,
+	D3DTSS_TEXTURETRANSFORMFLAGS, D3DTSS_COLORARG0, D3DTSS_ALPHAARG0, D3DTSS_RESULTARG,
+	D3DTSS_CONSTANT
+};
+
+StateCache& StateCache::Get()
+{
+	static StateCache s_cache;
+	return s_cache;
+}
+
+StateCache::StateCache()
+{
+	m_pd3dDevice = NULL;
+	ZeroMemory(&m_Stats, sizeof(m_Stats));
+	ZeroMemory(&m_LastFrame, sizeof(m_LastFrame));
+	Invalidate();
+}
+
+void StateCache::OnResetDevice(IDirect3DDevice9* pd3dDevice)
+{
+	m_pd3dDevice = pd3dDevice;
+	Invalidate();
+	ReadDevice();
+}
+
+void StateCache::OnLostDevice()
+{
+	// A reset puts every state back to its default
+	Invalidate();
+}
+
+void StateCache::BeginFrame()
+{
+	ZeroMemory(&m_Stats, sizeof(m_Stats));
+}
+
+void StateCache::EndFrame()
+{
+	m_LastFrame = m_Stats;
+}
+
+void StateCache::Invalidate()
+{
+	ZeroMemory(m_abRenderStateKnown, sizeof(m_abRenderStateKnown));
+	ZeroMemory(m_abSamplerStateKnown, sizeof(m_abSamplerStateKnown));
+	ZeroMemory(m_abStageStateKnown, sizeof(m_abStageStateKnown));
+	ZeroMemory(m_abTransformKnown, sizeof(m_abTransformKnown));
+}
+
+//
+//	Learns every state the cache keeps from the device. A pure device answers none, and
+//	the states are learned as they are set instead.
+//
+void StateCache::ReadDevice()
+{
+	for (UINT i = 0; i < sizeof(s_aRenderStates) / sizeof(s_aRenderStates[0]); i++)
+	{
+		D3DRENDERSTATETYPE state = s_aRenderStates[i];
+		m_abRenderStateKnown[state] = SUCCEEDED(m_pd3dDevice->GetRenderState(state, &m_adwRenderStates[state]));
+	}
+
+	for (int iSampler = 0; iSampler < MAX_SAMPLERS; iSampler++)
+	{
+		DWORD dwSampler = iSampler < 16 ? iSampler : D3DVERTEXTEXTURESAMPLER0 + (iSampler - 16);
+		for (int type = D3DSAMP_ADDRESSU; type < MAX_SAMPLER_STATES; type++)
+		{
+			m_abSamplerStateKnown[iSampler][type] = SUCCEEDED(m_pd3dDevice->GetSamplerState(dwSampler,
+				(D3DSAMPLERSTATETYPE)type, &m_adwSamplerStates[iSampler][type]));
+		}
+	}
+
+	for (int iStage = 0; iStage < MAX_STAGES; iStage++)
+	{
+		for (UINT i = 0; i < sizeof(s_aStageStates) / sizeof(s_aStageStates[0]); i++)
+		{
+			D3DTEXTURESTAGESTATETYPE type = s_aStageStates[i];
+			m_abStageStateKnown[iStage][type] = SUCCEEDED(m_pd3dDevice->GetTextureStageState(iStage, type,
+				&m_adwStageStates[iStage][type]));
+		}
+	}
+
+	const D3DTRANSFORMSTATETYPE aTransforms[MAX_TRANSFORMS] = { D3DTS_WORLD, D3DTS_VIEW, D3DTS_PROJECTION };
+	for (int i = 0; i < MAX_TRANSFORMS; i++)
+		m_abTransformKnown[i] = SUCCEEDED(m_pd3dDevice->GetTransform(aTransforms[i], &m_aTransforms[i]));
+}
+
+//
+//	Vertex texture samplers are numbered from D3DVERTEXTEXTURESAMPLER0, after the 16 pixel
+//	samplers. Returns -1 for a sampler the cache doesn't keep.
+//
+int StateCache::GetSamplerIndex(DWORD dwSampler)
+{
+	if (dwSampler < 16)
+		return (int)dwSampler;
+	if (dwSampler >= D3DVERTEXTEXTURESAMPLER0 && dwSampler <= D3DVERTEXTEXTURESAMPLER3)
+		return 16 + (int)(dwSampler - D3DVERTEXTEXTURESAMPLER0);
+	return -1;
+}
+
+int StateCache::GetTransformIndex(D3DTRANSFORMSTATETYPE state)
+{
+	switch (state)
+	{
+		case D3DTS_WORLD:		return 0;
+		case D3DTS_VIEW:		return 1;
+		case D3DTS_PROJECTION:	return 2;
+	}
+	return -1;
+}
+
+HRESULT StateCache::SetRenderState(D3DRENDERSTATETYPE state, DWORD dwValue)
+{
+	m_Stats.nCalls++;
+	if ((UINT)state >= MAX_RENDER_STATES)
+		return m_pd3dDevice->SetRenderState(state, dwValue);
+
+	if (m_abRenderStateKnown[state] && m_adwRenderStates[state] == dwValue)
+	{
+		m_Stats.nFiltered++;
+		return S_OK;
+	}
+
+	HRESULT hr = m_pd3dDevice->SetRenderState(state, dwValue);
+	m_adwRenderStates[state] = dwValue;
+	m_abRenderStateKnown[state] = SUCCEEDED(hr);
+	return hr;
+}
+
+HRESULT StateCache::GetRenderState(D3DRENDERSTATETYPE state, DWORD* pdwValue)
+{
+	if ((UINT)state < MAX_RENDER_STATES && m_abRenderStateKnown[state])
+	{
+		m_Stats.nGets++;
+		*pdwValue = m_adwRenderStates[state];
+		return S_OK;
+	}
+
+	m_Stats.nDeviceGets++;
+	HRESULT hr = m_pd3dDevice->GetRenderState(state, pdwValue);
+	if (SUCCEEDED(hr) && (UINT)state < MAX_RENDER_STATES)
+	{
+		m_adwRenderStates[state] = *pdwValue;
+		m_abRenderStateKnown[state] = true;
+	}
+	return hr;
+}
+
+HRESULT StateCache::SetSamplerState(DWORD dwSampler, D3DSAMPLERSTATETYPE type, DWORD dwValue)
+{
+	m_Stats.nCalls++;
+	int iSampler = GetSamplerIndex(dwSampler);
+	if (iSampler < 0 || (UINT)type >= MAX_SAMPLER_STATES)
+		return m_pd3dDevice->SetSamplerState(dwSampler, type, dwValue);
+
+	if (m_abSamplerStateKnown[iSampler][type] && m_adwSamplerStates[iSampler][type] == dwValue)
+	{
+		m_Stats.nFiltered++;
+		return S_OK;
+	}
+
+	HRESULT hr = m_pd3dDevice->SetSamplerState(dwSampler, type, dwValue);
+	m_adwSamplerStates[iSampler][type] = dwValue;
+	m_abSamplerStateKnown[iSampler][type] = SUCCEEDED(hr);
+	return hr;
+}
+
+HRESULT StateCache::SetTextureStageState(DWORD dwStage, D3DTEXTURESTAGESTATETYPE type, DWORD dwValue)
+{
+	m_Stats.nCalls++;
+	if (dwStage >= MAX_STAGES || (UINT)type >= MAX_STAGE_STATES)
+		return m_pd3dDevice->SetTextureStageState(dwStage, type, dwValue);
+
+	if (m_abStageStateKnown[dwStage][type] && m_adwStageStates[dwStage][type] == dwValue)
+	{
+		m_Stats.nFiltered++;
+		return S_OK;
+	}
+
+	HRESULT hr = m_pd3dDevice->SetTextureStageState(dwStage, type, dwValue);
+	m_adwStageStates[dwStage][type] = dwValue;
+	m_abStageStateKnown[dwStage][type] = SUCCEEDED(hr);
+	return hr;
+}
+
+HRESULT StateCache::SetTransform(D3DTRANSFORMSTATETYPE state, const D3DMATRIX* pMatrix)
+{
+	m_Stats.nCalls++;
+	int iTransform = GetTransformIndex(state);
+	if (iTransform < 0)
+		return m_pd3dDevice->SetTransform(state, pMatrix);
+
+	if (m_abTransformKnown[iTransform] && memcmp(&m_aTransforms[iTransform], pMatrix, sizeof(D3DMATRIX)) == 0)
+	{
+		m_Stats.nFiltered++;
+		return S_OK;
+	}
+
+	HRESULT hr = m_pd3dDevice->SetTransform(state, pMatrix);
+	m_aTransforms[iTransform] = *pMatrix;
+	m_abTransformKnown[iTransform] = SUCCEEDED(hr);
+	return hr;
+}
+
+HRESULT StateCache::GetTransform(D3DTRANSFORMSTATETYPE state, D3DMATRIX* pMatrix)
+{
+	int iTransform = GetTransformIndex(state);
+	if (iTransform >= 0 && m_abTransformKnown[iTransform])
+	{
+		m_Stats.nGets++;
+		*pMatrix = m_aTransforms[iTransform];
+		return S_OK;
+	}
+
+	m_Stats.nDeviceGets++;
+	HRESULT hr = m_pd3dDevice->GetTransform(state, pMatrix);
+	if (SUCCEEDED(hr) && iTransform >= 0)
+	{
+		m_aTransforms[iTransform] = *pMatrix;
+		m_abTransformKnown[iTransform] = true;
+	}
+	return hr;
+}
@@ -0,0 +1,138 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: WLStateCache.h
+//
+// Author: snez
+//
+// Desc: A copy of the device state the scene objects set, kept between them and the
+//       device. Setting a value the device already has costs nothing, and asking for a
+//       value the cache knows doesn't go to the device.
+//
+//       Every state the cache keeps is read from the device once, after a reset, so the
+//       values are known from the first frame on and stay known across frames. Only the
+//       calls made through the cache are followed after that. The post-processing graph
+//       goes through it too, and the HUD's sprite puts back what it changes. Code that
+//       sets the device up on its own has to be followed by Invalidate(), after which
+//       the first Get of every value asks the device again.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __WLStateCache_H__
+#define __WLStateCache_H__
+
+#include "dxstdafx.h"
+
+class StateCache
+{
+public:
+	struct Stats
+	{
+		UINT	nCalls;				// Set calls made to the cache
+		UINT	nFiltered;			// The ones that changed nothing and never reached the device
+		UINT	nGets;				// Get calls answered by the cache
+		UINT	nDeviceGets;		// Get calls the device had to answer
+		UINT	nDrawCalls;			// Counted by the code drawing, with CountDraws()
+	};
+
+	static StateCache& Get();
+
+	void OnResetDevice(IDirect3DDevice9* pd3dDevice);
+	void OnLostDevice();
+
+	//
+	//	Around the counting of a frame
+	//
+	void BeginFrame();
+	void EndFrame();
+	void Invalidate();
+
+	//
+	//	The same as the device calls. Transforms other than the world, view and
+	//	projection go straight to the device.
+	//
+	HRESULT SetRenderState(D3DRENDERSTATETYPE state, DWORD dwValue);
+	HRESULT GetRenderState(D3DRENDERSTATETYPE state, DWORD* pdwValue);
+	HRESULT SetSamplerState(DWORD dwSampler, D3DSAMPLERSTATETYPE type, DWORD dwValue);
+	HRESULT SetTextureStageState(DWORD dwStage, D3DTEXTURESTAGESTATETYPE type, DWORD dwValue);
+	HRESULT SetTransform(D3DTRANSFORMSTATETYPE state, const D3DMATRIX* pMatrix);
+	HRESULT GetTransform(D3DTRANSFORMSTATETYPE state, D3DMATRIX* pMatrix);
+
+	//
+	//	The draw calls made on the device, which the cache doesn't see
+	//
+	inline void CountDraws(UINT nDraws = 1) { m_Stats.nDrawCalls += nDraws; }
+
+	//
+	//	Counts of the frame EndFrame() was last called for
+	//
+	inline const Stats& GetStats() const { return m_LastFrame; }
+
+private:
+	StateCache();
+
+	enum
+	{
+		MAX_RENDER_STATES = 256,
+		MAX_SAMPLERS = 20,					// 16 pixel samplers and 4 vertex samplers
+		MAX_SAMPLER_STATES = 14,
+		MAX_STAGES = 8,
+		MAX_STAGE_STATES = 33,
+		MAX_TRANSFORMS = 3					// World, view and projection
+	};
+
+	static int GetSamplerIndex(DWORD dwSampler);
+	static int GetTransformIndex(D3DTRANSFORMSTATETYPE state);
+
+	void ReadDevice();
+
+	IDirect3DDevice9*	m_pd3dDevice;
+
+	DWORD				m_adwRenderStates[MAX_RENDER_STATES];
+	bool				m_abRenderStateKnown[MAX_RENDER_STATES];
+	DWORD				m_adwSamplerStates[MAX_SAMPLERS][MAX_SAMPLER_STATES];
+	bool				m_abSamplerStateKnown[MAX_SAMPLERS][MAX_SAMPLER_STATES];
+	DWORD				m_adwStageStates[MAX_STAGES][MAX_STAGE_STATES];
+	bool				m_abStageStateKnown[MAX_STAGES][MAX_STAGE_STATES];
+	D3DMATRIX			m_aTransforms[MAX_TRANSFORMS];
+	bool				m_abTransformKnown[MAX_TRANSFORMS];
+
+	Stats				m_Stats;			// Of the frame so far
+	Stats				m_LastFrame;
+};
+
+//
+//	The device calls a CommandBuffer replays, with the states going through the cache
+//
+class StateCacheDevice
+{
+public:
+	inline explicit StateCacheDevice(IDirect3DDevice9* pd3dDevice) { m_pd3dDevice = pd3dDevice; }
+
+	inline HRESULT SetRenderState(D3DRENDERSTATETYPE state, DWORD dwValue) { return StateCache::Get().SetRenderState(state, dwValue); }
+	inline HRESULT SetSamplerState(DWORD dwSampler, D3DSAMPLERSTATETYPE type, DWORD dwValue) { return StateCache::Get().SetSamplerState(dwSampler, type, dwValue); }
+	inline HRESULT SetTextureStageState(DWORD dwStage, D3DTEXTURESTAGESTATETYPE type, DWORD dwValue) { return StateCache::Get().SetTextureStageState(dwStage, type, dwValue); }
+	inline HRESULT SetTransform(D3DTRANSFORMSTATETYPE state, const D3DMATRIX* pMatrix) { return StateCache::Get().SetTransform(state, pMatrix); }
+
+	inline HRESULT SetMaterial(const D3DMATERIAL9* pMaterial) { return m_pd3dDevice->SetMaterial(pMaterial); }
+	inline HRESULT SetTexture(DWORD dwStage, IDirect3DBaseTexture9* pTexture) { return m_pd3dDevice->SetTexture(dwStage, pTexture); }
+	inline HRESULT SetVertexShader(IDirect3DVertexShader9* pShader) { return m_pd3dDevice->SetVertexShader(pShader); }
+	inline HRESULT SetPixelShader(IDirect3DPixelShader9* pShader) { return m_pd3dDevice->SetPixelShader(pShader); }
+	inline HRESULT SetFVF(DWORD dwFVF) { return m_pd3dDevice->SetFVF(dwFVF); }
+	inline HRESULT SetStreamSource(UINT nStream, IDirect3DVertexBuffer9* pVB, UINT nOffset, UINT nStride) { return m_pd3dDevice->SetStreamSource(nStream, pVB, nOffset, nStride); }
+	inline HRESULT SetIndices(IDirect3DIndexBuffer9* pIB) { return m_pd3dDevice->SetIndices(pIB); }
+	inline HRESULT DrawPrimitive(D3DPRIMITIVETYPE type, UINT nStartVertex, UINT nPrimitives)
+	{
+		StateCache::Get().CountDraws();
+		return m_pd3dDevice->DrawPrimitive(type, nStartVertex, nPrimitives);
+	}
+	inline HRESULT DrawIndexedPrimitive(D3DPRIMITIVETYPE type, INT nBaseVertex, UINT nMinIndex, UINT nVertices, UINT nStartIndex, UINT nPrimitives)
+	{
+		StateCache::Get().CountDraws();
+		return m_pd3dDevice->DrawIndexedPrimitive(type, nBaseVertex, nMinIndex, nVertices, nStartIndex, nPrimitives);
+	}
+
+private:
+	IDirect3DDevice9*	m_pd3dDevice;
+};
+
+#endif // __WLStateCache_H__
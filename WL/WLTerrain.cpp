@@ -0,0 +1,808 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: WLTerrain.cpp
+//
+// Author: snez
+//
+// Desc: Procedural planet terrain, generated in chunks on a quadtree per cube face.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "WLTerrain.h"
+#include <algorithm>
+#include <math.h>
+#include <string.h>
+
+static const float TERRAIN_PI = 3.14159265f;
+
+//
+//	Outward normal and the two axes of every cube face, with cross(u, v) = n so the same
+//	triangle order faces outwards on all of them
+//
+static const float FACE_AXES[TERRAIN_FACES][3][3] =
+{
+	{ {  1,  0,  0 }, {  0,  1,  0 }, {  0,  0,  1 } },		// +X
+	{ { -1,  0,  0 }, {  0,  0,  1 }, {  0,  1,  0 } },		// -X
+	{ {  0,  1,  0 }, {  0,  0,  1 }, {  1,  0,  0 } },		// +Y
+	{ {  0, -1,  0 }, {  1,  0,  0 }, {  0,  0,  1 } },		// -Y
+	{ {  0,  0,  1 }, {  1,  0,  0 }, {  0,  1,  0 } },		// +Z
+	{ {  0,  0, -1 }, {  0,  1,  0 }, {  1,  0,  0 } },		// -Z
+};
+
+//
+//	Colors by height above sea level, as fractions of the height scale
+//
+struct ColorStop
+{
+	float	fHeight;
+	float	r, g, b;
+};
+
+static const ColorStop LAND_COLORS[] =
+{
+	{ 0.00f, 0.76f, 0.70f, 0.50f },		// Sand
+	{ 0.04f, 0.24f, 0.47f, 0.20f },		// Grass
+	{ 0.30f, 0.20f, 0.35f, 0.15f },
+	{ 0.55f, 0.43f, 0.39f, 0.35f },		// Rock
+	{ 0.75f, 0.94f, 0.94f, 0.96f },		// Snow
+};
+
+static const ColorStop SEA_COLORS[] =
+{
+	{ 0.00f, 0.16f, 0.35f, 0.63f },
+	{ 1.00f, 0.04f, 0.12f, 0.35f },
+};
+
+static const float ROCK_COLOR[3] = { 0.43f, 0.39f, 0.35f };
+
+WL::TerrainSettings::TerrainSettings()
+{
+	fRadius = 50.0f;
+	fHeightScale = 1.5f;
+	fFrequency = 2.0f;
+	fLacunarity = 2.0f;
+	fGain = 0.5f;
+	nOctaves = 14;
+	nSeed = 1;
+
+	nMaxLevel = TERRAIN_MAX_LEVEL;
+	fMaxPixelError = 6.0f;
+	nMemoryBudget = 32 * 1024 * 1024;
+	nMaxInFlight = 32;
+}
+
+WL::TerrainChunkKey WL::TerrainChunkKey::GetChild(int i) const
+{
+	TerrainChunkKey child;
+	child.nFace = nFace;
+	child.nLevel = nLevel + 1;
+	child.x = 2 * x + (i & 1);
+	child.y = 2 * y + (i >> 1);
+	return child;
+}
+
+//
+//	Noise
+//
+
+static unsigned int HashLattice(int x, int y, int z, unsigned int nSeed)
+{
+	unsigned int h = nSeed;
+	h ^= (unsigned int)x * 0x8da6b343u;
+	h ^= (unsigned int)y * 0xd8163841u;
+	h ^= (unsigned int)z * 0xcb1ab31fu;
+	h ^= h >> 16;
+	h *= 0x7feb352du;
+	h ^= h >> 15;
+	h *= 0x846ca68bu;
+	h ^= h >> 16;
+	return h;
+}
+
+// One of the 12 cube edge gradients of improved Perlin noise, dotted with (x, y, z)
+static float Gradient(unsigned int nHash, float x, float y, float z)
+{
+	int h = nHash & 15;
+	float u = h < 8 ? x : y;
+	float v = h < 4 ? y : (h == 12 || h == 14 ? x : z);
+	return ((h & 1) ? -u : u) + ((h & 2) ? -v : v);
+}
+
+static inline float Fade(float t)
+{
+	return t * t * t * (t * (t * 6.0f - 15.0f) + 10.0f);
+}
+
+static inline float Lerp(float a, float b, float t)
+{
+	return a + (b - a) * t;
+}
+
+float WL::TerrainNoise(float x, float y, float z, unsigned int nSeed)
+{
+	float fx = floorf(x);
+	float fy = floorf(y);
+	float fz = floorf(z);
+	int ix = (int)fx;
+	int iy = (int)fy;
+	int iz = (int)fz;
+	x -= fx;
+	y -= fy;
+	z -= fz;
+
+	float u = Fade(x);
+	float v = Fade(y);
+	float w = Fade(z);
+
+	float n000 = Gradient(HashLattice(ix,     iy,     iz,     nSeed), x,        y,        z);
+	float n100 = Gradient(HashLattice(ix + 1, iy,     iz,     nSeed), x - 1.0f, y,        z);
+	float n010 = Gradient(HashLattice(ix,     iy + 1, iz,     nSeed), x,        y - 1.0f, z);
+	float n110 = Gradient(HashLattice(ix + 1, iy + 1, iz,     nSeed), x - 1.0f, y - 1.0f, z);
+	float n001 = Gradient(HashLattice(ix,     iy,     iz + 1, nSeed), x,        y,        z - 1.0f);
+	float n101 = Gradient(HashLattice(ix + 1, iy,     iz + 1, nSeed), x - 1.0f, y,        z - 1.0f);
+	float n011 = Gradient(HashLattice(ix,     iy + 1, iz + 1, nSeed), x,        y - 1.0f, z - 1.0f);
+	float n111 = Gradient(HashLattice(ix + 1, iy + 1, iz + 1, nSeed), x - 1.0f, y - 1.0f, z - 1.0f);
+
+	return Lerp(Lerp(Lerp(n000, n100, u), Lerp(n010, n110, u), v),
+				Lerp(Lerp(n001, n101, u), Lerp(n011, n111, u), v), w);
+}
+
+float WL::GetTerrainHeight(const TerrainSettings& settings, const float vDir[3])
+{
+	float fSum = 0.0f;
+	float fNorm = 0.0f;
+	float fAmplitude = 1.0f;
+	float fFrequency = settings.fFrequency;
+	for (int i = 0; i < settings.nOctaves; i++)
+	{
+		// Every octave gets its own seed, so the lattices don't line up at the origin
+		fSum += fAmplitude * TerrainNoise(vDir[0] * fFrequency, vDir[1] * fFrequency, vDir[2] * fFrequency,
+										  settings.nSeed + i);
+		fNorm += fAmplitude;
+		fAmplitude *= settings.fGain;
+		fFrequency *= settings.fLacunarity;
+	}
+
+	return fNorm > 0.0f ? settings.fHeightScale * fSum / fNorm : 0.0f;
+}
+
+void WL::GetTerrainDirection(int nFace, float s, float t, float vDir[3])
+{
+	// The tangent spreads the vertices evenly over the sphere instead of bunching them
+	// up towards the corners of the face
+	s = tanf(s * TERRAIN_PI * 0.25f);
+	t = tanf(t * TERRAIN_PI * 0.25f);
+
+	const float (*axes)[3] = FACE_AXES[nFace];
+	float x = axes[0][0] + s * axes[1][0] + t * axes[2][0];
+	float y = axes[0][1] + s * axes[1][1] + t * axes[2][1];
+	float z = axes[0][2] + s * axes[1][2] + t * axes[2][2];
+	float fInvLength = 1.0f / sqrtf(x * x + y * y + z * z);
+
+	vDir[0] = x * fInvLength;
+	vDir[1] = y * fInvLength;
+	vDir[2] = z * fInvLength;
+}
+
+//
+//	Chunk generation
+//
+
+static void PickColor(const ColorStop* aStops, int nStops, float fHeight, float color[3])
+{
+	if (fHeight <= aStops[0].fHeight)
+	{
+		color[0] = aStops[0].r;
+		color[1] = aStops[0].g;
+		color[2] = aStops[0].b;
+		return;
+	}
+
+	for (int i = 1; i < nStops; i++)
+	{
+		if (fHeight < aStops[i].fHeight)
+		{
+			float t = (fHeight - aStops[i - 1].fHeight) / (aStops[i].fHeight - aStops[i - 1].fHeight);
+			color[0] = Lerp(aStops[i - 1].r, aStops[i].r, t);
+			color[1] = Lerp(aStops[i - 1].g, aStops[i].g, t);
+			color[2] = Lerp(aStops[i - 1].b, aStops[i].b, t);
+			return;
+		}
+	}
+
+	color[0] = aStops[nStops - 1].r;
+	color[1] = aStops[nStops - 1].g;
+	color[2] = aStops[nStops - 1].b;
+}
+
+static unsigned int PackColor(const float color[3])
+{
+	unsigned int r = (unsigned int)(color[0] * 255.0f + 0.5f);
+	unsigned int g = (unsigned int)(color[1] * 255.0f + 0.5f);
+	unsigned int b = (unsigned int)(color[2] * 255.0f + 0.5f);
+	return 0xff000000 | (r << 16) | (g << 8) | b;
+}
+
+//
+//	Color from the height and how steep the ground is, fSlope being the cosine between
+//	the normal and the way up
+//
+static unsigned int TerrainColor(const WL::TerrainSettings& settings, float fHeight, float fSlope)
+{
+	float color[3];
+	if (fHeight < 0.0f)
+	{
+		PickColor(SEA_COLORS, sizeof(SEA_COLORS) / sizeof(SEA_COLORS[0]), -fHeight / settings.fHeightScale, color);
+		return PackColor(color);
+	}
+
+	PickColor(LAND_COLORS, sizeof(LAND_COLORS) / sizeof(LAND_COLORS[0]), fHeight / settings.fHeightScale, color);
+
+	// Steep ground is bare rock
+	float fRock = (0.85f - fSlope) * 5.0f;
+	fRock = fRock < 0.0f ? 0.0f : (fRock > 1.0f ? 1.0f : fRock);
+	for (int i = 0; i < 3; i++)
+		color[i] = Lerp(color[i], ROCK_COLOR[i], fRock);
+
+	return PackColor(color);
+}
+
+//
+//	Center and radius of a sphere enclosing a chunk, from the face alone
+//
+static void GetChunkBounds(const WL::TerrainSettings& settings, const WL::TerrainChunkKey& key,
+						   float vCenter[3], float* pfRadius)
+{
+	float fSize = 2.0f / (float)(1 << key.nLevel);
+	float s0 = -1.0f + key.x * fSize;
+	float t0 = -1.0f + key.y * fSize;
+
+	WL::GetTerrainDirection(key.nFace, s0 + 0.5f * fSize, t0 + 0.5f * fSize, vCenter);
+	for (int i = 0; i < 3; i++)
+		vCenter[i] *= settings.fRadius;
+
+	float fRadius = 0.0f;
+	for (int i = 0; i < 4; i++)
+	{
+		float vCorner[3];
+		WL::GetTerrainDirection(key.nFace, s0 + (i & 1) * fSize, t0 + (i >> 1) * fSize, vCorner);
+
+		float dx = vCorner[0] * settings.fRadius - vCenter[0];
+		float dy = vCorner[1] * settings.fRadius - vCenter[1];
+		float dz = vCorner[2] * settings.fRadius - vCenter[2];
+		float fDistance = sqrtf(dx * dx + dy * dy + dz * dz);
+		if (fDistance > fRadius)
+			fRadius = fDistance;
+	}
+
+	*pfRadius = fRadius + settings.fHeightScale;
+}
+
+// Distance between the vertices of a chunk at a level, along the surface
+static float GetVertexSpacing(const WL::TerrainSettings& settings, int nLevel)
+{
+	return settings.fRadius * TERRAIN_PI * 0.5f / (float)((1 << nLevel) * (TERRAIN_CHUNK_GRID - 1));
+}
+
+void WL::GenerateTerrainChunk(const TerrainSettings& settings, const TerrainChunkKey& key, TerrainChunkData* pData)
+{
+	const int N = TERRAIN_CHUNK_GRID;
+	const int B = N + 2;		// With a border of one vertex for the normals
+
+	float fSize = 2.0f / (float)(1 << key.nLevel);
+	float fStep = fSize / (float)(N - 1);
+	float s0 = -1.0f + key.x * fSize;
+	float t0 = -1.0f + key.y * fSize;
+
+	float vCenter[3];
+	GetTerrainDirection(key.nFace, s0 + 0.5f * fSize, t0 + 0.5f * fSize, vCenter);
+	for (int i = 0; i < 3; i++)
+		pData->vCenter[i] = vCenter[i] * settings.fRadius;
+
+	// Positions relative to the center, keeping the precision near the ground
+	float aPosition[B * B][3];
+	float aDir[B * B][3];
+	float aHeight[B * B];
+	for (int j = 0; j < B; j++)
+	{
+		for (int i = 0; i < B; i++)
+		{
+			int k = j * B + i;
+			GetTerrainDirection(key.nFace, s0 + (i - 1) * fStep, t0 + (j - 1) * fStep, aDir[k]);
+			aHeight[k] = GetTerrainHeight(settings, aDir[k]);
+
+			// The sea is flat
+			float r = settings.fRadius + (aHeight[k] > 0.0f ? aHeight[k] : 0.0f);
+			for (int c = 0; c < 3; c++)
+				aPosition[k][c] = aDir[k][c] * r - pData->vCenter[c];
+		}
+	}
+
+	pData->fBoundRadius = 0.0f;
+	pData->fMinHeight = aHeight[B + 1];
+	pData->fMaxHeight = aHeight[B + 1];
+	for (int j = 0; j < N; j++)
+	{
+		for (int i = 0; i < N; i++)
+		{
+			int k = (j + 1) * B + (i + 1);
+			TerrainVertex& vertex = pData->aVertices[j * N + i];
+			vertex.x = aPosition[k][0];
+			vertex.y = aPosition[k][1];
+			vertex.z = aPosition[k][2];
+
+			// Central differences along the two axes of the face, crossed in the same
+			// order as the face axes so the normal points outwards
+			const float* pLeft = aPosition[k - 1];
+			const float* pRight = aPosition[k + 1];
+			const float* pDown = aPosition[k - B];
+			const float* pUp = aPosition[k + B];
+			float du[3] = { pRight[0] - pLeft[0], pRight[1] - pLeft[1], pRight[2] - pLeft[2] };
+			float dv[3] = { pUp[0] - pDown[0], pUp[1] - pDown[1], pUp[2] - pDown[2] };
+			float nx = du[1] * dv[2] - du[2] * dv[1];
+			float ny = du[2] * dv[0] - du[0] * dv[2];
+			float nz = du[0] * dv[1] - du[1] * dv[0];
+			float fInvLength = 1.0f / sqrtf(nx * nx + ny * ny + nz * nz);
+			vertex.nx = nx * fInvLength;
+			vertex.ny = ny * fInvLength;
+			vertex.nz = nz * fInvLength;
+
+			float fSlope = vertex.nx * aDir[k][0] + vertex.ny * aDir[k][1] + vertex.nz * aDir[k][2];
+			vertex.color = TerrainColor(settings, aHeight[k], fSlope);
+
+			float fDistance = sqrtf(vertex.x * vertex.x + vertex.y * vertex.y + vertex.z * vertex.z);
+			if (fDistance > pData->fBoundRadius)
+				pData->fBoundRadius = fDistance;
+			if (aHeight[k] < pData->fMinHeight)
+				pData->fMinHeight = aHeight[k];
+			if (aHeight[k] > pData->fMaxHeight)
+				pData->fMaxHeight = aHeight[k];
+		}
+	}
+
+	// The skirts hang below the edges by about as much as a coarser neighbour can be off
+	float fSkirt = 2.0f * GetVertexSpacing(settings, key.nLevel) + settings.fHeightScale / (float)(1 << key.nLevel);
+	for (int e = 0; e < 4; e++)
+	{
+		for (int i = 0; i < N; i++)
+		{
+			// Bottom, right, top and left edge
+			int iGrid;
+			switch (e)
+			{
+				case 0:		iGrid = i; break;
+				case 1:		iGrid = i * N + N - 1; break;
+				case 2:		iGrid = (N - 1) * N + i; break;
+				default:	iGrid = i * N; break;
+			}
+
+			const TerrainVertex& edge = pData->aVertices[iGrid];
+			TerrainVertex& skirt = pData->aVertices[TerrainChunkData::GRID_VERTICES + e * N + i];
+			skirt = edge;
+
+			const float* pDir = aDir[((iGrid / N) + 1) * B + (iGrid % N) + 1];
+			skirt.x -= pDir[0] * fSkirt;
+			skirt.y -= pDir[1] * fSkirt;
+			skirt.z -= pDir[2] * fSkirt;
+		}
+	}
+
+	pData->fBoundRadius += fSkirt;
+}
+
+void WL::GetTerrainChunkIndices(unsigned short aIndices[TerrainChunkData::INDICES])
+{
+	const int N = TERRAIN_CHUNK_GRID;
+	unsigned short* pIndex = aIndices;
+
+	for (int j = 0; j < N - 1; j++)
+	{
+		for (int i = 0; i < N - 1; i++)
+		{
+			unsigned short v00 = (unsigned short)(j * N + i);
+			unsigned short v10 = (unsigned short)(v00 + 1);
+			unsigned short v01 = (unsigned short)(v00 + N);
+			unsigned short v11 = (unsigned short)(v01 + 1);
+
+			*pIndex++ = v00; *pIndex++ = v10; *pIndex++ = v01;
+			*pIndex++ = v10; *pIndex++ = v11; *pIndex++ = v01;
+		}
+	}
+
+	// The skirts face away from the chunk. The bottom and right edges run the other way
+	// round the chunk from the top and left ones, so their triangles are flipped.
+	for (int e = 0; e < 4; e++)
+	{
+		bool bFlip = e < 2;
+		for (int i = 0; i < N - 1; i++)
+		{
+			unsigned short a0, a1;
+			switch (e)
+			{
+				case 0:		a0 = (unsigned short)i; a1 = (unsigned short)(i + 1); break;
+				case 1:		a0 = (unsigned short)(i * N + N - 1); a1 = (unsigned short)(a0 + N); break;
+				case 2:		a0 = (unsigned short)((N - 1) * N + i); a1 = (unsigned short)(a0 + 1); break;
+				default:	a0 = (unsigned short)(i * N); a1 = (unsigned short)(a0 + N); break;
+			}
+			unsigned short b0 = (unsigned short)(TerrainChunkData::GRID_VERTICES + e * N + i);
+			unsigned short b1 = (unsigned short)(b0 + 1);
+
+			if (bFlip)
+			{
+				*pIndex++ = a0; *pIndex++ = b0; *pIndex++ = a1;
+				*pIndex++ = a1; *pIndex++ = b0; *pIndex++ = b1;
+			}
+			else
+			{
+				*pIndex++ = a0; *pIndex++ = a1; *pIndex++ = b0;
+				*pIndex++ = a1; *pIndex++ = b1; *pIndex++ = b0;
+			}
+		}
+	}
+}
+
+//
+//	Quadtree
+//
+
+WL::TerrainQuadtree::TerrainQuadtree()
+{
+	m_bCreated = false;
+	m_nInFlight = 0;
+	m_nGenerated = 0;
+	m_pfnEvict = NULL;
+	m_pEvictContext = NULL;
+	m_vCamera[0] = m_vCamera[1] = m_vCamera[2] = 0.0f;
+	m_fPixelsPerRadian = 0.0f;
+	m_aFrustum = NULL;
+	m_apSelected = NULL;
+	m_nMaxSelected = 0;
+	m_nFrame = 0;
+	memset(&m_Stats, 0, sizeof(m_Stats));
+}
+
+WL::TerrainQuadtree::~TerrainQuadtree()
+{
+	Release();
+}
+
+bool WL::TerrainQuadtree::Create(const TerrainSettings& settings, int nThreads)
+{
+	Release();
+
+	m_Settings = settings;
+	if (m_Settings.nMaxLevel > TERRAIN_MAX_LEVEL)
+		m_Settings.nMaxLevel = TERRAIN_MAX_LEVEL;
+	if (m_Settings.nMaxLevel < 0)
+		m_Settings.nMaxLevel = 0;
+	if (m_Settings.nMaxInFlight < 1)
+		m_Settings.nMaxInFlight = 1;
+
+	// Without workers the pool runs every job as it is submitted
+	if (nThreads >= 0 && !m_Pool.Start(nThreads))
+		return false;
+
+	m_bCreated = true;
+	return true;
+}
+
+void WL::TerrainQuadtree::Release()
+{
+	// Let the workers finish before their chunks go away
+	m_Pool.Stop();
+
+	for (ChunkMap::iterator it = m_Chunks.begin(); it != m_Chunks.end(); ++it)
+	{
+		Chunk* pChunk = it->second;
+		if (m_pfnEvict)
+			m_pfnEvict(pChunk, m_pEvictContext);
+		delete pChunk->pData;
+		delete pChunk;
+	}
+	m_Chunks.clear();
+
+	m_nInFlight = 0;
+	m_nGenerated = 0;
+	m_bCreated = false;
+	memset(&m_Stats, 0, sizeof(m_Stats));
+}
+
+void WL::TerrainQuadtree::Flush()
+{
+	m_Pool.WaitIdle();
+}
+
+void WL::TerrainQuadtree::GenerateJob(void* pContext)
+{
+	Job* pJob = (Job*)pContext;
+	Chunk* pChunk = pJob->pChunk;
+
+	TerrainChunkData* pData = new TerrainChunkData;
+	GenerateTerrainChunk(pJob->pTree->m_Settings, pChunk->key, pData);
+	pChunk->pData = pData;
+
+	// Publishes pData to the thread selecting the chunks
+	AtomicIncrement(&pChunk->nState);
+	AtomicIncrement(&pJob->pTree->m_nGenerated);
+	AtomicDecrement(&pJob->pTree->m_nInFlight);
+
+	delete pJob;
+}
+
+WL::TerrainQuadtree::Chunk* WL::TerrainQuadtree::Find(const TerrainChunkKey& key)
+{
+	ChunkMap::iterator it = m_Chunks.find(key.GetID());
+	return it != m_Chunks.end() ? it->second : NULL;
+}
+
+bool WL::TerrainQuadtree::Request(const TerrainChunkKey& key)
+{
+	if (m_nInFlight >= m_Settings.nMaxInFlight)
+		return false;
+
+	// The roots may go over the budget, there has to be something to draw
+	if (key.nLevel > 0 && m_Chunks.size() >= GetChunkLimit())
+		return false;
+
+	Chunk* pChunk = new Chunk;
+	pChunk->key = key;
+	pChunk->nState = STATE_QUEUED;
+	pChunk->pData = NULL;
+	pChunk->nLastUsed = m_nFrame;
+	pChunk->pUserData = NULL;
+	m_Chunks[key.GetID()] = pChunk;
+
+	Job* pJob = new Job;
+	pJob->pTree = this;
+	pJob->pChunk = pChunk;
+
+	AtomicIncrement(&m_nInFlight);
+	m_Pool.Submit(GenerateJob, pJob);
+	return true;
+}
+
+bool WL::TerrainQuadtree::IsVisible(const TerrainChunkKey& key)
+{
+	// The bounds come from the face, so they hold before the chunk is generated and
+	// every chunk's bounds lie about inside its parent's
+	float vCenter[3], fRadius;
+	GetChunkBounds(m_Settings, key, vCenter, &fRadius);
+
+	if (m_aFrustum)
+	{
+		for (int i = 0; i < 6; i++)
+		{
+			const float* pPlane = m_aFrustum[i];
+			float fDistance = pPlane[0] * vCenter[0] + pPlane[1] * vCenter[1] + pPlane[2] * vCenter[2] + pPlane[3];
+			if (fDistance < -fRadius * sqrtf(pPlane[0] * pPlane[0] + pPlane[1] * pPlane[1] + pPlane[2] * pPlane[2]))
+				return false;
+		}
+	}
+
+	// Seen from the camera, the sea level sphere hides everything behind the plane through
+	// its horizon that is also inside the cone of rays touching it
+	float R = m_Settings.fRadius;
+	float fCamera2 = m_vCamera[0] * m_vCamera[0] + m_vCamera[1] * m_vCamera[1] + m_vCamera[2] * m_vCamera[2];
+	if (fCamera2 <= R * R)
+		return true;
+
+	float fCamera = sqrtf(fCamera2);
+	float fAlong = (m_vCamera[0] * vCenter[0] + m_vCamera[1] * vCenter[1] + m_vCamera[2] * vCenter[2]) / fCamera;
+	if ((fAlong + fRadius) * fCamera >= R * R)
+		return true;
+
+	// Angle between the way to the chunk and the way to the planet center, plus the angle
+	// the chunk takes up, against the angle of the cone
+	float dx = vCenter[0] - m_vCamera[0];
+	float dy = vCenter[1] - m_vCamera[1];
+	float dz = vCenter[2] - m_vCamera[2];
+	float fDistance = sqrtf(dx * dx + dy * dy + dz * dz);
+	if (fDistance <= fRadius)
+		return true;
+
+	float fCos = -(dx * m_vCamera[0] + dy * m_vCamera[1] + dz * m_vCamera[2]) / (fDistance * fCamera);
+	fCos = fCos > 1.0f ? 1.0f : (fCos < -1.0f ? -1.0f : fCos);
+	return acosf(fCos) + asinf(fRadius / fDistance) >= asinf(R / fCamera);
+}
+
+float WL::TerrainQuadtree::GetScreenError(const Chunk* pChunk)
+{
+	// The generated bounds, much tighter than the face ones near the ground
+	const TerrainChunkData* pData = pChunk->pData;
+	float dx = m_vCamera[0] - pData->vCenter[0];
+	float dy = m_vCamera[1] - pData->vCenter[1];
+	float dz = m_vCamera[2] - pData->vCenter[2];
+	float fSpacing = GetVertexSpacing(m_Settings, pChunk->key.nLevel);
+	float fDistance = sqrtf(dx * dx + dy * dy + dz * dz) - pData->fBoundRadius;
+	if (fDistance < fSpacing)
+		fDistance = fSpacing;
+
+	// The detail missing from a chunk is about the distance between its vertices
+	return fSpacing * m_fPixelsPerRadian / fDistance;
+}
+
+void WL::TerrainQuadtree::Output(Chunk* pChunk)
+{
+	if ((int)m_Stats.nSelected >= m_nMaxSelected)
+		return;
+
+	m_apSelected[m_Stats.nSelected++] = pChunk;
+	if (pChunk->key.nLevel > m_Stats.nDeepestLevel)
+		m_Stats.nDeepestLevel = pChunk->key.nLevel;
+}
+
+void WL::TerrainQuadtree::Consider(Chunk* pChunk)
+{
+	pChunk->nLastUsed = m_nFrame;
+
+	float fError = GetScreenError(pChunk);
+	if (pChunk->key.nLevel < m_Settings.nMaxLevel && fError > m_Settings.fMaxPixelError)
+	{
+		Candidate candidate;
+		candidate.fError = fError;
+		candidate.pChunk = pChunk;
+		m_Candidates.push(candidate);
+	}
+	else
+	{
+		Output(pChunk);
+	}
+}
+
+static bool IsUsedEarlier(const WL::TerrainQuadtree::Chunk* a, const WL::TerrainQuadtree::Chunk* b)
+{
+	return a->nLastUsed < b->nLastUsed;
+}
+
+unsigned int WL::TerrainQuadtree::GetChunkLimit() const
+{
+	return m_Settings.nMemoryBudget / sizeof(TerrainChunkData);
+}
+
+void WL::TerrainQuadtree::Evict(unsigned int nRoom)
+{
+	// The chunks not needed this frame, apart from the roots
+	std::vector<Chunk*> candidates;
+	for (ChunkMap::iterator it = m_Chunks.begin(); it != m_Chunks.end(); ++it)
+	{
+		Chunk* pChunk = it->second;
+		if (pChunk->nState == STATE_READY && pChunk->key.nLevel > 0 && pChunk->nLastUsed != m_nFrame)
+			candidates.push_back(pChunk);
+	}
+
+	unsigned int nLimit = GetChunkLimit();
+	unsigned int nKeep = nLimit > nRoom ? nLimit - nRoom : 0;
+	if (m_Chunks.size() <= nKeep)
+		return;
+
+	// Longest unused first
+	std::sort(candidates.begin(), candidates.end(), IsUsedEarlier);
+
+	for (size_t i = 0; i < candidates.size() && m_Chunks.size() > nKeep; i++)
+	{
+		Chunk* pChunk = candidates[i];
+		if (m_pfnEvict)
+			m_pfnEvict(pChunk, m_pEvictContext);
+
+		m_Chunks.erase(pChunk->key.GetID());
+		delete pChunk->pData;
+		delete pChunk;
+
+		m_Stats.nEvicted++;
+	}
+}
+
+int WL::TerrainQuadtree::Select(const float vCamera[3], float fPixelsPerRadian, const float aFrustum[6][4],
+								 Chunk** apChunks, int nMaxChunks)
+{
+	if (!m_bCreated)
+		return 0;
+
+	m_nFrame++;
+	m_vCamera[0] = vCamera[0];
+	m_vCamera[1] = vCamera[1];
+	m_vCamera[2] = vCamera[2];
+	m_fPixelsPerRadian = fPixelsPerRadian;
+	m_aFrustum = aFrustum;
+	m_apSelected = apChunks;
+	m_nMaxSelected = nMaxChunks;
+	m_Stats.nSelected = 0;
+	m_Stats.nDeepestLevel = 0;
+	m_Requests.clear();
+
+	// Every chunk needed counts against the budget: the ones drawn, the ones above them
+	// and the ones on their way
+	unsigned int nLimit = GetChunkLimit();
+	unsigned int nNeeded = 0;
+
+	for (int nFace = 0; nFace < TERRAIN_FACES; nFace++)
+	{
+		TerrainChunkKey root;
+		root.nFace = nFace;
+		root.nLevel = 0;
+		root.x = 0;
+		root.y = 0;
+		if (!IsVisible(root))
+			continue;
+
+		nNeeded++;
+		Chunk* pChunk = Find(root);
+		if (pChunk == NULL)
+			m_Requests.push_back(root);
+		else if (pChunk->nState == STATE_READY)
+			Consider(pChunk);
+	}
+
+	// Split the chunk with the largest error first, for as long as the budget lasts, so
+	// when it runs out the detail is where it shows the most
+	while (!m_Candidates.empty())
+	{
+		Chunk* pChunk = m_Candidates.top().pChunk;
+		m_Candidates.pop();
+
+		TerrainChunkKey aChildren[4];
+		Chunk* apChildren[4];
+		int nChildren = 0;
+		bool bReady = true;
+		for (int i = 0; i < 4; i++)
+		{
+			// Hidden children are neither generated nor drawn
+			TerrainChunkKey child = pChunk->key.GetChild(i);
+			if (!IsVisible(child))
+				continue;
+
+			aChildren[nChildren] = child;
+			apChildren[nChildren] = Find(child);
+			if (apChildren[nChildren] == NULL || apChildren[nChildren]->nState != STATE_READY)
+				bReady = false;
+			nChildren++;
+		}
+
+		if (nNeeded + nChildren > nLimit)
+		{
+			Output(pChunk);
+			continue;
+		}
+		nNeeded += nChildren;
+
+		for (int i = 0; i < nChildren; i++)
+		{
+			if (apChildren[i] == NULL)
+				m_Requests.push_back(aChildren[i]);
+			else
+				apChildren[i]->nLastUsed = m_nFrame;
+		}
+
+		// Drawn until all of its children are there
+		if (!bReady)
+		{
+			Output(pChunk);
+			continue;
+		}
+
+		for (int i = 0; i < nChildren; i++)
+			Consider(apChildren[i]);
+	}
+
+	// Make room for the requests, which are in order of importance
+	Evict((unsigned int)m_Requests.size());
+	for (size_t i = 0; i < m_Requests.size(); i++)
+	{
+		if (!Request(m_Requests[i]))
+			break;
+	}
+
+	unsigned int nResident = 0;
+	for (ChunkMap::iterator it = m_Chunks.begin(); it != m_Chunks.end(); ++it)
+	{
+		if (it->second->nState == STATE_READY)
+			nResident++;
+	}
+
+	m_Stats.nResident = nResident;
+	m_Stats.nBytesResident = nResident * sizeof(TerrainChunkData);
+	m_Stats.nInFlight = m_nInFlight;
+	m_Stats.nGenerated = m_nGenerated;
+	m_apSelected = NULL;
+	return m_Stats.nSelected;
+}
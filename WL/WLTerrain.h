@@ -0,0 +1,240 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: WLTerrain.h
+//
+// Author: snez
+//
+// Desc: Procedural planet terrain. The planet is a cube pushed out to a sphere, every face
+//       the root of a quadtree of square chunks. A chunk is a fixed grid of vertices whose
+//       heights come from fractal noise over the direction from the planet center, so
+//       neighbouring chunks and faces agree without knowing about each other.
+//
+//       Every frame the chunks are split, largest error on screen first, until the error
+//       is small enough everywhere or the memory budget would not hold the result. Chunks
+//       outside the view or behind the horizon are skipped. Missing chunks are generated
+//       on a ThreadPool, and until the children of a chunk have arrived the chunk itself
+//       is drawn. The chunks not needed any more are dropped, longest unused first, when
+//       room is wanted for new ones.
+//
+//       Nothing in here depends on Direct3D.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __WLTerrain_H__
+#define __WLTerrain_H__
+
+#include <map>
+#include <queue>
+#include <vector>
+#include "WLThreadPool.h"
+
+#define TERRAIN_CHUNK_GRID		17			// Vertices along the edge of a chunk
+#define TERRAIN_MAX_LEVEL		12			// Deepest level of the quadtree, x and y fit in 12 bits
+#define TERRAIN_FACES			6
+
+namespace WL
+{
+
+	//
+	//	Position, normal and color, laid out like D3DFVF_XYZ | D3DFVF_NORMAL | D3DFVF_DIFFUSE
+	//
+	struct TerrainVertex
+	{
+		float			x, y, z;		// Relative to the chunk center
+		float			nx, ny, nz;
+		unsigned int	color;			// A8R8G8B8
+	};
+
+	struct TerrainSettings
+	{
+		float			fRadius;			// Sea level
+		float			fHeightScale;		// Largest height above, or depth below, sea level
+		float			fFrequency;			// Of the first octave, in features around the planet
+		float			fLacunarity;		// Frequency multiplier of each octave
+		float			fGain;				// Amplitude multiplier of each octave
+		int				nOctaves;
+		unsigned int	nSeed;
+
+		int				nMaxLevel;			// At most TERRAIN_MAX_LEVEL
+		float			fMaxPixelError;		// Chunks are split above this error on screen
+		unsigned int	nMemoryBudget;		// Bytes of vertex data kept resident
+		int				nMaxInFlight;		// Chunks queued for generation at once
+
+		TerrainSettings();
+	};
+
+	//
+	//	Identifies a chunk by its face, level and position within the face
+	//
+	struct TerrainChunkKey
+	{
+		int		nFace;
+		int		nLevel;
+		int		x;
+		int		y;
+
+		inline unsigned int GetID() const { return (nFace << 28) | (nLevel << 24) | (y << 12) | x; }
+		TerrainChunkKey GetChild(int i) const;
+	};
+
+	//
+	//	Gradient noise in [-1, 1] from an integer hash rather than a permutation table, so
+	//	a shader can evaluate the same function
+	//
+	float TerrainNoise(float x, float y, float z, unsigned int nSeed);
+
+	//
+	//	Height above sea level of the unit direction vDir, negative below the sea
+	//
+	float GetTerrainHeight(const TerrainSettings& settings, const float vDir[3]);
+
+	//
+	//	Unit direction of a point on a face, s and t in [-1, 1]
+	//
+	void GetTerrainDirection(int nFace, float s, float t, float vDir[3]);
+
+	//
+	//	The geometry of one chunk
+	//
+	struct TerrainChunkData
+	{
+		enum
+		{
+			GRID_VERTICES = TERRAIN_CHUNK_GRID * TERRAIN_CHUNK_GRID,
+			SKIRT_VERTICES = 4 * TERRAIN_CHUNK_GRID,		// Hang below the edges to hide cracks
+			VERTICES = GRID_VERTICES + SKIRT_VERTICES,
+			INDICES = 6 * (TERRAIN_CHUNK_GRID - 1) * (TERRAIN_CHUNK_GRID - 1) + 4 * 6 * (TERRAIN_CHUNK_GRID - 1),
+		};
+
+		float			vCenter[3];			// Planet space, the vertices are relative to it
+		float			fBoundRadius;		// Around vCenter, enclosing every vertex
+		float			fMinHeight;
+		float			fMaxHeight;
+		TerrainVertex	aVertices[VERTICES];
+	};
+
+	//
+	//	Fills in a chunk. Pure function of its arguments, safe on any thread.
+	//
+	void GenerateTerrainChunk(const TerrainSettings& settings, const TerrainChunkKey& key, TerrainChunkData* pData);
+
+	//
+	//	The triangle list every chunk is drawn with, clockwise seen from above the ground
+	//
+	void GetTerrainChunkIndices(unsigned short aIndices[TerrainChunkData::INDICES]);
+
+	class TerrainQuadtree
+	{
+	public:
+		struct Chunk
+		{
+			TerrainChunkKey		key;
+			volatile long		nState;
+			TerrainChunkData*	pData;			// Valid once the chunk is ready
+			unsigned int		nLastUsed;		// Frame it was last selected
+			void*				pUserData;		// The renderer's copy of the vertices
+		};
+
+		struct Stats
+		{
+			unsigned int	nResident;			// Generated chunks kept
+			unsigned int	nInFlight;			// Queued or being generated
+			unsigned int	nSelected;			// Chunks picked by the last Select()
+			unsigned int	nBytesResident;
+			unsigned int	nGenerated;			// Since Create()
+			unsigned int	nEvicted;
+			int				nDeepestLevel;		// Of the last selection
+		};
+
+		// Called on the thread calling Select() or Release() before a chunk goes away
+		typedef void (*EvictFunction)(Chunk* pChunk, void* pContext);
+
+		TerrainQuadtree();
+		~TerrainQuadtree();
+
+		//
+		//	A thread count of 0 uses one per processor minus one. Negative generates the
+		//	chunks on the thread calling Select() instead, as soon as they are asked for.
+		//
+		bool Create(const TerrainSettings& settings, int nThreads = 0);
+		void Release();
+
+		inline void SetEvictCallback(EvictFunction pfnEvict, void* pContext) { m_pfnEvict = pfnEvict; m_pEvictContext = pContext; }
+
+		//
+		//	Picks the chunks to draw from a camera position in planet space, in pixels per
+		//	radian of the view. The frustum planes (a, b, c, d) are in planet space with
+		//	the inside positive, NULL draws all round the camera. Queues the chunks it would
+		//	rather draw and evicts above the budget. Returns how many chunks were written
+		//	to apChunks.
+		//
+		int Select(const float vCamera[3], float fPixelsPerRadian, const float aFrustum[6][4],
+				   Chunk** apChunks, int nMaxChunks);
+
+		//
+		//	Block until every queued chunk is generated
+		//
+		void Flush();
+
+		inline const TerrainSettings& GetSettings() const { return m_Settings; }
+		inline const Stats& GetStats() const { return m_Stats; }
+
+	private:
+		TerrainQuadtree(const TerrainQuadtree&);
+		TerrainQuadtree& operator=(const TerrainQuadtree&);
+
+		enum EState { STATE_QUEUED, STATE_READY };
+
+		struct Job
+		{
+			TerrainQuadtree*	pTree;
+			Chunk*				pChunk;
+		};
+
+		struct Candidate
+		{
+			float				fError;
+			Chunk*				pChunk;
+
+			inline bool operator<(const Candidate& other) const { return fError < other.fError; }
+		};
+
+		static void GenerateJob(void* pContext);
+
+		Chunk* Find(const TerrainChunkKey& key);
+		bool Request(const TerrainChunkKey& key);
+		bool IsVisible(const TerrainChunkKey& key);
+		float GetScreenError(const Chunk* pChunk);
+		void Consider(Chunk* pChunk);
+		void Output(Chunk* pChunk);
+		void Evict(unsigned int nRoom);
+		unsigned int GetChunkLimit() const;
+
+		typedef std::map<unsigned int, Chunk*> ChunkMap;
+
+		TerrainSettings		m_Settings;
+		ThreadPool			m_Pool;
+		bool				m_bCreated;
+		ChunkMap			m_Chunks;
+		volatile long		m_nInFlight;
+		volatile long		m_nGenerated;
+
+		EvictFunction		m_pfnEvict;
+		void*				m_pEvictContext;
+
+		// State of the current Select()
+		float				m_vCamera[3];
+		float				m_fPixelsPerRadian;
+		const float			(*m_aFrustum)[4];
+		Chunk**				m_apSelected;
+		int					m_nMaxSelected;
+		unsigned int		m_nFrame;
+		std::priority_queue<Candidate>	m_Candidates;		// Chunks that would rather be split
+		std::vector<TerrainChunkKey>	m_Requests;			// Missing chunks, most wanted first
+
+		Stats				m_Stats;
+	};
+
+}
+
+#endif // __WLTerrain_H__
@@ -0,0 +1,274 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: WLTextureBaker.cpp
+//
+// Author: snez
+//
+// Desc: Offline conversion of the source images into block compressed DDS files.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "WLTextureBaker.h"
+
+//
+//	DDS file layout, declared here to avoid pulling in ddraw.h
+//
+#define DDS_MAGIC			0x20534444	// "DDS "
+#define DDS_FOURCC			0x00000004
+#define DDS_CUBEMAP			0x00000200
+#define DDS_VOLUME			0x00200000
+
+struct DDS_PIXELFORMAT
+{
+	DWORD	dwSize;
+	DWORD	dwFlags;
+	DWORD	dwFourCC;
+	DWORD	dwRGBBitCount;
+	DWORD	dwRBitMask;
+	DWORD	dwGBitMask;
+	DWORD	dwBBitMask;
+	DWORD	dwABitMask;
+};
+
+struct DDS_HEADER
+{
+	DWORD			dwSize;
+	DWORD			dwFlags;
+	DWORD			dwHeight;
+	DWORD			dwWidth;
+	DWORD			dwPitchOrLinearSize;
+	DWORD			dwDepth;
+	DWORD			dwMipMapCount;
+	DWORD			dwReserved1[11];
+	DDS_PIXELFORMAT	ddspf;
+	DWORD			dwCaps;
+	DWORD			dwCaps2;
+	DWORD			dwCaps3;
+	DWORD			dwCaps4;
+	DWORD			dwReserved2;
+};
+
+HRESULT WL::ParseDDS(const BYTE* pData, UINT nSize, DDSImage* pImage)
+{
+	if (nSize < sizeof(DWORD) + sizeof(DDS_HEADER) || *(const DWORD*)pData != DDS_MAGIC)
+		return E_FAIL;
+
+	const DDS_HEADER* pHeader = (const DDS_HEADER*)(pData + sizeof(DWORD));
+	if (pHeader->dwSize != sizeof(DDS_HEADER) || pHeader->ddspf.dwSize != sizeof(DDS_PIXELFORMAT))
+		return E_FAIL;
+	if ((pHeader->ddspf.dwFlags & DDS_FOURCC) == 0 || (pHeader->dwCaps2 & (DDS_CUBEMAP | DDS_VOLUME)) != 0)
+		return E_FAIL;
+
+	UINT nBlockBytes;
+	switch (pHeader->ddspf.dwFourCC)
+	{
+		case D3DFMT_DXT1:
+			nBlockBytes = 8;
+			break;
+		case D3DFMT_DXT3:
+		case D3DFMT_DXT5:
+			nBlockBytes = 16;
+			break;
+		default:
+			return E_FAIL;
+	}
+
+	pImage->Format = (D3DFORMAT)pHeader->ddspf.dwFourCC;
+	pImage->Width = pHeader->dwWidth;
+	pImage->Height = pHeader->dwHeight;
+	pImage->Levels = max(pHeader->dwMipMapCount, (DWORD)1);
+	if (pImage->Levels > DDSImage::MAX_LEVELS)
+		return E_FAIL;
+
+	// The levels follow the header back to back, largest first
+	const BYTE* pLevel = pData + sizeof(DWORD) + sizeof(DDS_HEADER);
+	const BYTE* pEnd = pData + nSize;
+	UINT width = pImage->Width;
+	UINT height = pImage->Height;
+	for (UINT i = 0; i < pImage->Levels; i++)
+	{
+		UINT nPitch = max((width + 3) / 4, (UINT)1) * nBlockBytes;
+		UINT nRows = max((height + 3) / 4, (UINT)1);
+		if (pLevel + nPitch * nRows > pEnd)
+			return E_FAIL;
+
+		pImage->pLevel[i] = pLevel;
+		pImage->LevelPitch[i] = nPitch;
+		pImage->LevelRows[i] = nRows;
+
+		pLevel += nPitch * nRows;
+		width = max(width / 2, (UINT)1);
+		height = max(height / 2, (UINT)1);
+	}
+
+	return S_OK;
+}
+
+//
+//	Replace the extension of a file name with .dds
+//
+static bool MakeBakedFileName(LPCWSTR strSrcFile, WCHAR* strBakedFile, UINT cchBakedFile)
+{
+	if (FAILED(StringCchCopyW(strBakedFile, cchBakedFile, strSrcFile)))
+		return false;
+
+	WCHAR* pExt = wcsrchr(strBakedFile, L'.');
+	WCHAR* pSlash = wcsrchr(strBakedFile, L'\\');
+	if (pExt == NULL || (pSlash != NULL && pExt < pSlash))
+		return false;
+	if (_wcsicmp(pExt, L".dds") == 0)
+		return false;
+
+	*pExt = 0;
+	return SUCCEEDED(StringCchCatW(strBakedFile, cchBakedFile, L".dds"));
+}
+
+bool WL::GetBakedFileName(LPCWSTR strSrcFile, WCHAR* strBakedFile, UINT cchBakedFile)
+{
+	if (!MakeBakedFileName(strSrcFile, strBakedFile, cchBakedFile))
+		return false;
+
+	WIN32_FILE_ATTRIBUTE_DATA src, baked;
+	if (!GetFileAttributesExW(strBakedFile, GetFileExInfoStandard, &baked))
+		return false;
+	if (!GetFileAttributesExW(strSrcFile, GetFileExInfoStandard, &src))
+		return true;	// Only the baked file was shipped
+
+	return CompareFileTime(&baked.ftLastWriteTime, &src.ftLastWriteTime) >= 0;
+}
+
+static bool HasAlpha(D3DFORMAT format)
+{
+	switch (format)
+	{
+		case D3DFMT_A8R8G8B8:
+		case D3DFMT_A8B8G8R8:
+		case D3DFMT_A1R5G5B5:
+		case D3DFMT_A4R4G4B4:
+		case D3DFMT_A8R3G3B2:
+		case D3DFMT_A2R10G10B10:
+		case D3DFMT_A2B10G10R10:
+		case D3DFMT_A16B16G16R16:
+		case D3DFMT_A8:
+		case D3DFMT_A8L8:
+		case D3DFMT_A4L4:
+		case D3DFMT_A8P8:
+		case D3DFMT_DXT2:
+		case D3DFMT_DXT3:
+		case D3DFMT_DXT4:
+		case D3DFMT_DXT5:
+			return true;
+	}
+	return false;
+}
+
+HRESULT WL::BakeTexture(IDirect3DDevice9* pd3dDevice, LPCWSTR strSrcFile)
+{
+	HRESULT hr;
+	WCHAR strBakedFile[MAX_PATH];
+	if (!MakeBakedFileName(strSrcFile, strBakedFile, MAX_PATH))
+		return E_INVALIDARG;
+
+	D3DXIMAGE_INFO info;
+	V_RETURN( D3DXGetImageInfoFromFile(strSrcFile, &info) );
+
+	// The scratch pool lets D3DX compress regardless of what the device supports. The
+	// size is rounded up to a power of two, the same as the runtime used to do.
+	LPDIRECT3DTEXTURE9 pTexture = NULL;
+	V_RETURN( D3DXCreateTextureFromFileEx(
+					pd3dDevice, strSrcFile,
+					D3DX_DEFAULT, D3DX_DEFAULT, D3DX_DEFAULT,
+					0, HasAlpha(info.Format) ? D3DFMT_DXT5 : D3DFMT_DXT1, D3DPOOL_SCRATCH,
+					D3DX_DEFAULT, D3DX_DEFAULT, 0,
+					NULL, NULL, &pTexture) );
+
+	hr = D3DXSaveTextureToFile(strBakedFile, D3DXIFF_DDS, pTexture, NULL);
+	SAFE_RELEASE(pTexture);
+
+	if (FAILED(hr))
+		return DXUT_ERR(L"D3DXSaveTextureToFile", hr);
+
+	return S_OK;
+}
+
+//
+//	Calls pfnBake for every file matching the pattern, with the pattern's directory prepended
+//
+static int ForEachFile(IDirect3DDevice9* pd3dDevice, LPCWSTR strPattern,
+					   HRESULT (*pfnBake)(IDirect3DDevice9*, LPCWSTR))
+{
+	WCHAR strDir[MAX_PATH];
+	StringCchCopyW(strDir, MAX_PATH, strPattern);
+	WCHAR* pSlash = wcsrchr(strDir, L'\\');
+	if (pSlash)
+		pSlash[1] = 0;
+	else
+		strDir[0] = 0;
+
+	WIN32_FIND_DATAW data;
+	HANDLE hFind = FindFirstFileW(strPattern, &data);
+	if (hFind == INVALID_HANDLE_VALUE)
+		return 0;
+
+	int nBaked = 0;
+	do
+	{
+		if (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+			continue;
+
+		WCHAR strFile[MAX_PATH];
+		StringCchCopyW(strFile, MAX_PATH, strDir);
+		StringCchCatW(strFile, MAX_PATH, data.cFileName);
+
+		if (SUCCEEDED(pfnBake(pd3dDevice, strFile)))
+			nBaked++;
+	}
+	while (FindNextFileW(hFind, &data));
+
+	FindClose(hFind);
+	return nBaked;
+}
+
+//
+//	Bakes the textures of a mesh. Texture names in the mesh are relative to the working
+//	directory, the same way XMesh loads them.
+//
+static HRESULT BakeMeshFile(IDirect3DDevice9* pd3dDevice, LPCWSTR strMeshFile)
+{
+	HRESULT hr;
+	LPD3DXMESH pMesh = NULL;
+	LPD3DXBUFFER pMaterialBuffer = NULL;
+	DWORD dwNumMaterials = 0;
+
+	V_RETURN( D3DXLoadMeshFromX(strMeshFile, D3DXMESH_SYSTEMMEM, pd3dDevice, NULL,
+								&pMaterialBuffer, NULL, &dwNumMaterials, &pMesh) );
+
+	hr = S_OK;
+	D3DXMATERIAL* d3dxMaterials = (D3DXMATERIAL*)pMaterialBuffer->GetBufferPointer();
+	for (DWORD i = 0; i < dwNumMaterials; i++)
+	{
+		if (d3dxMaterials[i].pTextureFilename == NULL || d3dxMaterials[i].pTextureFilename[0] == 0)
+			continue;
+
+		WCHAR textureName[MAX_PATH];
+		MultiByteToWideChar(CP_ACP, 0, d3dxMaterials[i].pTextureFilename, -1, textureName, MAX_PATH);
+
+		HRESULT hrBake = WL::BakeTexture(pd3dDevice, textureName);
+		if (FAILED(hrBake))
+			hr = hrBake;
+	}
+
+	SAFE_RELEASE(pMaterialBuffer);
+	SAFE_RELEASE(pMesh);
+	return hr;
+}
+
+int WL::BakeTextures(IDirect3DDevice9* pd3dDevice, LPCWSTR strPattern)
+{
+	return ForEachFile(pd3dDevice, strPattern, WL::BakeTexture);
+}
+
+int WL::BakeMeshTextures(IDirect3DDevice9* pd3dDevice, LPCWSTR strPattern)
+{
+	return ForEachFile(pd3dDevice, strPattern, BakeMeshFile);
+}
@@ -0,0 +1,65 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: WLTextureBaker.h
+//
+// Author: snez
+//
+// Desc: Offline conversion of the source images into block compressed DDS files. The baked
+//       file holds a DXT1 surface (DXT5 when the source has alpha) with the whole mip chain
+//       already generated, so the loader can copy the blocks straight into the texture.
+//
+//       A baked file sits next to its source with a .dds extension and is only used while
+//       it is newer than the source.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __WLTextureBaker_H__
+#define __WLTextureBaker_H__
+
+#include "dxstdafx.h"
+
+namespace WL
+{
+
+	//
+	//	A DDS file loaded in memory. The level pointers point into the file data.
+	//
+	struct DDSImage
+	{
+		enum { MAX_LEVELS = 16 };
+
+		D3DFORMAT		Format;
+		UINT			Width;
+		UINT			Height;
+		UINT			Levels;
+		const BYTE*		pLevel[MAX_LEVELS];
+		UINT			LevelPitch[MAX_LEVELS];		// Bytes per row of blocks
+		UINT			LevelRows[MAX_LEVELS];		// Rows of blocks
+	};
+
+	//
+	//	Fills the image description from the contents of a DXT1/3/5 DDS file. Fails for
+	//	anything else (cube maps, volumes, uncompressed formats).
+	//
+	HRESULT ParseDDS(const BYTE* pData, UINT nSize, DDSImage* pImage);
+
+	//
+	//	Returns true and the baked file name if an up to date bake of the source exists
+	//
+	bool GetBakedFileName(LPCWSTR strSrcFile, WCHAR* strBakedFile, UINT cchBakedFile);
+
+	//
+	//	Bake one image into a DDS file next to it
+	//
+	HRESULT BakeTexture(IDirect3DDevice9* pd3dDevice, LPCWSTR strSrcFile);
+
+	//
+	//	Bake every image matching a wildcard, or every texture referenced by the meshes
+	//	matching a wildcard. Both return the number of files that baked without errors.
+	//
+	int BakeTextures(IDirect3DDevice9* pd3dDevice, LPCWSTR strPattern);
+	int BakeMeshTextures(IDirect3DDevice9* pd3dDevice, LPCWSTR strPattern);
+
+}
+
+#endif // __WLTextureBaker_H__
@@ -0,0 +1,502 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: WLTextureLoader.cpp
+//
+// Author: snez
+//
+// Desc: Background texture loading with incremental uploads.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "WLTextureLoader.h"
+
+#define DEFAULT_UPLOAD_BUDGET	(2 * 1024 * 1024)	// Bytes copied to the GPU per frame
+
+//--------------------------------------------------------------------------------------
+// AsyncTexture
+//--------------------------------------------------------------------------------------
+AsyncTexture::AsyncTexture(LPCWSTR strFileName, D3DCOLOR placeholderColor)
+{
+	StringCchCopyW(m_strFileName, MAX_PATH, strFileName);
+	m_nRefCount = 1;
+	m_nState = STATE_QUEUED;
+	m_PlaceholderColor = placeholderColor;
+	m_pTexture = NULL;
+	m_pUpload = NULL;
+	m_pStaging = NULL;
+	m_pFileData = NULL;
+	m_hrDecode = S_OK;
+	m_iNextLevel = -1;
+	m_nBytesResident = 0;
+	m_fRequestTime = 0;
+	m_fDecodeStartTime = 0;
+}
+
+AsyncTexture::~AsyncTexture()
+{
+	TextureLoader::Get().ReleaseResident(this);
+	SAFE_RELEASE(m_pTexture);
+	SAFE_RELEASE(m_pUpload);
+	SAFE_RELEASE(m_pStaging);
+	SAFE_DELETE_ARRAY(m_pFileData);
+}
+
+LPDIRECT3DTEXTURE9 AsyncTexture::GetTexture() const
+{
+	if (m_pTexture)
+		return m_pTexture;
+
+	return TextureLoader::Get().GetPlaceholder(m_PlaceholderColor);
+}
+
+long AsyncTexture::AddRef()
+{
+	return WL::AtomicIncrement(&m_nRefCount);
+}
+
+long AsyncTexture::Release()
+{
+	long nRefCount = WL::AtomicDecrement(&m_nRefCount);
+	if (nRefCount == 0)
+		delete this;
+	return nRefCount;
+}
+
+//--------------------------------------------------------------------------------------
+// TextureLoader
+//--------------------------------------------------------------------------------------
+TextureLoader& TextureLoader::Get()
+{
+	static TextureLoader s_loader;
+	return s_loader;
+}
+
+TextureLoader::TextureLoader()
+{
+	m_pd3dDevice = NULL;
+	m_nUploadBudget = DEFAULT_UPLOAD_BUDGET;
+	m_bBakedSupported = false;
+	m_nPlaceholders = 0;
+	for (int i = 0; i < MAX_PLACEHOLDERS; i++)
+		m_apPlaceholder[i] = NULL;
+	ZeroMemory(&m_Stats, sizeof(m_Stats));
+	m_fTotalQueueWait = 0;
+	m_fTotalLatency = 0;
+}
+
+TextureLoader::~TextureLoader()
+{
+	OnDestroyDevice();
+}
+
+HRESULT TextureLoader::OnCreateDevice(IDirect3DDevice9* pd3dDevice)
+{
+	m_pd3dDevice = pd3dDevice;
+
+	// Baked files are only useful if the blocks can be uploaded as they are
+	DXUTDeviceSettings settings = DXUTGetDeviceSettings();
+	IDirect3D9* pD3D = DXUTGetD3DObject();
+	m_bBakedSupported =
+		SUCCEEDED(pD3D->CheckDeviceFormat(settings.AdapterOrdinal, settings.DeviceType, settings.AdapterFormat,
+										  0, D3DRTYPE_TEXTURE, D3DFMT_DXT1)) &&
+		SUCCEEDED(pD3D->CheckDeviceFormat(settings.AdapterOrdinal, settings.DeviceType, settings.AdapterFormat,
+										  0, D3DRTYPE_TEXTURE, D3DFMT_DXT5));
+
+	if (!m_Pool.Start())
+		return E_FAIL;
+
+	return S_OK;
+}
+
+void TextureLoader::OnDestroyDevice()
+{
+	// Let the workers drain, then drop everything that never made it to the GPU
+	m_Pool.Stop();
+
+	ProcessDecoded();
+	for (int i = 0; i < m_Uploading.GetSize(); i++)
+		Finish(m_Uploading[i], false);
+	m_Uploading.RemoveAll();
+
+	for (int i = 0; i < m_nPlaceholders; i++)
+		SAFE_RELEASE(m_apPlaceholder[i]);
+	m_nPlaceholders = 0;
+
+	m_pd3dDevice = NULL;
+}
+
+AsyncTexture* TextureLoader::Load(LPCWSTR strFileName, D3DCOLOR placeholderColor)
+{
+	if (strFileName == NULL || m_pd3dDevice == NULL)
+		return NULL;
+
+	AsyncTexture* pTexture = new AsyncTexture(strFileName, placeholderColor);
+	pTexture->m_fRequestTime = WL::GetTimeSeconds();
+
+	// The loader keeps its own reference until the request is finished
+	pTexture->AddRef();
+
+	{
+		WL::ScopedLock lock(m_Mutex);
+		m_Stats.nQueued++;
+	}
+
+	m_Pool.Submit(DecodeJob, pTexture);
+	return pTexture;
+}
+
+void TextureLoader::DecodeJob(void* pContext)
+{
+	TextureLoader::Get().Decode((AsyncTexture*)pContext);
+}
+
+//
+//	Runs on a worker thread: pick up the baked file, or failing that read the source and
+//	decode the full mip chain into system memory
+//
+void TextureLoader::Decode(AsyncTexture* pTexture)
+{
+	pTexture->m_fDecodeStartTime = WL::GetTimeSeconds();
+	pTexture->m_nState = AsyncTexture::STATE_DECODING;
+	{
+		WL::ScopedLock lock(m_Mutex);
+		m_Stats.nQueued--;
+		m_Stats.nDecoding++;
+	}
+
+	HRESULT hr = E_FAIL;
+	if (m_bBakedSupported)
+		hr = DecodeBaked(pTexture);
+
+	if (FAILED(hr))
+	{
+		BYTE* pData = NULL;
+		UINT nSize = 0;
+		hr = ReadWholeFile(pTexture->m_strFileName, &pData, &nSize);
+		if (SUCCEEDED(hr))
+		{
+			hr = D3DXCreateTextureFromFileInMemoryEx(
+					m_pd3dDevice, pData, nSize,
+					D3DX_DEFAULT, D3DX_DEFAULT, D3DX_DEFAULT,	// Same size and mip chain as D3DXCreateTextureFromFile
+					0, D3DFMT_UNKNOWN, D3DPOOL_SYSTEMMEM,
+					D3DX_DEFAULT, D3DX_DEFAULT, 0,
+					NULL, NULL, &pTexture->m_pStaging);
+			delete[] pData;
+		}
+	}
+
+	pTexture->m_hrDecode = hr;
+	pTexture->m_nState = AsyncTexture::STATE_UPLOADING;
+
+	WL::ScopedLock lock(m_Mutex);
+	m_Stats.nDecoding--;
+	m_Stats.nUploading++;
+	m_Decoded.Add(pTexture);
+}
+
+//
+//	Use the baked file, if there is one. Only the header is parsed; the blocks are uploaded
+//	straight out of the file data.
+//
+HRESULT TextureLoader::DecodeBaked(AsyncTexture* pTexture)
+{
+	WCHAR strBakedFile[MAX_PATH];
+	if (!WL::GetBakedFileName(pTexture->m_strFileName, strBakedFile, MAX_PATH))
+		return E_FAIL;
+
+	BYTE* pData = NULL;
+	UINT nSize = 0;
+	HRESULT hr = ReadWholeFile(strBakedFile, &pData, &nSize);
+	if (FAILED(hr))
+		return hr;
+
+	hr = WL::ParseDDS(pData, nSize, &pTexture->m_Baked);
+	if (FAILED(hr))
+	{
+		delete[] pData;
+		return hr;
+	}
+
+	pTexture->m_pFileData = pData;
+	return S_OK;
+}
+
+HRESULT TextureLoader::ReadWholeFile(LPCWSTR strFileName, BYTE** ppData, UINT* pnSize)
+{
+	HANDLE hFile = CreateFileW(strFileName, GENERIC_READ, FILE_SHARE_READ, NULL,
+							   OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+	if (hFile == INVALID_HANDLE_VALUE)
+		return HRESULT_FROM_WIN32(GetLastError());
+
+	HRESULT hr = S_OK;
+	DWORD dwSize = GetFileSize(hFile, NULL);
+	BYTE* pData = new BYTE[dwSize];
+	DWORD dwRead = 0;
+
+	if (!::ReadFile(hFile, pData, dwSize, &dwRead, NULL) || dwRead != dwSize)
+	{
+		hr = E_FAIL;
+		SAFE_DELETE_ARRAY(pData);
+		dwSize = 0;
+	}
+
+	CloseHandle(hFile);
+	*ppData = pData;
+	*pnSize = dwSize;
+	return hr;
+}
+
+//
+//	Move the requests that the workers finished into the upload list
+//
+void TextureLoader::ProcessDecoded()
+{
+	CGrowableArray<AsyncTexture*> decoded;
+	{
+		WL::ScopedLock lock(m_Mutex);
+		for (int i = 0; i < m_Decoded.GetSize(); i++)
+			decoded.Add(m_Decoded[i]);
+		m_Decoded.RemoveAll();
+	}
+
+	for (int i = 0; i < decoded.GetSize(); i++)
+	{
+		AsyncTexture* pTexture = decoded[i];
+		if (FAILED(pTexture->m_hrDecode))
+		{
+			// A missing texture is not fatal, the placeholder simply stays in place
+			WCHAR strMsg[MAX_PATH + 64];
+			StringCchPrintfW(strMsg, MAX_PATH + 64, L"Could not load texture %s", pTexture->m_strFileName);
+			DXUTTrace(__FILE__, (DWORD)__LINE__, pTexture->m_hrDecode, strMsg, false);
+			Finish(pTexture, false);
+		}
+		else
+		{
+			m_Uploading.Add(pTexture);
+		}
+	}
+}
+
+void TextureLoader::Update()
+{
+	if (m_pd3dDevice == NULL)
+		return;
+
+	ProcessDecoded();
+
+	UINT nBytes = 0;
+
+	// Every frame at least one level goes up, so large levels can't stall the queue
+	while (m_Uploading.GetSize() > 0)
+	{
+		AsyncTexture* pTexture = m_Uploading[0];
+		if (!UploadLevel(pTexture, &nBytes))
+		{
+			m_Uploading.Remove(0);
+			Finish(pTexture, false);
+		}
+		else if (pTexture->m_iNextLevel < 0)
+		{
+			m_Uploading.Remove(0);
+			Finish(pTexture, true);
+		}
+
+		if (nBytes >= m_nUploadBudget)
+			break;
+	}
+
+	m_Stats.nBytesUploaded = nBytes;
+}
+
+void TextureLoader::Flush()
+{
+	m_Pool.WaitIdle();
+
+	UINT nBudget = m_nUploadBudget;
+	m_nUploadBudget = UINT_MAX;
+	Update();
+	m_nUploadBudget = nBudget;
+}
+
+//
+//	Copy one mip level from the staging texture. Levels go up smallest first, and the
+//	texture is published as soon as the first one is resident.
+//
+bool TextureLoader::UploadLevel(AsyncTexture* pTexture, UINT* pBytes)
+{
+	HRESULT hr;
+	LPDIRECT3DTEXTURE9 pStaging = pTexture->m_pStaging;
+	const WL::DDSImage& baked = pTexture->m_Baked;
+
+	if (pTexture->m_pUpload == NULL)
+	{
+		UINT width, height, levels;
+		D3DFORMAT format;
+		if (pTexture->m_pFileData)
+		{
+			width = baked.Width;
+			height = baked.Height;
+			levels = baked.Levels;
+			format = baked.Format;
+		}
+		else
+		{
+			D3DSURFACE_DESC desc;
+			if (FAILED(pStaging->GetLevelDesc(0, &desc)))
+				return false;
+			width = desc.Width;
+			height = desc.Height;
+			levels = pStaging->GetLevelCount();
+			format = desc.Format;
+		}
+
+		hr = m_pd3dDevice->CreateTexture(width, height, levels, 0, format, D3DPOOL_MANAGED,
+										 &pTexture->m_pUpload, NULL);
+		if (FAILED(hr))
+			return false;
+
+		pTexture->m_iNextLevel = (int)levels - 1;
+	}
+
+	UINT level = (UINT)pTexture->m_iNextLevel;
+	D3DLOCKED_RECT src, dst;
+	UINT nRows, nRowBytes;
+
+	if (pTexture->m_pFileData)
+	{
+		src.pBits = (void*)baked.pLevel[level];
+		src.Pitch = (INT)baked.LevelPitch[level];
+		nRows = baked.LevelRows[level];
+	}
+	else
+	{
+		D3DSURFACE_DESC desc;
+		if (FAILED(pStaging->GetLevelDesc(level, &desc)))
+			return false;
+		if (FAILED(pStaging->LockRect(level, &src, NULL, D3DLOCK_READONLY)))
+			return false;
+
+		// Compressed formats are stored as rows of 4x4 blocks
+		nRows = desc.Height;
+		if (desc.Format == D3DFMT_DXT1 || desc.Format == D3DFMT_DXT2 || desc.Format == D3DFMT_DXT3 ||
+			desc.Format == D3DFMT_DXT4 || desc.Format == D3DFMT_DXT5)
+			nRows = (desc.Height + 3) / 4;
+	}
+
+	if (FAILED(pTexture->m_pUpload->LockRect(level, &dst, NULL, 0)))
+	{
+		if (pStaging)
+			pStaging->UnlockRect(level);
+		return false;
+	}
+
+	nRowBytes = (UINT)min(src.Pitch, dst.Pitch);
+	const BYTE* pSrc = (const BYTE*)src.pBits;
+	BYTE* pDst = (BYTE*)dst.pBits;
+	for (UINT y = 0; y < nRows; y++)
+	{
+		memcpy(pDst, pSrc, nRowBytes);
+		pSrc += src.Pitch;
+		pDst += dst.Pitch;
+	}
+
+	pTexture->m_pUpload->UnlockRect(level);
+	if (pStaging)
+		pStaging->UnlockRect(level);
+	*pBytes += nRowBytes * nRows;
+	pTexture->m_nBytesResident += nRowBytes * nRows;
+	{
+		WL::ScopedLock lock(m_Mutex);
+		m_Stats.nBytesResident += nRowBytes * nRows;
+	}
+
+	// Only sample the levels that have arrived
+	pTexture->m_pUpload->SetLOD(level);
+	if (pTexture->m_pTexture == NULL)
+	{
+		pTexture->m_pTexture = pTexture->m_pUpload;
+		pTexture->m_pTexture->AddRef();
+	}
+
+	pTexture->m_iNextLevel--;
+	return true;
+}
+
+void TextureLoader::Finish(AsyncTexture* pTexture, bool bSucceeded)
+{
+	bool bBaked = (pTexture->m_pFileData != NULL);
+	SAFE_RELEASE(pTexture->m_pStaging);
+	SAFE_RELEASE(pTexture->m_pUpload);
+	SAFE_DELETE_ARRAY(pTexture->m_pFileData);
+
+	{
+		WL::ScopedLock lock(m_Mutex);
+		m_Stats.nUploading--;
+	}
+
+	if (bSucceeded)
+	{
+		double fNow = WL::GetTimeSeconds();
+		double fLatency = (fNow - pTexture->m_fRequestTime) * 1000.0;
+		double fQueueWait = (pTexture->m_fDecodeStartTime - pTexture->m_fRequestTime) * 1000.0;
+
+		pTexture->m_nState = AsyncTexture::STATE_READY;
+		m_Stats.nCompleted++;
+		if (bBaked)
+			m_Stats.nBaked++;
+		m_fTotalLatency += fLatency;
+		m_fTotalQueueWait += fQueueWait;
+		m_Stats.fAvgLatency = float(m_fTotalLatency / m_Stats.nCompleted);
+		m_Stats.fAvgQueueWait = float(m_fTotalQueueWait / m_Stats.nCompleted);
+		if (fLatency > m_Stats.fMaxLatency)
+			m_Stats.fMaxLatency = float(fLatency);
+	}
+	else
+	{
+		pTexture->m_nState = AsyncTexture::STATE_FAILED;
+		ReleaseResident(pTexture);
+		SAFE_RELEASE(pTexture->m_pTexture);
+		m_Stats.nFailed++;
+	}
+
+	// Drop the loader's reference
+	pTexture->Release();
+}
+
+//
+//	Takes the levels a texture uploaded out of the resident size, once they are let go.
+//	The last reference may be dropped on any thread.
+//
+void TextureLoader::ReleaseResident(AsyncTexture* pTexture)
+{
+	WL::ScopedLock lock(m_Mutex);
+	m_Stats.nBytesResident -= pTexture->m_nBytesResident;
+	pTexture->m_nBytesResident = 0;
+}
+
+LPDIRECT3DTEXTURE9 TextureLoader::GetPlaceholder(D3DCOLOR color)
+{
+	for (int i = 0; i < m_nPlaceholders; i++)
+		if (m_aPlaceholderColor[i] == color)
+			return m_apPlaceholder[i];
+
+	if (m_pd3dDevice == NULL || m_nPlaceholders == MAX_PLACEHOLDERS)
+		return NULL;
+
+	LPDIRECT3DTEXTURE9 pTexture = NULL;
+	if (FAILED(m_pd3dDevice->CreateTexture(1, 1, 1, 0, D3DFMT_A8R8G8B8, D3DPOOL_MANAGED, &pTexture, NULL)))
+		return NULL;
+
+	D3DLOCKED_RECT rect;
+	if (SUCCEEDED(pTexture->LockRect(0, &rect, NULL, 0)))
+	{
+		*(DWORD*)rect.pBits = color;
+		pTexture->UnlockRect(0);
+	}
+
+	m_aPlaceholderColor[m_nPlaceholders] = color;
+	m_apPlaceholder[m_nPlaceholders] = pTexture;
+	m_nPlaceholders++;
+
+	return pTexture;
+}
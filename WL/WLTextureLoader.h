@@ -0,0 +1,151 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: WLTextureLoader.h
+//
+// Author: snez
+//
+// Desc: Loads textures in the background. Files are read and decoded on a pool of worker
+//       threads into system memory, and the decoded mip levels are copied into the final
+//       texture a few at a time from the render thread, smallest level first. Until a
+//       texture has arrived, a 1x1 placeholder is handed out instead.
+//
+//       When an up to date baked .dds exists next to the source image, its compressed
+//       blocks are uploaded as they are and nothing is decoded at all.
+//
+//       Decoding goes through D3DX on the worker threads, so the device must be created
+//       with D3DCREATE_MULTITHREADED.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _WLTEXTURELOADER_H_
+#define _WLTEXTURELOADER_H_
+
+#include "dxstdafx.h"
+#include "WLThreadPool.h"
+#include "WLTextureBaker.h"
+
+#define DEFAULT_PLACEHOLDER_COLOR	D3DCOLOR_ARGB(255, 128, 128, 128)
+
+//
+//	A texture that may still be in flight. GetTexture() always returns something that
+//	can be bound to the device: the placeholder until the first mip level is uploaded,
+//	then the real texture with its LOD clamped to the levels that have arrived.
+//
+class AsyncTexture
+{
+public:
+	LPDIRECT3DTEXTURE9 GetTexture() const;
+	inline bool IsReady() const { return m_nState == STATE_READY; }
+	inline bool HasFailed() const { return m_nState == STATE_FAILED; }
+	inline LPCWSTR GetFileName() const { return m_strFileName; }
+
+	long AddRef();
+	long Release();
+
+private:
+	friend class TextureLoader;
+
+	AsyncTexture(LPCWSTR strFileName, D3DCOLOR placeholderColor);
+	~AsyncTexture();
+
+	enum EState { STATE_QUEUED, STATE_DECODING, STATE_UPLOADING, STATE_READY, STATE_FAILED };
+
+	WCHAR					m_strFileName[MAX_PATH];
+	volatile long			m_nRefCount;
+	volatile long			m_nState;
+	D3DCOLOR				m_PlaceholderColor;
+
+	LPDIRECT3DTEXTURE9		m_pTexture;				// Published texture, NULL until a level has arrived
+	LPDIRECT3DTEXTURE9		m_pUpload;				// Destination of the incremental upload
+	LPDIRECT3DTEXTURE9		m_pStaging;				// Decoded mip chain in system memory
+	BYTE*					m_pFileData;			// Contents of a baked file, used instead of m_pStaging
+	WL::DDSImage			m_Baked;
+	HRESULT					m_hrDecode;				// Result of the worker's decode
+	int						m_iNextLevel;			// Next level to upload, counting down to 0
+	UINT					m_nBytesResident;		// Of the levels uploaded, counted in the loader's stats
+
+	double					m_fRequestTime;			// When Load() was called
+	double					m_fDecodeStartTime;		// When a worker picked the request up
+};
+
+class TextureLoader
+{
+public:
+	struct Stats
+	{
+		UINT	nQueued;			// Waiting for a worker
+		UINT	nDecoding;			// Being read and decoded
+		UINT	nUploading;			// Decoded, waiting for or in the middle of the upload
+		UINT	nCompleted;			// Loaded since startup
+		UINT	nFailed;			// Could not be loaded since startup
+		UINT	nBaked;				// Loaded from baked files since startup
+		UINT	nBytesUploaded;		// Bytes copied during the last Update()
+		UINT	nBytesResident;		// Size of all the loaded textures
+		float	fAvgQueueWait;		// Milliseconds between Load() and a worker starting it
+		float	fAvgLatency;		// Milliseconds between Load() and the full mip chain being resident
+		float	fMaxLatency;
+	};
+
+	static TextureLoader& Get();
+
+	//
+	//	Device changes
+	//
+	HRESULT OnCreateDevice(IDirect3DDevice9* pd3dDevice);
+	void OnDestroyDevice();
+
+	//
+	//	Queue a texture for loading. The returned object holds one reference for the caller.
+	//
+	AsyncTexture* Load(LPCWSTR strFileName, D3DCOLOR placeholderColor = DEFAULT_PLACEHOLDER_COLOR);
+
+	//
+	//	Called once per frame from the render thread; uploads decoded levels until the
+	//	per-frame budget is spent.
+	//
+	void Update();
+
+	//
+	//	Block until every queued texture is fully resident
+	//
+	void Flush();
+
+	inline void SetUploadBudget(UINT nBytesPerFrame) { m_nUploadBudget = nBytesPerFrame; }
+	inline const Stats& GetStats() const { return m_Stats; }
+
+	// Returns a 1x1 texture of the given color, created on first use
+	LPDIRECT3DTEXTURE9 GetPlaceholder(D3DCOLOR color);
+
+private:
+	TextureLoader();
+	~TextureLoader();
+
+	static void DecodeJob(void* pContext);
+	void Decode(AsyncTexture* pTexture);
+	static HRESULT ReadWholeFile(LPCWSTR strFileName, BYTE** ppData, UINT* pnSize);
+	HRESULT DecodeBaked(AsyncTexture* pTexture);
+	bool UploadLevel(AsyncTexture* pTexture, UINT* pBytes);
+	void Finish(AsyncTexture* pTexture, bool bSucceeded);
+	void ReleaseResident(AsyncTexture* pTexture);
+	void ProcessDecoded();
+
+	enum { MAX_PLACEHOLDERS = 8 };
+
+	IDirect3DDevice9*				m_pd3dDevice;
+	WL::ThreadPool					m_Pool;
+	WL::Mutex						m_Mutex;				// Guards m_Decoded and the queue counters
+	CGrowableArray<AsyncTexture*>	m_Decoded;				// Filled by the workers
+	CGrowableArray<AsyncTexture*>	m_Uploading;			// Render thread only
+	UINT							m_nUploadBudget;		// Bytes copied per Update()
+	bool							m_bBakedSupported;		// The device can sample DXT1 and DXT5
+
+	LPDIRECT3DTEXTURE9				m_apPlaceholder[MAX_PLACEHOLDERS];
+	D3DCOLOR						m_aPlaceholderColor[MAX_PLACEHOLDERS];
+	int								m_nPlaceholders;
+
+	Stats							m_Stats;
+	double							m_fTotalQueueWait;
+	double							m_fTotalLatency;
+};
+
+#endif // _WLTEXTURELOADER_H_
@@ -0,0 +1,152 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: WLThreadPool.cpp
+//
+// Author: snez
+//
+// Desc: A fixed size pool of worker threads consuming a FIFO queue of jobs.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "WLThreadPool.h"
+
+WL::ThreadPool::ThreadPool()
+{
+	m_nThreads = 0;
+	m_nPending = 0;
+	m_nIdleWaiters = 0;
+	m_bQuit = false;
+}
+
+WL::ThreadPool::~ThreadPool()
+{
+	Stop();
+}
+
+bool WL::ThreadPool::Start(int nThreads)
+{
+	if (m_nThreads > 0)
+		return true;
+
+	if (nThreads <= 0)
+		nThreads = GetProcessorCount() - 1;
+	if (nThreads < 1)
+		nThreads = 1;
+	if (nThreads > MAX_THREADS)
+		nThreads = MAX_THREADS;
+
+	m_bQuit = false;
+	for (int i = 0; i < nThreads; i++)
+	{
+		if (!m_aThreads[i].Start(WorkerEntry, this))
+			break;
+		m_nThreads++;
+	}
+
+	return m_nThreads > 0;
+}
+
+void WL::ThreadPool::Stop()
+{
+	if (m_nThreads == 0)
+		return;
+
+	WaitIdle();
+
+	{
+		ScopedLock lock(m_Mutex);
+		m_bQuit = true;
+	}
+
+	// Wake every worker so it can notice the quit flag
+	m_JobsAvailable.Post(m_nThreads);
+	for (int i = 0; i < m_nThreads; i++)
+		m_aThreads[i].Join();
+
+	m_nThreads = 0;
+}
+
+void WL::ThreadPool::Submit(JobFunction pfnJob, void* pContext)
+{
+	if (pfnJob == NULL)
+		return;
+
+	// Without workers the job simply runs on the calling thread
+	if (m_nThreads == 0)
+	{
+		pfnJob(pContext);
+		return;
+	}
+
+	Job job;
+	job.pfnJob = pfnJob;
+	job.pContext = pContext;
+
+	{
+		ScopedLock lock(m_Mutex);
+		m_Jobs.push_back(job);
+		m_nPending++;
+	}
+
+	m_JobsAvailable.Post();
+}
+
+void WL::ThreadPool::WaitIdle()
+{
+	{
+		ScopedLock lock(m_Mutex);
+		if (m_nPending == 0)
+			return;
+		m_nIdleWaiters++;
+	}
+
+	m_Idle.Wait();
+}
+
+int WL::ThreadPool::GetPendingCount()
+{
+	ScopedLock lock(m_Mutex);
+	return m_nPending;
+}
+
+void WL::ThreadPool::WorkerEntry(void* pContext)
+{
+	((ThreadPool*)pContext)->WorkerLoop();
+}
+
+void WL::ThreadPool::WorkerLoop()
+{
+	for (;;)
+	{
+		m_JobsAvailable.Wait();
+
+		Job job;
+		{
+			ScopedLock lock(m_Mutex);
+			if (m_Jobs.empty())
+			{
+				if (m_bQuit)
+					return;
+				continue;
+			}
+			job = m_Jobs.front();
+			m_Jobs.pop_front();
+		}
+
+		job.pfnJob(job.pContext);
+
+		long nWake = 0;
+		{
+			ScopedLock lock(m_Mutex);
+			m_nPending--;
+			if (m_nPending == 0 && m_nIdleWaiters > 0)
+			{
+				nWake = m_nIdleWaiters;
+				m_nIdleWaiters = 0;
+			}
+		}
+
+		if (nWake > 0)
+			m_Idle.Post(nWake);
+	}
+}
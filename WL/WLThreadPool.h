@@ -0,0 +1,72 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: WLThreadPool.h
+//
+// Author: snez
+//
+// Desc: A fixed size pool of worker threads consuming a FIFO queue of jobs.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __WLThreadPool_H__
+#define __WLThreadPool_H__
+
+#include <deque>
+#include "WLPlatform.h"
+
+namespace WL
+{
+
+	class ThreadPool
+	{
+	public:
+		typedef void (*JobFunction)(void* pContext);
+
+		ThreadPool();
+		~ThreadPool();
+
+		// Spawns the worker threads. A count of 0 uses one thread per processor minus
+		// one, leaving a core for the thread that feeds the GPU.
+		bool Start(int nThreads = 0);
+
+		// Finishes the queued jobs and joins all the workers
+		void Stop();
+
+		// Queue a job, it will run on one of the worker threads
+		void Submit(JobFunction pfnJob, void* pContext);
+
+		// Block until the queue is empty and no job is running
+		void WaitIdle();
+
+		inline int GetThreadCount() const { return m_nThreads; }
+		int GetPendingCount();
+
+	private:
+		ThreadPool(const ThreadPool&);
+		ThreadPool& operator=(const ThreadPool&);
+
+		struct Job
+		{
+			JobFunction	pfnJob;
+			void*		pContext;
+		};
+
+		static void WorkerEntry(void* pContext);
+		void WorkerLoop();
+
+		enum { MAX_THREADS = 32 };
+
+		Thread				m_aThreads[MAX_THREADS];
+		int					m_nThreads;
+		std::deque<Job>		m_Jobs;
+		Mutex				m_Mutex;
+		Semaphore			m_JobsAvailable;
+		Semaphore			m_Idle;
+		int					m_nPending;			// Queued plus running jobs
+		int					m_nIdleWaiters;
+		bool				m_bQuit;
+	};
+
+}
+
+#endif // __WLThreadPool_H__
@@ -1,91 +1,103 @@
-//////////////////////////////////////////////////////////////////////////////////////////////////
-// 
-// File: WLUtility.h
-// 
-// Author: snez
-//
-// Desc: Provides utility functions for simplifying common tasks.
-//          
-//////////////////////////////////////////////////////////////////////////////////////////////////
-
-#ifndef __WLUtility_H__
-#define __WLUtility_H__
-
-#include <d3dx9.h>
-#include <string>
-
-
-
-namespace WL
-{
-
-	//
-	//	Check what is supported by the video adapter
-	//
-	bool CheckDeviceCaps(IDirect3DDevice9* lpDevice);
-
-	//
-	//	Game Loop
-	//
-	void EnterMsgLoop( bool (*ptr_display)(float timeDelta));
-
-	//
-	//	Used to safely release interfaces and reset the handle to null, like ID3DMesh 
-	//
-	template<class T> void Release(T t)
-	{
-		if( t )
-		{
-			t->Release();
-			t = 0;
-		}
-	}
-		
-	//
-	// Delete and then set to NULL to avoid deleting it twice
-	//
-	template<class T> void Delete(T t)
-	{
-		if( t )
-		{
-			delete t;
-			t = 0;
-		}
-	}
-
-	//
-	// Color Constants
-	//	
-
-	const D3DXCOLOR      WHITE( D3DCOLOR_XRGB(255, 255, 255) );
-	const D3DXCOLOR      BLACK( D3DCOLOR_XRGB(  0,   0,   0) );
-	const D3DXCOLOR        RED( D3DCOLOR_XRGB(255,   0,   0) );
-	const D3DXCOLOR      GREEN( D3DCOLOR_XRGB(  0, 255,   0) );
-	const D3DXCOLOR       BLUE( D3DCOLOR_XRGB(  0,   0, 255) );
-	const D3DXCOLOR     YELLOW( D3DCOLOR_XRGB(255, 255,   0) );
-	const D3DXCOLOR       CYAN( D3DCOLOR_XRGB(  0, 255, 255) );
-	const D3DXCOLOR    MAGENTA( D3DCOLOR_XRGB(255,   0, 255) );
-
-	//
-	// Lights
-	//
-
-	D3DLIGHT9 InitDirectionalLight(const float& x, const float& y, const float& z, const D3DXCOLOR& color);
-	D3DLIGHT9 InitPointLight(D3DXVECTOR3* position, D3DXCOLOR* color);
-	D3DLIGHT9 InitSpotLight(D3DXVECTOR3* position, D3DXVECTOR3* direction, D3DXCOLOR* color);
-
-	//
-	// Materials
-	//
-
-	D3DMATERIAL9 InitMtrl(D3DXCOLOR a, D3DXCOLOR d, D3DXCOLOR s, D3DXCOLOR e, float p);
-
-	const D3DMATERIAL9 WHITE_MTRL  = InitMtrl(WHITE, WHITE, WHITE, BLACK, 2.0f);
-	const D3DMATERIAL9 RED_MTRL    = InitMtrl(RED, RED, RED, BLACK, 2.0f);
-	const D3DMATERIAL9 GREEN_MTRL  = InitMtrl(GREEN, GREEN, GREEN, BLACK, 2.0f);
-	const D3DMATERIAL9 BLUE_MTRL   = InitMtrl(BLUE, BLUE, BLUE, BLACK, 2.0f);
-	const D3DMATERIAL9 YELLOW_MTRL = InitMtrl(YELLOW, YELLOW, YELLOW, BLACK, 2.0f);
-
-}
-
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// 
+// File: WLUtility.h
+// 
+// Author: snez
+//
+// Desc: Provides utility functions for simplifying common tasks.
+//          
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __WLUtility_H__
+#define __WLUtility_H__
+
+#include <d3dx9.h>
+#include <string>
+#include "WLCommandBuffer.h"
+
+
+
+namespace WL
+{
+
+	//
+	//	Check what is supported by the video adapter
+	//
+	bool CheckDeviceCaps(IDirect3DDevice9* lpDevice);
+
+	//
+	//	Game Loop
+	//
+	void EnterMsgLoop( bool (*ptr_display)(float timeDelta));
+
+	//
+	//	Used to safely release interfaces and reset the handle to null, like ID3DMesh 
+	//
+	template<class T> void Release(T t)
+	{
+		if( t )
+		{
+			t->Release();
+			t = 0;
+		}
+	}
+		
+	//
+	// Delete and then set to NULL to avoid deleting it twice
+	//
+	template<class T> void Delete(T t)
+	{
+		if( t )
+		{
+			delete t;
+			t = 0;
+		}
+	}
+
+	//
+	// Color Constants
+	//	
+
+	const D3DXCOLOR      WHITE( D3DCOLOR_XRGB(255, 255, 255) );
+	const D3DXCOLOR      BLACK( D3DCOLOR_XRGB(  0,   0,   0) );
+	const D3DXCOLOR        RED( D3DCOLOR_XRGB(255,   0,   0) );
+	const D3DXCOLOR      GREEN( D3DCOLOR_XRGB(  0, 255,   0) );
+	const D3DXCOLOR       BLUE( D3DCOLOR_XRGB(  0,   0, 255) );
+	const D3DXCOLOR     YELLOW( D3DCOLOR_XRGB(255, 255,   0) );
+	const D3DXCOLOR       CYAN( D3DCOLOR_XRGB(  0, 255, 255) );
+	const D3DXCOLOR    MAGENTA( D3DCOLOR_XRGB(255,   0, 255) );
+
+	//
+	// Lights
+	//
+
+	D3DLIGHT9 InitDirectionalLight(const float& x, const float& y, const float& z, const D3DXCOLOR& color);
+	D3DLIGHT9 InitPointLight(D3DXVECTOR3* position, D3DXCOLOR* color);
+	D3DLIGHT9 InitSpotLight(D3DXVECTOR3* position, D3DXVECTOR3* direction, D3DXCOLOR* color);
+
+	//
+	// Materials
+	//
+
+	D3DMATERIAL9 InitMtrl(D3DXCOLOR a, D3DXCOLOR d, D3DXCOLOR s, D3DXCOLOR e, float p);
+
+	const D3DMATERIAL9 WHITE_MTRL  = InitMtrl(WHITE, WHITE, WHITE, BLACK, 2.0f);
+	const D3DMATERIAL9 RED_MTRL    = InitMtrl(RED, RED, RED, BLACK, 2.0f);
+	const D3DMATERIAL9 GREEN_MTRL  = InitMtrl(GREEN, GREEN, GREEN, BLACK, 2.0f);
+	const D3DMATERIAL9 BLUE_MTRL   = InitMtrl(BLUE, BLUE, BLUE, BLACK, 2.0f);
+	const D3DMATERIAL9 YELLOW_MTRL = InitMtrl(YELLOW, YELLOW, YELLOW, BLACK, 2.0f);
+
+	//
+	// Meshes
+	//
+
+	//
+	//	Records the calls pMesh->DrawSubset(iSubset) makes, read from the mesh's attribute
+	//	table. Fails for a mesh without an attribute table or an FVF, which has to be drawn
+	//	with DrawSubset(). The recording holds no references to the mesh's buffers.
+	//
+	HRESULT RecordMeshSubset(CommandBuffer& commands, ID3DXMesh* pMesh, DWORD iSubset);
+
+}
+
 #endif // __WLUtility_H__
\ No newline at end of file
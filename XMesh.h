@@ -1,19 +1,29 @@
-#pragma once
-
-class XMesh
-{
-private:
-
-	LPD3DXMESH              pMesh;			// Our mesh object in sysmem
-	D3DMATERIAL9*           pMaterials;		// Materials for our mesh
-	LPDIRECT3DTEXTURE9*     ppTextures;		// Textures for our mesh
-	DWORD                   dwNumMaterials; // Number of mesh materials
-
-public:
-
-	XMesh();
-	~XMesh();
-	void Render();
-	LPDIRECT3DTEXTURE9 GetTexture(DWORD num);
-	HRESULT LoadFile(LPCWSTR fileName);
-};
+#pragma once
+
+class AsyncTexture;
+class CommandBuffer;
+
+class XMesh
+{
+private:
+
+	LPD3DXMESH              pMesh;			// Our mesh object in sysmem
+	D3DMATERIAL9*           pMaterials;		// Materials for our mesh
+	AsyncTexture**          ppTextures;		// Textures for our mesh, loaded in the background
+	CommandBuffer*          pSubsetCommands;	// The draw of each subset with its material, recorded on load
+	DWORD                   dwNumMaterials; // Number of mesh materials
+	long                    nRefCount;		// Meshes are shared through the asset cache
+
+	~XMesh();
+
+public:
+
+	XMesh();
+	long AddRef();
+	long Release();
+	void Render();
+	void RenderSubset(DWORD num);					// Leaves the texture to the caller
+	inline DWORD GetNumSubsets() const { return dwNumMaterials; }
+	LPDIRECT3DTEXTURE9 GetTexture(DWORD num);
+	HRESULT LoadFile(LPCWSTR fileName);
+};
@@ -1,167 +1,256 @@
-//
-// Glow Effect
-// 
-
-// texture
-texture Tex0;
-
-// transforms
-float4x4 World;
-float4x4 View;
-float4x4 Projection;
-
-// light direction (view space)
-float3 LightDir = normalize(float3(0.0f, 0.0f, 1.0f));
-
-// glow parameters
-float4 GlowColor = float4(0.0f, 0.0f, 0.0f, 1.0f);
-float4 GlowAmbient = float4(0.1f, 0.1f, 0.3f, 1.0f);
-float  GlowThickness = 0.3f;
-float	Bias = 0.2f;
-
-struct VSTEXTURE_OUTPUT
-{
-    float4 Position : POSITION;
-    float4 Diffuse  : COLOR;
-    float2 TexCoord : TEXCOORD0;
-};
-
-// draws unskinned object with one texture and one directional light.
-VSTEXTURE_OUTPUT VSTexture
-    (
-    float4 Position : POSITION, 
-    float3 Normal   : NORMAL,
-    float2 TexCoord : TEXCOORD0
-    )
-{
-    VSTEXTURE_OUTPUT Out = (VSTEXTURE_OUTPUT)0;
-    
-    float3 L = -LightDir;                                   // light direction (view space)
-    float3 P = mul(Position, World);                    // position (view space)
-    P = mul(float4(P, 1), View);                    // position (view space)
-    
-    float3 N = mul(Normal, (float3x3)World); // normal (view space)
-    N = normalize(mul(N, (float3x3)View)); // normal (view space)
-   
-    Out.Position = mul(float4(P, 1), Projection);   // projected position
-    Out.Diffuse  = max(0, dot(N, L));               // diffuse 
-    Out.TexCoord = TexCoord;                        // texture coordinates
-    
-    return Out;    
-}
-
-struct VSGLOW_OUTPUT
-{
-    float4 Position : POSITION;
-    float4 Diffuse  : COLOR;
-};
-
-// draws a transparent hull of the unskinned object.
-VSGLOW_OUTPUT VSGlow
-    (
-    float4 Position : POSITION, 
-    float3 Normal   : NORMAL
-    )
-{
-    VSGLOW_OUTPUT Out = (VSGLOW_OUTPUT)0;
-    float3 L = -LightDir;								// light direction (view space)
-    float3 N = mul(Normal, (float3x3)World);			// normal (view space)
-    N = normalize(mul(N, (float3x3)View));				// normal (view space)
-    float3 P = mul(Position, World);					// displaced position (view space)
-    P = mul(float4(P, 1) , View) + GlowThickness * N;   // displaced position (view space)    
-    float3 A = float3(0, 0, 1);                         // glow axis
-
-    float Power;
-
-    Power  = dot(N, A);
-    Power *= Power;
-    Power -= 0;
-    Power *= Power;     // Power = (1 - (N.A)^2)^2 [ = ((N.A)^2 - 1)^2 ]
-    
-    Out.Position = mul(float4(P, 1), Projection);   // projected position
-    Out.Diffuse  = GlowColor * Power + GlowAmbient * max(0, dot(N, L) + Bias); // modulated glow color + glow ambient
-    
-    return Out;    
-}
-
-
-
-technique TGlowAndTexture
-{
-    pass PTexture
-    {   
-        // single texture/one directional light shader
-        VertexShader = compile vs_1_1 VSTexture();
-        PixelShader  = NULL;
-        
-        // texture
-        Texture[0] = (Tex0);
-
-        // sampler states
-        MinFilter[0] = LINEAR;
-        MagFilter[0] = LINEAR;
-        MipFilter[0] = POINT;
-
-        // set up texture stage states for single texture modulated by diffuse 
-        ColorOp[0]   = MODULATE;
-        ColorArg1[0] = TEXTURE;
-        ColorArg2[0] = CURRENT;
-        AlphaOp[0]   = DISABLE;
-
-        ColorOp[1]   = DISABLE;
-        AlphaOp[1]   = DISABLE;
-        
-    }
-
-    pass PGlow
-    {   
-        // glow shader
-        VertexShader = compile vs_1_1 VSGlow();
-        PixelShader  = NULL;
-        
-        // no texture
-        Texture[0] = NULL;
-
-        // enable alpha blending
-        AlphaBlendEnable = TRUE;
-        SrcBlend         = ONE;
-        DestBlend        = ONE;
-
-        // set up texture stage states to use the diffuse color
-        ColorOp[0]   = SELECTARG2;
-        ColorArg2[0] = DIFFUSE;
-        AlphaOp[0]   = SELECTARG2;
-        AlphaArg2[0] = DIFFUSE;
-
-        ColorOp[1]   = DISABLE;
-        AlphaOp[1]   = DISABLE;
-    }
-}
-
-
-technique TGlowOnly
-{
-    pass PGlow
-    {   
-        // glow shader
-        VertexShader = compile vs_1_1 VSGlow();
-        PixelShader  = NULL;
-        
-        // no texture
-        Texture[0] = NULL;
-
-        // enable alpha blending
-        AlphaBlendEnable = TRUE;
-        SrcBlend         = ONE;
-        DestBlend        = ONE;
-
-        // set up texture stage states to use the diffuse color
-        ColorOp[0]   = SELECTARG2;
-        ColorArg2[0] = DIFFUSE;
-        AlphaOp[0]   = SELECTARG2;
-        AlphaArg2[0] = DIFFUSE;
-
-        ColorOp[1]   = DISABLE;
-        AlphaOp[1]   = DISABLE;
-   }
-}
+//
+// Glow Effect
+// 
+
+// texture
+texture Tex0;
+
+// transforms, the view and projection are set once a frame for every effect
+float4x4 World;
+shared float4x4 View;
+shared float4x4 Projection;
+
+// light direction (view space), also set once a frame
+shared float3 LightDir = normalize(float3(0.0f, 0.0f, 1.0f));
+
+// glow parameters
+float4 GlowColor = float4(0.0f, 0.0f, 0.0f, 1.0f);
+float4 GlowAmbient = float4(0.1f, 0.1f, 0.3f, 1.0f);
+float  GlowThickness = 0.3f;
+float	Bias = 0.2f;
+
+struct VSTEXTURE_OUTPUT
+{
+    float4 Position : POSITION;
+    float4 Diffuse  : COLOR;
+    float2 TexCoord : TEXCOORD0;
+};
+
+// draws unskinned object with one texture and one directional light.
+VSTEXTURE_OUTPUT VSTexture
+    (
+    float4 Position : POSITION, 
+    float3 Normal   : NORMAL,
+    float2 TexCoord : TEXCOORD0
+    )
+{
+    VSTEXTURE_OUTPUT Out = (VSTEXTURE_OUTPUT)0;
+    
+    float3 L = -LightDir;                                   // light direction (view space)
+    float3 P = mul(Position, World);                    // position (view space)
+    P = mul(float4(P, 1), View);                    // position (view space)
+    
+    float3 N = mul(Normal, (float3x3)World); // normal (view space)
+    N = normalize(mul(N, (float3x3)View)); // normal (view space)
+   
+    Out.Position = mul(float4(P, 1), Projection);   // projected position
+    Out.Diffuse  = max(0, dot(N, L));               // diffuse 
+    Out.TexCoord = TexCoord;                        // texture coordinates
+    
+    return Out;    
+}
+
+struct VSGLOW_OUTPUT
+{
+    float4 Position : POSITION;
+    float4 Diffuse  : COLOR;
+};
+
+// draws a transparent hull of the unskinned object.
+VSGLOW_OUTPUT VSGlow
+    (
+    float4 Position : POSITION, 
+    float3 Normal   : NORMAL
+    )
+{
+    VSGLOW_OUTPUT Out = (VSGLOW_OUTPUT)0;
+    float3 L = -LightDir;								// light direction (view space)
+    float3 N = mul(Normal, (float3x3)World);			// normal (view space)
+    N = normalize(mul(N, (float3x3)View));				// normal (view space)
+    float3 P = mul(Position, World);					// displaced position (view space)
+    P = mul(float4(P, 1) , View) + GlowThickness * N;   // displaced position (view space)    
+    float3 A = float3(0, 0, 1);                         // glow axis
+
+    float Power;
+
+    Power  = dot(N, A);
+    Power *= Power;
+    Power -= 0;
+    Power *= Power;     // Power = (1 - (N.A)^2)^2 [ = ((N.A)^2 - 1)^2 ]
+    
+    Out.Position = mul(float4(P, 1), Projection);   // projected position
+    Out.Diffuse  = GlowColor * Power + GlowAmbient * max(0, dot(N, L) + Bias); // modulated glow color + glow ambient
+    
+    return Out;    
+}
+
+struct VSATMOSPHERE_OUTPUT
+{
+    float4 Position : POSITION;
+    float3 ViewPos  : TEXCOORD0;
+    float4 Center   : TEXCOORD1;
+};
+
+// draws the outer hull of the atmosphere once, the pixel shader works out how much
+// air the view ray crosses on its way through it.
+VSATMOSPHERE_OUTPUT VSAtmosphere
+    (
+    float4 Position : POSITION, 
+    float3 Normal   : NORMAL
+    )
+{
+    VSATMOSPHERE_OUTPUT Out = (VSATMOSPHERE_OUTPUT)0;
+    float4x4 WorldView = mul(World, View);
+    float3 C = mul(float4(0, 0, 0, 1), WorldView);      // planet center (view space)
+    float3 P = mul(Position, WorldView);                // surface position (view space)
+    float3 N = normalize(mul(Normal, (float3x3)WorldView)); // normal (view space)
+    float  R = length(P - C);                           // planet radius (view space)
+    P += GlowThickness * N;                             // top of the atmosphere (view space)
+
+    Out.Position = mul(float4(P, 1), Projection);   // projected position
+    Out.ViewPos  = P;
+    Out.Center   = float4(C, R);
+    
+    return Out;    
+}
+
+// the glow of the layered hulls, integrated along the view ray. The layers add up to
+// the air crossed, thickest where the ray grazes the surface and a thin film over the
+// planet itself.
+float4 PSAtmosphere
+    (
+    float3 ViewPos : TEXCOORD0,
+    float4 Center  : TEXCOORD1
+    ) : COLOR
+{
+    float3 D  = normalize(ViewPos);                     // view ray, the eye is at the origin
+    float3 C  = Center.xyz;
+    float  R2 = Center.w * Center.w;                    // planet radius squared
+    float  Ra = Center.w + GlowThickness;               // atmosphere radius
+    float  Ra2 = Ra * Ra;
+
+    float  t  = dot(C, D);                              // closest approach to the center
+    float  b2 = dot(C, C) - t * t;                      // its distance from the center, squared
+    float  ha = sqrt(max(Ra2 - b2, 0));                 // half the chord through the atmosphere
+    float  hp = sqrt(max(R2 - b2, 0));                  // half the chord through the planet
+    bool   bPlanet = b2 < R2;
+
+    // the whole chord beside the planet, down to the surface in front of it,
+    // 1 for the ray grazing the surface
+    float  Path = bPlanet ? ha - hp : 2 * ha;
+    Path /= 2 * sqrt(Ra2 - R2);
+
+    // lit like the hull at the deepest point of the ray
+    float3 N = normalize(D * (bPlanet ? t - hp : t) - C);
+    float3 L = -LightDir;                               // light direction (view space)
+    float3 A = float3(0, 0, 1);                         // glow axis
+
+    float Power;
+
+    Power  = dot(N, A);
+    Power *= Power;
+    Power *= Power;
+
+    return (GlowColor * Power + GlowAmbient * max(0, dot(N, L) + Bias)) * Path;
+}
+
+
+
+technique TGlowAndTexture
+{
+    pass PTexture
+    {   
+        // single texture/one directional light shader
+        VertexShader = compile vs_1_1 VSTexture();
+        PixelShader  = NULL;
+        
+        // texture
+        Texture[0] = (Tex0);
+
+        // sampler states
+        MinFilter[0] = LINEAR;
+        MagFilter[0] = LINEAR;
+        MipFilter[0] = POINT;
+
+        // set up texture stage states for single texture modulated by diffuse 
+        ColorOp[0]   = MODULATE;
+        ColorArg1[0] = TEXTURE;
+        ColorArg2[0] = CURRENT;
+        AlphaOp[0]   = DISABLE;
+
+        ColorOp[1]   = DISABLE;
+        AlphaOp[1]   = DISABLE;
+        
+    }
+
+    pass PGlow
+    {   
+        // glow shader
+        VertexShader = compile vs_1_1 VSGlow();
+        PixelShader  = NULL;
+        
+        // no texture
+        Texture[0] = NULL;
+
+        // enable alpha blending
+        AlphaBlendEnable = TRUE;
+        SrcBlend         = ONE;
+        DestBlend        = ONE;
+
+        // set up texture stage states to use the diffuse color
+        ColorOp[0]   = SELECTARG2;
+        ColorArg2[0] = DIFFUSE;
+        AlphaOp[0]   = SELECTARG2;
+        AlphaArg2[0] = DIFFUSE;
+
+        ColorOp[1]   = DISABLE;
+        AlphaOp[1]   = DISABLE;
+    }
+}
+
+
+technique TGlowOnly
+{
+    pass PGlow
+    {   
+        // glow shader
+        VertexShader = compile vs_1_1 VSGlow();
+        PixelShader  = NULL;
+        
+        // no texture
+        Texture[0] = NULL;
+
+        // enable alpha blending
+        AlphaBlendEnable = TRUE;
+        SrcBlend         = ONE;
+        DestBlend        = ONE;
+
+        // set up texture stage states to use the diffuse color
+        ColorOp[0]   = SELECTARG2;
+        ColorArg2[0] = DIFFUSE;
+        AlphaOp[0]   = SELECTARG2;
+        AlphaArg2[0] = DIFFUSE;
+
+        ColorOp[1]   = DISABLE;
+        AlphaOp[1]   = DISABLE;
+   }
+}
+
+
+technique TAtmosphere
+{
+    pass PAtmosphere
+    {   
+        // single pass atmosphere, drawn after the planet
+        VertexShader = compile vs_2_0 VSAtmosphere();
+        PixelShader  = compile ps_2_0 PSAtmosphere();
+        
+        // no texture
+        Texture[0] = NULL;
+
+        // enable alpha blending
+        AlphaBlendEnable = TRUE;
+        SrcBlend         = ONE;
+        DestBlend        = ONE;
+   }
+}